@@ -249,6 +249,72 @@ typedef struct _Amethyst_SW_VCT_REGISTER
     MSD_U8    regOffset;
 } Amethyst_SW_VCT_REGISTER;
 
+#define AMETHYST_MSD_ADV_VCT_MAX_PORTS    11   /* size of a multi-port VCT session */
+
+/*
+ * typedef: enum  AMETHYST_MSD_ADV_VCT_PORT_STATE
+ *
+ * Description: State of one port in a multi-port advanced VCT session
+ *
+ * Enumerations:
+ *       AMETHYST_MSD_ADV_VCT_PORT_IDLE    - port is not part of the session
+ *       AMETHYST_MSD_ADV_VCT_PORT_RUNNING - test started, waiting for completion
+ *       AMETHYST_MSD_ADV_VCT_PORT_DONE    - test completed, cableStatus is valid
+ *       AMETHYST_MSD_ADV_VCT_PORT_ERROR   - test failed, see status
+ */
+typedef enum
+{
+     AMETHYST_MSD_ADV_VCT_PORT_IDLE,
+     AMETHYST_MSD_ADV_VCT_PORT_RUNNING,
+     AMETHYST_MSD_ADV_VCT_PORT_DONE,
+     AMETHYST_MSD_ADV_VCT_PORT_ERROR
+}  AMETHYST_MSD_ADV_VCT_PORT_STATE;
+
+/*
+ * typedef: struct  AMETHYST_MSD_ADV_VCT_PORT_RESULT
+ *
+ * Description: Per port state and result of a multi-port advanced VCT session.
+ *
+ * Fields:
+ *      state       - port state.
+ *      status      - MSD_OK, or the error that stopped the test on this port.
+ *      cableStatus - the port copper cable status, valid in state DONE.
+ *      hwPort, pageReg, org0, orgPulse, autoNeg, tooShort, pollCount -
+ *                    driver private, PHY settings restored when the test ends.
+ */
+typedef struct
+{
+    AMETHYST_MSD_ADV_VCT_PORT_STATE state;
+    MSD_STATUS                      status;
+    AMETHYST_MSD_ADV_CABLE_STATUS   cableStatus;
+    MSD_U8                          hwPort;
+    MSD_U16                         pageReg;
+    MSD_U16                         org0;
+    MSD_U16                         orgPulse;
+    MSD_BOOL                        autoNeg;
+    MSD_BOOL                        tooShort;
+    MSD_U16                         pollCount;
+}  AMETHYST_MSD_ADV_VCT_PORT_RESULT;
+
+/*
+ * typedef: struct  AMETHYST_MSD_ADV_VCT_SESSION
+ *
+ * Description: Advanced VCT running on a set of ports at the same time.
+ *
+ * Fields:
+ *      mode    - advanced VCT mode used for all ports.
+ *      portVec - ports of the session, bit n for logical port n.
+ *      doneVec - ports whose test has ended, successfully or not.
+ *      port    - per port state and result, indexed by logical port.
+ */
+typedef struct
+{
+    AMETHYST_MSD_ADV_VCT_MODE         mode;
+    MSD_U32                           portVec;
+    MSD_U32                           doneVec;
+    AMETHYST_MSD_ADV_VCT_PORT_RESULT  port[AMETHYST_MSD_ADV_VCT_MAX_PORTS];
+}  AMETHYST_MSD_ADV_VCT_SESSION;
+
 
 /*******************************************************************************
 *  Amethyst_gvctGetAdvCableDiag
@@ -288,6 +354,105 @@ MSD_STATUS  Amethyst_gvctGetAdvCableDiagIntf
 	IN   MSD_ADV_VCT_MODE mode,
 	OUT  MSD_ADV_CABLE_STATUS *cableStatus
 );
+
+/*******************************************************************************
+*  Amethyst_gvctAdvCableDiagStart
+*
+* DESCRIPTION:
+*       This routine starts the advanced virtual cable test on a set of ports
+*       and returns without waiting for the tests to complete. Each port is
+*       prepared the same way as Amethyst_gvctGetAdvCableDiag does.
+*       Completion is collected with Amethyst_gvctAdvCableDiagPoll.
+*
+* INPUTS:
+*       portVec - ports to test, bit n for logical port n.
+*       mode    - advance VCT mode (either First Peak or Maximum Peak)
+*
+* OUTPUTS:
+*       session - session state, passed to Amethyst_gvctAdvCableDiagPoll.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       A port that fails to start is reported in state
+*       AMETHYST_MSD_ADV_VCT_PORT_ERROR, the other ports keep running.
+*
+*******************************************************************************/
+MSD_STATUS  Amethyst_gvctAdvCableDiagStart
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32    portVec,
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
+    OUT AMETHYST_MSD_ADV_VCT_SESSION *session
+);
+
+/*******************************************************************************
+*  Amethyst_gvctAdvCableDiagPoll
+*
+* DESCRIPTION:
+*       This routine checks once all running ports of a session, with one
+*       batched PHY register read for all of them. Ports whose test completed
+*       get their status per MDI pair and have their PHY settings restored.
+*
+* INPUTS:
+*       session - session started by Amethyst_gvctAdvCableDiagStart.
+*
+* OUTPUTS:
+*       session - updated port states and results.
+*       done    - MSD_TRUE once every port of the session has ended.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       A port still running after 4000 polls is failed with MSD_FAIL.
+*       MSD_FAIL from the batched read leaves the session unchanged, the
+*       poll may be retried.
+*
+*******************************************************************************/
+MSD_STATUS  Amethyst_gvctAdvCableDiagPoll
+(
+    IN    MSD_QD_DEV *dev,
+    INOUT AMETHYST_MSD_ADV_VCT_SESSION *session,
+    OUT   MSD_BOOL   *done
+);
+
+/*******************************************************************************
+*  Amethyst_gvctGetAdvCableDiagMulti
+*
+* DESCRIPTION:
+*       This routine performs the advanced virtual cable test on a set of
+*       ports in parallel and waits for all of them to complete.
+*
+* INPUTS:
+*       portVec - ports to test, bit n for logical port n.
+*       mode    - advance VCT mode (either First Peak or Maximum Peak)
+*
+* OUTPUTS:
+*       session - per port state and copper cable status.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       The status of the first failed port is returned, the results of the
+*       other ports are still valid in session.
+*
+*******************************************************************************/
+MSD_STATUS  Amethyst_gvctGetAdvCableDiagMulti
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32    portVec,
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
+    OUT AMETHYST_MSD_ADV_VCT_SESSION *session
+);
 /*******************************************************************************
 *  Amethyst_gvctGetAdvExtendedStatus
 *
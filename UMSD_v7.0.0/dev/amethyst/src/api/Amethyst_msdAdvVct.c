@@ -23,11 +23,14 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <amethyst/include/api/Amethyst_msdRMU.h>
 
 #define AMETHYST_MSD_LOOKUP_TABLE_ENTRY  128  /* 73 */
 
 #define AMETHYST_MSD_ADV_VCT_ACCEPTABLE_SHORT_CABLE  11
 
+#define AMETHYST_MSD_ADV_VCT_POLL_LIMIT  4000
+
 
 
 #define AMETHYST_MSD_ADV_VCT_CALC(_data)        \
@@ -485,57 +488,22 @@ MSD_STATUS Amethyst_runAdvCableTest_1680_check
 }
 
 static 
-MSD_STATUS Amethyst_runAdvCableTest_1680_get
+MSD_STATUS Amethyst_analyzeAdvCableTest_1680
 (    
-    IN  MSD_QD_DEV          *dev,
-    IN  MSD_U8           hwPort,
     IN  AMETHYST_MSD_ADV_VCT_TRANS_CHAN_SEL    crosspair,
     IN  AMETHYST_MSD_ADV_VCT_MOD     advMod,
+    IN  MSD_U16          *crossChannelReg,
     OUT AMETHYST_MSD_ADV_CABLE_STATUS *cableStatus,
     OUT MSD_BOOL         *tooShort
 )
 {
-    MSD_STATUS	retVal;
-    MSD_U16		u16Data;
-    MSD_U16		crossChannelReg[AMETHYST_MSD_MDI_PAIR_NUM];
     int			j;
     MSD_16		dist2fault;
     MSD_BOOL     mode;
     MSD_BOOL     localTooShort[AMETHYST_MSD_MDI_PAIR_NUM];
 
-    Amethyst_SW_VCT_REGISTER regList[AMETHYST_MSD_MDI_PAIR_NUM] = {
-                    {5,16},{5,17},{5,18},{5,19} };
     mode = MSD_TRUE;
 
-    MSD_DBG_INFO(("Amethyst_runAdvCableTest_1680_get Called.\n"));
-
-
-    if ((retVal = Amethyst_msdReadPagedPhyReg(
-                        dev,hwPort,5,AMETHYST_QD_REG_ADV_VCT_CONTROL_5,&u16Data)) != MSD_OK)
-    {
-		MSD_DBG_ERROR(("Reading from paged phy reg AMETHYST_QD_REG_ADV_VCT_CONTROL_5 returned: %s.\n", msdDisplayStatus(retVal)));
-		return retVal;
-    }
-
-    /*MSD_DBG_INFO(("Page 5 of Reg23 after test : %0#x.\n", u16Data));*/
-
-    /*
-     * read the test result for the cross pair against selected MDI Pair
-     */
-    for (j=0; j<AMETHYST_MSD_MDI_PAIR_NUM; j++)
-    {
-      if((retVal = Amethyst_msdReadPagedPhyReg(
-                        dev,hwPort,
-                        regList[j].page,
-                        regList[j].regOffset,
-                        &crossChannelReg[j])) != MSD_OK)
-      {
-		  MSD_DBG_ERROR(("Reading from paged phy reg returned: %s.\n", msdDisplayStatus(retVal)));
-         return retVal;
-      }
-      /*MSD_DBG_INFO(("@@@@@ reg channel %d is %x \n", j, crossChannelReg[j]));*/
-    }
-
     /*
      * analyze the test result for RX Pair
      */
@@ -545,7 +513,6 @@ MSD_STATUS Amethyst_runAdvCableTest_1680_get
       {
         cableStatus->u[j].offset = (crossChannelReg[j]>>8)&0xff;
       }
-	  MSD_DBG_INFO(("Amethyst_runAdvCableTest_1680_get Exit.\n"));
       return MSD_OK;
     }
 
@@ -555,7 +522,6 @@ MSD_STATUS Amethyst_runAdvCableTest_1680_get
       {
         cableStatus->u[j].sampleAmp = (crossChannelReg[j]>>8)&0xff;
       }
-	  MSD_DBG_INFO(("Amethyst_runAdvCableTest_1680_get Exit.\n"));
       return MSD_OK;
     }
 
@@ -587,11 +553,64 @@ MSD_STATUS Amethyst_runAdvCableTest_1680_get
 
     if (j==AMETHYST_MSD_MDI_PAIR_NUM)
           *tooShort = MSD_TRUE;
-  
-	MSD_DBG_INFO(("Amethyst_runAdvCableTest_1680_get Exit.\n"));
+
     return MSD_OK;
 }
 
+static 
+MSD_STATUS Amethyst_runAdvCableTest_1680_get
+(    
+    IN  MSD_QD_DEV          *dev,
+    IN  MSD_U8           hwPort,
+    IN  AMETHYST_MSD_ADV_VCT_TRANS_CHAN_SEL    crosspair,
+    IN  AMETHYST_MSD_ADV_VCT_MOD     advMod,
+    OUT AMETHYST_MSD_ADV_CABLE_STATUS *cableStatus,
+    OUT MSD_BOOL         *tooShort
+)
+{
+    MSD_STATUS	retVal;
+    MSD_U16		u16Data;
+    MSD_U16		crossChannelReg[AMETHYST_MSD_MDI_PAIR_NUM];
+    int			j;
+
+    Amethyst_SW_VCT_REGISTER regList[AMETHYST_MSD_MDI_PAIR_NUM] = {
+                    {5,16},{5,17},{5,18},{5,19} };
+
+    MSD_DBG_INFO(("Amethyst_runAdvCableTest_1680_get Called.\n"));
+
+
+    if ((retVal = Amethyst_msdReadPagedPhyReg(
+                        dev,hwPort,5,AMETHYST_QD_REG_ADV_VCT_CONTROL_5,&u16Data)) != MSD_OK)
+    {
+		MSD_DBG_ERROR(("Reading from paged phy reg AMETHYST_QD_REG_ADV_VCT_CONTROL_5 returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+    }
+
+    /*MSD_DBG_INFO(("Page 5 of Reg23 after test : %0#x.\n", u16Data));*/
+
+    /*
+     * read the test result for the cross pair against selected MDI Pair
+     */
+    for (j=0; j<AMETHYST_MSD_MDI_PAIR_NUM; j++)
+    {
+      if((retVal = Amethyst_msdReadPagedPhyReg(
+                        dev,hwPort,
+                        regList[j].page,
+                        regList[j].regOffset,
+                        &crossChannelReg[j])) != MSD_OK)
+      {
+		  MSD_DBG_ERROR(("Reading from paged phy reg returned: %s.\n", msdDisplayStatus(retVal)));
+         return retVal;
+      }
+      /*MSD_DBG_INFO(("@@@@@ reg channel %d is %x \n", j, crossChannelReg[j]));*/
+    }
+
+    retVal = Amethyst_analyzeAdvCableTest_1680(crosspair, advMod, crossChannelReg, cableStatus, tooShort);
+
+	MSD_DBG_INFO(("Amethyst_runAdvCableTest_1680_get Exit.\n"));
+    return retVal;
+}
+
 static 
 MSD_STATUS  Amethyst_runAdvCableTest_1680
 (    
@@ -639,32 +658,12 @@ MSD_STATUS  Amethyst_runAdvCableTest_1680
 	return MSD_OK;
 }
 
-static 
-MSD_STATUS Amethyst_getAdvCableStatus_1680
-(    
-    IN  MSD_QD_DEV          *dev,
-    IN  MSD_U8           hwPort,
-    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
-    OUT AMETHYST_MSD_ADV_CABLE_STATUS *cableStatus
+static
+MSD_STATUS Amethyst_checkAdvCableMode
+(
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode
 )
 {
-    MSD_STATUS retVal;
-    MSD_U16 orgPulse, u16Data;
-    MSD_BOOL flag, tooShort;
-    AMETHYST_MSD_ADV_VCT_TRANS_CHAN_SEL crosspair;
-
-
-    MSD_DBG_INFO(("Amethyst_getAdvCableStatus_1680 Called.\n"));
-
-    /* flag = (dev->flags & MAD_FLAG_SHORT_CABLE_FIX)?MSD_TRUE:MSD_FALSE; */
-	flag = MSD_TRUE;
-    crosspair = mode.transChanSel;
-	
-	orgPulse = 0;
-
-    /*
-     * Check Adv VCT Mode
-     */
     switch (mode.mode)
     {
         case AMETHYST_MSD_ADV_VCT_FIRST_PEAK:
@@ -677,6 +676,21 @@ MSD_STATUS Amethyst_getAdvCableStatus_1680
                 return MSD_BAD_PARAM;
     }
 
+    return MSD_OK;
+}
+
+/* Program the test mode and sample point distance of a PHY */
+static
+MSD_STATUS Amethyst_setAdvCableMode_1680
+(
+    IN  MSD_QD_DEV          *dev,
+    IN  MSD_U8           hwPort,
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode
+)
+{
+    MSD_STATUS retVal;
+    MSD_U16 u16Data;
+
     if((retVal = Amethyst_msdGetPagedPhyRegField(
                     dev,hwPort,5,AMETHYST_QD_REG_ADV_VCT_CONTROL_5,0,13, &u16Data)) != MSD_OK)
     {
@@ -714,6 +728,46 @@ MSD_STATUS Amethyst_getAdvCableStatus_1680
 		MSD_DBG_ERROR(("Writing paged phy reg AMETHYST_QD_REG_ADV_VCT_SMPL_DIST returned: %s.\n", msdDisplayStatus(retVal)));
       return retVal;
     }
+
+    return MSD_OK;
+}
+
+static 
+MSD_STATUS Amethyst_getAdvCableStatus_1680
+(    
+    IN  MSD_QD_DEV          *dev,
+    IN  MSD_U8           hwPort,
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
+    OUT AMETHYST_MSD_ADV_CABLE_STATUS *cableStatus
+)
+{
+    MSD_STATUS retVal;
+    MSD_U16 orgPulse;
+    MSD_BOOL flag, tooShort;
+    AMETHYST_MSD_ADV_VCT_TRANS_CHAN_SEL crosspair;
+
+
+    MSD_DBG_INFO(("Amethyst_getAdvCableStatus_1680 Called.\n"));
+
+    /* flag = (dev->flags & MAD_FLAG_SHORT_CABLE_FIX)?MSD_TRUE:MSD_FALSE; */
+	flag = MSD_TRUE;
+    crosspair = mode.transChanSel;
+	
+	orgPulse = 0;
+
+    /*
+     * Check Adv VCT Mode
+     */
+    if((retVal = Amethyst_checkAdvCableMode(mode)) != MSD_OK)
+    {
+        return retVal;
+    }
+
+    if((retVal = Amethyst_setAdvCableMode_1680(dev,hwPort,mode)) != MSD_OK)
+    {
+        return retVal;
+    }
+
     if (flag)
     {
         /* save original Pulse Width */
@@ -780,57 +834,23 @@ MSD_STATUS Amethyst_getAdvCableStatus_1680
     return MSD_OK;
 }
 
-/*******************************************************************************
-* gvctGetAdvCableDiag
-*
-* DESCRIPTION:
-*       This routine perform the advanced virtual cable test for the requested
-*       port and returns the the status per MDI pair.
-*
-* INPUTS:
-*       port - logical port number.
-*       mode - advance VCT mode (either First Peak or Maximum Peak)
-*
-* OUTPUTS:
-*       cableStatus - the port copper cable status.
-*
-* RETURNS:
-*       MSD_OK   - on success
-*       MSD_FAIL - on error
-*       MSD_BAD_PARAM - if invalid parameter is given
-*
-* COMMENTS:
-*       None
-*
-*******************************************************************************/
-MSD_STATUS Amethyst_gvctGetAdvCableDiag
+/* Save the page register and disable auto-neg while the link is down */
+static
+MSD_STATUS Amethyst_prepAdvCableTest
 (
     IN  MSD_QD_DEV *dev,
-    IN  MSD_LPORT        port,
-    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
-    OUT AMETHYST_MSD_ADV_CABLE_STATUS *cableStatus
+    IN  MSD_U8     hwPort,
+    OUT MSD_U16    *pageReg,
+    OUT MSD_BOOL   *autoNeg,
+    OUT MSD_U16    *org0
 )
 {
     MSD_STATUS status;
-    MSD_U8 hwPort;
-    MSD_U16 u16Data, org0;
-    MSD_BOOL            autoNeg;
-    MSD_U16            pageReg;
-
-    MSD_DBG_INFO(("Amethyst_gvctGetCableDiag Called.\n"));
-    hwPort = MSD_LPORT_2_PHY(port);
-	if(hwPort == MSD_INVALID_PORT)
-	{
-		MSD_DBG_ERROR(("Bad Port: %d.\n", hwPort));
-        return MSD_BAD_PARAM;
-	}
-
-    msdSemTake(dev->devNum, dev->phyRegsSem,OS_WAIT_FOREVER);
+    MSD_U16 u16Data;
 
-    if((status= Amethyst_msdGetSMIPhyRegField(dev,hwPort,22,0,8,&pageReg)) != MSD_OK)
+    if((status= Amethyst_msdGetSMIPhyRegField(dev,hwPort,22,0,8,pageReg)) != MSD_OK)
     {
 		MSD_DBG_ERROR(("Read Phy Page Register returned: %s.\n", msdDisplayStatus(status)));
-        msdSemGive(dev->devNum, dev->phyRegsSem);
         return status;
     }
     /*
@@ -839,23 +859,21 @@ MSD_STATUS Amethyst_gvctGetAdvCableDiag
     if((status= Amethyst_msdReadPagedPhyReg(dev,hwPort,0,17,&u16Data)) != MSD_OK)
     {
 		MSD_DBG_ERROR(("Check phy link status returned: %s.\n", msdDisplayStatus(status)));
-        msdSemGive(dev->devNum, dev->phyRegsSem);
         return status;
     }
 
-    autoNeg = MSD_FALSE;
-    org0 = 0;
+    *autoNeg = MSD_FALSE;
+    *org0 = 0;
     if (!(u16Data & 0x400))
     {
         /* link is down, so disable auto-neg if enabled */
         if((status= Amethyst_msdReadPagedPhyReg(dev,hwPort,0,0,&u16Data)) != MSD_OK)
         {
 			MSD_DBG_ERROR(("Read the Phy register returned: %s.\n", msdDisplayStatus(status)));
-			msdSemGive(dev->devNum, dev->phyRegsSem);
             return status;
         }
         
-        org0 = u16Data;
+        *org0 = u16Data;
 
         if (u16Data & 0x1000)
         {
@@ -865,35 +883,39 @@ MSD_STATUS Amethyst_gvctGetAdvCableDiag
             if((status= Amethyst_msdWritePagedPhyReg(dev,hwPort,0,0,u16Data)) != MSD_OK)
             {
 				MSD_DBG_ERROR(("Disable the auto-neg returned: %s.\n", msdDisplayStatus(status)));
-				msdSemGive(dev->devNum, dev->phyRegsSem);
                 return status;
             }
 
 			if ((status = Amethyst_msdPhyReset(dev, hwPort, 0, 0xFF)) != MSD_OK)
             {
 				MSD_DBG_ERROR(("Reset the Phy returned: %s.\n", msdDisplayStatus(status)));
-				msdSemGive(dev->devNum, dev->phyRegsSem);
                 return status;
             }
-            autoNeg = MSD_TRUE;        
+            *autoNeg = MSD_TRUE;        
         }
     }
-	
-    /* status = Amethyst_getAdvCableStatus_1116(dev,hwPort,mode,cableStatus); */
-	status = Amethyst_getAdvCableStatus_1680(dev,hwPort,mode,cableStatus);
-	if(status != MSD_OK)
-	{
-		MSD_DBG_ERROR(("Amethyst_getAdvCableStatus_1680 returned: %s.\n", msdDisplayStatus(status)));
-		msdSemGive(dev->devNum, dev->phyRegsSem);
-		return status;
-	}
-	
+
+    return MSD_OK;
+}
+
+/* Restore auto-neg and the page register saved by Amethyst_prepAdvCableTest */
+static
+MSD_STATUS Amethyst_restoreAdvCableTest
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U8     hwPort,
+    IN  MSD_U16    pageReg,
+    IN  MSD_BOOL   autoNeg,
+    IN  MSD_U16    org0
+)
+{
+    MSD_STATUS status;
+
     if (autoNeg)
     {
         if((status= Amethyst_msdPhyReset(dev,hwPort, 0, org0)) != MSD_OK)
         {
 			MSD_DBG_ERROR(("Reset the Phy returned: %s.\n", msdDisplayStatus(status)));
-			msdSemGive(dev->devNum, dev->phyRegsSem);
             return status;
         }
     }
@@ -901,13 +923,571 @@ MSD_STATUS Amethyst_gvctGetAdvCableDiag
 	if ((status = Amethyst_msdSetSMIPhyRegField(dev, hwPort, 22, 0, 8, pageReg)) != MSD_OK)
     {
 		MSD_DBG_ERROR(("Set back Phy Page Register returned: %s.\n", msdDisplayStatus(status)));
-        msdSemGive(dev->devNum, dev->phyRegsSem);
         return status;
     }
 
-	msdSemGive(dev->devNum, dev->phyRegsSem);
-	MSD_DBG_INFO(("Amethyst_gvctGetCableDiag Exit.\n"));
-    return status;    
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* gvctGetAdvCableDiag
+*
+* DESCRIPTION:
+*       This routine perform the advanced virtual cable test for the requested
+*       port and returns the the status per MDI pair.
+*
+* INPUTS:
+*       port - logical port number.
+*       mode - advance VCT mode (either First Peak or Maximum Peak)
+*
+* OUTPUTS:
+*       cableStatus - the port copper cable status.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Amethyst_gvctGetAdvCableDiag
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_LPORT        port,
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
+    OUT AMETHYST_MSD_ADV_CABLE_STATUS *cableStatus
+)
+{
+    MSD_STATUS status;
+    MSD_U8 hwPort;
+    MSD_U16 org0;
+    MSD_BOOL            autoNeg;
+    MSD_U16            pageReg;
+
+    MSD_DBG_INFO(("Amethyst_gvctGetCableDiag Called.\n"));
+    hwPort = MSD_LPORT_2_PHY(port);
+	if(hwPort == MSD_INVALID_PORT)
+	{
+		MSD_DBG_ERROR(("Bad Port: %d.\n", hwPort));
+        return MSD_BAD_PARAM;
+	}
+
+    msdSemTake(dev->devNum, dev->phyRegsSem,OS_WAIT_FOREVER);
+
+    if((status = Amethyst_prepAdvCableTest(dev,hwPort,&pageReg,&autoNeg,&org0)) != MSD_OK)
+    {
+        msdSemGive(dev->devNum, dev->phyRegsSem);
+        return status;
+    }
+	
+    /* status = Amethyst_getAdvCableStatus_1116(dev,hwPort,mode,cableStatus); */
+	status = Amethyst_getAdvCableStatus_1680(dev,hwPort,mode,cableStatus);
+	if(status != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Amethyst_getAdvCableStatus_1680 returned: %s.\n", msdDisplayStatus(status)));
+		msdSemGive(dev->devNum, dev->phyRegsSem);
+		return status;
+	}
+	
+    if((status = Amethyst_restoreAdvCableTest(dev,hwPort,pageReg,autoNeg,org0)) != MSD_OK)
+    {
+        msdSemGive(dev->devNum, dev->phyRegsSem);
+        return status;
+    }
+
+	msdSemGive(dev->devNum, dev->phyRegsSem);
+	MSD_DBG_INFO(("Amethyst_gvctGetCableDiag Exit.\n"));
+    return status;    
+}
+
+/* Append one Global 2 register access to an RMU command list */
+static void Amethyst_vctRmuAdd
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        opCode,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U16       data
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+    regCmd[*nCmd].opCode = opCode;
+    regCmd[*nCmd].devAddr = AMETHYST_GLOBAL2_DEV_ADDR;
+    regCmd[*nCmd].regAddr = regAddr;
+    regCmd[*nCmd].data = data;
+    *nCmd += 1U;
+}
+
+/* Wait until the SMI PHY command is done */
+static void Amethyst_vctRmuAddWait
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+    regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+    regCmd[*nCmd].devAddr = AMETHYST_GLOBAL2_DEV_ADDR;
+    regCmd[*nCmd].regAddr = AMETHYST_QD_REG_SMI_PHY_CMD;
+    regCmd[*nCmd].data = 15;
+    *nCmd += 1U;
+}
+
+/*
+ * Read nReg consecutive page 5 registers from firstReg on each PHY in hwPort.
+ * Over RMU the accesses of as many PHYs as fit go in one frame, over SMI
+ * the page is set once per PHY.
+ */
+static
+MSD_STATUS Amethyst_readAdvVctRegs
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U8     *hwPort,
+    IN  MSD_U32    nPort,
+    IN  MSD_U8     firstReg,
+    IN  MSD_U32    nReg,
+    OUT MSD_U16    *data
+)
+{
+    MSD_STATUS retVal;
+    MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd = &(regCmd[0]);
+    MSD_U32 nCmd, perPort, nFrame, i, j, k;
+    MSD_U16 smiCmd;
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; i < nPort; i++)
+        {
+            if ((retVal = Amethyst_msdSetSMIPhyReg(dev, hwPort[i], 22, 5)) != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Writing Phy Page Register returned: %s.\n", msdDisplayStatus(retVal)));
+                return retVal;
+            }
+            for (j = 0; j < nReg; j++)
+            {
+                if ((retVal = Amethyst_msdGetSMIPhyReg(dev, hwPort[i], (MSD_U8)(firstReg + j), &data[i * nReg + j])) != MSD_OK)
+                {
+                    MSD_DBG_ERROR(("Reading from phy reg returned: %s.\n", msdDisplayStatus(retVal)));
+                    return retVal;
+                }
+            }
+        }
+        return MSD_OK;
+    }
+
+    /* page write: wait, data, command; each read: wait, command, wait, data */
+    perPort = 3U + 4U * nReg;
+    for (i = 0; i < nPort; i += nFrame)
+    {
+        nFrame = MSD_RMU_MAX_REGCMDS / perPort;
+        if (nFrame > nPort - i)
+        {
+            nFrame = nPort - i;
+        }
+
+        nCmd = 0;
+        for (k = i; k < i + nFrame; k++)
+        {
+            smiCmd = (MSD_U16)(MSD_SMI_BUSY | (hwPort[k] << MSD_SMI_DEV_ADDR_BIT) | (MSD_SMI_WRITE << MSD_SMI_OP_BIT) |
+                (22 << MSD_SMI_REG_ADDR_BIT) | (MSD_SMI_CLAUSE22 << MSD_SMI_MODE_BIT));
+            Amethyst_vctRmuAddWait(regCmd, &nCmd);
+            Amethyst_vctRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, AMETHYST_QD_REG_SMI_PHY_DATA, 5);
+            Amethyst_vctRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, AMETHYST_QD_REG_SMI_PHY_CMD, smiCmd);
+            for (j = 0; j < nReg; j++)
+            {
+                smiCmd = (MSD_U16)(MSD_SMI_BUSY | (hwPort[k] << MSD_SMI_DEV_ADDR_BIT) | (MSD_SMI_READ_22 << MSD_SMI_OP_BIT) |
+                    ((firstReg + j) << MSD_SMI_REG_ADDR_BIT) | (MSD_SMI_CLAUSE22 << MSD_SMI_MODE_BIT));
+                Amethyst_vctRmuAddWait(regCmd, &nCmd);
+                Amethyst_vctRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, AMETHYST_QD_REG_SMI_PHY_CMD, smiCmd);
+                Amethyst_vctRmuAddWait(regCmd, &nCmd);
+                Amethyst_vctRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, AMETHYST_QD_REG_SMI_PHY_DATA, 0);
+            }
+        }
+
+        if ((retVal = Amethyst_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd)) != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Amethyst_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+            return retVal;
+        }
+
+        for (k = 0; k < nFrame; k++)
+        {
+            for (j = 0; j < nReg; j++)
+            {
+                data[(i + k) * nReg + j] = (MSD_U16)regCmd[k * perPort + 3U + j * 4U + 3U].data;
+            }
+        }
+    }
+
+    return MSD_OK;
+}
+
+/* Prepare one port, program the test mode and start the test */
+static
+MSD_STATUS Amethyst_startAdvCablePort
+(
+    IN    MSD_QD_DEV *dev,
+    IN    AMETHYST_MSD_ADV_VCT_MODE mode,
+    INOUT AMETHYST_MSD_ADV_VCT_PORT_RESULT *res
+)
+{
+    MSD_STATUS retVal;
+
+    if ((retVal = Amethyst_prepAdvCableTest(dev, res->hwPort, &res->pageReg, &res->autoNeg, &res->org0)) != MSD_OK)
+    {
+        return retVal;
+    }
+
+    /* save original Pulse Width */
+    if ((retVal = Amethyst_msdGetPagedPhyRegField(dev, res->hwPort, 5, 28, 10, 2, &res->orgPulse)) != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Reading paged phy reg to save original Pulse Width returned: %s.\n", msdDisplayStatus(retVal)));
+        (void)Amethyst_restoreAdvCableTest(dev, res->hwPort, res->pageReg, res->autoNeg, res->org0);
+        return retVal;
+    }
+
+    retVal = Amethyst_setAdvCableMode_1680(dev, res->hwPort, mode);
+    /* set the Pulse Width with default value */
+    if ((retVal == MSD_OK) && (res->orgPulse != 0))
+    {
+        retVal = Amethyst_msdSetPagedPhyRegField(dev, res->hwPort, 5, 28, 10, 2, 0);
+    }
+    if (retVal == MSD_OK)
+    {
+        retVal = Amethyst_runAdvCableTest_1680_set(dev, res->hwPort);
+    }
+    if (retVal != MSD_OK)
+    {
+        (void)Amethyst_msdSetPagedPhyRegField(dev, res->hwPort, 5, 28, 10, 2, res->orgPulse);
+        (void)Amethyst_restoreAdvCableTest(dev, res->hwPort, res->pageReg, res->autoNeg, res->org0);
+        return retVal;
+    }
+
+    res->tooShort = MSD_FALSE;
+    res->pollCount = 0;
+    res->state = AMETHYST_MSD_ADV_VCT_PORT_RUNNING;
+    return MSD_OK;
+}
+
+/* Restore the PHY settings of a port whose test has ended */
+static
+MSD_STATUS Amethyst_endAdvCablePort
+(
+    IN    MSD_QD_DEV *dev,
+    INOUT AMETHYST_MSD_ADV_VCT_SESSION *session,
+    IN    MSD_LPORT  port,
+    IN    MSD_STATUS status
+)
+{
+    MSD_STATUS retVal;
+    AMETHYST_MSD_ADV_VCT_PORT_RESULT *res = &session->port[port];
+
+    /* set the Pulse Width back to the original value */
+    retVal = Amethyst_msdSetPagedPhyRegField(dev, res->hwPort, 5, 28, 10, 2, res->orgPulse);
+    if (retVal == MSD_OK)
+    {
+        retVal = Amethyst_restoreAdvCableTest(dev, res->hwPort, res->pageReg, res->autoNeg, res->org0);
+    }
+    if (status == MSD_OK)
+    {
+        status = retVal;
+    }
+
+    res->status = status;
+    res->state = (status == MSD_OK) ? AMETHYST_MSD_ADV_VCT_PORT_DONE : AMETHYST_MSD_ADV_VCT_PORT_ERROR;
+    session->doneVec |= (MSD_U32)1 << port;
+    return status;
+}
+
+/*******************************************************************************
+* Amethyst_gvctAdvCableDiagStart
+*
+* DESCRIPTION:
+*       This routine starts the advanced virtual cable test on a set of ports
+*       and returns without waiting for the tests to complete.
+*
+* INPUTS:
+*       portVec - ports to test, bit n for logical port n.
+*       mode    - advance VCT mode (either First Peak or Maximum Peak)
+*
+* OUTPUTS:
+*       session - session state, passed to Amethyst_gvctAdvCableDiagPoll.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       phyRegsSem is only held inside this call, not until the tests end.
+*
+*******************************************************************************/
+MSD_STATUS Amethyst_gvctAdvCableDiagStart
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32    portVec,
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
+    OUT AMETHYST_MSD_ADV_VCT_SESSION *session
+)
+{
+    MSD_STATUS status;
+    MSD_LPORT port;
+    MSD_U8 hwPort;
+
+    MSD_DBG_INFO(("Amethyst_gvctAdvCableDiagStart Called.\n"));
+
+    if (session == NULL)
+    {
+        MSD_DBG_ERROR(("Input param AMETHYST_MSD_ADV_VCT_SESSION in Amethyst_gvctAdvCableDiagStart is NULL. \n"));
+        return MSD_BAD_PARAM;
+    }
+    if ((status = Amethyst_checkAdvCableMode(mode)) != MSD_OK)
+    {
+        return status;
+    }
+    if ((portVec == 0) || (dev->numOfPorts > AMETHYST_MSD_ADV_VCT_MAX_PORTS) ||
+        ((portVec >> dev->numOfPorts) != 0))
+    {
+        MSD_DBG_ERROR(("Bad portVec: 0x%x.\n", (unsigned int)portVec));
+        return MSD_BAD_PARAM;
+    }
+
+    msdMemSet((void*)session, 0, sizeof(AMETHYST_MSD_ADV_VCT_SESSION));
+    session->mode = mode;
+    session->portVec = portVec;
+    for (port = 0; port < dev->numOfPorts; port++)
+    {
+        if ((portVec & ((MSD_U32)1 << port)) == 0)
+        {
+            continue;
+        }
+        hwPort = MSD_LPORT_2_PHY(port);
+        if (hwPort == MSD_INVALID_PORT)
+        {
+            MSD_DBG_ERROR(("Bad Port: %d.\n", (int)port));
+            return MSD_BAD_PARAM;
+        }
+        session->port[port].hwPort = hwPort;
+    }
+
+    msdSemTake(dev->devNum, dev->phyRegsSem, OS_WAIT_FOREVER);
+
+    for (port = 0; port < dev->numOfPorts; port++)
+    {
+        if ((portVec & ((MSD_U32)1 << port)) == 0)
+        {
+            continue;
+        }
+        if ((status = Amethyst_startAdvCablePort(dev, mode, &session->port[port])) != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Starting advanced VCT on port %d returned: %s.\n", (int)port, msdDisplayStatus(status)));
+            session->port[port].status = status;
+            session->port[port].state = AMETHYST_MSD_ADV_VCT_PORT_ERROR;
+            session->doneVec |= (MSD_U32)1 << port;
+        }
+    }
+
+    msdSemGive(dev->devNum, dev->phyRegsSem);
+
+    MSD_DBG_INFO(("Amethyst_gvctAdvCableDiagStart Exit.\n"));
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* Amethyst_gvctAdvCableDiagPoll
+*
+* DESCRIPTION:
+*       This routine checks once all running ports of a session. The test
+*       control register of every running port is read in one batch, the
+*       pair registers of the completed ports in a second one.
+*
+* INPUTS:
+*       session - session started by Amethyst_gvctAdvCableDiagStart.
+*
+* OUTPUTS:
+*       session - updated port states and results.
+*       done    - MSD_TRUE once every port of the session has ended.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       A too short cable is retested with the minimum pulse width, as
+*       Amethyst_gvctGetAdvCableDiag does, the port keeps running meanwhile.
+*
+*******************************************************************************/
+MSD_STATUS Amethyst_gvctAdvCableDiagPoll
+(
+    IN    MSD_QD_DEV *dev,
+    INOUT AMETHYST_MSD_ADV_VCT_SESSION *session,
+    OUT   MSD_BOOL   *done
+)
+{
+    MSD_STATUS retVal, status;
+    MSD_LPORT lport[AMETHYST_MSD_ADV_VCT_MAX_PORTS];
+    MSD_U8 hwPort[AMETHYST_MSD_ADV_VCT_MAX_PORTS];
+    MSD_U16 ctrlReg[AMETHYST_MSD_ADV_VCT_MAX_PORTS];
+    MSD_U16 pairReg[AMETHYST_MSD_ADV_VCT_MAX_PORTS * AMETHYST_MSD_MDI_PAIR_NUM];
+    MSD_U32 nRun, nEnd, i;
+    MSD_BOOL tooShort;
+    AMETHYST_MSD_ADV_VCT_PORT_RESULT *res;
+
+    MSD_DBG_INFO(("Amethyst_gvctAdvCableDiagPoll Called.\n"));
+
+    if ((session == NULL) || (done == NULL))
+    {
+        MSD_DBG_ERROR(("Input param in Amethyst_gvctAdvCableDiagPoll is NULL. \n"));
+        return MSD_BAD_PARAM;
+    }
+
+    msdSemTake(dev->devNum, dev->phyRegsSem, OS_WAIT_FOREVER);
+
+    nRun = 0;
+    for (i = 0; i < AMETHYST_MSD_ADV_VCT_MAX_PORTS; i++)
+    {
+        if (session->port[i].state == AMETHYST_MSD_ADV_VCT_PORT_RUNNING)
+        {
+            lport[nRun] = (MSD_LPORT)i;
+            hwPort[nRun] = session->port[i].hwPort;
+            nRun++;
+        }
+    }
+
+    if (nRun > 0)
+    {
+        if ((retVal = Amethyst_readAdvVctRegs(dev, hwPort, nRun, AMETHYST_QD_REG_ADV_VCT_CONTROL_5, 1, ctrlReg)) != MSD_OK)
+        {
+            msdSemGive(dev->devNum, dev->phyRegsSem);
+            return retVal;
+        }
+
+        /* keep the ports whose test has completed */
+        nEnd = 0;
+        for (i = 0; i < nRun; i++)
+        {
+            res = &session->port[lport[i]];
+            if ((ctrlReg[i] & 0x8000) == 0)
+            {
+                lport[nEnd] = lport[i];
+                hwPort[nEnd] = hwPort[i];
+                nEnd++;
+            }
+            else if (++res->pollCount >= AMETHYST_MSD_ADV_VCT_POLL_LIMIT)
+            {
+                MSD_DBG_ERROR(("Running advanced VCT on port %d failed, check error.\n", (int)lport[i]));
+                (void)Amethyst_endAdvCablePort(dev, session, lport[i], MSD_FAIL);
+            }
+        }
+
+        if (nEnd > 0)
+        {
+            if ((retVal = Amethyst_readAdvVctRegs(dev, hwPort, nEnd, 16, AMETHYST_MSD_MDI_PAIR_NUM, pairReg)) != MSD_OK)
+            {
+                msdSemGive(dev->devNum, dev->phyRegsSem);
+                return retVal;
+            }
+        }
+
+        for (i = 0; i < nEnd; i++)
+        {
+            res = &session->port[lport[i]];
+            tooShort = res->tooShort;
+            status = Amethyst_analyzeAdvCableTest_1680(session->mode.transChanSel, session->mode.mode,
+                &pairReg[i * AMETHYST_MSD_MDI_PAIR_NUM], &res->cableStatus, &res->tooShort);
+
+            if ((status == MSD_OK) && (tooShort == MSD_FALSE) && (res->tooShort == MSD_TRUE))
+            {
+                /* set the Pulse Width with minimum width and run the Adv VCT again */
+                MSD_DBG_INFO(("Cable on port %d is too short, try again!\n", (int)lport[i]));
+                status = Amethyst_msdSetPagedPhyRegField(dev, res->hwPort, 5, 28, 10, 2, 3);
+                if (status == MSD_OK)
+                {
+                    status = Amethyst_runAdvCableTest_1680_set(dev, res->hwPort);
+                }
+                if (status == MSD_OK)
+                {
+                    res->pollCount = 0;
+                    continue;
+                }
+            }
+
+            (void)Amethyst_endAdvCablePort(dev, session, lport[i], status);
+        }
+    }
+
+    msdSemGive(dev->devNum, dev->phyRegsSem);
+
+    *done = (session->doneVec == session->portVec) ? MSD_TRUE : MSD_FALSE;
+
+    MSD_DBG_INFO(("Amethyst_gvctAdvCableDiagPoll Exit.\n"));
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* Amethyst_gvctGetAdvCableDiagMulti
+*
+* DESCRIPTION:
+*       This routine performs the advanced virtual cable test on a set of
+*       ports in parallel and waits for all of them to complete.
+*
+* INPUTS:
+*       portVec - ports to test, bit n for logical port n.
+*       mode    - advance VCT mode (either First Peak or Maximum Peak)
+*
+* OUTPUTS:
+*       session - per port state and copper cable status.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Amethyst_gvctGetAdvCableDiagMulti
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32    portVec,
+    IN  AMETHYST_MSD_ADV_VCT_MODE mode,
+    OUT AMETHYST_MSD_ADV_VCT_SESSION *session
+)
+{
+    MSD_STATUS retVal;
+    MSD_BOOL done;
+    MSD_U32 i;
+
+    MSD_DBG_INFO(("Amethyst_gvctGetAdvCableDiagMulti Called.\n"));
+
+    if ((retVal = Amethyst_gvctAdvCableDiagStart(dev, portVec, mode, session)) != MSD_OK)
+    {
+        return retVal;
+    }
+
+    do
+    {
+        if ((retVal = Amethyst_gvctAdvCableDiagPoll(dev, session, &done)) != MSD_OK)
+        {
+            return retVal;
+        }
+    } while (done == MSD_FALSE);
+
+    for (i = 0; i < AMETHYST_MSD_ADV_VCT_MAX_PORTS; i++)
+    {
+        if (session->port[i].state == AMETHYST_MSD_ADV_VCT_PORT_ERROR)
+        {
+            return session->port[i].status;
+        }
+    }
+
+    MSD_DBG_INFO(("Amethyst_gvctGetAdvCableDiagMulti Exit.\n"));
+    return MSD_OK;
 }
 
 
@@ -18,6 +18,7 @@
 *******************************************************************************/
 
 #include <amethyst/include/api/Amethyst_msdIMP.h>
+#include <amethyst/include/api/Amethyst_msdRMU.h>
 #include <amethyst/include/api/Amethyst_msdApiInternal.h>
 #include <amethyst/include/driver/Amethyst_msdHwAccess.h>
 #include <amethyst/include/driver/Amethyst_msdDrvSwRegs.h>
@@ -81,6 +82,13 @@ static MSD_STATUS Amethyst_IMP_Download
 	IN	MSD_U32	datasize,
 	IN	MSD_U8	*data
 );
+
+static MSD_STATUS Amethyst_IMP_DownloadRmu
+(
+	IN	MSD_QD_DEV	*dev,
+	IN	MSD_U32	datasize,
+	IN	MSD_U8	*data
+);
 /*******************************************************************************
 * Amethyst_impRun
 *
@@ -453,15 +461,23 @@ static MSD_STATUS Amethyst_IMP_Download
 		return MSD_FAIL;
 	}
 
-	if (datasize > 0)
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		retVal = Amethyst_IMP_DownloadRmu(dev, datasize, data);
+	}
+	else
 	{
 		for (Idx = 0; Idx < datasize; Idx++)
 		{
-			Amethyst_IMP_Write(dev, pointer_WrData, (MSD_U16)data[Idx]);
-			Amethyst_IMP_De_Next(dev);
+			retVal = Amethyst_IMP_Write(dev, pointer_WrData, (MSD_U16)data[Idx]);
+			retVal |= Amethyst_IMP_De_Next(dev);
+			if (retVal != MSD_OK)
+			{
+				break;
+			}
 		}
 	}
-	retVal = Amethyst_IMP_ByPassMode_Set(dev, pointer_MMUBypass, isByPassMode);
+	retVal |= Amethyst_IMP_ByPassMode_Set(dev, pointer_MMUBypass, isByPassMode);
 	if (retVal != MSD_OK)
 	{
 		return MSD_FAIL;
@@ -470,6 +486,49 @@ static MSD_STATUS Amethyst_IMP_Download
 	return MSD_OK;
 }
 
+/* Write and deposit-next pairs, queued into as few RMU frames as possible */
+static MSD_STATUS Amethyst_IMP_DownloadRmu
+(
+	IN	MSD_QD_DEV	*dev,
+	IN	MSD_U32	datasize,
+	IN	MSD_U8	*data
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 Idx, nCmd;
+
+	MSD_U16 pointer_WrData = 0x0c;
+	MSD_U16 pointer = 0x8;
+
+	nCmd = 0;
+	for (Idx = 0; Idx < datasize; Idx++)
+	{
+		regCmd[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+		regCmd[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+		regCmd[nCmd].devAddr = AMETHYST_GLOBAL2_DEV_ADDR;
+		regCmd[nCmd].regAddr = 0x13;
+		regCmd[nCmd].data = 0x8000 | ((0x7F & pointer_WrData) << 8) | data[Idx];
+		regCmd[nCmd + 1] = regCmd[nCmd];
+		regCmd[nCmd + 1].data = 0x8000 | ((0x7F & pointer) << 8) | 0x6;
+		nCmd += 2;
+
+		if ((nCmd + 2 > MSD_RMU_MAX_REGCMDS) || (Idx == datasize - 1))
+		{
+			retVal = Amethyst_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			if (retVal != MSD_OK)
+			{
+				MSD_DBG_ERROR(("Amethyst_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+				return retVal;
+			}
+			nCmd = 0;
+		}
+	}
+
+	return MSD_OK;
+}
+
 
 
 /*******************************************************************************
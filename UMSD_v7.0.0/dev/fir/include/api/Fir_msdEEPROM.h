@@ -157,6 +157,74 @@ MSD_STATUS Fir_EEPROMChipSelGetIntf
 	IN  MSD_QD_DEV *dev,
 	OUT  MSD_U8  *chipSelect
 );
+
+/*******************************************************************************
+* Fir_EEPROMReadBlock
+*
+* DESCRIPTION:
+*       This routine is used to read a range of EEPROM bytes
+*
+*
+* INPUTS:
+*      addr - first EEPROM address
+*      len  - number of bytes to read
+*
+* OUTPUTS:
+*      data - EEPROM Data, len bytes
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Over RMU the reads are sent in multi register frames.
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMReadBlock
+(
+	IN  MSD_QD_DEV *dev,
+	IN  MSD_U16  addr,
+	IN  MSD_U32  len,
+	OUT MSD_U8   *data
+);
+
+/*******************************************************************************
+* Fir_EEPROMWriteBlock
+*
+* DESCRIPTION:
+*       This routine is used to write a range of EEPROM bytes
+*
+*
+* INPUTS:
+*      addr     - first EEPROM address
+*      len      - number of bytes to write
+*      data     - data to be written, len bytes
+*      diffOnly - MSD_TRUE to read the range first and only write the bytes
+*                 that differ from data
+*
+* OUTPUTS:
+*      numWritten - number of bytes actually written, may be NULL
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Over RMU the writes are sent in multi register frames, each write
+*       waits for the EEPROM busy bit before the next one is issued.
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMWriteBlock
+(
+	IN  MSD_QD_DEV *dev,
+	IN  MSD_U16  addr,
+	IN  MSD_U32  len,
+	IN  MSD_U8   *data,
+	IN  MSD_BOOL diffOnly,
+	OUT MSD_U32  *numWritten
+);
 #ifdef __cplusplus
 }
 #endif
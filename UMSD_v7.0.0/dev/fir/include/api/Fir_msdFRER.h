@@ -111,6 +111,86 @@ typedef struct
 
 } FIR_MSD_FRER_BANK1_COUNTER;
 
+#define FIR_FRER_MAX_RCVY		128U
+#define FIR_FRER_MAX_BANK_SCTR	32U
+
+/* Instances firstId to firstId + numIds - 1 of one FRER table, numIds 0 skips the table */
+typedef struct
+{
+	MSD_U8 firstId;
+	MSD_U8 numIds;
+
+} FIR_MSD_FRER_RANGE;
+
+typedef struct
+{
+	FIR_MSD_FRER_RANGE indvRcvy;
+	FIR_MSD_FRER_RANGE seqRcvy;
+	FIR_MSD_FRER_RANGE bank0;
+	FIR_MSD_FRER_RANGE bank1;
+
+} FIR_MSD_FRER_SNAPSHOT_SCOPE;
+
+typedef struct
+{
+	FIR_MSD_FRER_INDVRCVY indvRcvy;
+	MSD_U16 indvRcvyResets;
+
+} FIR_MSD_FRER_INDVRCVY_STATE;
+
+typedef struct
+{
+	FIR_MSD_FRER_SEQRCVY seqRcvy;
+	MSD_U16 seqRcvyResets;
+	MSD_U16 latErrResets;
+
+} FIR_MSD_FRER_SEQRCVY_STATE;
+
+typedef struct
+{
+	FIR_MSD_FRER_BANK0_CONFIG config;
+	FIR_MSD_FRER_BANK0_COUNTER counter;
+
+} FIR_MSD_FRER_BANK0_STATE;
+
+typedef struct
+{
+	FIR_MSD_FRER_BANK1_CONFIG config;
+	FIR_MSD_FRER_BANK1_COUNTER counter;
+
+} FIR_MSD_FRER_BANK1_STATE;
+
+/* Entry i of each table holds instance scope.<table>.firstId + i */
+typedef struct
+{
+	MSD_U64 timeStamp;
+	MSD_BOOL cleared;
+	FIR_MSD_FRER_SNAPSHOT_SCOPE scope;
+	MSD_U32 numViolations;
+	FIR_MSD_FRER_INDVRCVY_STATE indvRcvy[FIR_FRER_MAX_RCVY];
+	FIR_MSD_FRER_SEQRCVY_STATE seqRcvy[FIR_FRER_MAX_RCVY];
+	FIR_MSD_FRER_BANK0_STATE bank0[FIR_FRER_MAX_BANK_SCTR];
+	FIR_MSD_FRER_BANK1_STATE bank1[FIR_FRER_MAX_BANK_SCTR];
+
+} FIR_MSD_FRER_SNAPSHOT;
+
+/* Counter increase of one stream counter between two snapshots */
+typedef struct
+{
+	MSD_U8 bank;
+	MSD_U8 sCtrId;
+	MSD_U8 sCtrPort;
+	MSD_U8 sCtrIndex;
+	MSD_U32 passed;
+	MSD_U32 discarded;
+	MSD_U32 lost;
+	MSD_U32 outOfOrder;
+	MSD_U32 rogue;
+	MSD_U32 lossPpm;
+	MSD_U32 duplicatePpm;
+
+} FIR_MSD_FRER_STREAM_RATE;
+
 MSD_STATUS Fir_gfrerSeqGenFlushAll
 (
 IN  MSD_QD_DEV	*dev
@@ -454,6 +534,23 @@ OUT MSD_FRER_BANK1_CONFIG	*bk1ConfigData,
 OUT MSD_FRER_BANK1_COUNTER	*bk1SCtrData
 );
 
+MSD_STATUS Fir_gfrerSnapshot
+(
+IN  MSD_QD_DEV	*dev,
+IN  FIR_MSD_FRER_SNAPSHOT_SCOPE	*scope,
+IN  MSD_BOOL	clear,
+OUT FIR_MSD_FRER_SNAPSHOT	*snapshot
+);
+
+MSD_STATUS Fir_gfrerSnapshotRates
+(
+IN    MSD_QD_DEV	*dev,
+IN    MSD_BOOL	clear,
+INOUT FIR_MSD_FRER_SNAPSHOT	*snapshot,
+OUT   FIR_MSD_FRER_STREAM_RATE	*rates,
+OUT   MSD_U32	*numRates
+);
+
 
 
 #ifdef __cplusplus
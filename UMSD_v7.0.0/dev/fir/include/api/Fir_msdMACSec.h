@@ -252,6 +252,106 @@ typedef struct _FIR_MSEC_RULE {
 	FIR_MSEC_TCAM_ACTION action;
 }FIR_MSEC_RULE;
 
+typedef enum
+{
+	FIR_MACSEC_TXN_CREATE_RX_SECY = 0,
+	FIR_MACSEC_TXN_CREATE_TX_SECY,
+	FIR_MACSEC_TXN_DELETE_RX_SECY,
+	FIR_MACSEC_TXN_DELETE_TX_SECY,
+	FIR_MACSEC_TXN_CREATE_RX_SC,
+	FIR_MACSEC_TXN_CREATE_TX_SC,
+	FIR_MACSEC_TXN_DELETE_RX_SC,
+	FIR_MACSEC_TXN_DELETE_TX_SC,
+	FIR_MACSEC_TXN_CREATE_RX_SA,
+	FIR_MACSEC_TXN_CREATE_TX_SA,
+	FIR_MACSEC_TXN_DELETE_RX_SA,
+	FIR_MACSEC_TXN_DELETE_TX_SA,
+	/* load SA index and install it in SC scIndex with AN an */
+	FIR_MACSEC_TXN_REKEY_RX_SA,
+	FIR_MACSEC_TXN_REKEY_TX_SA
+}FIR_MACSEC_TXN_OP_TYPE;
+
+typedef struct _FIR_MACSEC_TXN_OP {
+	FIR_MACSEC_TXN_OP_TYPE opType;
+	/* SecY, SC or SA index */
+	MSD_U8 index;
+	/* rekey only */
+	MSD_U8 scIndex;
+	/*2 bits*/
+	MSD_U8 an;
+	union {
+		FIR_SECY_INGRESS rxSecY;
+		FIR_SECY_EGRESS txSecY;
+		FIR_MSEC_RX_SC rxSC;
+		FIR_MSEC_TX_SC txSC;
+		FIR_MSEC_RX_SA rxSA;
+		FIR_MSEC_TX_SA txSA;
+	} data;
+}FIR_MACSEC_TXN_OP;
+
+#define FIR_MSEC_MAX_MIB 16U
+
+/* Counter totals, accumulated over polls */
+typedef struct _FIR_MSEC_TX_SECY_TOTAL {
+	MSD_U64 outOctetsSecYControlledPort;
+	MSD_U64 outOctetsSecYEncrypted;
+	MSD_U64 outOctetsSecYProtected;
+	MSD_U64 outPktsSecYUnicast;
+	MSD_U64 outPktsSecYMulticast;
+	MSD_U64 outPktSecYBroadcast;
+	MSD_U64 outPktsSecYuntagged;
+	MSD_U64 outPktsSecYTooLong;
+	MSD_U64 outPktsSecYNoSAError;
+}FIR_MSEC_TX_SECY_TOTAL;
+
+typedef struct _FIR_MSEC_TX_SC_TOTAL {
+	MSD_U64 outPktsProtected;
+	MSD_U64 outPktsEncrypted;
+}FIR_MSEC_TX_SC_TOTAL;
+
+typedef struct _FIR_MSEC_RX_SECY_TOTAL {
+	MSD_U64 inOctetsSecYControlledPort;
+	MSD_U64 inOctetsSecYValidated;
+	MSD_U64 inOctetsSecYDecrypted;
+	MSD_U64 inPktsSecYUnicast;
+	MSD_U64 inPktsSecYMulticast;
+	MSD_U64 inPktsSecYBroadCast;
+	MSD_U64 inPktsSecYUnTagged;
+	MSD_U64 inPktsSecYNoTag;
+	MSD_U64 inPktsSecYBadTag;
+	MSD_U64 inPktsSecYNoSA;
+	MSD_U64 inPktsSecYNoSAErr;
+}FIR_MSEC_RX_SECY_TOTAL;
+
+typedef struct _FIR_MSEC_RX_SC_TOTAL {
+	MSD_U64 inPktsSCLate;
+	MSD_U64 inPktsSCNotValid;
+	MSD_U64 inPktsSCInvalid;
+	MSD_U64 inPktsSCDelayed;
+	MSD_U64 inPktsSCUnchecked;
+	MSD_U64 inPktsSCOK;
+}FIR_MSEC_RX_SC_TOTAL;
+
+typedef struct _FIR_MSEC_STATS_SNAPSHOT {
+	/* counter indexes to poll, bit n selects counter index n */
+	MSD_U16 txSecYMask;
+	MSD_U16 txSCMask;
+	MSD_U16 rxSecYMask;
+	MSD_U16 rxSCMask;
+	/* host time of the last poll, 0 if dev->getTime is not set */
+	MSD_U64 timeStamp;
+	MSD_U32 numPolls;
+	/* events and Tx SC interrupts of the last poll, bit n is SC n */
+	FIR_MSEC_EVENT event;
+	MSD_U16 txSCAutoRekeyInt;
+	MSD_U16 txSCSAInvalidInt;
+	MSD_U16 txSCPNThrInt;
+	FIR_MSEC_TX_SECY_TOTAL txSecY[FIR_MSEC_MAX_MIB];
+	FIR_MSEC_TX_SC_TOTAL txSC[FIR_MSEC_MAX_MIB];
+	FIR_MSEC_RX_SECY_TOTAL rxSecY[FIR_MSEC_MAX_MIB];
+	FIR_MSEC_RX_SC_TOTAL rxSC[FIR_MSEC_MAX_MIB];
+}FIR_MSEC_STATS_SNAPSHOT;
+
 /*Macsec register R/W*/
 /******************************************************************************
 * DESCRIPTION:
@@ -273,7 +373,7 @@ typedef struct _FIR_MSEC_RULE {
 ******************************************************************************/
 MSD_STATUS Fir_gmacsecRead
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN MSD_U32 regAddr,
 	OUT MSD_U32* data
 );
@@ -297,7 +397,7 @@ MSD_STATUS Fir_gmacsecRead
 ******************************************************************************/
 MSD_STATUS Fir_gmacsecWrite
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN MSD_U32 regAddr,
 	IN MSD_U32 data
 );
@@ -1359,6 +1459,66 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrlIntf
 	OUT MSD_MACSEC_INT_CONTROL_TXSC* txscIntCtrl
 );
 
+/******************************************************************************
+* DESCRIPTION:
+*	This function applies a batch of SecY, SC and SA create, delete and
+*	rekey operations as one transaction. The operations run in order under
+*	one hold of the MACSec register lock, and with RMU the register
+*	accesses of consecutive operations share frames. All operations are
+*	checked before any is applied.
+*
+* INPUTS:
+*	dev  - physical device
+*	ops - operations
+*	numOps - number of operations
+*
+* OUTPUTS:
+*	numDone - number of operations applied
+*
+* RETURNS:
+*	MSD_STATUS
+*
+* NOTES/WARNINGS:
+*	Rekey loads the new SA before the SC takes it, the SA it replaces
+*	stays loaded. A Tx SC switches to the new SA.
+******************************************************************************/
+MSD_STATUS Fir_gmacsecApplyTransaction
+(
+	IN MSD_QD_DEV *dev,
+	IN FIR_MACSEC_TXN_OP* ops,
+	IN MSD_U32 numOps,
+	OUT MSD_U32* numDone
+);
+
+/******************************************************************************
+* DESCRIPTION:
+*	This function polls the selected SecY and SC counters with auto clear
+*	and adds them to the 64 bit totals of the snapshot. The MACSec events
+*	and the pending Tx SC interrupts, PN threshold included, are read and
+*	cleared by the same poll. The register accesses of the whole poll go
+*	out under one hold of the MACSec register lock, and with RMU the
+*	counter reads of one index share the frame of the next capture.
+*
+* INPUTS:
+*	dev  - physical device
+*	snapshot - counter masks, and the totals of previous polls
+*
+* OUTPUTS:
+*	snapshot - totals, events, Tx SC interrupts and time stamp
+*
+* RETURNS:
+*	MSD_STATUS
+*
+* NOTES/WARNINGS:
+*	Zero the snapshot and set the masks before the first poll. The
+*	totals are not changed if the poll fails.
+******************************************************************************/
+MSD_STATUS Fir_gmacsecPollStats
+(
+	IN MSD_QD_DEV *dev,
+	INOUT FIR_MSEC_STATS_SNAPSHOT* snapshot
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -218,6 +218,43 @@ typedef struct
 
 } FIR_MSD_PIRL_DATA;
 
+#define FIR_MSD_PIRL_MAX_RES    8U
+
+/*
+ *  typedef: struct FIR_MSD_PIRL_RES_PROFILE
+ *
+ *  Description: one PIRL resource of a port profile.
+ *
+ *  Fields:
+ *      tgtRate    - target rate, in the units of Fir_gpirlCustomSetup_sr2c for
+ *                   pirlData.customSetup.countMode. 0 writes customSetup as given.
+ *      tgtBstSize - target burst size in bytes, used with tgtRate
+ *      pirlData   - resource data
+ */
+typedef struct
+{
+    MSD_U32             tgtRate;
+    MSD_U32             tgtBstSize;
+    FIR_MSD_PIRL_DATA   pirlData;
+} FIR_MSD_PIRL_RES_PROFILE;
+
+/*
+ *  typedef: struct FIR_MSD_PIRL_PORT_PROFILE
+ *
+ *  Description: PIRL resources of one port.
+ *
+ *  Fields:
+ *      port    - logical port
+ *      resMask - resources of the profile, bit n is resource n
+ *      res     - resource profiles, indexed by resource
+ */
+typedef struct
+{
+    MSD_LPORT                   port;
+    MSD_U8                      resMask;
+    FIR_MSD_PIRL_RES_PROFILE    res[FIR_MSD_PIRL_MAX_RES];
+} FIR_MSD_PIRL_PORT_PROFILE;
+
 /****************************************************************************/
 /* Exported PIRL Functions		 			                                   */
 /****************************************************************************/
@@ -537,6 +574,104 @@ IN  MSD_QD_DEV    *dev,
 IN  MSD_LPORT  irlPort,
 IN  MSD_U32  irlRes
 );
+
+/*******************************************************************************
+* Fir_gpirlProfileApply
+*
+* DESCRIPTION:
+*       This function writes the PIRL resources selected in a list of port
+*       profiles. Resources with a target rate get their bucket parameters
+*       from Fir_gpirlCustomSetup_sr2c, all of them are computed and checked
+*       before anything is written. With RMU the resource registers go out in
+*       multi register frames, several resources per frame.
+*
+* INPUTS:
+*       ports    - port profiles
+*       numPorts - number of port profiles
+*       verify   - MSD_TRUE to read the resources back after writing them
+*
+* OUTPUTS:
+*       ports    - customSetup of the resources with a target rate
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error, or a resource read back differs from its profile
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Nothing is written when a port, a resource or a target rate is bad.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gpirlProfileApply
+(
+    IN    MSD_QD_DEV       *dev,
+    INOUT FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN    MSD_U32          numPorts,
+    IN    MSD_BOOL         verify
+);
+
+/*******************************************************************************
+* Fir_gpirlProfileRead
+*
+* DESCRIPTION:
+*       This function reads the PIRL resources selected in a list of port
+*       profiles. With RMU several resources are read per frame.
+*
+* INPUTS:
+*       ports    - port profiles, port and resMask
+*       numPorts - number of port profiles
+*
+* OUTPUTS:
+*       ports    - pirlData of the selected resources
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       tgtRate and tgtBstSize are not changed.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gpirlProfileRead
+(
+    IN    MSD_QD_DEV       *dev,
+    INOUT FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN    MSD_U32          numPorts
+);
+
+/*******************************************************************************
+* Fir_gpirlProfileVerify
+*
+* DESCRIPTION:
+*       This function reads back the PIRL resources selected in a list of port
+*       profiles and counts the resource registers that differ from them.
+*
+* INPUTS:
+*       ports    - port profiles
+*       numPorts - number of port profiles
+*
+* OUTPUTS:
+*       numMismatches - number of resource registers that differ
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       customSetup is compared as given, run Fir_gpirlProfileApply first for
+*       resources with a target rate.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gpirlProfileVerify
+(
+    IN  MSD_QD_DEV       *dev,
+    IN  const FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN  MSD_U32          numPorts,
+    OUT MSD_U32          *numMismatches
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,6 +55,37 @@ typedef struct
     MSD_BOOL        ptpDepIntEn;
 }FIR_PTP_PORT_INTERRUPT_EN;
 
+/*
+*  typedef: struct FIR_PTP_PORT_CONFIG
+*
+*  Description: PTP port register settings applied by Fir_gptpSetPortConfigs
+*
+*  Fields:
+*      port             - logical port
+*      ptpEn            - PTP logic enable, inverse of <DisPTP>
+*      transSpec        - <TransSpec>, 0 for IEEE 1588, 1 for IEEE 802.1AS
+*      oneStepSync      - <OneStepSync>
+*      oneStepCfg       - OneStep config, 0 for two-step, 3 for one-step
+*      hwAccel          - PTP hardware acceleration enable
+*      intEn            - arrival and departure interrupt enables
+*      meanPathDelay    - mean path delay in ns
+*      igrPathDelayAsym - ingress path delay asymmetry
+*      egrPathDelayAsym - egress path delay asymmetry
+*/
+typedef struct
+{
+    MSD_LPORT    port;
+    MSD_BOOL     ptpEn;
+    MSD_U8       transSpec;
+    MSD_BOOL     oneStepSync;
+    MSD_U8       oneStepCfg;
+    MSD_BOOL     hwAccel;
+    FIR_PTP_PORT_INTERRUPT_EN    intEn;
+    MSD_U16      meanPathDelay;
+    MSD_U16      igrPathDelayAsym;
+    MSD_U16      egrPathDelayAsym;
+} FIR_PTP_PORT_CONFIG;
+
 /*
 * Typedef: enum FIR_PTP_TIME
 *
@@ -115,6 +146,33 @@ typedef struct
     MSD_PTP_INT_STATUS    status;
 } FIR_PTP_TS_STATUS;
 
+/*
+*  typedef: struct FIR_PTP_TS_HARVEST
+*
+*  Description: Time stamp returned by Fir_gptpHarvestTimeStamps
+*
+*  Fields:
+*      port        - logical port of the time stamp
+*      timeType    - time stamp register set, arrival 0/1 or departure 0/1
+*      tsStatus    - time stamp, sequence ID and error status
+*      hostTime    - host time in ns when the time stamp was read, from the BSP
+*                    getTime function, 0 if it is not provided
+*/
+typedef struct
+{
+    MSD_LPORT    port;
+    FIR_PTP_TIME    timeType;
+    FIR_PTP_TS_STATUS    tsStatus;
+    MSD_U64    hostTime;
+} FIR_PTP_TS_HARVEST;
+
+/* timeMask bits of Fir_gptpHarvestTimeStamps */
+#define FIR_PTP_HARVEST_ARR0    ((MSD_U32)1 << FIR_PTP_ARR0_TIME)
+#define FIR_PTP_HARVEST_ARR1    ((MSD_U32)1 << FIR_PTP_ARR1_TIME)
+#define FIR_PTP_HARVEST_DEP     ((MSD_U32)1 << FIR_PTP_DEP_TIME)
+#define FIR_PTP_HARVEST_DEP1    ((MSD_U32)1 << FIR_PTP_DEP1_TIME)
+#define FIR_PTP_HARVEST_ALL     (FIR_PTP_HARVEST_ARR0 | FIR_PTP_HARVEST_ARR1 | FIR_PTP_HARVEST_DEP | FIR_PTP_HARVEST_DEP1)
+
 /*
 *  typedef: struct FIR_PTP_INTERRUPT_STATUS
 *
@@ -166,6 +224,42 @@ typedef struct
     MSD_U32    todCompensation;
 }FIR_PTP_TIME_ARRAY;
 
+/*
+*  typedef: struct FIR_PTP_CROSS_TS_SAMPLE
+*
+*  Description: One switch time read bracketed by two host time reads
+*
+*  Fields:
+*      hostBefore  - host time in ns just before the switch time was latched
+*      switchTime  - ToD in ns when the time array was captured, or the
+*                    32 bit PTP global time counter otherwise
+*      hostAfter   - host time in ns just after the switch time was latched
+*/
+typedef struct
+{
+    MSD_U64    hostBefore;
+    MSD_U64    switchTime;
+    MSD_U64    hostAfter;
+} FIR_PTP_CROSS_TS_SAMPLE;
+
+/*
+*  typedef: struct FIR_PTP_CROSS_TS
+*
+*  Description: Result of Fir_gptpCrossTimeStamp
+*
+*  Fields:
+*      best        - sample with the narrowest host time window
+*      offset      - switch ToD minus the host window midpoint in ns, 0 when
+*                    the PTP global time counter is sampled
+*      uncertainty - half the width of the best host time window in ns
+*/
+typedef struct
+{
+    FIR_PTP_CROSS_TS_SAMPLE    best;
+    MSD_64    offset;
+    MSD_U64    uncertainty;
+} FIR_PTP_CROSS_TS;
+
 /*
 * Typedef: enum FIR_PTP_TOD_STORE_OPERATION
 *
@@ -299,6 +393,22 @@ MSD_STATUS Fir_gptpGetIntStatus
     IN  MSD_QD_DEV* dev,
     OUT FIR_PTP_INTERRUPT_STATUS *ptpIntSt
 );
+
+/*
+* Reads the valid time stamps of the timeMask register sets of the given
+* ports, clearing only the sets returned. Over RMU all sets are read in as few
+* frames as fit, and the sets read are cleared in the next frame.
+*/
+MSD_STATUS Fir_gptpHarvestTimeStamps
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    IN  const MSD_LPORT    *ports,
+    IN  MSD_U32    timeMask,
+    IN  MSD_U32    maxResults,
+    OUT FIR_PTP_TS_HARVEST    *results,
+    OUT MSD_U32    *numResults
+);
 MSD_STATUS Fir_gptpGetIntStatusIntf
 (
     IN  MSD_QD_DEV* dev,
@@ -347,6 +457,40 @@ MSD_STATUS Fir_gptpGetEgrPathDelayAsym
     OUT MSD_U16    *asym
 );
 
+/*
+* Applies the PTP port settings of numPorts ports, writing only the registers
+* that change. Over RMU the registers of up to 10 ports are read in one frame
+* and the changed ones written in as few frames as fit.
+*/
+MSD_STATUS Fir_gptpSetPortConfigs
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    IN  const FIR_PTP_PORT_CONFIG    *portCfg
+);
+
+/*
+* Reads the PTP port settings of numPorts ports, the port field of each
+* entry selects the port.
+*/
+MSD_STATUS Fir_gptpGetPortConfigs
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    INOUT FIR_PTP_PORT_CONFIG    *portCfg
+);
+
+/*
+* Writes the mean path delay of numPorts ports, in one frame over RMU.
+*/
+MSD_STATUS Fir_gptpSetMeanPathDelays
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    IN  const MSD_LPORT    *ports,
+    IN  const MSD_U16    *delays
+);
+
 MSD_STATUS Fir_gptpGetTODBusyBitStatus
 (
     IN  MSD_QD_DEV* dev,
@@ -420,6 +564,23 @@ MSD_STATUS Fir_gtaiGetPTPGlobalTime
     OUT MSD_U32 *ptpTime
 );
 
+/*
+* Brackets nSamples switch time reads with the BSP getTime function and keeps
+* the sample with the narrowest window. With useTodCapture the time array
+* timeArrayIndex is captured so that only the capture write is bracketed,
+* otherwise the PTP global time counter read is. Over RMU the bracketed access
+* is a single frame. samples, if not NULL, receives all nSamples samples.
+*/
+MSD_STATUS Fir_gptpCrossTimeStamp
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    nSamples,
+    IN  MSD_BOOL   useTodCapture,
+    IN  MSD_U8     timeArrayIndex,
+    OUT FIR_PTP_CROSS_TS_SAMPLE    *samples,
+    OUT FIR_PTP_CROSS_TS    *crossTs
+);
+
 MSD_STATUS Fir_gptpPortRegGet
 (
     IN  MSD_QD_DEV  *dev,
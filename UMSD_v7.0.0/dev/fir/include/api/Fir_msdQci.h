@@ -45,6 +45,89 @@ typedef struct
 	MSD_U16 gateAllowedBytes;
 } FIR_MSD_STREAM_GATE_ENTRY;
 
+/* Qci instance counts */
+#define FIR_QCI_MAX_STREAM_FILTERS	16U
+#define FIR_QCI_MAX_STREAM_GATES	16U
+#define FIR_QCI_MAX_GATE_ENTRIES	16U
+#define FIR_QCI_MAX_TIME_GENS		4U
+#define FIR_QCI_MAX_FLOW_METERS		128U
+#define FIR_QCI_NO_ID				0xFFU
+
+/* Qci instances in use, bit n set means instance n is taken */
+typedef struct
+{
+	MSD_U16 streamFilters;
+	MSD_U16 streamGates;
+	MSD_U8  timeGens;
+	MSD_U32 flowMeters[FIR_QCI_MAX_FLOW_METERS / 32U];
+} FIR_MSD_QCI_RESOURCES;
+
+/* Stream gate time generation, as Fir_gqciStreamGateTimeGenSet */
+typedef struct
+{
+	MSD_U32 gateCycleTime;
+	MSD_U64 gateBaseTime;
+} FIR_MSD_QCI_TIME_GEN;
+
+/* One stream: stream filter, optional stream gate and optional flow meter */
+typedef struct
+{
+	MSD_U16 maxSDUSize;
+	MSD_U8  blockEn;
+
+	/* stream gate, numGateEntries 0 means the stream has no gate */
+	MSD_U8  numGateEntries;
+	MSD_U8  timeGen;			/* index into the timeGens of the request */
+	MSD_U8  defGateState;
+	MSD_U8  defGateIPVEn;
+	MSD_U8  defGateIPV;
+	MSD_U8  timeScale;
+	MSD_U8  byteScale;
+	FIR_MSD_STREAM_GATE_ENTRY gateEntries[FIR_QCI_MAX_GATE_ENTRIES];
+
+	/* flow meter, as Fir_gqciFlowMeterAdvConfig */
+	MSD_BOOL meterEn;
+	MSD_U32 tgtRate;
+	MSD_U32 bstSize;
+	MSD_U8  countMode;
+	MSD_U8  coupleFlag;
+	MSD_U8  dropOnYel;
+	MSD_U8  redBlockEn;
+} FIR_MSD_QCI_STREAM;
+
+/* Instances assigned to one stream, FIR_QCI_NO_ID when not used */
+typedef struct
+{
+	MSD_U8  streamFilterId;
+	MSD_U8  streamGateId;
+	MSD_U8  flowMeterId;
+} FIR_MSD_QCI_STREAM_IDS;
+
+/* Qci frame counters of one stream filter */
+typedef struct
+{
+	MSD_U16 matchCtr;			/* stream filter matching frames */
+	MSD_U16 filterCtr;			/* stream filter filtered frames */
+	MSD_U16 gateFiltCtr;		/* stream gate filtered frames */
+	MSD_U16 meterFiltCtr;		/* flow meter filtered frames */
+} FIR_MSD_QCI_COUNTERS;
+
+/* Qci counters of a range of stream filters */
+typedef struct
+{
+	MSD_U64 timeStamp;			/* BSP getTime after the last counter read, 0 without getTime */
+	MSD_U8  firstId;
+	MSD_U8  numIds;
+	FIR_MSD_QCI_COUNTERS counters[FIR_QCI_MAX_STREAM_FILTERS];
+} FIR_MSD_QCI_SNAPSHOT;
+
+/* Counter increase of one stream filter between two snapshots, modulo 2^16 */
+typedef struct
+{
+	MSD_U8  streamFilterId;
+	FIR_MSD_QCI_COUNTERS delta;
+} FIR_MSD_QCI_COUNTER_DELTA;
+
 
 /******************************************************************************
 * Fir_gqciStreamFilterFlushAll
@@ -906,6 +989,124 @@ IN  MSD_U32 bstSize,
 IN  MSD_U8  countMode
 );
 
+/******************************************************************************
+* Fir_gqciStreamsProvision
+*
+* DESCRIPTION:
+*        This routine provisions a list of streams in one call. Each stream
+*        gets a stream filter, a stream gate with its gate control list when
+*        numGateEntries is not 0, and a flow meter when meterEn is set. The
+*        gate time generations of the request are shared by the gated streams.
+*        Instances are taken from the free ones in resources, lowest first,
+*        and all register writes are sent in RMU frames when RMU is in use.
+*
+* INPUTS:
+*        numTimeGens     - number of gate time generations
+*        timeGens        - gate time generations
+*        numStreams      - number of streams
+*        streams         - streams to provision
+*        resources       - instances already in use
+*
+* OUTPUTS:
+*        timeGenIds      - time generation instance of each timeGens entry
+*        resources       - updated with the instances taken
+*        ids             - instances of each stream
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NO_SPACE - if there are not enough free instances, nothing is
+*                       written in this case
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The instances taken must be free (flushed): their registers are
+*        written whole instead of read, modified and written back. Flow meter
+*        tuning and instance allocation are done before any register write.
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciStreamsProvision
+(
+IN    MSD_QD_DEV	*dev,
+IN    MSD_U32	numTimeGens,
+IN    const FIR_MSD_QCI_TIME_GEN	*timeGens,
+OUT   MSD_U8	*timeGenIds,
+IN    MSD_U32	numStreams,
+IN    const FIR_MSD_QCI_STREAM	*streams,
+INOUT FIR_MSD_QCI_RESOURCES	*resources,
+OUT   FIR_MSD_QCI_STREAM_IDS	*ids
+);
+
+/******************************************************************************
+* Fir_gqciCountersSnapshot
+*
+* DESCRIPTION:
+*        This routine reads the matching, filtered, stream gate filtered and
+*        flow meter filtered frames counters of stream filters firstId to
+*        firstId + numIds - 1. With RMU all counters are read in two frames
+*        at most, so the values are close to each other in time.
+*
+* INPUTS:
+*        firstId         - first stream filter instance identifier
+*        numIds          - number of stream filter instances
+*
+* OUTPUTS:
+*        snapshot        - counters and the time they were read
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciCountersSnapshot
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	firstId,
+IN  MSD_U8	numIds,
+OUT FIR_MSD_QCI_SNAPSHOT	*snapshot
+);
+
+/******************************************************************************
+* Fir_gqciCountersDelta
+*
+* DESCRIPTION:
+*        This routine takes a new snapshot of the stream filters of a previous
+*        snapshot and reports the stream filters whose counters changed, with
+*        the increase of each counter.
+*
+* INPUTS:
+*        snapshot        - previous snapshot, from Fir_gqciCountersSnapshot
+*
+* OUTPUTS:
+*        snapshot        - replaced by the new snapshot
+*        deltas          - changed stream filters, room for snapshot->numIds
+*        numDeltas       - number of entries in deltas
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The counters are 16 bits, a counter that advanced by 65536 or more
+*        between the two snapshots is reported short.
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciCountersDelta
+(
+IN    MSD_QD_DEV	*dev,
+INOUT FIR_MSD_QCI_SNAPSHOT	*snapshot,
+OUT   FIR_MSD_QCI_COUNTER_DELTA	*deltas,
+OUT   MSD_U32	*numDeltas
+);
+
 
 #ifdef __cplusplus
 }
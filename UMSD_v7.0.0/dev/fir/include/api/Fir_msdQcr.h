@@ -27,6 +27,71 @@
 extern "C" {
 #endif
 
+#define FIR_ATS_MAX_SCHEDULERS      16U
+#define FIR_SHAPING_MAX_QUEUES      8U
+
+/*
+*  typedef: struct FIR_MSD_ATS_SCHED_PROFILE
+*
+*  Description: configuration of one ATS scheduler instance
+*
+*  Fields:
+*      schedId          - ATS scheduler instance id, 0 - 15
+*      grpId            - ATS scheduler group id, 0 - 15
+*      rateLimit        - committed rate in kbps, 8 - 10000000
+*      cbsLimit         - committed burst size, 24 bits
+*      maxTimeScale     - 0: maxResidenceTime in ns, 1: in us
+*      maxResidenceTime - max residence time, 12 bits
+*      port             - egress port whose bandwidth the rate is charged to
+*                         when the profile is validated
+*/
+typedef struct
+{
+    MSD_U16     schedId;
+    MSD_U16     grpId;
+    MSD_U32     rateLimit;
+    MSD_U32     cbsLimit;
+    MSD_U16     maxTimeScale;
+    MSD_U16     maxResidenceTime;
+    MSD_LPORT   port;
+} FIR_MSD_ATS_SCHED_PROFILE;
+
+/*
+*  typedef: struct FIR_MSD_SHAPING_PORT_PROFILE
+*
+*  Description: ATS queue enables and Qav shapers of one egress port
+*
+*  Fields:
+*      port            - egress port
+*      linkRate        - bandwidth in kbps the Qav and ATS rates of the port may reserve
+*      atsQueueEnables - queues using the ATS transmission selection, one bit per queue
+*      qavQueues       - queues whose Qav shaper is written, one bit per queue
+*      qavRate         - Qav rate in kbps, multiple of 32, 0 disables the shaper
+*      qavHiLimit      - Qav high limit in bytes, 14 bits
+*/
+typedef struct
+{
+    MSD_LPORT   port;
+    MSD_U32     linkRate;
+    MSD_U8      atsQueueEnables;
+    MSD_U8      qavQueues;
+    MSD_U32     qavRate[FIR_SHAPING_MAX_QUEUES];
+    MSD_U16     qavHiLimit[FIR_SHAPING_MAX_QUEUES];
+} FIR_MSD_SHAPING_PORT_PROFILE;
+
+/*
+*  typedef: struct FIR_MSD_SHAPING_PROFILE
+*
+*  Description: ATS schedulers and per port shaping applied in one call
+*/
+typedef struct
+{
+    MSD_U32                             numScheds;
+    const FIR_MSD_ATS_SCHED_PROFILE     *scheds;
+    MSD_U32                             numPorts;
+    const FIR_MSD_SHAPING_PORT_PROFILE  *ports;
+} FIR_MSD_SHAPING_PROFILE;
+
 /*******************************************************************************
 * Fir_gatsFlushOne
 *
@@ -378,6 +443,72 @@ IN  MSD_U16             port,
 IN  MSD_U16             queue,
 OUT MSD_BOOL*           status
 );
+
+/*******************************************************************************
+* Fir_gatsShapingProfileApply
+*
+* DESCRIPTION:
+*       This routine writes the ATS schedulers, the ATS queue enables and the
+*       Qav queue shapers of a shaping profile. The whole profile is checked
+*       first: field ranges, and for each port the sum of its Qav rates and of
+*       the rates of the ATS schedulers charged to it against linkRate. With
+*       RMU the registers are written whole, without read-modify-write, in
+*       multi register frames.
+*
+* INPUTS:
+*       profile - shaping profile
+*       verify  - MSD_TRUE to read the profile back after writing it
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error, or a register read back differs from the profile
+*       MSD_BAD_PARAM - if invalid parameter is given or a port is over booked
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Nothing is written when the profile does not pass the checks.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gatsShapingProfileApply
+(
+IN  MSD_QD_DEV* const   dev,
+IN  const FIR_MSD_SHAPING_PROFILE   *profile,
+IN  MSD_BOOL            verify
+);
+
+/*******************************************************************************
+* Fir_gatsShapingProfileVerify
+*
+* DESCRIPTION:
+*       This routine reads back the ATS schedulers, ATS queue enables and Qav
+*       queue shapers of a shaping profile and counts the values that differ.
+*
+* INPUTS:
+*       profile - shaping profile
+*
+* OUTPUTS:
+*       numMismatches - number of values that differ from the profile
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       ATS rates are compared as the register values Fir_gatsSetRateLimit
+*       would write.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gatsShapingProfileVerify
+(
+IN  MSD_QD_DEV* const   dev,
+IN  const FIR_MSD_SHAPING_PROFILE   *profile,
+OUT MSD_U32             *numMismatches
+);
 #ifdef __cplusplus
 }
 #endif
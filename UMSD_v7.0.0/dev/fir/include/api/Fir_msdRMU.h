@@ -307,6 +307,38 @@ MSD_STATUS Fir_msdRmuTCAMDumpIntf
 	OUT MSD_TCAM_DATA **tcamEntry
 );
 
+/*******************************************************************************
+* Fir_msdRmuTCAMDumpEntry
+*
+* DESCRIPTION:
+*       Dump valid TCAM entries together with their entry numbers.
+*
+* INPUTS:
+*       startAddr - starting address to search the valid tcam entryies
+*
+* OUTPUTS:
+*       startAddr - continue code for the next search, 0 when no more entries
+*		numOfEntry - number of returned valued entries
+*       tcamPointer - array of entry numbers, may be NULL
+*       tcamEntry - array of tcam Entries.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*
+* COMMENTS:
+*       Both arrays must hold MSD_RMU_MAX_TCAMS elements.
+*
+*******************************************************************************/
+MSD_STATUS Fir_msdRmuTCAMDumpEntry
+(
+	IN MSD_QD_DEV *dev,
+	INOUT MSD_U32 *startAddr,
+	OUT MSD_U32 *numOfEntry,
+	OUT MSD_U32 *tcamPointer,
+	OUT FIR_MSD_TCAM_DATA **tcamEntry
+);
+
 /*******************************************************************************
 * msdRmuTCAMWrite
 *
@@ -339,6 +371,34 @@ MSD_STATUS Fir_msdRmuTCAMWriteIntf
 	IN MSD_TCAM_DATA *tcamEntry
 );
 
+/*******************************************************************************
+* Fir_msdRmuTCAMWriteMulti
+*
+* DESCRIPTION:
+*       Load up to MSD_RMU_MAX_TCAMS TCAM entries with a single request.
+*
+* INPUTS:
+*       nEntry - number of entries
+*       entries - entry numbers and data
+*
+* OUTPUTS:
+*       NONE
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error .
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*
+*******************************************************************************/
+MSD_STATUS Fir_msdRmuTCAMWriteMulti
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 nEntry,
+	IN FIR_MSD_TCAM_IGR_IMAGE *entries
+);
+
 /*******************************************************************************
 * msdRmuTCAMRead
 *
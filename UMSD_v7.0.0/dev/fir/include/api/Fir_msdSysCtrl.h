@@ -32,6 +32,41 @@ extern "C" {
 /****************************************************************************/
 #define FIR_MAX_LAG_MASK_NUM    8U
 
+/* Gate control list entries per port, the entry index field of Qbv register 2 is 7 bits */
+#define FIR_QBV_MAX_GCL_ENTRIES    128U
+
+/*
+ *  typedef: struct FIR_QBV_GCL_ENTRY
+ *
+ *  Description: One Qbv gate control list entry.
+ *
+ *  Fields:
+ *      gateStates - bit n set opens the gate of priority queue n
+ *      interval   - window time in PTP clock cycles, 0 holds the entry until the cycle ends
+ */
+typedef struct
+{
+	MSD_U8		gateStates;
+	MSD_U16		interval;
+} FIR_QBV_GCL_ENTRY;
+
+/*
+ *  typedef: struct FIR_QBV_SCHEDULE
+ *
+ *  Description: Qbv gate control list of one port.
+ *
+ *  Fields:
+ *      port       - logical port number
+ *      numEntries - number of entries, 1 ~ FIR_QBV_MAX_GCL_ENTRIES
+ *      entries    - entries in list order, written to table index 0 ~ numEntries-1
+ */
+typedef struct
+{
+	MSD_LPORT					port;
+	MSD_U32						numEntries;
+	const FIR_QBV_GCL_ENTRY		*entries;
+} FIR_QBV_SCHEDULE;
+
 /****************************************************************************/
 /* Exported SysCtrl Functions		 			                                   */
 /****************************************************************************/
@@ -524,6 +559,77 @@ IN MSD_U8        qbvRegAddr,
 OUT MSD_U16      *data
 );
 
+/*******************************************************************************
+* Fir_gsysQbvLoadSchedules
+*
+* DESCRIPTION:
+*       This routine programs the Qbv gate control lists of several ports.
+*       Each entry takes a window time write (Qbv register 3) followed by an
+*       entry write (Qbv register 2). With RMU the writes of all ports are
+*       packed into multi register frames, up to 19 entries per frame.
+*
+* INPUTS:
+*       numSchedules - number of schedules
+*       schedules    - gate control list per port
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       The gate control table has a single set, entries take effect as soon
+*       as they are written. Load the lists before Fir_gsysQbvCommitCycle so
+*       the new lists run from a cycle boundary.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gsysQbvLoadSchedules
+(
+IN MSD_QD_DEV    *dev,
+IN MSD_U32       numSchedules,
+IN const FIR_QBV_SCHEDULE *schedules
+);
+
+/*******************************************************************************
+* Fir_gsysQbvCommitCycle
+*
+* DESCRIPTION:
+*       This routine sets the Qbv cycle time and starts the next cycle at a
+*       boundary of baseTime. The cycle is driven by the TAI trigger generator:
+*       TrigGenAmt is set to cycleTime and TrigGenTime to baseTime, or, when
+*       baseTime is less than one cycle and 1ms ahead of the current PTP global
+*       time, to the first baseTime + N * cycleTime that is. Then the trigger
+*       generator is requested.
+*
+* INPUTS:
+*       cycleTime - cycle time in PTP clock cycles
+*       baseTime  - PTP global time of a cycle boundary
+*
+* OUTPUTS:
+*       startTime - PTP global time at which the new cycle starts
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       With RMU the global time read and the trigger update take two frames.
+*       The TAI global time counter is 32 bits, baseTime must be within half
+*       of its range from the current global time.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gsysQbvCommitCycle
+(
+IN MSD_QD_DEV    *dev,
+IN MSD_U32       cycleTime,
+IN MSD_U32       baseTime,
+OUT MSD_U32      *startTime
+);
+
 /*******************************************************************************
 * Fir_gsysDevIntEnableSet
 *
@@ -279,6 +279,161 @@ typedef struct
 
 	MSD_U8		  tcamCtr;
 } FIR_MSD_TCAM_ENT_ACT;
+
+#define FIR_MAX_EGR_TCAM_ENTRY 64U
+#define FIR_MSD_TCAM_RULE_KEY_SIZE 144U
+
+/*Typedef: enum FIR_MSD_TCAM_RULE_TYPE
+*
+* Description : Header stack matched by a TCAM rule
+*
+* Fields :
+*      FIR_MSD_TCAM_RULE_L2       - DA, SA, VLAN tag and EtherType only
+*      FIR_MSD_TCAM_RULE_IPV4     - L2 followed by an IPv4 header
+*      FIR_MSD_TCAM_RULE_IPV4_TCP - L2, IPv4 and TCP headers
+*      FIR_MSD_TCAM_RULE_IPV4_UDP - L2, IPv4 and UDP headers
+*      FIR_MSD_TCAM_RULE_IPV6     - L2 followed by an IPv6 header
+*      FIR_MSD_TCAM_RULE_IPV6_TCP - L2, IPv6 and TCP headers
+*      FIR_MSD_TCAM_RULE_IPV6_UDP - L2, IPv6 and UDP headers
+*/
+typedef enum
+{
+    FIR_MSD_TCAM_RULE_L2,
+    FIR_MSD_TCAM_RULE_IPV4,
+    FIR_MSD_TCAM_RULE_IPV4_TCP,
+    FIR_MSD_TCAM_RULE_IPV4_UDP,
+    FIR_MSD_TCAM_RULE_IPV6,
+    FIR_MSD_TCAM_RULE_IPV6_TCP,
+    FIR_MSD_TCAM_RULE_IPV6_UDP
+} FIR_MSD_TCAM_RULE_TYPE;
+
+/*Typedef: struct FIR_MSD_TCAM_RULE
+*
+* Description : High level match/action description of a TCAM rule
+*
+* Fields :
+*      priority   - rule precedence, lower value is matched first
+*      ruleType   - header stack to match
+*      vlanTagged - MSD_TRUE if the frame carries a 4 byte tag between SA and
+*                   EtherType, MSD_FALSE if EtherType directly follows SA
+*      key        - data for TCAM entry key
+*      keyMask    - mask for TCAM entry key
+*      pattern    - header data, only the headers selected by ruleType are used
+*      mask       - header mask, only the headers selected by ruleType are used
+*      action     - ingress action, egActPoint is assigned by the compiler
+*                   when egrActionEn is set
+*      egrActionEn - MSD_TRUE to attach egrAction to the rule
+*      egrPortVec  - logical port vector the egress action is loaded for
+*      egrAction   - egress action
+*/
+typedef struct
+{
+    MSD_U16                  priority;
+    FIR_MSD_TCAM_RULE_TYPE   ruleType;
+    MSD_BOOL                 vlanTagged;
+    FIR_MSD_TCAM_ENT_KEY     key;
+    FIR_MSD_TCAM_ENT_KEY     keyMask;
+    MSD_TCAM_ENT_PKT_UNT     pattern;
+    MSD_TCAM_ENT_PKT_UNT     mask;
+    FIR_MSD_TCAM_ENT_ACT     action;
+    MSD_BOOL                 egrActionEn;
+    MSD_U32                  egrPortVec;
+    FIR_MSD_TCAM_EGR_DATA    egrAction;
+} FIR_MSD_TCAM_RULE;
+
+/*Typedef: struct FIR_MSD_TCAM_IGR_IMAGE
+*
+* Description : Ingress TCAM entry image produced by the rule compiler
+*
+* Fields :
+*      tcamPointer - TCAM entry the image is loaded to
+*      tcamData    - TCAM entry data
+*/
+typedef struct
+{
+    MSD_U32                  tcamPointer;
+    FIR_MSD_TCAM_DATA        tcamData;
+} FIR_MSD_TCAM_IGR_IMAGE;
+
+/*Typedef: struct FIR_MSD_TCAM_EGR_IMAGE
+*
+* Description : Egress TCAM entry image produced by the rule compiler
+*
+* Fields :
+*      egActPoint  - egress action pointer (1 ~ 63)
+*      portVec     - logical port vector the entry is loaded for
+*      tcamEgrData - egress TCAM entry data
+*/
+typedef struct
+{
+    MSD_U8                   egActPoint;
+    MSD_U32                  portVec;
+    FIR_MSD_TCAM_EGR_DATA    tcamEgrData;
+} FIR_MSD_TCAM_EGR_IMAGE;
+
+/*Typedef: struct FIR_MSD_TCAM_RULE_IMAGE
+*
+* Description : Output buffers of the rule compiler, owned by the caller
+*
+* Fields :
+*      igrSize  - number of elements in igrImage
+*      igrCount - number of ingress images produced
+*      igrImage - ingress images, primary entries in priority order followed
+*                 by the extension entries they chain to
+*      egrSize  - number of elements in egrImage
+*      egrCount - number of egress images produced
+*      egrImage - egress images
+*/
+typedef struct
+{
+    MSD_U32                  igrSize;
+    MSD_U32                  igrCount;
+    FIR_MSD_TCAM_IGR_IMAGE   *igrImage;
+    MSD_U32                  egrSize;
+    MSD_U32                  egrCount;
+    FIR_MSD_TCAM_EGR_IMAGE   *egrImage;
+} FIR_MSD_TCAM_RULE_IMAGE;
+
+/*Typedef: struct FIR_MSD_TCAM_SHADOW
+*
+* Description : Host copy of the TCAM page registers, owned by the caller
+*               and attached with Fir_gtcamShadowEnable
+*
+* Fields :
+*      igrPage - page 0, 1 and 2 registers of every ingress entry, as
+*                last programmed through this driver
+*      egrPage - page 3 registers of every egress entry, per physical port
+*/
+typedef struct
+{
+    MSD_U16    igrPage[FIR_MAX_IGR_TCAM_ENTRY][3][26];
+    MSD_U16    egrPage[MSD_MAX_SWITCH_PORTS][FIR_MAX_EGR_TCAM_ENTRY][4];
+} FIR_MSD_TCAM_SHADOW;
+
+/* Entries fetched per refill of FIR_MSD_TCAM_ITER, one RMU TCAM dump frame */
+#define FIR_MSD_TCAM_ITER_SIZE 3U
+
+/*Typedef: struct FIR_MSD_TCAM_ITER
+*
+* Description : State of a full ingress TCAM walk, see Fir_gtcamIterInit
+*
+* Fields :
+*      contCode    - where the next refill continues the search
+*      done        - no more entries after the buffered ones
+*      count       - number of buffered entries
+*      index       - next buffered entry to return
+*      tcamPointer - entry numbers of the buffered entries
+*      tcamData    - buffered entries
+*/
+typedef struct
+{
+    MSD_U32              contCode;
+    MSD_BOOL             done;
+    MSD_U32              count;
+    MSD_U32              index;
+    MSD_U32              tcamPointer[FIR_MSD_TCAM_ITER_SIZE];
+    FIR_MSD_TCAM_DATA    tcamData[FIR_MSD_TCAM_ITER_SIZE];
+} FIR_MSD_TCAM_ITER;
 /****************************************************************************/
 /* Exported TCAM Functions		 			                                   */
 /****************************************************************************/
@@ -898,6 +1053,293 @@ MSD_STATUS Fir_gtcamAdvConfigIntf
     IN  MSD_TCAM_ENT_ACT *actionPtr,
     OUT MSD_BOOL *entry2Used
 );
+
+/*******************************************************************************
+* Fir_gtcamRuleCompile
+*
+* DESCRIPTION:
+*       This routine compiles a set of high level match/action rules into TCAM
+*       entry images ready to be loaded. Frame offsets are computed from the
+*       header stack of each rule, a rule is extended into a second or third
+*       chained entry only when it matches beyond the first 48 bytes, and rules
+*       of the same priority with the same action are merged whenever their
+*       keys can be expressed by one ternary entry.
+*
+* INPUTS:
+*       mode      - TCAM key mode the ports are configured with (Fir_gtcamSetMode)
+*       baseEntry - first TCAM entry to place the rules at
+*       numRules  - number of rules
+*       rules     - rule array
+*       image     - igrSize, igrImage, egrSize and egrImage provided by the caller
+*
+* OUTPUTS:
+*       ruleEntry - TCAM entry each rule starts at, may be NULL
+*       image     - igrCount and egrCount images filled in
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_BAD_PARAM - if invalid parameter is given or a rule does not fit
+*                       in the key mode
+*       MSD_NO_SPACE  - if the rules need more TCAM entries or egress action
+*                       pointers than available
+*
+* COMMENTS:
+*       Rules are placed from baseEntry in ascending priority, extension
+*       entries follow the last primary entry. Only rules of equal priority
+*       are merged, so rules whose relative order matters must use distinct
+*       priorities. No hardware access is done.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRuleCompile
+(
+    IN    FIR_MSD_TCAM_MODE mode,
+    IN    MSD_U32 baseEntry,
+    IN    MSD_U32 numRules,
+    IN    const FIR_MSD_TCAM_RULE *rules,
+    OUT   MSD_U32 *ruleEntry,
+    INOUT FIR_MSD_TCAM_RULE_IMAGE *image
+);
+
+/*******************************************************************************
+* Fir_gtcamRuleLoad
+*
+* DESCRIPTION:
+*       This routine loads the TCAM images produced by Fir_gtcamRuleCompile.
+*       Egress entries are loaded first, then ingress entries from the last
+*       one to the first one, so that extension entries and lower priority
+*       entries are in place before the entries chaining to them go live.
+*
+* INPUTS:
+*       image - compiled images
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRuleLoad
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const FIR_MSD_TCAM_RULE_IMAGE *image
+);
+
+/*******************************************************************************
+* Fir_gtcamShadowEnable
+*
+* DESCRIPTION:
+*       This routine attaches a host copy of the TCAM to the device and fills
+*       it from the hardware. While the shadow is attached, entry loads only
+*       write the pages and registers that differ from the last programmed
+*       image, and entry reads and searches are served from the shadow
+*       without accessing the hardware.
+*
+* INPUTS:
+*       shadow - shadow storage, must stay valid until Fir_gtcamShadowDisable
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       TCAM updates done outside of this module, such as by RMU frames or by
+*       another agent, are not seen by the shadow. Use Fir_gtcamShadowVerify
+*       and Fir_gtcamShadowSync to detect and repair them.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowEnable
+(
+    IN  MSD_QD_DEV *dev,
+    IN  FIR_MSD_TCAM_SHADOW *shadow
+);
+
+/*******************************************************************************
+* Fir_gtcamShadowDisable
+*
+* DESCRIPTION:
+*       This routine detaches the TCAM shadow from the device. All following
+*       TCAM operations access the hardware directly.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowDisable
+(
+    IN  MSD_QD_DEV *dev
+);
+
+/*******************************************************************************
+* Fir_gtcamShadowSync
+*
+* DESCRIPTION:
+*       This routine reloads the attached TCAM shadow from the hardware,
+*       ingress entries and the egress entries of every port.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_FEATURE_NOT_ENABLE - if no shadow is attached
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowSync
+(
+    IN  MSD_QD_DEV *dev
+);
+
+/*******************************************************************************
+* Fir_gtcamShadowVerify
+*
+* DESCRIPTION:
+*       This routine compares the attached TCAM shadow with the hardware and
+*       counts the entries that differ. The shadow is not modified.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       mismatch - number of ingress and egress entries that differ
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_FEATURE_NOT_ENABLE - if no shadow is attached
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowVerify
+(
+    IN  MSD_QD_DEV *dev,
+    OUT MSD_U32 *mismatch
+);
+
+/*******************************************************************************
+* Fir_gtcamIterInit
+*
+* DESCRIPTION:
+*       This routine starts a walk over all valid ingress TCAM entries in
+*       ascending entry order.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       iter - walk state
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamIterInit
+(
+    IN  MSD_QD_DEV *dev,
+    OUT FIR_MSD_TCAM_ITER *iter
+);
+
+/*******************************************************************************
+* Fir_gtcamIterNext
+*
+* DESCRIPTION:
+*       This routine returns the next valid ingress TCAM entry of a walk
+*       started by Fir_gtcamIterInit. Entries are fetched FIR_MSD_TCAM_ITER_SIZE
+*       at a time, with one TCAM dump frame when the device is accessed over
+*       RMU, from the shadow when one is attached, or by get next otherwise.
+*
+* INPUTS:
+*       iter - walk state
+*
+* OUTPUTS:
+*       iter        - walk state
+*       tcamPointer - entry number
+*       tcamData    - entry data
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - no more valid entries
+*
+* COMMENTS:
+*       Entries changed during the walk may or may not be returned.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamIterNext
+(
+    IN    MSD_QD_DEV *dev,
+    INOUT FIR_MSD_TCAM_ITER *iter,
+    OUT   MSD_U32 *tcamPointer,
+    OUT   FIR_MSD_TCAM_DATA *tcamData
+);
+
+/*******************************************************************************
+* Fir_gtcamLoadEntries
+*
+* DESCRIPTION:
+*       This routine loads an ordered array of ingress TCAM entries. Over RMU
+*       the entries are sent MSD_RMU_MAX_TCAMS at a time with the multi TCAM
+*       request, and a batch the request fails for is retried one entry per
+*       register frame. Otherwise each entry is loaded as by
+*       Fir_gtcamLoadEntry.
+*
+* INPUTS:
+*       numEntries - number of entries
+*       entries    - entry numbers and data, loaded in array order
+*
+* OUTPUTS:
+*       entryStatus - load status of each entry
+*
+* RETURNS:
+*       MSD_OK  - if all entries are loaded
+*       MSD_FAIL  - if any entry failed, see entryStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       With the TCAM shadow attached, entries equal to the shadow are skipped
+*       and the shadow is updated with the loaded entries.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamLoadEntries
+(
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 numEntries,
+    IN  const FIR_MSD_TCAM_IGR_IMAGE *entries,
+    OUT MSD_STATUS *entryStatus
+);
 #ifdef __cplusplus
 }
 #endif
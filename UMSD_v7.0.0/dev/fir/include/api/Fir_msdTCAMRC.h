@@ -101,6 +101,12 @@ typedef struct {
 
 }  FIR_MSD_TCAM_RC_DATA;
 
+/* Range Check entry number and data, used by the bulk load and read APIs */
+typedef struct {
+	MSD_U32		rcEntryNum;
+	FIR_MSD_TCAM_RC_DATA	rcData;
+}  FIR_MSD_TCAM_RC_ENTRY;
+
 /****************************************************************************/
 /* Exported TCAM Functions		 			                                   */
 /****************************************************************************/
@@ -404,6 +410,107 @@ OUT	MSD_TCAM_RC_DATA  *rcData,
 OUT	MSD_BOOL		  *found
 );
 /*******************************************************************************
+* Fir_gtcamRCLoadEntries
+*
+* DESCRIPTION:
+*       This routine loads an array of TCAM Range Check entries. Over RMU the
+*       register sequences of several entries are sent in one frame, otherwise
+*       each entry is loaded as by Fir_gtcamRCLoadEntry.
+*
+* INPUTS:
+*       numEntries - number of entries
+*       entries    - entry numbers and Range Check data, loaded in array order
+*
+* OUTPUTS:
+*       entryStatus - load status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are loaded
+*       MSD_FAIL    - if any entry failed, see entryStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCLoadEntries
+(
+IN  MSD_QD_DEV  *dev,
+IN  MSD_U32     numEntries,
+IN  const FIR_MSD_TCAM_RC_ENTRY *entries,
+OUT MSD_STATUS  *entryStatus
+);
+/*******************************************************************************
+* Fir_gtcamRCReadEntries
+*
+* DESCRIPTION:
+*       This routine reads an array of TCAM Range Check entries. Over RMU the
+*       register sequences of several entries are sent in one frame, otherwise
+*       each entry is read as by Fir_gtcamRCReadEntry.
+*
+* INPUTS:
+*       numEntries - number of entries
+*       entries    - rcEntryNum of each entry to read
+*
+* OUTPUTS:
+*       entries     - rcData of each entry
+*       entryStatus - read status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are read
+*       MSD_FAIL    - if any entry failed, see entryStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCReadEntries
+(
+IN    MSD_QD_DEV  *dev,
+IN    MSD_U32     numEntries,
+INOUT FIR_MSD_TCAM_RC_ENTRY *entries,
+OUT   MSD_STATUS  *entryStatus
+);
+/*******************************************************************************
+* Fir_gtcamRCGetNextEntries
+*
+* DESCRIPTION:
+*       This routine finds up to maxEntries valid TCAM Range Check entries with
+*       entry numbers higher than rcEntryNum and reads them. Over RMU the read
+*       of each entry found shares its frame with the search for the next one,
+*       so n entries take n + 1 frames.
+*
+* INPUTS:
+*       rcEntryNum - entry to search from, 0xFF to start from the lowest entry
+*       maxEntries - size of the entries array
+*
+* OUTPUTS:
+*       rcEntryNum - last entry found, to continue the search from
+*       entries    - entry numbers and Range Check data found
+*       numEntries - number of entries found
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_NO_SUCH - no higher valid entry
+*       MSD_FAIL    - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Fewer than maxEntries entries returned with MSD_OK do not mean the
+*       search is done; it is done when MSD_NO_SUCH is returned or the last
+*       entry found is 0xFF.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCGetNextEntries
+(
+IN    MSD_QD_DEV  *dev,
+INOUT MSD_U32     *rcEntryNum,
+IN    MSD_U32     maxEntries,
+OUT   FIR_MSD_TCAM_RC_ENTRY *entries,
+OUT   MSD_U32     *numEntries
+);
+/*******************************************************************************
 * Fir_gtcamRCEntryDump
 *
 * DESCRIPTION:
@@ -100,6 +100,12 @@ extern "C" {
 
 	} FIR_MSD_TCAM_RC_COMP_DATA;
 
+	/* Port and Range Check Comparator data, used by the bulk load and read APIs */
+	typedef struct {
+		MSD_LPORT     portNum;
+		FIR_MSD_TCAM_RC_COMP_DATA compData;
+	} FIR_MSD_TCAM_RC_COMP_ENTRY;
+
 /*******************************************************************************
 * Fir_gtcamRCCompFlushAll
 *
@@ -267,6 +273,69 @@ IN  MSD_QD_DEV  *dev,
 IN  MSD_LPORT portNum,
 OUT FIR_MSD_TCAM_RC_COMP_DATA *tcamRCCompData
 );
+/*******************************************************************************
+* Fir_gtcamRCCompLoadPorts
+*
+* DESCRIPTION:
+*       This routine configures the Range Check Comparators of an array of
+*       ports. Over RMU the register sequences of several ports are sent in one
+*       frame, otherwise each port is loaded as by Fir_gtcamRCCompLoad.
+*
+* INPUTS:
+*       numPorts - number of entries
+*       entries  - logical port numbers and Range Check Comparator Data
+*
+* OUTPUTS:
+*       portStatus - load status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are loaded
+*       MSD_FAIL    - if any entry failed, see portStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCCompLoadPorts
+(
+IN  MSD_QD_DEV  *dev,
+IN  MSD_U32     numPorts,
+IN  const FIR_MSD_TCAM_RC_COMP_ENTRY *entries,
+OUT MSD_STATUS  *portStatus
+);
+/*******************************************************************************
+* Fir_gtcamRCCompReadPorts
+*
+* DESCRIPTION:
+*       This routine reads the Range Check Comparators of an array of ports.
+*       Over RMU the register sequences of several ports are sent in one frame,
+*       otherwise each port is read as by Fir_gtcamRCCompRead.
+*
+* INPUTS:
+*       numPorts - number of entries
+*       entries  - portNum of each entry to read
+*
+* OUTPUTS:
+*       entries    - compData of each entry
+*       portStatus - read status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are read
+*       MSD_FAIL    - if any entry failed, see portStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCCompReadPorts
+(
+IN    MSD_QD_DEV  *dev,
+IN    MSD_U32     numPorts,
+INOUT FIR_MSD_TCAM_RC_COMP_ENTRY *entries,
+OUT   MSD_STATUS  *portStatus
+);
 #ifdef __cplusplus
 }
 #endif
@@ -279,6 +279,74 @@ extern "C" {
 		OUT MSD_U16* data
 	);
 
+	/*****************************************************************************
+	* msdGetSMIC45PhyRegBlock
+	*
+	* DESCRIPTION:
+	*       This function indirectly reads consecutive Clause 45 registers through
+	*       SMI PHY command, with one address cycle and post read increment reads.
+	*
+	* INPUTS:
+	*       devAddr - The device address.
+	*       phyAddr - The PHY address.
+	*       regAddr - The first register address to read.
+	*       count   - The number of registers to read.
+	*
+	* OUTPUTS:
+	*       data    - The storage of count registers.
+	*
+	* RETURNS:
+	*       MSD_OK   - on success
+	*       MSD_FAIL - on error
+	*
+	* COMMENTS:
+	*       None.
+	*
+	*******************************************************************************/
+	MSD_STATUS Fir_msdGetSMIC45PhyRegBlock
+	(
+		IN  MSD_QD_DEV* dev,
+		IN  MSD_U8     devAddr,
+		IN  MSD_U8     phyAddr,
+		IN  MSD_U16    regAddr,
+		IN  MSD_U32    count,
+		OUT MSD_U16* data
+	);
+
+	/*****************************************************************************
+	* msdGetSMIPhyXMDIORegBlock
+	*
+	* DESCRIPTION:
+	*       This function reads consecutive internal PHY XMDIO registers through
+	*       the MMD access registers, with the MMD address set once.
+	*
+	* INPUTS:
+	*       portNum - The PHY address.
+	*       devAddr - The Clause45 device address.
+	*       regAddr - The first register address to read.
+	*       count   - The number of registers to read.
+	*
+	* OUTPUTS:
+	*       data    - The storage of count registers.
+	*
+	* RETURNS:
+	*       MSD_OK   - on success
+	*       MSD_FAIL - on error
+	*
+	* COMMENTS:
+	*       None.
+	*
+	*******************************************************************************/
+	MSD_STATUS Fir_msdGetSMIPhyXMDIORegBlock
+	(
+		IN  MSD_QD_DEV* dev,
+		IN  MSD_U8     portNum,
+		IN  MSD_U8     devAddr,
+		IN  MSD_U16    regAddr,
+		IN  MSD_U32    count,
+		OUT MSD_U16* data
+	);
+
 	MSD_STATUS Fir_msdPhyReset
 	(
 		IN  MSD_QD_DEV* dev,
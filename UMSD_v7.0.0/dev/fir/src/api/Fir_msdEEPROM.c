@@ -22,6 +22,10 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
+
+/* bytes compared per read when only the differing bytes are written */
+#define FIR_EEPROM_CMP_CHUNK	240U
 
 /****************************************************************************/
 /* internal IMP related function declaration.                                    */
@@ -52,6 +56,35 @@ static MSD_STATUS Fir_EEPROM_Chip_Select_Get
 IN  MSD_QD_DEV *dev,
 OUT MSD_U8  *chipSelect
 );
+static void Fir_EEPROM_RmuAdd
+(
+IN    MSD_RegCmd*   regCmd,
+INOUT MSD_U32*      nCmd,
+IN    MSD_U8        opCode,
+IN    MSD_U8        regAddr,
+IN    MSD_U16       data
+);
+static void Fir_EEPROM_RmuAddWait
+(
+IN    MSD_RegCmd*   regCmd,
+INOUT MSD_U32*      nCmd
+);
+static MSD_STATUS Fir_EEPROM_Read_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	addr,
+IN	MSD_U32	len,
+OUT	MSD_U8	*data
+);
+static MSD_STATUS Fir_EEPROM_Write_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	addr,
+IN	MSD_U32	len,
+IN	MSD_U8	*data,
+IN	MSD_U8	*orgData,
+OUT	MSD_U32	*numWritten
+);
 /*******************************************************************************
 * Fir_EEPROMWrite
 *
@@ -234,6 +267,143 @@ OUT  MSD_U8  *chipSelect
 	return retVal;
 }
 
+/*******************************************************************************
+* Fir_EEPROMReadBlock
+*
+* DESCRIPTION:
+*       This routine is used to read a range of EEPROM bytes
+*
+*
+* INPUTS:
+*      addr - first EEPROM address
+*      len  - number of bytes to read
+*
+* OUTPUTS:
+*      data - EEPROM Data, len bytes
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMReadBlock
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U16  addr,
+IN  MSD_U32  len,
+OUT MSD_U8   *data
+)
+{
+	MSD_STATUS retVal;
+	MSD_DBG_INFO(("Fir_EEPROMReadBlock Called.\n"));
+
+	if ((data == NULL) || ((MSD_U32)addr + len > (MSD_U32)0x10000))
+	{
+		MSD_DBG_ERROR(("Bad EEPROM range addr 0x%x len %d.\n", addr, (int)len));
+		return MSD_BAD_PARAM;
+	}
+
+	msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	retVal = Fir_EEPROM_Read_Block(dev, addr, len, data);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_EEPROMReadBlock returned: %d.\n", msdDisplayStatus(retVal)));
+	}
+
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+	MSD_DBG_INFO(("Fir_EEPROMReadBlock Exit.\n"));
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_EEPROMWriteBlock
+*
+* DESCRIPTION:
+*       This routine is used to write a range of EEPROM bytes
+*
+*
+* INPUTS:
+*      addr     - first EEPROM address
+*      len      - number of bytes to write
+*      data     - data to be written, len bytes
+*      diffOnly - MSD_TRUE to only write the bytes that differ from data
+*
+* OUTPUTS:
+*      numWritten - number of bytes actually written, may be NULL
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_EEPROMWriteBlock
+(
+IN  MSD_QD_DEV *dev,
+IN  MSD_U16  addr,
+IN  MSD_U32  len,
+IN  MSD_U8   *data,
+IN  MSD_BOOL diffOnly,
+OUT MSD_U32  *numWritten
+)
+{
+	MSD_STATUS retVal;
+	MSD_U8 orgData[FIR_EEPROM_CMP_CHUNK];
+	MSD_U32 i, n, written, total;
+	MSD_DBG_INFO(("Fir_EEPROMWriteBlock Called.\n"));
+
+	if ((data == NULL) || ((MSD_U32)addr + len > (MSD_U32)0x10000))
+	{
+		MSD_DBG_ERROR(("Bad EEPROM range addr 0x%x len %d.\n", addr, (int)len));
+		return MSD_BAD_PARAM;
+	}
+
+	msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	retVal = MSD_OK;
+	total = 0;
+	if (diffOnly == MSD_TRUE)
+	{
+		/* compare and write one chunk at a time */
+		for (i = 0; (i < len) && (retVal == MSD_OK); i += n)
+		{
+			n = (len - i > FIR_EEPROM_CMP_CHUNK) ? FIR_EEPROM_CMP_CHUNK : (len - i);
+			retVal = Fir_EEPROM_Read_Block(dev, (MSD_U16)(addr + i), n, orgData);
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_EEPROM_Write_Block(dev, (MSD_U16)(addr + i), n, data + i, orgData, &written);
+				total += written;
+			}
+		}
+	}
+	else
+	{
+		retVal = Fir_EEPROM_Write_Block(dev, addr, len, data, NULL, &total);
+	}
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_EEPROMWriteBlock returned: %d.\n", msdDisplayStatus(retVal)));
+	}
+
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+
+	if (numWritten != NULL)
+	{
+		*numWritten = total;
+	}
+
+	MSD_DBG_INFO(("Fir_EEPROMWriteBlock Exit.\n"));
+	return retVal;
+}
+
 /****************************************************************************/
 /* Internal functions.                                                  */
 /****************************************************************************/
@@ -414,4 +584,173 @@ OUT MSD_U8  *chipSelect
 	}
 
 	return retVal;
-}
\ No newline at end of file
+}
+
+static void Fir_EEPROM_RmuAdd
+(
+IN    MSD_RegCmd*   regCmd,
+INOUT MSD_U32*      nCmd,
+IN    MSD_U8        opCode,
+IN    MSD_U8        regAddr,
+IN    MSD_U16       data
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
+
+/* Wait until the EEPROM busy bit self clears */
+static void Fir_EEPROM_RmuAddWait
+(
+IN    MSD_RegCmd*   regCmd,
+INOUT MSD_U32*      nCmd
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = (MSD_U8)0x14;
+	regCmd[*nCmd].data = (MSD_U16)15;
+	*nCmd += 1U;
+}
+
+/*
+* Each byte is wait, address, read command, wait, read data; as many bytes
+* as fit in one RMU frame are read together.
+*/
+static MSD_STATUS Fir_EEPROM_Read_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	addr,
+IN	MSD_U32	len,
+OUT	MSD_U8	*data
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 i, k, nCmd, nByte;
+	MSD_U16 tmpData;
+
+	if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; i < len; i++)
+		{
+			retVal = Fir_EEPROM_Read(dev, (MSD_U16)(addr + i), &tmpData);
+			if (retVal != MSD_OK)
+			{
+				return retVal;
+			}
+			data[i] = (MSD_U8)tmpData;
+		}
+		return MSD_OK;
+	}
+
+	for (i = 0; i < len; i += nByte)
+	{
+		nByte = MSD_RMU_MAX_REGCMDS / 5U;
+		if (nByte > len - i)
+		{
+			nByte = len - i;
+		}
+
+		nCmd = 0;
+		for (k = 0; k < nByte; k++)
+		{
+			Fir_EEPROM_RmuAddWait(regCmd, &nCmd);
+			Fir_EEPROM_RmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)0x15, (MSD_U16)(addr + i + k));
+			Fir_EEPROM_RmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)0x14, (MSD_U16)0x8000 | (MSD_U16)((MSD_U16)4 << 12));
+			Fir_EEPROM_RmuAddWait(regCmd, &nCmd);
+			Fir_EEPROM_RmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, (MSD_U8)0x14, 0);
+		}
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal != MSD_OK)
+		{
+			return retVal;
+		}
+
+		for (k = 0; k < nByte; k++)
+		{
+			data[i + k] = (MSD_U8)(regCmd[k * 5U + 4U].data & (MSD_U16)0xFF);
+		}
+	}
+
+	return MSD_OK;
+}
+
+/*
+* Each byte is wait, address, write command. A frame ends with a wait so the
+* last write has completed when it returns. Bytes equal to orgData, when
+* given, are skipped.
+*/
+static MSD_STATUS Fir_EEPROM_Write_Block
+(
+IN	MSD_QD_DEV	*dev,
+IN	MSD_U16	addr,
+IN	MSD_U32	len,
+IN	MSD_U8	*data,
+IN	MSD_U8	*orgData,
+OUT	MSD_U32	*numWritten
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 i, nCmd;
+	MSD_BOOL isRmu;
+
+	isRmu = (IS_RMU_SUPPORTED(dev)) ? MSD_TRUE : MSD_FALSE;
+	*numWritten = 0;
+	nCmd = 0;
+	for (i = 0; i < len; i++)
+	{
+		if ((orgData != NULL) && (orgData[i] == data[i]))
+		{
+			continue;
+		}
+
+		if (isRmu == MSD_FALSE)
+		{
+			retVal = Fir_EEPROM_Write(dev, (MSD_U16)(addr + i), (MSD_U16)data[i]);
+			if (retVal != MSD_OK)
+			{
+				return retVal;
+			}
+			*numWritten += 1U;
+			continue;
+		}
+
+		if (nCmd + 4U > MSD_RMU_MAX_REGCMDS)
+		{
+			Fir_EEPROM_RmuAddWait(regCmd, &nCmd);
+			retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			if (retVal != MSD_OK)
+			{
+				return retVal;
+			}
+			nCmd = 0;
+		}
+		Fir_EEPROM_RmuAddWait(regCmd, &nCmd);
+		Fir_EEPROM_RmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)0x15, (MSD_U16)(addr + i));
+		Fir_EEPROM_RmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)0x14,
+			(MSD_U16)0x8000 | (MSD_U16)((MSD_U16)3 << 12) | (MSD_U16)((MSD_U16)1 << 10) | (MSD_U16)data[i]);
+		*numWritten += 1U;
+	}
+
+	if (nCmd > 0U)
+	{
+		Fir_EEPROM_RmuAddWait(regCmd, &nCmd);
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	return MSD_OK;
+}
@@ -22,6 +22,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 /**********************************************************************************************
 *
@@ -106,6 +107,51 @@ IN  MSD_U8	bk1Op,
 IN  MSD_U8	bk1Id
 );
 
+static MSD_U32 Fir_frerSnapshotNumRegs
+(
+IN  MSD_U8	frerBlock
+);
+
+static void Fir_frerSnapshotStore
+(
+IN  MSD_U8	frerBlock,
+IN  MSD_U32	index,
+IN  MSD_U8	id,
+IN  MSD_U16	*regs,
+OUT FIR_MSD_FRER_SNAPSHOT	*snapshot
+);
+
+static MSD_STATUS Fir_frerSnapshotTable
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	frerBlock,
+IN  MSD_U8	frerOp,
+IN  FIR_MSD_FRER_RANGE	*range,
+OUT FIR_MSD_FRER_SNAPSHOT	*snapshot
+);
+
+static MSD_U16 Fir_frerAvbCommand
+(
+IN  MSD_U16	avbOp,
+IN  MSD_U8	frerBlock,
+IN  MSD_U8	frerRegAddr
+);
+
+static void Fir_frerRmuAdd
+(
+IN    MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd,
+IN    MSD_U8	opCode,
+IN    MSD_U8	regAddr,
+IN    MSD_U16	data
+);
+
+static void Fir_frerRmuAddWait
+(
+IN    MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd
+);
+
 /************************************************************************************************************************************/
 /****************************************** below is public function ***************************************************************/
 /***********************************************************************************************************************************/
@@ -2209,6 +2255,250 @@ OUT FIR_MSD_FRER_BANK1_COUNTER	*bk1SCtrData
 
 }
 
+/******************************************************************************
+* Fir_gfrerSnapshot
+*
+* DESCRIPTION:
+*        This routine reads the individual recovery, sequence recovery, bank 0
+*        and bank 1 stream counter instances of a scope in one pass, with their
+*        counters, reset counters and latent error status. With RMU the entries
+*        are read with one post increment read each and packed into as few
+*        frames as possible.
+*
+* INPUTS:
+*        scope  - instance range of each table
+*        clear  - MSD_TRUE to clear the counters of each instance as it is read
+*
+* OUTPUTS:
+*        snapshot    - instance data, number of sequence recovery instances with
+*                      latErrStatus set and the time of the read
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        With clear set, each instance is read and cleared by a single READ_CLEAR
+*        operation, so no count is lost between the read and the clear.
+*
+******************************************************************************/
+MSD_STATUS Fir_gfrerSnapshot
+(
+IN  MSD_QD_DEV	*dev,
+IN  FIR_MSD_FRER_SNAPSHOT_SCOPE	*scope,
+IN  MSD_BOOL	clear,
+OUT FIR_MSD_FRER_SNAPSHOT	*snapshot
+)
+{
+	MSD_STATUS	retVal;
+	MSD_U8	op;
+	MSD_U32	i;
+
+	MSD_DBG_INFO(("Fir_gfrerSnapshot Called.\n"));
+
+	if ((scope == NULL) || (snapshot == NULL))
+	{
+		MSD_DBG_ERROR(("Input param is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+	if (((MSD_U32)scope->indvRcvy.firstId + (MSD_U32)scope->indvRcvy.numIds > FIR_FRER_MAX_RCVY) ||
+		((MSD_U32)scope->seqRcvy.firstId + (MSD_U32)scope->seqRcvy.numIds > FIR_FRER_MAX_RCVY) ||
+		((MSD_U32)scope->bank0.firstId + (MSD_U32)scope->bank0.numIds > FIR_FRER_MAX_BANK_SCTR) ||
+		((MSD_U32)scope->bank1.firstId + (MSD_U32)scope->bank1.numIds > FIR_FRER_MAX_BANK_SCTR))
+	{
+		MSD_DBG_ERROR(("Bad snapshot range.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	op = (clear == MSD_TRUE) ? (MSD_U8)READ_CLEAR : (MSD_U8)READ;
+
+	msdSemTake(dev->devNum, dev->frerRegsSem, OS_WAIT_FOREVER);
+
+	retVal = Fir_frerSnapshotTable(dev, (MSD_U8)INDV_RCVY, op, &scope->indvRcvy, snapshot);
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_frerSnapshotTable(dev, (MSD_U8)SEQ_RCVY, op, &scope->seqRcvy, snapshot);
+	}
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_frerSnapshotTable(dev, (MSD_U8)BANK_0, op, &scope->bank0, snapshot);
+	}
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_frerSnapshotTable(dev, (MSD_U8)BANK_1, op, &scope->bank1, snapshot);
+	}
+
+	msdSemGive(dev->devNum, dev->frerRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("FRER snapshot returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	snapshot->numViolations = 0;
+	for (i = 0; i < scope->seqRcvy.numIds; i++)
+	{
+		if (snapshot->seqRcvy[i].seqRcvy.latErrStatus != 0U)
+		{
+			snapshot->numViolations += 1U;
+		}
+	}
+
+	snapshot->timeStamp = (dev->getTime != NULL) ? dev->getTime() : 0U;
+	snapshot->cleared = clear;
+	snapshot->scope = *scope;
+
+	MSD_DBG_INFO(("Fir_gfrerSnapshot Exit.\n"));
+	return retVal;
+}
+
+/******************************************************************************
+* Fir_gfrerSnapshotRates
+*
+* DESCRIPTION:
+*        This routine takes a new snapshot of the scope of a previous snapshot
+*        and reports, for each enabled bank 0 and bank 1 stream counter, the
+*        counter increase since the previous snapshot with the loss and
+*        duplicate rates.
+*
+* INPUTS:
+*        clear     - MSD_TRUE to clear the counters as they are read
+*        snapshot  - previous snapshot, from Fir_gfrerSnapshot
+*
+* OUTPUTS:
+*        snapshot  - replaced by the new snapshot
+*        rates     - enabled stream counters, room for the bank 0 and bank 1
+*                    numIds of the scope
+*        numRates  - number of entries in rates
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        lossPpm is lost / (passed + lost) and duplicatePpm is
+*        discarded / (passed + discarded), in parts per million. If the previous
+*        snapshot cleared the counters, the new counters are the increase.
+*
+******************************************************************************/
+MSD_STATUS Fir_gfrerSnapshotRates
+(
+IN    MSD_QD_DEV	*dev,
+IN    MSD_BOOL	clear,
+INOUT FIR_MSD_FRER_SNAPSHOT	*snapshot,
+OUT   FIR_MSD_FRER_STREAM_RATE	*rates,
+OUT   MSD_U32	*numRates
+)
+{
+	MSD_STATUS	retVal;
+	FIR_MSD_FRER_BANK0_COUNTER	prev0[FIR_FRER_MAX_BANK_SCTR];
+	FIR_MSD_FRER_BANK1_COUNTER	prev1[FIR_FRER_MAX_BANK_SCTR];
+	FIR_MSD_FRER_SNAPSHOT_SCOPE	scope;
+	FIR_MSD_FRER_BANK0_STATE	*b0;
+	FIR_MSD_FRER_BANK1_STATE	*b1;
+	FIR_MSD_FRER_STREAM_RATE	*r;
+	MSD_U64	total;
+	MSD_U32	i;
+
+	MSD_DBG_INFO(("Fir_gfrerSnapshotRates Called.\n"));
+
+	if ((snapshot == NULL) || (rates == NULL) || (numRates == NULL))
+	{
+		MSD_DBG_ERROR(("Input param is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+	if (((MSD_U32)snapshot->scope.bank0.firstId + (MSD_U32)snapshot->scope.bank0.numIds > FIR_FRER_MAX_BANK_SCTR) ||
+		((MSD_U32)snapshot->scope.bank1.firstId + (MSD_U32)snapshot->scope.bank1.numIds > FIR_FRER_MAX_BANK_SCTR))
+	{
+		MSD_DBG_ERROR(("Bad snapshot range.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	/* counters restart from zero after a clearing snapshot */
+	for (i = 0; i < snapshot->scope.bank0.numIds; i++)
+	{
+		prev0[i] = snapshot->bank0[i].counter;
+		if (snapshot->cleared == MSD_TRUE)
+		{
+			msdMemSet(&prev0[i], 0, sizeof(FIR_MSD_FRER_BANK0_COUNTER));
+		}
+	}
+	for (i = 0; i < snapshot->scope.bank1.numIds; i++)
+	{
+		prev1[i] = snapshot->bank1[i].counter;
+		if (snapshot->cleared == MSD_TRUE)
+		{
+			msdMemSet(&prev1[i], 0, sizeof(FIR_MSD_FRER_BANK1_COUNTER));
+		}
+	}
+
+	scope = snapshot->scope;
+	retVal = Fir_gfrerSnapshot(dev, &scope, clear, snapshot);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	*numRates = 0;
+	for (i = 0; i < scope.bank0.numIds; i++)
+	{
+		b0 = &snapshot->bank0[i];
+		if (b0->config.bk0SCtrEn == 0U)
+		{
+			continue;
+		}
+
+		r = &rates[*numRates];
+		r->bank = 0;
+		r->sCtrId = b0->config.bk0SCtrId;
+		r->sCtrPort = b0->config.bk0SCtrPort;
+		r->sCtrIndex = b0->config.bk0SCtrIndex;
+		r->passed = b0->counter.indvRcvyPassed - prev0[i].indvRcvyPassed;
+		r->discarded = b0->counter.indvRcvyDiscarded - prev0[i].indvRcvyDiscarded;
+		r->lost = b0->counter.indvRcvyLost - prev0[i].indvRcvyLost;
+		r->outOfOrder = b0->counter.indvRcvyOutofOrder - prev0[i].indvRcvyOutofOrder;
+		r->rogue = b0->counter.indvRcvyRogue - prev0[i].indvRcvyRogue;
+		*numRates += 1U;
+	}
+	for (i = 0; i < scope.bank1.numIds; i++)
+	{
+		b1 = &snapshot->bank1[i];
+		if (b1->config.bk1SCtrEn == 0U)
+		{
+			continue;
+		}
+
+		r = &rates[*numRates];
+		r->bank = 1;
+		r->sCtrId = b1->config.bk1SCtrId;
+		r->sCtrPort = b1->config.bk1SCtrPort;
+		r->sCtrIndex = b1->config.bk1SCtrIndex;
+		r->passed = b1->counter.seqRcvyPassed - prev1[i].seqRcvyPassed;
+		r->discarded = b1->counter.seqRcvyDiscarded - prev1[i].seqRcvyDiscarded;
+		r->lost = b1->counter.seqRcvyLost - prev1[i].seqRcvyLost;
+		r->outOfOrder = b1->counter.seqRcvyOutofOrder - prev1[i].seqRcvyOutofOrder;
+		r->rogue = b1->counter.seqRcvyRogue - prev1[i].seqRcvyRogue;
+		*numRates += 1U;
+	}
+
+	for (i = 0; i < *numRates; i++)
+	{
+		r = &rates[i];
+		total = (MSD_U64)r->passed + (MSD_U64)r->lost;
+		r->lossPpm = (total != 0U) ? (MSD_U32)((MSD_U64)r->lost * 1000000U / total) : 0U;
+		total = (MSD_U64)r->passed + (MSD_U64)r->discarded;
+		r->duplicatePpm = (total != 0U) ? (MSD_U32)((MSD_U64)r->discarded * 1000000U / total) : 0U;
+	}
+
+	MSD_DBG_INFO(("Fir_gfrerSnapshotRates Exit.\n"));
+	return MSD_OK;
+}
+
 static MSD_STATUS Fir_frerBasicWrite
 (
 IN MSD_QD_DEV* dev,
@@ -2644,3 +2934,255 @@ IN  MSD_U8	bk1Id
 	return retVal;
 }
 
+/* Data registers read for a snapshot entry, from register 0 (operation status) */
+static MSD_U32 Fir_frerSnapshotNumRegs
+(
+IN  MSD_U8	frerBlock
+)
+{
+	switch (frerBlock)
+	{
+	case INDV_RCVY:
+		return 5U;
+	case SEQ_RCVY:
+		return 10U;
+	case BANK_0:
+		return 20U;
+	default:
+		return 18U;
+	}
+}
+
+static void Fir_frerSnapshotStore
+(
+IN  MSD_U8	frerBlock,
+IN  MSD_U32	index,
+IN  MSD_U8	id,
+IN  MSD_U16	*regs,
+OUT FIR_MSD_FRER_SNAPSHOT	*snapshot
+)
+{
+	FIR_MSD_FRER_INDVRCVY_STATE	*indv;
+	FIR_MSD_FRER_SEQRCVY_STATE	*seq;
+	FIR_MSD_FRER_BANK0_STATE	*bk0;
+	FIR_MSD_FRER_BANK1_STATE	*bk1;
+
+	switch (frerBlock)
+	{
+	case INDV_RCVY:
+		indv = &snapshot->indvRcvy[index];
+		indv->indvRcvy.indvRcvyId = id;
+		indv->indvRcvy.indvRcvyEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+		indv->indvRcvy.indvRcvyAlg = (MSD_U8)((regs[1] & 0x2000) >> 13);
+		indv->indvRcvy.indvRcvyTakeNoSeq = (MSD_U8)((regs[1] & 0x1000) >> 12);
+		indv->indvRcvy.indvRcvySeqHisLen = (MSD_U8)(regs[1] & 0x1F);
+		indv->indvRcvy.indvRcvyRstRate = (MSD_U8)((regs[2] & 0x3000) >> 12);
+		indv->indvRcvy.indvRcvyRstTime = regs[2] & 0x3FF;
+		indv->indvRcvyResets = regs[4];
+		break;
+	case SEQ_RCVY:
+		seq = &snapshot->seqRcvy[index];
+		seq->seqRcvy.seqRcvyId = id;
+		seq->seqRcvy.seqRcvyEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+		seq->seqRcvy.seqRcvyPort = (MSD_U8)((regs[1] & 0x1F00) >> 8);
+		seq->seqRcvy.seqRcvyIndex = (MSD_U8)(regs[1] & 0x7F);
+		seq->seqRcvy.seqRcvyAlg = (MSD_U8)((regs[2] & 0x2000) >> 13);
+		seq->seqRcvy.seqRcvyTakeNoSeq = (MSD_U8)((regs[2] & 0x1000) >> 12);
+		seq->seqRcvy.latErrIntEn = (MSD_U8)((regs[2] & 0x200) >> 9);
+		seq->seqRcvy.latErrStatus = (MSD_U8)((regs[2] & 0x100) >> 8);
+		seq->seqRcvy.seqRcvySeqHisLen = (MSD_U8)(regs[2] & 0x1F);
+		seq->seqRcvy.seqRcvyRstRate = (MSD_U8)((regs[3] & 0x3000) >> 12);
+		seq->seqRcvy.seqRcvyRstTime = regs[3] & 0x3FF;
+		seq->seqRcvy.latErrEn = (MSD_U8)((regs[4] & 0x8000) >> 15);
+		seq->seqRcvy.rdantPaths = (MSD_U8)((regs[4] & 0x3000) >> 12);
+		seq->seqRcvy.latErrDiff = (MSD_U8)(regs[4] & 0xFF);
+		seq->seqRcvy.latErrTestRate = (MSD_U8)((regs[5] & 0x3000) >> 12);
+		seq->seqRcvy.latErrTestTime = regs[5] & 0x3FF;
+		seq->seqRcvy.latErrRstRate = (MSD_U8)((regs[6] & 0x3000) >> 12);
+		seq->seqRcvy.latErrRstTime = regs[6] & 0x3FF;
+		seq->seqRcvyResets = regs[8];
+		seq->latErrResets = regs[9];
+		break;
+	case BANK_0:
+		bk0 = &snapshot->bank0[index];
+		bk0->config.bk0SCtrId = id;
+		bk0->config.bk0SCtrEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+		bk0->config.bk0SCtrPort = (MSD_U8)((regs[1] & 0x1F00) >> 8);
+		bk0->config.bk0SCtrIndex = (MSD_U8)(regs[1] & 0x1F);
+		bk0->counter.indvRcvyTagless = ((MSD_U32)regs[4] << 16) | regs[5];
+		bk0->counter.indvRcvyPassed = ((MSD_U32)regs[6] << 16) | regs[7];
+		bk0->counter.indvRcvyDiscarded = ((MSD_U32)regs[8] << 16) | regs[9];
+		bk0->counter.indvRcvyOutofOrder = ((MSD_U32)regs[10] << 16) | regs[11];
+		bk0->counter.indvRcvyRogue = ((MSD_U32)regs[12] << 16) | regs[13];
+		bk0->counter.indvRcvyLost = ((MSD_U32)regs[14] << 16) | regs[15];
+		bk0->counter.sidInput = ((MSD_U32)regs[16] << 16) | regs[17];
+		bk0->counter.seqEncErrored = ((MSD_U32)regs[18] << 16) | regs[19];
+		break;
+	default:
+		bk1 = &snapshot->bank1[index];
+		bk1->config.bk1SCtrId = id;
+		bk1->config.bk1SCtrEn = (MSD_U8)((regs[1] & 0x8000) >> 15);
+		bk1->config.bk1SCtrPort = (MSD_U8)((regs[1] & 0x1F00) >> 8);
+		bk1->config.bk1SCtrIndex = (MSD_U8)(regs[1] & 0x1F);
+		bk1->counter.seqRcvyTagless = ((MSD_U32)regs[4] << 16) | regs[5];
+		bk1->counter.seqRcvyPassed = ((MSD_U32)regs[6] << 16) | regs[7];
+		bk1->counter.seqRcvyDiscarded = ((MSD_U32)regs[8] << 16) | regs[9];
+		bk1->counter.seqRcvyOutofOrder = ((MSD_U32)regs[10] << 16) | regs[11];
+		bk1->counter.seqRcvyRogue = ((MSD_U32)regs[12] << 16) | regs[13];
+		bk1->counter.seqRcvyLost = ((MSD_U32)regs[14] << 16) | regs[15];
+		bk1->counter.sidOutput = ((MSD_U32)regs[16] << 16) | regs[17];
+		break;
+	}
+}
+
+/* Read a range of one FRER table into the snapshot, the caller holds frerRegsSem */
+static MSD_STATUS Fir_frerSnapshotTable
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	frerBlock,
+IN  MSD_U8	frerOp,
+IN  FIR_MSD_FRER_RANGE	*range,
+OUT FIR_MSD_FRER_SNAPSHOT	*snapshot
+)
+{
+	MSD_STATUS	retVal = MSD_OK;
+	MSD_RegCmd	regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd	*pRegCmd = regCmd;
+	MSD_U32	first[MSD_RMU_MAX_REGCMDS / 6U];
+	MSD_U16	regs[20];
+	MSD_U32	numRegs;
+	MSD_U32	nCmd;
+	MSD_U32	i;
+	MSD_U32	n;
+	MSD_U32	k;
+	MSD_U32	r;
+	MSD_U8	id;
+
+	numRegs = Fir_frerSnapshotNumRegs(frerBlock);
+
+	if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; (i < range->numIds) && (retVal == MSD_OK); i++)
+		{
+			id = (MSD_U8)(range->firstId + i);
+			retVal = Fir_frerWaitBusyBitSelfClear(dev, frerBlock);
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_frerBasicWrite(dev, frerBlock, 0,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)frerOp << 12) | (MSD_U16)id));
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_frerWaitBusyBitSelfClear(dev, frerBlock);
+			}
+			for (r = 0; (r < numRegs) && (retVal == MSD_OK); r++)
+			{
+				retVal = Fir_frerBasicRead(dev, frerBlock, (MSD_U8)r, &regs[r]);
+			}
+			if (retVal == MSD_OK)
+			{
+				Fir_frerSnapshotStore(frerBlock, i, id, regs, snapshot);
+			}
+		}
+		return retVal;
+	}
+
+	msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+	i = 0;
+	while ((i < range->numIds) && (retVal == MSD_OK))
+	{
+		/* operation, then registers 0 (operation status) up in one post increment read */
+		nCmd = 0;
+		n = 0;
+		while ((i + n < range->numIds) && (nCmd + 6U + numRegs <= MSD_RMU_MAX_REGCMDS))
+		{
+			id = (MSD_U8)(range->firstId + i + n);
+			Fir_frerRmuAddWait(regCmd, &nCmd);
+			Fir_frerRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA,
+				(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)frerOp << 12) | (MSD_U16)id));
+			Fir_frerRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+				Fir_frerAvbCommand(0x3U, frerBlock, 0));
+			Fir_frerRmuAddWait(regCmd, &nCmd);
+			Fir_frerRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+				Fir_frerAvbCommand(0x2U, frerBlock, 0));
+			Fir_frerRmuAddWait(regCmd, &nCmd);
+			first[n] = nCmd;
+			for (r = 0; r < numRegs; r++)
+			{
+				Fir_frerRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+			}
+			n++;
+		}
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+			break;
+		}
+
+		for (k = 0; k < n; k++)
+		{
+			if ((regCmd[first[k]].data & (MSD_U16)0x8000) != 0U)
+			{
+				MSD_DBG_ERROR(("FRER operation still busy in RMU frame.\n"));
+				retVal = MSD_FAIL;
+				break;
+			}
+			for (r = 0; r < numRegs; r++)
+			{
+				regs[r] = regCmd[first[k] + r].data;
+			}
+			Fir_frerSnapshotStore(frerBlock, i + k, (MSD_U8)(range->firstId + i + k), regs, snapshot);
+		}
+		i += n;
+	}
+
+	msdSemGive(dev->devNum, dev->ptpRegsSem);
+	return retVal;
+}
+
+/* AVB command of a FRER register, avbOp 0 read, 2 read with post increment, 3 write */
+static MSD_U16 Fir_frerAvbCommand
+(
+IN  MSD_U16	avbOp,
+IN  MSD_U8	frerBlock,
+IN  MSD_U8	frerRegAddr
+)
+{
+	return (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((avbOp & (MSD_U16)0x3) << 13) | (MSD_U16)((MSD_U16)frerBlock << 8) |
+		(MSD_U16)((MSD_U16)0x5 << 5) | (MSD_U16)((MSD_U16)frerRegAddr & (MSD_U16)0x1F));
+}
+
+static void Fir_frerRmuAdd
+(
+IN    MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd,
+IN    MSD_U8	opCode,
+IN    MSD_U8	regAddr,
+IN    MSD_U16	data
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
+
+/* Wait until the busy bit of the AVB command register clears */
+static void Fir_frerRmuAddWait
+(
+IN    MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = FIR_AVB_COMMAND;
+	regCmd[*nCmd].data = 15U;
+	*nCmd += 1U;
+}
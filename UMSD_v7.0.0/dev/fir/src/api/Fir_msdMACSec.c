@@ -18,6 +18,7 @@
 *******************************************************************************/
 #include <fir/include/api/Fir_msdMACSec.h>
 #include <fir/include/api/Fir_msdApiInternal.h>
+#include <fir/include/api/Fir_msdRMU.h>
 #include <fir/include/driver/Fir_msdHwAccess.h>
 #include <fir/include/driver/Fir_msdDrvSwRegs.h>
 #include <utils/msdUtils.h>
@@ -27,6 +28,10 @@
 #define regBusWidth 0x4U
 #define APB_PHYADDR 0x1CU
 #define APB_REGADDR 0x11U
+/* Switch register commands per APB word access at most, and reads per burst frame */
+#define APB_BURST_WRITE_CMDS 11U
+#define APB_BURST_READ_CMDS 17U
+#define APB_BURST_MAX_READS (MSD_RMU_MAX_REGCMDS / 13U)
 #define GLOBAL_CTRL_ADDR 0x50071000U
 #define MIB_OP_ADDR 0x5007100CU
 #define INT_OP_ADDR 0x50071008U
@@ -98,6 +103,13 @@
 #define FIR_MAXMIBINDEX 16U
 #define FIR_MAXSAKINDEX 32U
 
+/*Counter words read per MIB index*/
+#define FIR_TX_SECY_MIB_WORDS 12U
+#define FIR_TX_SC_MIB_WORDS 2U
+#define FIR_RX_SECY_MIB_WORDS 14U
+#define FIR_RX_SC_MIB_WORDS 6U
+#define FIR_EVENT_WORDS 3U
+
 typedef enum
 {
 	FIR_MACSec_FLUSH_ALL = 0x1,
@@ -191,6 +203,25 @@ typedef union
 
 } FIR_MACSec_DATA_HW;
 
+/*
+* APB burst: MACSec register accesses queued as switch register commands.
+* With RMU a flush sends them in one multi register frame, otherwise they
+* are run one by one over SMI. Read data is valid after the flush.
+*/
+typedef struct
+{
+	MSD_QD_DEV *dev;
+	MSD_STATUS status;
+	MSD_U32 nCmd;
+	MSD_U32 nRead;
+	MSD_U32 addr;		/* APB address bytes last written in this burst */
+	MSD_BOOL addrValid;
+	MSD_U32 opReady;	/* operation registers known idle, see Fir_apbOpMask */
+	MSD_U32 *readData[APB_BURST_MAX_READS];
+	MSD_U32 readIndex[APB_BURST_MAX_READS];
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+} FIR_MACSEC_APB_BURST;
+
 static MSD_U32* ConvertRuleToArray(IN FIR_MACSec_DATA_HW* dataRw);
 static MSD_U32* ConvertActionToArray(IN FIR_MACSec_DATA_HW* dataRw);
 static MSD_U32* ConvertRXSecYToArray(IN FIR_MACSec_DATA_HW* dataRw);
@@ -200,29 +231,51 @@ static MSD_U32* ConvertTXSCToArray(IN FIR_MACSec_DATA_HW* dataRw);
 static MSD_U32* ConvertRXSAToArray(IN FIR_MACSec_DATA_HW* dataRw);
 static MSD_U32* ConvertTXSAToArray(IN FIR_MACSec_DATA_HW* dataRw);
 
-static FIR_MSEC_RULE* ConvertArrayToRule(IN  MSD_QD_DEV dev);
-static FIR_MSEC_TCAM_ACTION* ConvertArrayToAction(IN MSD_QD_DEV dev);
-static FIR_SECY_INGRESS* ConvertArrayToRxSecY(IN  MSD_QD_DEV dev);
-static FIR_SECY_EGRESS* ConvertArrayToTxSecY(IN  MSD_QD_DEV dev);
-static FIR_MSEC_RX_SC* ConvertArrayToRxSc(IN  MSD_QD_DEV dev);
-static FIR_MSEC_TX_SC* ConvertArrayToTxSc(IN  MSD_QD_DEV dev);
-static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev);
-static FIR_MSEC_TX_SA* ConvertArrayToTxSa(IN  MSD_QD_DEV dev);
+static FIR_MSEC_RULE* ConvertArrayToRule(INOUT FIR_MACSEC_APB_BURST* burst);
+static FIR_MSEC_TCAM_ACTION* ConvertArrayToAction(INOUT FIR_MACSEC_APB_BURST* burst);
+static FIR_SECY_INGRESS* ConvertArrayToRxSecY(INOUT FIR_MACSEC_APB_BURST* burst);
+static FIR_SECY_EGRESS* ConvertArrayToTxSecY(INOUT FIR_MACSEC_APB_BURST* burst);
+static FIR_MSEC_RX_SC* ConvertArrayToRxSc(INOUT FIR_MACSEC_APB_BURST* burst);
+static FIR_MSEC_TX_SC* ConvertArrayToTxSc(INOUT FIR_MACSEC_APB_BURST* burst);
+static FIR_MSEC_RX_SA* ConvertArrayToRxSa(INOUT FIR_MACSEC_APB_BURST* burst);
+static FIR_MSEC_TX_SA* ConvertArrayToTxSa(INOUT FIR_MACSEC_APB_BURST* burst);
 
 
-static MSD_STATUS Fir_MACSecGetAnyRegField(IN  MSD_QD_DEV dev, IN MSD_U32 regAddr, IN MSD_U32 fieldOffset, IN MSD_U32 fieldLength, OUT MSD_U32* data);
-static MSD_STATUS Fir_WaitOperationReady(IN  MSD_QD_DEV dev, IN MSD_32 regAddr);
+static MSD_STATUS Fir_WaitOperationReady(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_32 regAddr);
 static MSD_STATUS Fir_OperationPerform(IN  MSD_QD_DEV* dev, IN	MSD_32	regAddr, IN	FIR_MEMTYPE memType, IN  FIR_MACSec_OPERATION  tcamOp, INOUT FIR_MACSec_DATA_HW* opData, IN MSD_U8 index);
-static MSD_STATUS  Fir_SAKOperation(IN  MSD_QD_DEV* dev, IN  FIR_MACSec_SAK_OPERATION  sakOp, IN MSD_U8 index);
-static MSD_STATUS MACSec_SetMEMData(IN  MSD_QD_DEV dev, IN FIR_MEMTYPE memType, IN FIR_MACSec_DATA_HW* tcamDataP);
-static MSD_STATUS MACSec_GetMEMData(IN  MSD_QD_DEV dev, IN FIR_MEMTYPE memType, OUT FIR_MACSec_DATA_HW* tcamDataP);
-
-static MSD_STATUS Wait_APBReady(IN  MSD_QD_DEV dev);
-static MSD_STATUS Operation_APB(IN  MSD_QD_DEV dev, IN FIR_MACSec_APB_OPERATION opCode, IN FIR_RW_OP rwOp, INOUT MSD_U8* value);
+static MSD_STATUS Fir_burstOperationPerform(INOUT FIR_MACSEC_APB_BURST* burst, IN	MSD_32	regAddr, IN	FIR_MEMTYPE memType, IN  FIR_MACSec_OPERATION  tcamOp, INOUT FIR_MACSec_DATA_HW* opData, IN MSD_U8 index);
+static MSD_STATUS Fir_burstSAKOperation(INOUT FIR_MACSEC_APB_BURST* burst, IN  FIR_MACSec_SAK_OPERATION  sakOp, IN MSD_U8 index);
+static MSD_STATUS Fir_burstCreateSA(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_BOOL isTx, IN MSD_U8 saIndex, IN FIR_MACSec_DATA_HW* saData);
+static MSD_STATUS Fir_WaitAllOperationReady(INOUT FIR_MACSEC_APB_BURST* burst);
+static MSD_STATUS Fir_txnOpCheck(IN FIR_MACSEC_TXN_OP* op);
+static MSD_STATUS Fir_txnOpApply(INOUT FIR_MACSEC_APB_BURST* burst, IN FIR_MACSEC_TXN_OP* op);
+static MSD_STATUS MACSec_SetMEMData(INOUT FIR_MACSEC_APB_BURST* burst, IN FIR_MEMTYPE memType, IN FIR_MACSec_DATA_HW* tcamDataP);
+static MSD_STATUS MACSec_GetMEMData(INOUT FIR_MACSEC_APB_BURST* burst, IN FIR_MEMTYPE memType, OUT FIR_MACSec_DATA_HW* tcamDataP);
+
+/*APB burst*/
+static void Fir_apbBurstStart(OUT FIR_MACSEC_APB_BURST* burst, IN MSD_QD_DEV* dev);
+static MSD_STATUS Fir_apbBurstWrite(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U32 regAddr, IN MSD_U32 data);
+static MSD_STATUS Fir_apbBurstRead(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U32 regAddr, OUT MSD_U32* data);
+static MSD_STATUS Fir_apbBurstFlush(INOUT FIR_MACSEC_APB_BURST* burst);
+static MSD_STATUS Fir_apbBurstEnd(INOUT FIR_MACSEC_APB_BURST* burst);
+static void Fir_apbBurstAdd(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U8 isWaitOnBit, IN MSD_U8 opCode, IN MSD_U16 data);
+static void Fir_apbBurstWaitReady(INOUT FIR_MACSEC_APB_BURST* burst);
+static void Fir_apbBurstAddress(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U32 regAddr);
+static MSD_U32 Fir_apbOpMask(IN MSD_U32 regAddr);
 
 /*MACSec mibs*/
-static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV dev, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index);
-static MSD_STATUS Operation_INT(IN  MSD_QD_DEV dev, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 MIB_Index);
+static MSD_STATUS Operation_MIB(INOUT FIR_MACSEC_APB_BURST* burst, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index);
+static MSD_STATUS Operation_INT(INOUT FIR_MACSEC_APB_BURST* burst, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 MIB_Index);
+static void Fir_queueTxSecYMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data);
+static void Fir_decodeTxSecYMib(IN MSD_U32* data, OUT FIR_MSEC_TX_SECY_COUNTER* states);
+static void Fir_queueTxSCMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data);
+static void Fir_decodeTxSCMib(IN MSD_U32* data, OUT FIR_MSEC_TX_SC_COUNTER* states);
+static void Fir_queueRxSecYMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data);
+static void Fir_decodeRxSecYMib(IN MSD_U32* data, OUT FIR_MSEC_RX_SECY_COUNTER* states);
+static void Fir_queueRxSCMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data);
+static void Fir_decodeRxSCMib(IN MSD_U32* data, OUT FIR_MSEC_RX_SC_COUNTER* states);
+static void Fir_queueEvent(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data);
+static void Fir_decodeEvent(IN MSD_U32* data, OUT FIR_MSEC_EVENT* event);
 
 /****************************************************************************************************/
 
@@ -231,185 +284,30 @@ static MSD_STATUS Operation_INT(IN  MSD_QD_DEV dev, IN FIR_MACSec_INT_OPERATION
 /****************************************************************************************************/
 MSD_STATUS Fir_gmacsecRead
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN MSD_U32 regAddr,
 	OUT MSD_U32* data
 )
 {
-	MSD_STATUS retVal = MSD_OK;
-	MSD_U8 value = 0;
-	/*step 1 wait Ready*/
-	msdSemTake(dev.devNum, dev.apbRegsSem, OS_WAIT_FOREVER);
-	/* Wait until the tcam in ready. */
-	retVal = Wait_APBReady(dev);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 2, write address*/
-	value = regAddr & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B0, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 8) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B1, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 16) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B2, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 24) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B3, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 3, action read*/
-	value = 0;
-	retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
+	FIR_MACSEC_APB_BURST burst;
 
-	value = (1 << 1) | FIR_APB_READ | ((value | 0x80) & 0xFC);
-	retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 4, read value*/
-	retVal = Operation_APB(dev, FIR_DATA_B0, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	*data = (MSD_U32)(value & 0xFF);
-	retVal = Operation_APB(dev, FIR_DATA_B1, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	*data += (MSD_U32)(value & 0xFF) << 8;
-	retVal = Operation_APB(dev, FIR_DATA_B2, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	*data += (MSD_U32)(value & 0xFF) << 16;
-	retVal = Operation_APB(dev, FIR_DATA_B3, FIR_APB_READ, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	*data += (MSD_U32)(value & 0xFF) << 24;
-	msdSemGive(dev.devNum, dev.apbRegsSem);
-	return retVal;
+	Fir_apbBurstStart(&burst, dev);
+	Fir_apbBurstRead(&burst, regAddr, data);
+	return Fir_apbBurstEnd(&burst);
 }
 
 MSD_STATUS Fir_gmacsecWrite
 (
-	IN MSD_QD_DEV dev,
+	IN MSD_QD_DEV *dev,
 	IN MSD_U32 regAddr,
 	IN MSD_U32 data
 )
 {
-	MSD_STATUS retVal = MSD_OK;
-	MSD_U8 value = 0;
-	msdSemTake(dev.devNum, dev.apbRegsSem, OS_WAIT_FOREVER);
-	retVal = Wait_APBReady(dev);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 2, write address*/
-	value = regAddr & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B0, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 8) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B1, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 16) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B2, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (regAddr >> 24) & 0xFF;
-	retVal = Operation_APB(dev, FIR_ADDRESS_B3, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
+	FIR_MACSEC_APB_BURST burst;
 
-	/*Step 3, write data*/
-	value = data & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B0, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (data >> 8) & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B1, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (data >> 16) & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B2, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	value = (data >> 24) & 0xFF;
-	retVal = Operation_APB(dev, FIR_DATA_B3, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	/*Step 4, action Write*/
-	value = (1 << 1) | FIR_APB_WRITE | 0x80;
-	retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_WRITE, &value);
-	if (retVal != MSD_OK)
-	{
-		msdSemGive(dev.devNum, dev.apbRegsSem);
-		return retVal;
-	}
-	msdSemGive(dev.devNum, dev.apbRegsSem);
-	return retVal;
+	Fir_apbBurstStart(&burst, dev);
+	Fir_apbBurstWrite(&burst, regAddr, data);
+	return Fir_apbBurstEnd(&burst);
 }
 
 MSD_STATUS Fir_gmacsecFlushAll
@@ -794,7 +692,9 @@ MSD_STATUS Fir_gmacsecCreateRxSA
 ) 
 {
 	MSD_STATUS tempStatus = MSD_OK;
+	MSD_STATUS endStatus;
 	FIR_MACSec_DATA_HW tmp;
+	FIR_MACSEC_APB_BURST burst;
 	if (saIndex >= FIR_MAXSAINDEX)
 	{
 		MSD_DBG_ERROR(("Bad saIndex: It should be within %u\n", FIR_MAXSAINDEX));
@@ -804,8 +704,13 @@ MSD_STATUS Fir_gmacsecCreateRxSA
 	{
 		msdMemSet(&tmp, 0, sizeof(FIR_MACSec_DATA_HW));
 		msdMemCpy(&(tmp.rxSa), rxSA, sizeof(FIR_MSEC_RX_SA));
-		tempStatus = Fir_OperationPerform(dev, BASE_RX_SA, FIR_TYPE_RX_SA, FIR_MACSec_LOAD_ENTRY, &tmp, saIndex);
-		tempStatus |= Fir_SAKOperation(dev, FIR_SAK_LOAD_RX, saIndex);
+		Fir_apbBurstStart(&burst, dev);
+		tempStatus = Fir_burstCreateSA(&burst, MSD_FALSE, saIndex, &tmp);
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (tempStatus == MSD_OK)
+		{
+			tempStatus = endStatus;
+		}
 	}
 
 	return tempStatus;
@@ -839,7 +744,9 @@ MSD_STATUS Fir_gmacsecGetRxSA
 )
 {
 	MSD_STATUS tempStatus = MSD_OK;
+	MSD_STATUS endStatus;
 	FIR_MACSec_DATA_HW tmp;
+	FIR_MACSEC_APB_BURST burst;
 	if (saIndex >= FIR_MAXSAINDEX)
 	{
 		MSD_DBG_ERROR(("Bad saIndex: It should be within %u\n", FIR_MAXSAINDEX));
@@ -848,8 +755,17 @@ MSD_STATUS Fir_gmacsecGetRxSA
 	else
 	{
 		msdMemSet(&tmp, 0, sizeof(FIR_MACSec_DATA_HW));		
-		tempStatus = Fir_SAKOperation(dev, FIR_SAK_READ_RX, saIndex);
-		tempStatus |= Fir_OperationPerform(dev, BASE_RX_SA, FIR_TYPE_RX_SA, FIR_MACSec_READ_ENTRY, &tmp, saIndex);
+		Fir_apbBurstStart(&burst, dev);
+		tempStatus = Fir_burstSAKOperation(&burst, FIR_SAK_READ_RX, saIndex);
+		if (tempStatus == MSD_OK)
+		{
+			tempStatus = Fir_burstOperationPerform(&burst, BASE_RX_SA, FIR_TYPE_RX_SA, FIR_MACSec_READ_ENTRY, &tmp, saIndex);
+		}
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (tempStatus == MSD_OK)
+		{
+			tempStatus = endStatus;
+		}
 		msdMemCpy(rxSA, &(tmp.rxSa), sizeof(FIR_MSEC_RX_SA));
 	}
 
@@ -863,7 +779,9 @@ MSD_STATUS Fir_gmacsecCreateTxSA
 	IN FIR_MSEC_TX_SA* txSA
 ) {
 	MSD_STATUS tempStatus = MSD_OK;
+	MSD_STATUS endStatus;
 	FIR_MACSec_DATA_HW tmp;
+	FIR_MACSEC_APB_BURST burst;
 	if (saIndex >= FIR_MAXSAINDEX)
 	{
 		MSD_DBG_ERROR(("Bad saIndex: It should be within %u\n", FIR_MAXSAINDEX));
@@ -873,8 +791,13 @@ MSD_STATUS Fir_gmacsecCreateTxSA
 	{
 		msdMemSet(&tmp, 0, sizeof(FIR_MACSec_DATA_HW));
 		msdMemCpy(&(tmp.txSa), txSA, sizeof(FIR_MSEC_TX_SA));
-		tempStatus = Fir_OperationPerform(dev, BASE_TX_SA, FIR_TYPE_TX_SA, FIR_MACSec_LOAD_ENTRY, &tmp, saIndex);
-		tempStatus |= Fir_SAKOperation(dev, FIR_SAK_LOAD_TX, saIndex);
+		Fir_apbBurstStart(&burst, dev);
+		tempStatus = Fir_burstCreateSA(&burst, MSD_TRUE, saIndex, &tmp);
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (tempStatus == MSD_OK)
+		{
+			tempStatus = endStatus;
+		}
 	}
 
 	return tempStatus;
@@ -908,7 +831,9 @@ MSD_STATUS Fir_gmacsecGetTxSA
 )
 {
 	MSD_STATUS tempStatus = MSD_OK;
+	MSD_STATUS endStatus;
 	FIR_MACSec_DATA_HW tmp;
+	FIR_MACSEC_APB_BURST burst;
 	if (saIndex >= FIR_MAXSAINDEX)
 	{
 		MSD_DBG_ERROR(("Bad saIndex: It should be within %u\n", FIR_MAXSAINDEX));
@@ -917,14 +842,71 @@ MSD_STATUS Fir_gmacsecGetTxSA
 	else
 	{
 		msdMemSet(&tmp, 0, sizeof(FIR_MACSec_DATA_HW));
-		tempStatus = Fir_SAKOperation(dev, FIR_SAK_READ_TX, saIndex);
-		tempStatus |= Fir_OperationPerform(dev, BASE_TX_SA, FIR_TYPE_TX_SA, FIR_MACSec_READ_ENTRY, &tmp, saIndex);
+		Fir_apbBurstStart(&burst, dev);
+		tempStatus = Fir_burstSAKOperation(&burst, FIR_SAK_READ_TX, saIndex);
+		if (tempStatus == MSD_OK)
+		{
+			tempStatus = Fir_burstOperationPerform(&burst, BASE_TX_SA, FIR_TYPE_TX_SA, FIR_MACSec_READ_ENTRY, &tmp, saIndex);
+		}
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (tempStatus == MSD_OK)
+		{
+			tempStatus = endStatus;
+		}
 		msdMemCpy(txSA, &(tmp.txSa), sizeof(FIR_MSEC_TX_SA));
 	}
 
 	return tempStatus;
 }
 
+MSD_STATUS Fir_gmacsecApplyTransaction
+(
+	IN MSD_QD_DEV *dev,
+	IN FIR_MACSEC_TXN_OP* ops,
+	IN MSD_U32 numOps,
+	OUT MSD_U32* numDone
+)
+{
+	MSD_STATUS status = MSD_OK;
+	MSD_STATUS endStatus;
+	MSD_U32 i;
+	FIR_MACSEC_APB_BURST burst;
+
+	*numDone = 0;
+	for (i = 0; i < numOps; i++)
+	{
+		status = Fir_txnOpCheck(&ops[i]);
+		if (status != MSD_OK)
+		{
+			MSD_DBG_ERROR(("Bad MACSec transaction operation %u.\n", (unsigned int)i));
+			return status;
+		}
+	}
+
+	Fir_apbBurstStart(&burst, dev);
+	status = Fir_WaitAllOperationReady(&burst);
+	for (i = 0; (i < numOps) && (status == MSD_OK); i++)
+	{
+		status = Fir_txnOpApply(&burst, &ops[i]);
+		if (status == MSD_OK)
+		{
+			*numDone = i + 1U;
+		}
+	}
+	endStatus = Fir_apbBurstEnd(&burst);
+	if (status == MSD_OK)
+	{
+		status = endStatus;
+	}
+	if (status != MSD_OK)
+	{
+		MSD_DBG_ERROR(("FIR_MACSecApplyTransaction function returned: %s after %u operations.\n",
+			msdDisplayStatus(status), (unsigned int)*numDone));
+	}
+
+	return status;
+}
+
 MSD_STATUS Fir_gmacsecGetTXSecYStates
 (
 	IN MSD_QD_DEV *dev,
@@ -934,7 +916,9 @@ MSD_STATUS Fir_gmacsecGetTXSecYStates
 )
 {
 	MSD_STATUS status = MSD_OK;
-	MSD_U32 data = 0;
+	MSD_STATUS endStatus;
+	FIR_MACSEC_APB_BURST burst;
+	MSD_U32 data[FIR_TX_SECY_MIB_WORDS];
 	if (secYCounterIndex >= FIR_MAXMIBINDEX)
 	{
 		MSD_DBG_ERROR(("Bad secYCounterIndex: It should be within %u\n", FIR_MAXMIBINDEX));
@@ -942,103 +926,31 @@ MSD_STATUS Fir_gmacsecGetTXSecYStates
 	}
 	else
 	{
+		/* capture, then all counters of the index in one burst */
+		Fir_apbBurstStart(&burst, dev);
 		if (FIR_ENABLE == autoClear)
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SECY_AUTO_CLEAR, secYCounterIndex);
+			status = Operation_MIB(&burst, FIR_CAPTURE_TX_SECY_AUTO_CLEAR, secYCounterIndex);
 		}
 		else
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
-		}
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_HICAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outOctetsSecYControlledPort = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_LOCAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outOctetsSecYControlledPort |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_HICAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outOctetsSecYEncrypted = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_LOCAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outOctetsSecYEncrypted |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_HICAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outOctetsSecYProtected = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_LOCAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outOctetsSecYProtected |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTUNIFR_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outPktsSecYUnicast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTMULFR_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->outPktsSecYMulticast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_CPTBRDFR_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = Operation_MIB(&burst, FIR_CAPTURE_TX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
 		}
-		states->outPktSecYBroadcast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_UNTAG_CAP_OFFSET, &data);
-		if (MSD_OK != status)
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			Fir_queueTxSecYMib(&burst, data);
 		}
-		states->outPktsSecYuntagged = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_TOOLONG_CAP_OFFSET, &data);
-		if (MSD_OK != status)
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = endStatus;
 		}
-		states->outPktsSecYTooLong = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_TX_NOSAERROR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		states->outPktsSecYNoSAError = (data & 0xFFFFFFFF);
+		Fir_decodeTxSecYMib(data, states);
 	}
 	return status;
 }
@@ -1051,7 +963,9 @@ MSD_STATUS Fir_gmacsecGetTXSCStates
 )
 {
 	MSD_STATUS status = MSD_OK;
-	MSD_U32 data = 0;
+	MSD_STATUS endStatus;
+	FIR_MACSEC_APB_BURST burst;
+	MSD_U32 data[FIR_TX_SC_MIB_WORDS];
 	if (scCounterIndex >= FIR_MAXMIBINDEX)
 	{
 		MSD_DBG_ERROR(("Bad scCounterIndex: It should be within %u\n", FIR_MAXMIBINDEX));
@@ -1059,33 +973,31 @@ MSD_STATUS Fir_gmacsecGetTXSCStates
 	}
 	else
 	{
+		/* capture, then all counters of the index in one burst */
+		Fir_apbBurstStart(&burst, dev);
 		if (FIR_ENABLE == autoClear)
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SC_AUTO_CLEAR, scCounterIndex);
+			status = Operation_MIB(&burst, FIR_CAPTURE_TX_SC_AUTO_CLEAR, scCounterIndex);
 		}
 		else
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_TX_SC_NO_AUTO_CLEAR, scCounterIndex);
+			status = Operation_MIB(&burst, FIR_CAPTURE_TX_SC_NO_AUTO_CLEAR, scCounterIndex);
 		}
-		if (MSD_OK != status)
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			Fir_queueTxSCMib(&burst, data);
 		}
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_TX_SC_ENC_CAP_OFFSET, &data);
-		if (MSD_OK != status)
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetTXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = endStatus;
 		}
-		states->outPktsEncrypted = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_TX_SC_PRO_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetTXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		states->outPktsProtected = (data & 0xFFFFFFFF);
+		Fir_decodeTxSCMib(data, states);
 	}
 	return status;
 }
@@ -1098,7 +1010,9 @@ MSD_STATUS Fir_gmacsecGetRXSecYStates
 )
 {
 	MSD_STATUS status = MSD_OK;
-	MSD_U32 data = 0;
+	MSD_STATUS endStatus;
+	FIR_MACSEC_APB_BURST burst;
+	MSD_U32 data[FIR_RX_SECY_MIB_WORDS];
 	if (secYCounterIndex >= FIR_MAXMIBINDEX)
 	{
 		MSD_DBG_ERROR(("Bad secYCounterIndex: It should be within %u\n", FIR_MAXMIBINDEX));
@@ -1106,193 +1020,241 @@ MSD_STATUS Fir_gmacsecGetRXSecYStates
 	}
 	else
 	{
+		/* capture, then all counters of the index in one burst */
+		Fir_apbBurstStart(&burst, dev);
 		if (FIR_ENABLE == autoClear)
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SECY_AUTO_CLEAR, secYCounterIndex);
+			status = Operation_MIB(&burst, FIR_CAPTURE_RX_SECY_AUTO_CLEAR, secYCounterIndex);
 		}
 		else
 		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
+			status = Operation_MIB(&burst, FIR_CAPTURE_RX_SECY_NO_AUTO_CLEAR, secYCounterIndex);
 		}
-		if (MSD_OK != status)
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			Fir_queueRxSecYMib(&burst, data);
 		}
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_HICAP_OFFSET, &data);
-		if (MSD_OK != status)
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = endStatus;
 		}
-		states->inOctetsSecYControlledPort = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_LOCAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
 			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		states->inOctetsSecYControlledPort |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_HICAP_OFFSET, &data);
-		if (MSD_OK != status)
+		Fir_decodeRxSecYMib(data, states);
+	}
+	return status;
+}
+MSD_STATUS Fir_gmacsecGetRXSCStates
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U8 scCounterIndex,
+	IN FIR_AUTO_CLEAR autoClear,
+	OUT FIR_MSEC_RX_SC_COUNTER* states
+)
+{
+	MSD_STATUS status = MSD_OK;
+	MSD_STATUS endStatus;
+	FIR_MACSEC_APB_BURST burst;
+	MSD_U32 data[FIR_RX_SC_MIB_WORDS];
+	if (scCounterIndex >= FIR_MAXMIBINDEX)
+	{
+		MSD_DBG_ERROR(("Bad scCounterIndex: It should be within %u\n", FIR_MAXMIBINDEX));
+		return MSD_BAD_PARAM;
+	}
+	else
+	{
+		/* capture, then all counters of the index in one burst */
+		Fir_apbBurstStart(&burst, dev);
+		if (FIR_ENABLE == autoClear)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = Operation_MIB(&burst, FIR_CAPTURE_RX_SC_AUTO_CLEAR, scCounterIndex);
 		}
-		states->inOctetsSecYValidated = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_LOCAP_OFFSET, &data);
-		if (MSD_OK != status)
+		else
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = Operation_MIB(&burst, FIR_CAPTURE_RX_SC_NO_AUTO_CLEAR, scCounterIndex);
 		}
-		states->inOctetsSecYValidated |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_HICAP_OFFSET, &data);
-		if (MSD_OK != status)
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			Fir_queueRxSCMib(&burst, data);
 		}
-		states->inOctetsSecYDecrypted = (MSD_U64)(((MSD_U64)data & 0xFFFFFFFF) << 32);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_LOCAP_OFFSET, &data);
-		if (MSD_OK != status)
+		endStatus = Fir_apbBurstEnd(&burst);
+		if (MSD_OK == status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = endStatus;
 		}
-		states->inOctetsSecYDecrypted |= (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTUNIFR_CAP_OFFSET, &data);
 		if (MSD_OK != status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
+			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
 			return MSD_FAIL;
 		}
-		states->inPktsSecYUnicast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTMULFR_CAP_OFFSET, &data);
-		if (MSD_OK != status)
+		Fir_decodeRxSCMib(data, states);
+	}
+	return status;
+}
+
+MSD_STATUS Fir_gmacsecPollStats
+(
+	IN MSD_QD_DEV *dev,
+	INOUT FIR_MSEC_STATS_SNAPSHOT* snapshot
+)
+{
+	MSD_STATUS status = MSD_OK;
+	MSD_STATUS endStatus;
+	FIR_MACSEC_APB_BURST burst;
+	MSD_U32 txSecYData[FIR_MAXMIBINDEX][FIR_TX_SECY_MIB_WORDS];
+	MSD_U32 txSCData[FIR_MAXMIBINDEX][FIR_TX_SC_MIB_WORDS];
+	MSD_U32 rxSecYData[FIR_MAXMIBINDEX][FIR_RX_SECY_MIB_WORDS];
+	MSD_U32 rxSCData[FIR_MAXMIBINDEX][FIR_RX_SC_MIB_WORDS];
+	MSD_U32 eventData[FIR_EVENT_WORDS];
+	MSD_U32 intData = 0;
+	MSD_U16 autoRekeyInt = 0;
+	MSD_U16 saInvalidInt = 0;
+	MSD_U16 pnThrInt = 0;
+	MSD_U8 index;
+	MSD_U8 scIndex;
+	MSD_U32 i;
+	FIR_MSEC_TX_SECY_COUNTER txSecY;
+	FIR_MSEC_TX_SC_COUNTER txSC;
+	FIR_MSEC_RX_SECY_COUNTER rxSecY;
+	FIR_MSEC_RX_SC_COUNTER rxSC;
+
+	/*
+	* Capture each index and queue its counter reads without a flush, they go
+	* out with the ready poll of the next capture.
+	*/
+	Fir_apbBurstStart(&burst, dev);
+	for (index = 0; (index < FIR_MAXMIBINDEX) && (MSD_OK == status); index++)
+	{
+		if ((snapshot->txSecYMask & (1U << index)) != 0)
+		{
+			status = Operation_MIB(&burst, FIR_CAPTURE_TX_SECY_AUTO_CLEAR, index);
+			if (MSD_OK != status)
+			{
+				break;
+			}
+			Fir_queueTxSecYMib(&burst, txSecYData[index]);
+		}
+		if ((snapshot->txSCMask & (1U << index)) != 0)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = Operation_MIB(&burst, FIR_CAPTURE_TX_SC_AUTO_CLEAR, index);
+			if (MSD_OK != status)
+			{
+				break;
+			}
+			Fir_queueTxSCMib(&burst, txSCData[index]);
 		}
-		states->inPktsSecYMulticast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_CPTBRDFR_CAP_OFFSET, &data);
-		if (MSD_OK != status)
+		if ((snapshot->rxSecYMask & (1U << index)) != 0)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSecYBroadCast = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_UNTAGGED_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSecYUnTagged = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_NOTAG_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSecYNoTag = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_BADTAG_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSecYBadTag = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_NOSA_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = Operation_MIB(&burst, FIR_CAPTURE_RX_SECY_AUTO_CLEAR, index);
+			if (MSD_OK != status)
+			{
+				break;
+			}
+			Fir_queueRxSecYMib(&burst, rxSecYData[index]);
 		}
-		states->inPktsSecYNoSA = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SECY_MIB + FIR_MSEC_RX_NOSAERR_CAP_OFFSET, &data);
-		if (MSD_OK != status)
+		if ((snapshot->rxSCMask & (1U << index)) != 0)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSecYStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			status = Operation_MIB(&burst, FIR_CAPTURE_RX_SC_AUTO_CLEAR, index);
+			if (MSD_OK != status)
+			{
+				break;
+			}
+			Fir_queueRxSCMib(&burst, rxSCData[index]);
 		}
-		states->inPktsSecYNoSAErr = (data & 0xFFFFFFFF);
 	}
-	return status;
-}
-MSD_STATUS Fir_gmacsecGetRXSCStates
-(
-	IN MSD_QD_DEV *dev,
-	IN MSD_U8 scCounterIndex,
-	IN FIR_AUTO_CLEAR autoClear,
-	OUT FIR_MSEC_RX_SC_COUNTER* states
-)
-{
-	MSD_STATUS status = MSD_OK;
-	MSD_U32 data = 0;
-	if (scCounterIndex >= FIR_MAXMIBINDEX)
+	if (MSD_OK == status)
 	{
-		MSD_DBG_ERROR(("Bad scCounterIndex: It should be within %u\n", FIR_MAXMIBINDEX));
-		return MSD_BAD_PARAM;
+		Fir_queueEvent(&burst, eventData);
 	}
-	else
+
+	/* walk the pending Tx SC interrupts, auto clear moves the walk on */
+	scIndex = 0;
+	for (i = 0; (i < FIR_MAXSCINDEX) && (MSD_OK == status); i++)
 	{
-		if (FIR_ENABLE == autoClear)
-		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SC_AUTO_CLEAR, scCounterIndex);
-		}
-		else
-		{
-			status = Operation_MIB(*dev, FIR_CAPTURE_RX_SC_NO_AUTO_CLEAR, scCounterIndex);
-		}
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_OK_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSCOK = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_UNCHK_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSCUnchecked = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_DLYED_CAP_OFFSET, &data);
+		status = Operation_INT(&burst, FIR_NEXT_TX_SC_INT_AUTO_CLEAR, scIndex);
 		if (MSD_OK != status)
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSCDelayed = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_LATE_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
-		}
-		states->inPktsSCLate = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_INVLD_CAP_OFFSET, &data);
-		if (MSD_OK != status)
-		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			break;
 		}
-		states->inPktsSCInvalid = (data & 0xFFFFFFFF);
-		status = Fir_gmacsecRead(*dev, BASE_SC_MIB + FIR_MSEC_RX_SC_NOVLD_CAP_OFFSET, &data);
-		if (MSD_OK != status)
+		Fir_apbBurstRead(&burst, INT_OP_ADDR, &intData);
+		status = Fir_apbBurstFlush(&burst);
+		if ((MSD_OK != status) || (((intData & 0xF) == 0xF) && ((intData & 0x7F0000) == 0)))
 		{
-			MSD_DBG_ERROR(("FIR_MACSecGetRXSCStates function returned: %s.\n", msdDisplayStatus(status)));
-			return MSD_FAIL;
+			break;
 		}
-		states->inPktsSCNotValid = (data & 0xFFFFFFFF);
+		scIndex = (MSD_U8)(intData & 0xF);
+		autoRekeyInt |= (MSD_U16)(((intData >> 16) & 0x1) << scIndex);
+		saInvalidInt |= (MSD_U16)(((intData >> 17) & 0x1) << scIndex);
+		pnThrInt |= (MSD_U16)(((intData >> 18) & 0x1) << scIndex);
+	}
+	endStatus = Fir_apbBurstEnd(&burst);
+	if (MSD_OK == status)
+	{
+		status = endStatus;
+	}
+	if (MSD_OK != status)
+	{
+		MSD_DBG_ERROR(("FIR_MACSecPollStats function returned: %s.\n", msdDisplayStatus(status)));
+		return status;
 	}
+
+	for (index = 0; index < FIR_MAXMIBINDEX; index++)
+	{
+		if ((snapshot->txSecYMask & (1U << index)) != 0)
+		{
+			Fir_decodeTxSecYMib(txSecYData[index], &txSecY);
+			snapshot->txSecY[index].outOctetsSecYControlledPort += txSecY.outOctetsSecYControlledPort;
+			snapshot->txSecY[index].outOctetsSecYEncrypted += txSecY.outOctetsSecYEncrypted;
+			snapshot->txSecY[index].outOctetsSecYProtected += txSecY.outOctetsSecYProtected;
+			snapshot->txSecY[index].outPktsSecYUnicast += txSecY.outPktsSecYUnicast;
+			snapshot->txSecY[index].outPktsSecYMulticast += txSecY.outPktsSecYMulticast;
+			snapshot->txSecY[index].outPktSecYBroadcast += txSecY.outPktSecYBroadcast;
+			snapshot->txSecY[index].outPktsSecYuntagged += txSecY.outPktsSecYuntagged;
+			snapshot->txSecY[index].outPktsSecYTooLong += txSecY.outPktsSecYTooLong;
+			snapshot->txSecY[index].outPktsSecYNoSAError += txSecY.outPktsSecYNoSAError;
+		}
+		if ((snapshot->txSCMask & (1U << index)) != 0)
+		{
+			Fir_decodeTxSCMib(txSCData[index], &txSC);
+			snapshot->txSC[index].outPktsProtected += txSC.outPktsProtected;
+			snapshot->txSC[index].outPktsEncrypted += txSC.outPktsEncrypted;
+		}
+		if ((snapshot->rxSecYMask & (1U << index)) != 0)
+		{
+			Fir_decodeRxSecYMib(rxSecYData[index], &rxSecY);
+			snapshot->rxSecY[index].inOctetsSecYControlledPort += rxSecY.inOctetsSecYControlledPort;
+			snapshot->rxSecY[index].inOctetsSecYValidated += rxSecY.inOctetsSecYValidated;
+			snapshot->rxSecY[index].inOctetsSecYDecrypted += rxSecY.inOctetsSecYDecrypted;
+			snapshot->rxSecY[index].inPktsSecYUnicast += rxSecY.inPktsSecYUnicast;
+			snapshot->rxSecY[index].inPktsSecYMulticast += rxSecY.inPktsSecYMulticast;
+			snapshot->rxSecY[index].inPktsSecYBroadCast += rxSecY.inPktsSecYBroadCast;
+			snapshot->rxSecY[index].inPktsSecYUnTagged += rxSecY.inPktsSecYUnTagged;
+			snapshot->rxSecY[index].inPktsSecYNoTag += rxSecY.inPktsSecYNoTag;
+			snapshot->rxSecY[index].inPktsSecYBadTag += rxSecY.inPktsSecYBadTag;
+			snapshot->rxSecY[index].inPktsSecYNoSA += rxSecY.inPktsSecYNoSA;
+			snapshot->rxSecY[index].inPktsSecYNoSAErr += rxSecY.inPktsSecYNoSAErr;
+		}
+		if ((snapshot->rxSCMask & (1U << index)) != 0)
+		{
+			Fir_decodeRxSCMib(rxSCData[index], &rxSC);
+			snapshot->rxSC[index].inPktsSCLate += rxSC.inPktsSCLate;
+			snapshot->rxSC[index].inPktsSCNotValid += rxSC.inPktsSCNotValid;
+			snapshot->rxSC[index].inPktsSCInvalid += rxSC.inPktsSCInvalid;
+			snapshot->rxSC[index].inPktsSCDelayed += rxSC.inPktsSCDelayed;
+			snapshot->rxSC[index].inPktsSCUnchecked += rxSC.inPktsSCUnchecked;
+			snapshot->rxSC[index].inPktsSCOK += rxSC.inPktsSCOK;
+		}
+	}
+	Fir_decodeEvent(eventData, &(snapshot->event));
+	snapshot->txSCAutoRekeyInt = autoRekeyInt;
+	snapshot->txSCSAInvalidInt = saInvalidInt;
+	snapshot->txSCPNThrInt = pnThrInt;
+	snapshot->numPolls++;
+	snapshot->timeStamp = (dev->getTime != NULL) ? dev->getTime() : 0U;
 	return status;
 }
 MSD_STATUS Fir_gmacsecSetTxPNThreshold
@@ -1304,7 +1266,7 @@ MSD_STATUS Fir_gmacsecSetTxPNThreshold
 	MSD_STATUS status = MSD_OK;
 	MSD_U32 regAddr = 0;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecWrite(*dev, regAddr, (MSD_U32)pnThr & 0xFFFFFFFF); 
+	status = Fir_gmacsecWrite(dev, regAddr, (MSD_U32)pnThr & 0xFFFFFFFF); 
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetTxPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
@@ -1322,7 +1284,7 @@ MSD_STATUS Fir_gmacsecGetTxPNThreshold
 	MSD_U32 regAddr = 0;
 	MSD_U32 data = 0;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecRead(*dev, regAddr, &data); 
+	status = Fir_gmacsecRead(dev, regAddr, &data); 
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetTxPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
@@ -1339,14 +1301,12 @@ MSD_STATUS Fir_gmacsecSetTxXPNThreshold
 {
 	MSD_STATUS status = MSD_OK;
 	MSD_U32 regAddr = 0;
+	FIR_MACSEC_APB_BURST burst;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecWrite(*dev, regAddr + 8, (MSD_U32)xpnThr & 0xFFFFFFFF);
-	if (MSD_OK != status)
-	{
-		MSD_DBG_ERROR(("FIR_MACSecSetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
-		return MSD_FAIL;
-	}
-	status = Fir_gmacsecWrite(*dev, regAddr + 4, (MSD_U32)(xpnThr >> 32) & 0xFFFFFFFF);
+	Fir_apbBurstStart(&burst, dev);
+	Fir_apbBurstWrite(&burst, regAddr + 8, (MSD_U32)xpnThr & 0xFFFFFFFF);
+	Fir_apbBurstWrite(&burst, regAddr + 4, (MSD_U32)(xpnThr >> 32) & 0xFFFFFFFF);
+	status = Fir_apbBurstEnd(&burst);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
@@ -1362,22 +1322,20 @@ MSD_STATUS Fir_gmacsecGetTxXPNThreshold
 {
 	MSD_STATUS status = MSD_OK;
 	MSD_U32 regAddr = 0;
-	MSD_U32 data = 0;
+	MSD_U32 dataLow = 0;
+	MSD_U32 dataHigh = 0;
+	FIR_MACSEC_APB_BURST burst;
 	regAddr = BASE_TXNEXTPN_THR;
-	status = Fir_gmacsecRead(*dev, regAddr + 8, &data);
+	Fir_apbBurstStart(&burst, dev);
+	Fir_apbBurstRead(&burst, regAddr + 8, &dataLow);
+	Fir_apbBurstRead(&burst, regAddr + 4, &dataHigh);
+	status = Fir_apbBurstEnd(&burst);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
-	*xpnThr = (MSD_U64)data;
-	status = Fir_gmacsecRead(*dev, regAddr + 4, &data);
-	if (MSD_OK != status)
-	{
-		MSD_DBG_ERROR(("FIR_MACSecGetTxXPNThreshold function returned: %s.\n", msdDisplayStatus(status)));
-		return MSD_FAIL;
-	}
-	*xpnThr = (*xpnThr) | ((MSD_U64)data << 32);
+	*xpnThr = (MSD_U64)dataLow | ((MSD_U64)dataHigh << 32);
 	return status;
 }
 MSD_STATUS Fir_gmacsecSetRxDefaultSCI
@@ -1389,19 +1347,17 @@ MSD_STATUS Fir_gmacsecSetRxDefaultSCI
 {
 	MSD_STATUS status = MSD_OK;
 	MSD_U32 regAddr = 0;
+	FIR_MACSEC_APB_BURST burst;
 	if (!((portNum <= 7) && (portNum >= 1)))
 	{
 		MSD_DBG_ERROR(("Bad Port: %u. It should be within [1,7]\n", (unsigned int)portNum));
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_DEFRXSCI + (portNum << 7);
-	status = Fir_gmacsecWrite(*dev, regAddr, (MSD_U32)((defaultRxSCI >> 32) & 0xFFFFFFFF));
-	if (MSD_OK != status)
-	{
-		MSD_DBG_ERROR(("FIR_MACSecSetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
-		return MSD_FAIL;
-	}
-	status = Fir_gmacsecWrite(*dev, regAddr + 4, (MSD_U32)defaultRxSCI & 0xFFFFFFFF);
+	Fir_apbBurstStart(&burst, dev);
+	Fir_apbBurstWrite(&burst, regAddr, (MSD_U32)((defaultRxSCI >> 32) & 0xFFFFFFFF));
+	Fir_apbBurstWrite(&burst, regAddr + 4, (MSD_U32)defaultRxSCI & 0xFFFFFFFF);
+	status = Fir_apbBurstEnd(&burst);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecSetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
@@ -1418,27 +1374,25 @@ MSD_STATUS Fir_gmacsecGetRxDefaultSCI
 {
 	MSD_STATUS status = MSD_OK;
 	MSD_U32 regAddr = 0;
-	MSD_U32 data = 0;
+	MSD_U32 dataHigh = 0;
+	MSD_U32 dataLow = 0;
+	FIR_MACSEC_APB_BURST burst;
 	if (!((portNum <= 7) && (portNum >= 1)))
 	{
 		MSD_DBG_ERROR(("Bad Port: %u. It should be within [1,7]\n", (unsigned int)portNum));
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_DEFRXSCI + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
-	if (MSD_OK != status)
-	{
-		MSD_DBG_ERROR(("FIR_MACSecGetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
-		return MSD_FAIL;
-	}
-	*defaultRxSCI = (MSD_U64)data << 32;
-	status = Fir_gmacsecRead(*dev, regAddr + 4, &data);
+	Fir_apbBurstStart(&burst, dev);
+	Fir_apbBurstRead(&burst, regAddr, &dataHigh);
+	Fir_apbBurstRead(&burst, regAddr + 4, &dataLow);
+	status = Fir_apbBurstEnd(&burst);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecGetRxDefaultSCI function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
-	*defaultRxSCI = (*defaultRxSCI) | (MSD_U64)data;
+	*defaultRxSCI = ((MSD_U64)dataHigh << 32) | (MSD_U64)dataLow;
 	return status;
 }
 
@@ -1450,8 +1404,10 @@ MSD_STATUS Fir_gmacsecSetTxSCIntCtrl
 )
 {
 	MSD_STATUS status = MSD_OK;
+	MSD_STATUS endStatus;
 	MSD_U32 regAddr;
 	MSD_U32 tempData;
+	FIR_MACSEC_APB_BURST burst;
 	tempData = 0;
 
 	if (index >= FIR_MAXSCINDEX)
@@ -1459,39 +1415,39 @@ MSD_STATUS Fir_gmacsecSetTxSCIntCtrl
 		MSD_DBG_ERROR(("Bad SC Index: It should be within %u\n", FIR_MAXSCINDEX));
 		return MSD_BAD_PARAM;
 	}
+	Fir_apbBurstStart(&burst, dev);
+
 	/* Global enable TXSC Interrupt.*/
-	tempData = Fir_gmacsecRead(*dev, GLOBAL_CTRL_ADDR, &tempData);
-	tempData = (tempData | (0x1 << 19));
-	status = Fir_gmacsecWrite(*dev, GLOBAL_CTRL_ADDR, tempData);
+	Fir_apbBurstRead(&burst, GLOBAL_CTRL_ADDR, &tempData);
+	status = Fir_apbBurstFlush(&burst);
+	if (status == MSD_OK)
+	{
+		Fir_apbBurstWrite(&burst, GLOBAL_CTRL_ADDR, tempData | (0x1 << 19));
 
-	regAddr = BASE_TX_SC + 0x14;
-	tempData = (txscIntCtrl->txPNThrIntEn << 18) + (txscIntCtrl->txSAInvalidIntEn << 17) + (txscIntCtrl->txAutoRekeyIntEn << 16);
-	status = Fir_gmacsecWrite(*dev, regAddr, tempData);
+		regAddr = BASE_TX_SC + 0x14;
+		tempData = (txscIntCtrl->txPNThrIntEn << 18) + (txscIntCtrl->txSAInvalidIntEn << 17) + (txscIntCtrl->txAutoRekeyIntEn << 16);
+		Fir_apbBurstWrite(&burst, regAddr, tempData);
 
-	regAddr = BASE_TX_SC;
-	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
-	if (status != MSD_OK)
-	{
-		msdSemGive(dev->devNum, dev->tblRegsSem);
-		return status;
+		regAddr = BASE_TX_SC;
+		/*Wait until the tcam in ready. */
+		status = Fir_WaitOperationReady(&burst, regAddr);
 	}
+	if (status == MSD_OK)
+	{
+		tempData = (MSD_U32)((1 << 15) | (FIR_MACSec_LOAD_ENTRY << 12) | index);
+		Fir_apbBurstWrite(&burst, regAddr, tempData);
 
-	tempData = (MSD_U32)((1 << 15) | (FIR_MACSec_LOAD_ENTRY << 12) | index);
-	status = Fir_gmacsecWrite(*dev, regAddr, tempData);
-	if (status != MSD_OK)
+		/*Wait until the tcam in ready. */
+		status = Fir_WaitOperationReady(&burst, regAddr);
+	}
+	endStatus = Fir_apbBurstEnd(&burst);
+	if (status == MSD_OK)
 	{
-		msdSemGive(dev->devNum, dev->tblRegsSem);
-		MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(status)));
-		return status;
+		status = endStatus;
 	}
-
-	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
 	if (status != MSD_OK)
 	{
-		msdSemGive(dev->devNum, dev->tblRegsSem);
-		return status;
+		MSD_DBG_ERROR(("FIR_MACSecSetTxSCIntCtrl function returned: %s.\n", msdDisplayStatus(status)));
 	}
 	return status;
 }
@@ -1504,9 +1460,11 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrl
 )
 {
 	MSD_STATUS status = MSD_OK;
+	MSD_STATUS endStatus;
 	MSD_U32 regAddr;
 	MSD_U32 data = 0;
 	MSD_U32 tempData;
+	FIR_MACSEC_APB_BURST burst;
 	
 	if (index >= FIR_MAXSCINDEX)
 	{
@@ -1514,35 +1472,32 @@ MSD_STATUS Fir_gmacsecGetTxSCIntCtrl
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_TX_SC;
+	Fir_apbBurstStart(&burst, dev);
 
 	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
-	if (status != MSD_OK)
+	status = Fir_WaitOperationReady(&burst, regAddr);
+	if (status == MSD_OK)
 	{
-		msdSemGive(dev->devNum, dev->tblRegsSem);
-		return status;
-	}
+		tempData = (MSD_U32)((1 << 15) | (FIR_MACSec_READ_ENTRY << 12) | index);
+		Fir_apbBurstWrite(&burst, regAddr, tempData);
 
-	tempData = 0;
-	tempData = (MSD_U32)((1 << 15) | (FIR_MACSec_READ_ENTRY << 12) | index);
-	status = Fir_gmacsecWrite(*dev, regAddr, tempData);
-	if (status != MSD_OK)
+		/*Wait until the tcam in ready. */
+		status = Fir_WaitOperationReady(&burst, regAddr);
+	}
+	if (status == MSD_OK)
 	{
-		msdSemGive(dev->devNum, dev->tblRegsSem);
-		MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(status)));
-		return status;
+		Fir_apbBurstRead(&burst, BASE_TX_SC + 0x14, &data);
+	}
+	endStatus = Fir_apbBurstEnd(&burst);
+	if (status == MSD_OK)
+	{
+		status = endStatus;
 	}
-
-	/*Wait until the tcam in ready. */
-	status = Fir_WaitOperationReady(*dev, regAddr);
 	if (status != MSD_OK)
 	{
-		msdSemGive(dev->devNum, dev->tblRegsSem);
+		MSD_DBG_ERROR(("FIR_MACSecGetTxSCIntCtrl function returned: %s.\n", msdDisplayStatus(status)));
 		return status;
 	}
-
-	regAddr = BASE_TX_SC + 0x14;
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
 	txscIntCtrl->txPNThrIntEn = (MSD_BOOL)((data>>18)&1);
 	txscIntCtrl->txSAInvalidIntEn = (MSD_BOOL)((data >> 17) & 1);
 	txscIntCtrl->txAutoRekeyIntEn = (MSD_BOOL)((data >> 16) & 1);
@@ -1561,8 +1516,10 @@ MSD_STATUS Fir_gmacsecGetNextTxSCIntStatus
 )
 {
 	MSD_STATUS status = MSD_OK;
+	MSD_STATUS endStatus;
 	MSD_U32 data = 0;
 	FIR_MACSec_INT_OPERATION opMode;
+	FIR_MACSEC_APB_BURST burst;
 	msdMemSet(txscInt, 0, sizeof(FIR_MACSEC_INT_TXSC));
 
 	if (index >= FIR_MAXSCINDEX)
@@ -1578,8 +1535,22 @@ MSD_STATUS Fir_gmacsecGetNextTxSCIntStatus
 	{
 		opMode = FIR_NEXT_TX_SC_INT_NO_AUTO_CLEAR;
 	}
-	status = Operation_INT(*dev, opMode, index);
-	status = Fir_gmacsecRead(*dev, INT_OP_ADDR, &data);
+	Fir_apbBurstStart(&burst, dev);
+	status = Operation_INT(&burst, opMode, index);
+	if (status == MSD_OK)
+	{
+		Fir_apbBurstRead(&burst, INT_OP_ADDR, &data);
+	}
+	endStatus = Fir_apbBurstEnd(&burst);
+	if (status == MSD_OK)
+	{
+		status = endStatus;
+	}
+	if (status != MSD_OK)
+	{
+		MSD_DBG_ERROR(("FIR_MACSecGetNextTxSCIntStatus function returned: %s.\n", msdDisplayStatus(status)));
+		return status;
+	}
 	if ((data & 0xF) == 0xF && (data & 0x7F0000) == 0)
 	{
 		return MSD_NO_SUCH;
@@ -1610,14 +1581,14 @@ MSD_STATUS Fir_gmacsecEnableIngressSet
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_RXPortCTRL + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecRead function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
 	data = (isEnable << 31) | (data & 0x7FFFFFFF);
-	status = Fir_gmacsecWrite(*dev, regAddr, data & 0xFFFFFFFF);
+	status = Fir_gmacsecWrite(dev, regAddr, data & 0xFFFFFFFF);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
@@ -1642,14 +1613,14 @@ MSD_STATUS Fir_gmacsecEnableEgressSet
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_TXPortCTRL + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecRead function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
 	data = (isEnable << 31) | (data & 0x7FFFFFFF);
-	status = Fir_gmacsecWrite(*dev, regAddr, data & 0xFFFFFFFF);
+	status = Fir_gmacsecWrite(dev, regAddr, data & 0xFFFFFFFF);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function returned: %s.\n", msdDisplayStatus(status)));
@@ -1674,7 +1645,7 @@ MSD_STATUS Fir_gmacsecEnableIngressGet
 		return MSD_BAD_PARAM;
 	}
 	regAddr = BASE_RXPortCTRL + (portNum << 7);
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function returned: %s.\n", msdDisplayStatus(status)));
@@ -1701,7 +1672,7 @@ MSD_STATUS Fir_gmacsecEnableEgressGet
 	}
 	regAddr = BASE_TXPortCTRL + (portNum << 7);	
 	
-	status = Fir_gmacsecRead(*dev, regAddr, &data);
+	status = Fir_gmacsecRead(dev, regAddr, &data);
 	if (MSD_OK != status)
 	{
 		MSD_DBG_ERROR(("FIR_MACSecEnableSet function returned: %s.\n", msdDisplayStatus(status)));
@@ -1718,56 +1689,34 @@ MSD_STATUS Fir_gmacsecGetEvent
 )
 {
 	MSD_STATUS status = MSD_OK;
-	MSD_U32 regAddr = 0;
-	MSD_U32 temp0 = 0;
-	MSD_U32 temp1 = 0;
-	MSD_U32 temp2 = 0;
-	regAddr = GLOBAL_CTRL_ADDR;
+	MSD_U32 data[FIR_EVENT_WORDS];
+	FIR_MACSEC_APB_BURST burst;
 
 	/* get the EVENT VALUE */
-	status = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_ECC_ERR_EVTS_OFFSET, &temp0);
-	if (MSD_OK != status)
-	{
-		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
-		return MSD_FAIL;
-	}
-	status = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_ECC_MISMAC_EVTS_OFFSET, &temp1);
-	if (MSD_OK != status)
-	{
-		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
-		return MSD_FAIL;
-	}
-	status = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_SMS_RPE_EVTS_OFFSET, &temp2);
+	Fir_apbBurstStart(&burst, dev);
+	Fir_queueEvent(&burst, data);
+	status = Fir_apbBurstEnd(&burst);
 	if (MSD_OK != status)
 	{
-		MSD_DBG_ERROR(("FIR_MACSecEnableSet function MPDU returned: %s.\n", msdDisplayStatus(status)));
+		MSD_DBG_ERROR(("FIR_MACSecGetEvent function returned: %s.\n", msdDisplayStatus(status)));
 		return MSD_FAIL;
 	}
-	event->msecCECCErrEvent = (MSD_U32)((temp0 >> 16) & 0x1FF);
-	event->msecUCECCErrEvent = (MSD_U32)(temp0 & 0x1FF);
-	event->msecCECCErrInjectMisEvent = (MSD_U32)((temp1 >> 16) & 0x1FF);
-	event->msecCECCOutMisEvent = (MSD_U32)(temp1 & 0x1FF);
-	event->msecRegParityErrEvent = (MSD_BOOL)((temp2 >> 16) & 0x1);
-	event->msecCECCErrEvent = (MSD_U32)(temp2 & 0x1FF);
+	Fir_decodeEvent(data, event);
 	return status;
 }
 
-static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV dev, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index)
+static MSD_STATUS Operation_MIB(INOUT FIR_MACSEC_APB_BURST* burst, IN FIR_MACSec_MIB_OPERATION opCode, IN MSD_U8 MIB_Index)
 {
 	MSD_STATUS retVal = MSD_OK;
-	retVal = Fir_WaitOperationReady(dev, MIB_OP_ADDR);
+	retVal = Fir_WaitOperationReady(burst, MIB_OP_ADDR);
 	if (retVal != MSD_OK)
 	{
 		MSD_DBG_ERROR(("Operation_MIB function returned: %s.\n", msdDisplayStatus(retVal)));
 		return retVal;
 	}
-	retVal = Fir_gmacsecWrite(dev, MIB_OP_ADDR, (1 << 15) | (opCode << 11) | (MIB_Index));
-	if (retVal != MSD_OK)
-	{
-		MSD_DBG_ERROR(("Operation_MIB function returned: %s.\n", msdDisplayStatus(retVal)));
-	}
+	Fir_apbBurstWrite(burst, MIB_OP_ADDR, (1 << 15) | (opCode << 11) | (MIB_Index));
 
-	retVal = Fir_WaitOperationReady(dev, MIB_OP_ADDR);
+	retVal = Fir_WaitOperationReady(burst, MIB_OP_ADDR);
 	if (retVal != MSD_OK)
 	{
 		MSD_DBG_ERROR(("Operation_MIB function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -1775,21 +1724,17 @@ static MSD_STATUS Operation_MIB(IN  MSD_QD_DEV dev, IN FIR_MACSec_MIB_OPERATION
 	}
 	return retVal;
 }
-static MSD_STATUS Operation_INT(IN  MSD_QD_DEV dev, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 Index)
+static MSD_STATUS Operation_INT(INOUT FIR_MACSEC_APB_BURST* burst, IN FIR_MACSec_INT_OPERATION opCode, IN MSD_U8 Index)
 {
 	MSD_STATUS retVal = MSD_OK;
-	retVal = Fir_WaitOperationReady(dev, INT_OP_ADDR);
+	retVal = Fir_WaitOperationReady(burst, INT_OP_ADDR);
 	if (retVal != MSD_OK)
 	{
 		MSD_DBG_ERROR(("Operation_INT function returned: %s.\n", msdDisplayStatus(retVal)));
 		return retVal;
 	}
-	retVal = Fir_gmacsecWrite(dev, INT_OP_ADDR, (1 << 15) | (opCode << 11) | (Index));
-	if (retVal != MSD_OK)
-	{
-		MSD_DBG_ERROR(("Operation_INT function returned: %s.\n", msdDisplayStatus(retVal)));
-	}
-	retVal = Fir_WaitOperationReady(dev, INT_OP_ADDR);
+	Fir_apbBurstWrite(burst, INT_OP_ADDR, (1 << 15) | (opCode << 11) | (Index));
+	retVal = Fir_WaitOperationReady(burst, INT_OP_ADDR);
 	if (retVal != MSD_OK)
 	{
 		MSD_DBG_ERROR(("Operation_INT function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -1797,55 +1742,323 @@ static MSD_STATUS Operation_INT(IN  MSD_QD_DEV dev, IN FIR_MACSec_INT_OPERATION
 	}
 	return retVal;
 }
-/*MACSec interrupt*/
-static MSD_STATUS Operation_APB(IN  MSD_QD_DEV dev, IN FIR_MACSec_APB_OPERATION opCode, IN FIR_RW_OP rwOp, INOUT MSD_U8* value)
+
+static void Fir_queueTxSecYMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data)
 {
-	MSD_STATUS retVal = MSD_OK;
-	MSD_U16 tempData = 0;
-	if (rwOp == FIR_APB_READ)
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_HICAP_OFFSET, &data[0]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_CPTOCT_LOCAP_OFFSET, &data[1]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_HICAP_OFFSET, &data[2]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_ENCOCT_LOCAP_OFFSET, &data[3]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_HICAP_OFFSET, &data[4]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_PROOCT_LOCAP_OFFSET, &data[5]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_CPTUNIFR_CAP_OFFSET, &data[6]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_CPTMULFR_CAP_OFFSET, &data[7]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_CPTBRDFR_CAP_OFFSET, &data[8]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_UNTAG_CAP_OFFSET, &data[9]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_TOOLONG_CAP_OFFSET, &data[10]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_TX_NOSAERROR_CAP_OFFSET, &data[11]);
+}
+
+static void Fir_decodeTxSecYMib(IN MSD_U32* data, OUT FIR_MSEC_TX_SECY_COUNTER* states)
+{
+	states->outOctetsSecYControlledPort = ((MSD_U64)data[0] << 32) | (MSD_U64)data[1];
+	states->outOctetsSecYEncrypted = ((MSD_U64)data[2] << 32) | (MSD_U64)data[3];
+	states->outOctetsSecYProtected = ((MSD_U64)data[4] << 32) | (MSD_U64)data[5];
+	states->outPktsSecYUnicast = data[6];
+	states->outPktsSecYMulticast = data[7];
+	states->outPktSecYBroadcast = data[8];
+	states->outPktsSecYuntagged = data[9];
+	states->outPktsSecYTooLong = data[10];
+	states->outPktsSecYNoSAError = data[11];
+}
+
+static void Fir_queueTxSCMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data)
+{
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_TX_SC_ENC_CAP_OFFSET, &data[0]);
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_TX_SC_PRO_CAP_OFFSET, &data[1]);
+}
+
+static void Fir_decodeTxSCMib(IN MSD_U32* data, OUT FIR_MSEC_TX_SC_COUNTER* states)
+{
+	states->outPktsEncrypted = data[0];
+	states->outPktsProtected = data[1];
+}
+
+static void Fir_queueRxSecYMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data)
+{
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_HICAP_OFFSET, &data[0]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_CPTOCT_LOCAP_OFFSET, &data[1]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_HICAP_OFFSET, &data[2]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_VLDOCT_LOCAP_OFFSET, &data[3]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_HICAP_OFFSET, &data[4]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_DECOCT_LOCAP_OFFSET, &data[5]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_CPTUNIFR_CAP_OFFSET, &data[6]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_CPTMULFR_CAP_OFFSET, &data[7]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_CPTBRDFR_CAP_OFFSET, &data[8]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_UNTAGGED_CAP_OFFSET, &data[9]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_NOTAG_CAP_OFFSET, &data[10]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_BADTAG_CAP_OFFSET, &data[11]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_NOSA_CAP_OFFSET, &data[12]);
+	Fir_apbBurstRead(burst, BASE_SECY_MIB + FIR_MSEC_RX_NOSAERR_CAP_OFFSET, &data[13]);
+}
+
+static void Fir_decodeRxSecYMib(IN MSD_U32* data, OUT FIR_MSEC_RX_SECY_COUNTER* states)
+{
+	states->inOctetsSecYControlledPort = ((MSD_U64)data[0] << 32) | (MSD_U64)data[1];
+	states->inOctetsSecYValidated = ((MSD_U64)data[2] << 32) | (MSD_U64)data[3];
+	states->inOctetsSecYDecrypted = ((MSD_U64)data[4] << 32) | (MSD_U64)data[5];
+	states->inPktsSecYUnicast = data[6];
+	states->inPktsSecYMulticast = data[7];
+	states->inPktsSecYBroadCast = data[8];
+	states->inPktsSecYUnTagged = data[9];
+	states->inPktsSecYNoTag = data[10];
+	states->inPktsSecYBadTag = data[11];
+	states->inPktsSecYNoSA = data[12];
+	states->inPktsSecYNoSAErr = data[13];
+}
+
+static void Fir_queueRxSCMib(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data)
+{
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_RX_SC_OK_CAP_OFFSET, &data[0]);
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_RX_SC_UNCHK_CAP_OFFSET, &data[1]);
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_RX_SC_DLYED_CAP_OFFSET, &data[2]);
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_RX_SC_LATE_CAP_OFFSET, &data[3]);
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_RX_SC_INVLD_CAP_OFFSET, &data[4]);
+	Fir_apbBurstRead(burst, BASE_SC_MIB + FIR_MSEC_RX_SC_NOVLD_CAP_OFFSET, &data[5]);
+}
+
+static void Fir_decodeRxSCMib(IN MSD_U32* data, OUT FIR_MSEC_RX_SC_COUNTER* states)
+{
+	states->inPktsSCOK = data[0];
+	states->inPktsSCUnchecked = data[1];
+	states->inPktsSCDelayed = data[2];
+	states->inPktsSCLate = data[3];
+	states->inPktsSCInvalid = data[4];
+	states->inPktsSCNotValid = data[5];
+}
+
+static void Fir_queueEvent(INOUT FIR_MACSEC_APB_BURST* burst, OUT MSD_U32* data)
+{
+	Fir_apbBurstRead(burst, GLOBAL_CTRL_ADDR + FIR_MSEC_ECC_ERR_EVTS_OFFSET, &data[0]);
+	Fir_apbBurstRead(burst, GLOBAL_CTRL_ADDR + FIR_MSEC_ECC_MISMAC_EVTS_OFFSET, &data[1]);
+	Fir_apbBurstRead(burst, GLOBAL_CTRL_ADDR + FIR_MSEC_SMS_RPE_EVTS_OFFSET, &data[2]);
+}
+
+static void Fir_decodeEvent(IN MSD_U32* data, OUT FIR_MSEC_EVENT* event)
+{
+	event->msecCECCErrEvent = (MSD_U32)((data[0] >> 16) & 0x1FF);
+	event->msecUCECCErrEvent = (MSD_U32)(data[0] & 0x1FF);
+	event->msecCECCErrInjectMisEvent = (MSD_U32)((data[1] >> 16) & 0x1FF);
+	event->msecCECCOutMisEvent = (MSD_U32)(data[1] & 0x1FF);
+	event->msecRegParityErrEvent = (MSD_BOOL)((data[2] >> 16) & 0x1);
+	event->msecCECCErrEvent = (MSD_U32)(data[2] & 0x1FF);
+}
+
+/*APB burst*/
+static void Fir_apbBurstStart(OUT FIR_MACSEC_APB_BURST* burst, IN MSD_QD_DEV* dev)
+{
+	burst->dev = dev;
+	burst->status = MSD_OK;
+	burst->nCmd = 0;
+	burst->nRead = 0;
+	burst->addr = 0;
+	burst->addrValid = MSD_FALSE;
+	burst->opReady = 0;
+	msdSemTake(dev->devNum, dev->apbRegsSem, OS_WAIT_FOREVER);
+}
+
+static MSD_STATUS Fir_apbBurstEnd(INOUT FIR_MACSEC_APB_BURST* burst)
+{
+	MSD_STATUS retVal;
+	retVal = Fir_apbBurstFlush(burst);
+	msdSemGive(burst->dev->devNum, burst->dev->apbRegsSem);
+	return retVal;
+}
+
+static void Fir_apbBurstAdd(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U8 isWaitOnBit, IN MSD_U8 opCode, IN MSD_U16 data)
+{
+	MSD_RegCmd *cmd = &burst->regCmd[burst->nCmd];
+	cmd->isWaitOnBit = isWaitOnBit;
+	cmd->opCode = opCode;
+	cmd->devAddr = (MSD_U8)APB_PHYADDR;
+	cmd->regAddr = (MSD_U8)APB_REGADDR;
+	cmd->data = data;
+	burst->nCmd++;
+}
+
+/* Point the bridge at the transfer control byte and wait for bit 7 (busy) to clear */
+static void Fir_apbBurstWaitReady(INOUT FIR_MACSEC_APB_BURST* burst)
+{
+	Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U16)(FIR_TRANSFER_CONTROL << 8));
+	Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, 7);
+}
+
+/* The bridge keeps its address bytes, only the ones that changed are written */
+static void Fir_apbBurstAddress(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U32 regAddr)
+{
+	MSD_U32 i;
+	MSD_U16 byte;
+	for (i = 0; i < 4U; i++)
 	{
-		tempData = (opCode & 0x7F) << 8;
-		retVal = msdSetAnyReg(dev.devNum, APB_PHYADDR, APB_REGADDR, tempData);
-		if (retVal != MSD_OK)
+		byte = (MSD_U16)((regAddr >> (8U * i)) & 0xFFU);
+		if ((burst->addrValid == MSD_TRUE) && (((burst->addr >> (8U * i)) & 0xFFU) == byte))
 		{
-			MSD_DBG_ERROR(("Operation_APB function returned: %s.\n", msdDisplayStatus(retVal)));
+			continue;
 		}
-		else
+		Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE,
+			(MSD_U16)(0x8000U | ((MSD_U16)(FIR_ADDRESS_B0 + i) << 8) | byte));
+	}
+	burst->addr = regAddr;
+	burst->addrValid = MSD_TRUE;
+}
+
+/*
+* Operation registers whose busy bit 15 the burst may remember as clear.
+* Only this driver starts operations and it holds apbRegsSem for the whole
+* burst, so a register stays idle until the burst itself writes bit 15.
+*/
+static MSD_U32 Fir_apbOpMask(IN MSD_U32 regAddr)
+{
+	static const MSD_U32 opRegs[] = { BASE_TCAM, BASE_TCAM_ACTION, BASE_RX_SECY, BASE_TX_SECY, BASE_RX_SC,
+		BASE_TX_SC, BASE_RX_SA, BASE_TX_SA, BASE_SAK, MIB_OP_ADDR, INT_OP_ADDR };
+	MSD_U32 i;
+	for (i = 0; i < sizeof(opRegs) / sizeof(opRegs[0]); i++)
+	{
+		if (opRegs[i] == regAddr)
 		{
-			retVal = msdGetAnyReg(dev.devNum, APB_PHYADDR, APB_REGADDR, &tempData);
-			if (retVal != MSD_OK)
+			return (MSD_U32)1 << i;
+		}
+	}
+	return 0;
+}
+
+static MSD_STATUS Fir_apbBurstWrite(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U32 regAddr, IN MSD_U32 data)
+{
+	MSD_U32 i;
+	if ((burst->status == MSD_OK) && (burst->nCmd + APB_BURST_WRITE_CMDS > MSD_RMU_MAX_REGCMDS))
+	{
+		Fir_apbBurstFlush(burst);
+	}
+	if (burst->status != MSD_OK)
+	{
+		return burst->status;
+	}
+	if ((data & 0x8000U) != 0U)
+	{
+		burst->opReady &= ~Fir_apbOpMask(regAddr);
+	}
+
+	Fir_apbBurstWaitReady(burst);
+	Fir_apbBurstAddress(burst, regAddr);
+	for (i = 0; i < 4U; i++)
+	{
+		Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE,
+			(MSD_U16)(0x8000U | ((MSD_U16)(FIR_DATA_B0 + i) << 8) | (MSD_U16)((data >> (8U * i)) & 0xFFU)));
+	}
+	/* start write transfer */
+	Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U16)(0x8000U | (FIR_TRANSFER_CONTROL << 8) | 0x83U));
+	return burst->status;
+}
+
+static MSD_STATUS Fir_apbBurstRead(INOUT FIR_MACSEC_APB_BURST* burst, IN MSD_U32 regAddr, OUT MSD_U32* data)
+{
+	MSD_U32 i;
+	if ((burst->status == MSD_OK) &&
+		((burst->nCmd + APB_BURST_READ_CMDS > MSD_RMU_MAX_REGCMDS) || (burst->nRead >= APB_BURST_MAX_READS)))
+	{
+		Fir_apbBurstFlush(burst);
+	}
+	if (burst->status != MSD_OK)
+	{
+		return burst->status;
+	}
+
+	Fir_apbBurstWaitReady(burst);
+	Fir_apbBurstAddress(burst, regAddr);
+	/* start read transfer, data bytes are valid once it completes */
+	Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U16)(0x8000U | (FIR_TRANSFER_CONTROL << 8) | 0x82U));
+	Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_TRUE, MSD_RMU_WAIT_ON_BIT_VAL0, 7);
+
+	burst->readData[burst->nRead] = data;
+	burst->readIndex[burst->nRead] = burst->nCmd;
+	burst->nRead++;
+	for (i = 0; i < 4U; i++)
+	{
+		Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U16)((FIR_DATA_B0 + i) << 8));
+		Fir_apbBurstAdd(burst, MSD_RMU_WAIT_ON_BIT_FALSE, MSD_RMU_REQ_OPCODE_READ, 0);
+	}
+	return burst->status;
+}
+
+/* Run the queued commands, in one RMU frame when available, and fill in the read data */
+static MSD_STATUS Fir_apbBurstFlush(INOUT FIR_MACSEC_APB_BURST* burst)
+{
+	MSD_QD_DEV *dev = burst->dev;
+	MSD_RegCmd *pRegCmd = burst->regCmd;
+	MSD_RegCmd *cmd;
+	MSD_U32 i, j;
+	MSD_U32 value;
+	MSD_U16 tempData;
+
+	if ((burst->status != MSD_OK) || (burst->nCmd == 0U))
+	{
+		burst->nCmd = 0;
+		burst->nRead = 0;
+		return burst->status;
+	}
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		burst->status = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, burst->nCmd);
+		if (burst->status != MSD_OK)
+		{
+			MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(burst->status)));
+		}
+	}
+	else
+	{
+		for (i = 0; (i < burst->nCmd) && (burst->status == MSD_OK); i++)
+		{
+			cmd = &burst->regCmd[i];
+			if (cmd->isWaitOnBit == MSD_RMU_WAIT_ON_BIT_TRUE)
+			{
+				do
+				{
+					burst->status = msdGetAnyRegField(dev->devNum, cmd->devAddr, cmd->regAddr, (MSD_U8)cmd->data, 1, &tempData);
+				} while ((burst->status == MSD_OK) && (tempData != (MSD_U16)((cmd->opCode == MSD_RMU_WAIT_ON_BIT_VAL0) ? 0 : 1)));
+			}
+			else if (cmd->opCode == MSD_RMU_REQ_OPCODE_WRITE)
 			{
-				MSD_DBG_ERROR(("Operation_APB function returned: %s.\n", msdDisplayStatus(retVal)));
+				burst->status = msdSetAnyReg(dev->devNum, cmd->devAddr, cmd->regAddr, cmd->data);
+			}
+			else
+			{
+				burst->status = msdGetAnyReg(dev->devNum, cmd->devAddr, cmd->regAddr, &cmd->data);
 			}
-			*value = tempData & 0xFF;
+		}
+		if (burst->status != MSD_OK)
+		{
+			MSD_DBG_ERROR(("APB burst access returned: %s.\n", msdDisplayStatus(burst->status)));
 		}
 	}
-	else
-	{
-		tempData = ((1 << 15) | (MSD_U16)((opCode & 0x7F) << 8) | (MSD_U16)((*value) & 0xFF));
-		retVal = msdSetAnyReg(dev.devNum, APB_PHYADDR, APB_REGADDR, tempData);
-	}
-	return retVal;
-}
 
-static MSD_STATUS Wait_APBReady(IN  MSD_QD_DEV dev)
-{
-	MSD_STATUS retVal = MSD_OK;
-	MSD_U8 tempData = 1 << 7;
-	while (((tempData >> 7) & 0x1) == 1)
+	for (i = 0; (i < burst->nRead) && (burst->status == MSD_OK); i++)
 	{
-		retVal = Operation_APB(dev, FIR_TRANSFER_CONTROL, FIR_APB_READ, &tempData);
-		if (retVal != MSD_OK)
+		value = 0;
+		for (j = 0; j < 4U; j++)
 		{
-			MSD_DBG_ERROR(("Wait_APBReady function returned: %s.\n", msdDisplayStatus(retVal)));
-			break;
+			value |= (MSD_U32)(burst->regCmd[burst->readIndex[i] + 1U + 2U * j].data & 0xFFU) << (8U * j);
 		}
+		*(burst->readData[i]) = value;
 	}
-	return retVal;
+
+	burst->nCmd = 0;
+	burst->nRead = 0;
+	return burst->status;
 }
 
 /*Convert Array to Mem Data*/
-static FIR_MSEC_RULE* ConvertArrayToRule(IN  MSD_QD_DEV dev)
+static FIR_MSEC_RULE* ConvertArrayToRule(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_MSEC_RULE temp_rule;
 	MSD_U8 i;
@@ -1857,8 +2070,9 @@ static FIR_MSEC_RULE* ConvertArrayToRule(IN  MSD_QD_DEV dev)
 
 	for (i = 0; i < TCAM_WIDTH; i++)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * i, &array[i]);
 	}
+	Fir_apbBurstFlush(burst);
 
 	temp_rule.maskSPV = (array[1] >> 17) & 0x7F;
 	temp_rule.keySPV = (array[1] >> 1) & 0x7F;
@@ -1922,7 +2136,7 @@ static FIR_MSEC_RULE* ConvertArrayToRule(IN  MSD_QD_DEV dev)
 
 	return &temp_rule;
 }
-static FIR_MSEC_TCAM_ACTION* ConvertArrayToAction(IN MSD_QD_DEV dev)
+static FIR_MSEC_TCAM_ACTION* ConvertArrayToAction(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_MSEC_TCAM_ACTION action;
 	MSD_U32 data_addr = 0;
@@ -1931,13 +2145,14 @@ static FIR_MSEC_TCAM_ACTION* ConvertArrayToAction(IN MSD_QD_DEV dev)
 	GET_MEM_ADDR(FIR_TYPE_ACTION, _data_addr);
 	data_addr = (MSD_U32)_data_addr;
 	data_addr += regBusWidth;
-	Fir_gmacsecRead(dev, data_addr, &tempData);
+	Fir_apbBurstRead(burst, data_addr, &tempData);
+	Fir_apbBurstFlush(burst);
 	action.isControlledPort = (((tempData >> 15) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
 	action.secYIndex = tempData & 0xF;
 	action.txSCIndex = (tempData >> 16) & 0xF;
 	return &action;
 }
-static FIR_SECY_INGRESS* ConvertArrayToRxSecY(IN  MSD_QD_DEV dev)
+static FIR_SECY_INGRESS* ConvertArrayToRxSecY(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_SECY_INGRESS rxSecY;
 	MSD_U8 i;
@@ -1949,8 +2164,9 @@ static FIR_SECY_INGRESS* ConvertArrayToRxSecY(IN  MSD_QD_DEV dev)
 	data_addr += regBusWidth;
 	for (i = 0; i < (RX_SECY_WIDTH - 1); i++)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * i, &array[i]);
 	}
+	Fir_apbBurstFlush(burst);
 	rxSecY.allowZeroRxPN = (((array[0] >> 24) & 1) == 1) ? MSD_TRUE : MSD_FALSE;
 	rxSecY.secYCounterIndex = (array[0] >> 16) & 0xF;
 	rxSecY.rxConfOffset = (array[0] >> 8) & 0x3F;
@@ -1961,7 +2177,7 @@ static FIR_SECY_INGRESS* ConvertArrayToRxSecY(IN  MSD_QD_DEV dev)
 	rxSecY.replayWindow = array[1];
 	return &rxSecY;
 }
-static FIR_SECY_EGRESS* ConvertArrayToTxSecY(IN  MSD_QD_DEV dev)
+static FIR_SECY_EGRESS* ConvertArrayToTxSecY(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_SECY_EGRESS txSecY;
 	MSD_U8 i;
@@ -1973,8 +2189,9 @@ static FIR_SECY_EGRESS* ConvertArrayToTxSecY(IN  MSD_QD_DEV dev)
 	data_addr += regBusWidth;
 	for (i = 0; i < (TX_SECY_WIDTH - 1); i++)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * i, &array[i]);
 	}
+	Fir_apbBurstFlush(burst);
 	txSecY.secYCounterIndex = (array[0] >> 16) & 0xF;
 	txSecY.txConfOffset = (array[0] >> 8) & 0x3F;
 	txSecY.cipher = (MSD_CIPHER_SUITE)((array[0] >> 4) & 0x3);
@@ -1988,7 +2205,7 @@ static FIR_SECY_EGRESS* ConvertArrayToTxSecY(IN  MSD_QD_DEV dev)
 	txSecY.secTagTCI = array[1] & 0x3F;
 	return &txSecY;
 }
-static FIR_MSEC_RX_SC* ConvertArrayToRxSc(IN  MSD_QD_DEV dev)
+static FIR_MSEC_RX_SC* ConvertArrayToRxSc(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_MSEC_RX_SC rxSC;
 	MSD_U8 i;
@@ -2000,8 +2217,9 @@ static FIR_MSEC_RX_SC* ConvertArrayToRxSc(IN  MSD_QD_DEV dev)
 	data_addr += regBusWidth;
 	for (i = 0; i < (RX_SC_WIDTH - 1); i++)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * i, &array[i]);
 	}
+	Fir_apbBurstFlush(burst);
 	rxSC.scCounterIndex = (array[0] >> 16) & 0xF;
 	rxSC.secYIndex = array[0] & 0xF;
 	rxSC.sci = (((MSD_U64)array[1] << 32) | array[2]);
@@ -2013,7 +2231,7 @@ static FIR_MSEC_RX_SC* ConvertArrayToRxSc(IN  MSD_QD_DEV dev)
 	rxSC.sa1Valid = (((array[3] >> 30) & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
 	return &rxSC;
 }
-static FIR_MSEC_TX_SC* ConvertArrayToTxSc(IN  MSD_QD_DEV dev)
+static FIR_MSEC_TX_SC* ConvertArrayToTxSc(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_MSEC_TX_SC txSC;
 	MSD_U8 i;
@@ -2025,8 +2243,9 @@ static FIR_MSEC_TX_SC* ConvertArrayToTxSc(IN  MSD_QD_DEV dev)
 	data_addr += regBusWidth;
 	for (i = 0; i < (TX_SC_WIDTH - 1); i++)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * i, &array[i]);
 	}
+	Fir_apbBurstFlush(burst);
 	txSC.scCounterIndex = (array[0] >> 16) & 0xF;
 	txSC.txNextPNRolloEn = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
 	txSC.sci = (((MSD_U64)array[1] << 32) | array[2]);
@@ -2040,7 +2259,7 @@ static FIR_MSEC_TX_SC* ConvertArrayToTxSc(IN  MSD_QD_DEV dev)
 	txSC.sa0Index = array[3] & 0x1F;
 	return &txSC;
 }
-static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev)
+static FIR_MSEC_RX_SA* ConvertArrayToRxSa(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_MSEC_RX_SA rxSA;
 	MSD_U8 i, j;
@@ -2052,8 +2271,14 @@ static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev)
 	data_addr += regBusWidth;
 	for (i = 0; i < (RX_SA_WIDTH - 1); i++)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * i, &array[i]);
 	}
+	data_addr = (MSD_U32)BASE_SAK;
+	for (i =(RX_SA_WIDTH -1); i < (RX_SA_WIDTH + SAK_WIDTH - 2); i++)
+	{
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * (i - RX_SA_WIDTH + 2), &array[i]);
+	}
+	Fir_apbBurstFlush(burst);
 	rxSA.rxSAValid = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
 	rxSA.ssci = array[1] & 0xFFFFFFFFU;
 	for (i = 0; i < 3; i++)
@@ -2064,11 +2289,6 @@ static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev)
 		}
 	}
 	rxSA.nextPN = ((MSD_U64)array[5] << 32) | array[6];
-	data_addr = (MSD_U32)BASE_SAK;
-	for (i =(RX_SA_WIDTH -1); i < (RX_SA_WIDTH + SAK_WIDTH - 2); i++)
-	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * (i - RX_SA_WIDTH + 2), &array[i]);
-	}
 	for (i = 0; i < 8; i++)
 	{
 		for (j = 0; j < 4; j++)
@@ -2078,7 +2298,7 @@ static FIR_MSEC_RX_SA* ConvertArrayToRxSa(IN  MSD_QD_DEV dev)
 	}
 	return &rxSA;
 }
-static FIR_MSEC_TX_SA* ConvertArrayToTxSa(IN  MSD_QD_DEV dev)
+static FIR_MSEC_TX_SA* ConvertArrayToTxSa(INOUT FIR_MACSEC_APB_BURST* burst)
 {
 	static FIR_MSEC_TX_SA txSA;
 	MSD_U8 i, j;
@@ -2090,8 +2310,14 @@ static FIR_MSEC_TX_SA* ConvertArrayToTxSa(IN  MSD_QD_DEV dev)
 	data_addr += regBusWidth;
 	for (i = 0; i < (TX_SA_WIDTH - 1); i++)
 	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * i, &array[i]);
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * i, &array[i]);
 	}
+	data_addr = (MSD_U32)BASE_SAK;
+	for (i = (TX_SA_WIDTH - 1); i < (TX_SA_WIDTH + SAK_WIDTH - 2); i++)
+	{
+		Fir_apbBurstRead(burst, data_addr + regBusWidth * (i - TX_SA_WIDTH + 2), &array[i]);
+	}
+	Fir_apbBurstFlush(burst);
 	txSA.txSAValid = ((array[0] & 0x1) == 1) ? MSD_TRUE : MSD_FALSE;
 	txSA.ssci = array[1] & 0xFFFFFFFFU;
 	for (i = 0; i < 3; i++)
@@ -2102,11 +2328,6 @@ static FIR_MSEC_TX_SA* ConvertArrayToTxSa(IN  MSD_QD_DEV dev)
 		}
 	}
 	txSA.nextPN = ((MSD_U64)array[5] << 32) | array[6];
-	data_addr = (MSD_U32)BASE_SAK;
-	for (i = (TX_SA_WIDTH - 1); i < (TX_SA_WIDTH + SAK_WIDTH - 2); i++)
-	{
-		Fir_gmacsecRead(dev, data_addr + regBusWidth * (i - TX_SA_WIDTH + 2), &array[i]);
-	}
 	for (i = 0; i < 8; i++)
 	{
 		for (j = 0; j < 4; j++)
@@ -2253,63 +2474,85 @@ static MSD_U32* ConvertTXSAToArray(IN FIR_MACSec_DATA_HW* dataRw)
 }
 
 
-/*In case MACSec Read\Write change*/
-static MSD_STATUS Fir_MACSecGetAnyRegField
+static MSD_STATUS Fir_WaitOperationReady
 (
-	IN  MSD_QD_DEV dev,
-	IN  MSD_U32    regAddr,
-	IN  MSD_U32    fieldOffset,
-	IN  MSD_U32    fieldLength,
-	OUT MSD_U32* data
+	INOUT FIR_MACSEC_APB_BURST* burst,
+	IN MSD_32 regAddr
 )
 {
-	MSD_U32 mask;            /* Bits mask to be read */
-	MSD_U32 tmpData = 0;
-	MSD_STATUS   retVal;
+	MSD_STATUS       retVal = MSD_FAIL;    /* Functions return value */
+	MSD_U32          tempData;     /* temporary Data storage */
+	MSD_U32          mask;
+	tempData = 0;
 
-	retVal = Fir_gmacsecRead(dev, regAddr, &tmpData);
-	if (retVal != MSD_OK)
+	mask = Fir_apbOpMask((MSD_U32)regAddr);
+	if ((mask != 0U) && ((burst->opReady & mask) == mask))
 	{
-		MSD_DBG_ERROR(("MACSecRead function returned: %s.\n", msdDisplayStatus(retVal)));
+		return MSD_OK;
 	}
-	else
-	{
-		MSD_CALC_MASK_32(fieldOffset, fieldLength, mask);
 
-		tmpData = (tmpData & mask) >> fieldOffset;
-		*data = tmpData;
-		MSD_DBG(("(LOG RR): regAddr 0x%02x, ", regAddr));
-		MSD_DBG(("fOff %d, fLen %d, data 0x%04x.\n", fieldOffset, fieldLength, *data));
+	/* Queued commands go out with the first poll */
+	do
+	{
+		Fir_apbBurstRead(burst, (MSD_U32)regAddr, &tempData);
+		retVal = Fir_apbBurstFlush(burst);
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("Fir_apbBurstFlush returned: %s.\n", msdDisplayStatus(retVal)));
+			break;
+		}
+	} while (((tempData >> 15) & 0x1) == 1);
+	if (retVal == MSD_OK)
+	{
+		burst->opReady |= mask;
 	}
-
 	return retVal;
 }
 
-static MSD_STATUS Fir_WaitOperationReady
+/* Poll the table operation registers together until all of them are idle */
+static MSD_STATUS Fir_WaitAllOperationReady
 (
-	IN  MSD_QD_DEV dev,
-	IN MSD_32 regAddr
+	INOUT FIR_MACSEC_APB_BURST* burst
 )
 {
-	MSD_STATUS       retVal = MSD_FAIL;    /* Functions return value */
-	MSD_U32          tempData;     /* temporary Data storage */
-	tempData = 1;
+	MSD_STATUS       retVal = MSD_OK;
+	MSD_U32          regAddr[9] = { BASE_TCAM, BASE_TCAM_ACTION, BASE_RX_SECY, BASE_TX_SECY, BASE_RX_SC,
+							BASE_TX_SC, BASE_RX_SA, BASE_TX_SA, BASE_SAK };
+	MSD_U32          tempData[9];
+	MSD_U32          busy;
+	MSD_U32          i;
 
-	while (tempData == 1)
+	do
 	{
-		retVal = Fir_MACSecGetAnyRegField(dev, regAddr, 15, 1, &tempData);
+		for (i = 0; i < 9U; i++)
+		{
+			Fir_apbBurstRead(burst, regAddr[i], &tempData[i]);
+		}
+		retVal = Fir_apbBurstFlush(burst);
 		if (retVal != MSD_OK)
 		{
-			MSD_DBG_ERROR(("Fir_MACSecGetAnyRegField returned: %s.\n", msdDisplayStatus(retVal)));
+			MSD_DBG_ERROR(("Fir_apbBurstFlush returned: %s.\n", msdDisplayStatus(retVal)));
 			break;
 		}
-	}
+		busy = 0;
+		for (i = 0; i < 9U; i++)
+		{
+			if (((tempData[i] >> 15) & 0x1) == 1)
+			{
+				busy++;
+			}
+			else
+			{
+				burst->opReady |= Fir_apbOpMask(regAddr[i]);
+			}
+		}
+	} while (busy != 0U);
 	return retVal;
 }
 
-static MSD_STATUS Fir_SAKOperation
+static MSD_STATUS Fir_burstSAKOperation
 (
-	IN  MSD_QD_DEV* dev,
+	INOUT FIR_MACSEC_APB_BURST* burst,
 	IN  FIR_MACSec_SAK_OPERATION  sakOp,
 	IN	MSD_U8 index
 )
@@ -2320,7 +2563,7 @@ static MSD_STATUS Fir_SAKOperation
 
 	regAddr = BASE_SAK;
 	/* Wait until the tcam in ready. */
-	retVal = Fir_WaitOperationReady(*dev, regAddr);
+	retVal = Fir_WaitOperationReady(burst, regAddr);
 	if (retVal != MSD_OK)
 	{
 		return retVal;
@@ -2328,22 +2571,43 @@ static MSD_STATUS Fir_SAKOperation
 
 	tempData = 0;
 	tempData = (MSD_U32)((1 << 15) | (sakOp << 12) | index);
-	retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
-	if (retVal != MSD_OK)
-	{
-		MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-		return retVal;
-	}
+	Fir_apbBurstWrite(burst, (MSD_U32)regAddr, tempData);
 
 	/* Wait until the tcam in ready. */
-	retVal = Fir_WaitOperationReady(*dev, regAddr);
-	if (retVal != MSD_OK)
+	retVal = Fir_WaitOperationReady(burst, regAddr);
+
+	return retVal;
+}
+
+/* Load an SA entry and its SAK */
+static MSD_STATUS Fir_burstCreateSA
+(
+	INOUT FIR_MACSEC_APB_BURST* burst,
+	IN MSD_BOOL isTx,
+	IN MSD_U8 saIndex,
+	IN FIR_MACSec_DATA_HW* saData
+)
+{
+	MSD_STATUS retVal;
+	if (isTx == MSD_TRUE)
 	{
-		return retVal;
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SA, FIR_TYPE_TX_SA, FIR_MACSec_LOAD_ENTRY, saData, saIndex);
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_burstSAKOperation(burst, FIR_SAK_LOAD_TX, saIndex);
+		}
+	}
+	else
+	{
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SA, FIR_TYPE_RX_SA, FIR_MACSec_LOAD_ENTRY, saData, saIndex);
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_burstSAKOperation(burst, FIR_SAK_LOAD_RX, saIndex);
+		}
 	}
-
 	return retVal;
 }
+
 static MSD_STATUS Fir_OperationPerform
 (
 	IN  MSD_QD_DEV* dev,
@@ -2353,12 +2617,38 @@ static MSD_STATUS Fir_OperationPerform
 	INOUT FIR_MACSec_DATA_HW* opData,
 	IN MSD_U8 index
 )
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_STATUS       endStatus;
+	FIR_MACSEC_APB_BURST burst;
+
+	Fir_apbBurstStart(&burst, dev);
+	retVal = Fir_burstOperationPerform(&burst, regAddr, memType, tcamOp, opData, index);
+	endStatus = Fir_apbBurstEnd(&burst);
+	if (retVal == MSD_OK)
+	{
+		retVal = endStatus;
+	}
+
+	return retVal;
+}
+
+static MSD_STATUS Fir_burstOperationPerform
+(
+	INOUT FIR_MACSEC_APB_BURST* burst,
+	IN	MSD_32	regAddr,
+	IN	FIR_MEMTYPE memType,
+	IN  FIR_MACSec_OPERATION   tcamOp,
+	INOUT FIR_MACSec_DATA_HW* opData,
+	IN MSD_U8 index
+)
 {
 	MSD_STATUS       retVal;    /* Functions return value */
 	MSD_U32          tempData;     /* temporary Data storage */
+	MSD_U32          data1;
 
 	/* Wait until the tcam in ready. */
-	retVal = Fir_WaitOperationReady(*dev, regAddr);
+	retVal = Fir_WaitOperationReady(burst, regAddr);
 	if (retVal != MSD_OK)
 	{
 		return retVal;
@@ -2369,178 +2659,105 @@ static MSD_STATUS Fir_OperationPerform
 	{
 	case FIR_MACSec_FLUSH_ALL:
 	{
-		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
-		if (retVal != MSD_OK)
-		{
-			return retVal;
-		}
-
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12));
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
-		if (retVal != MSD_OK)
-		{
-			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-			return retVal;
-		}
+		Fir_apbBurstWrite(burst, (MSD_U32)regAddr, tempData);
 	}
 	break;
 
 	case FIR_MACSec_FLUSH_ONE:
 	{
-		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
-		if (retVal != MSD_OK)
-		{
-			return retVal;
-		}
-
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
-		if (retVal != MSD_OK)
-		{
-			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-			return retVal;
-		}
+		Fir_apbBurstWrite(burst, (MSD_U32)regAddr, tempData);
 	}
 	break;
 
 	case FIR_MACSec_LOAD_ENTRY:
 	{
-		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
-		if (retVal != MSD_OK)
-		{
-			return retVal;
-		}
-
-		retVal = MACSec_SetMEMData(*dev, memType, opData);
+		retVal = MACSec_SetMEMData(burst, memType, opData);
 		if (retVal != MSD_OK)
 		{
-			return retVal;
+			break;
 		}
 
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
-		if (retVal != MSD_OK)
-		{
-			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-			return retVal;
-		}
-
-		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
-		if (retVal != MSD_OK)
-		{
-			return retVal;
-		}
+		Fir_apbBurstWrite(burst, (MSD_U32)regAddr, tempData);
 
+		/* Wait until the tcam in ready, the entry data goes out in the same frame */
+		retVal = Fir_WaitOperationReady(burst, regAddr);
 	}
 	break;
 
 	case FIR_MACSec_LOAD_PN_ONLY_GET_NEXT_ENTRY:
 	{
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
-		if (retVal != MSD_OK)
-		{
-			return retVal;
-		}
-
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
-		if (retVal != MSD_OK)
-		{
-			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-			return retVal;
-		}
+		Fir_apbBurstWrite(burst, (MSD_U32)regAddr, tempData);
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(burst, regAddr);
 		if (retVal != MSD_OK)
 		{
-			return retVal;
+			break;
 		}
 
 		/* read the updated entry index*/
-		retVal = Fir_gmacsecRead(*dev, regAddr, &tempData);
+		data1 = 0;
+		Fir_apbBurstRead(burst, (MSD_U32)regAddr, &tempData);
+		Fir_apbBurstRead(burst, (MSD_U32)regAddr + FIR_MSEC_TCAM_DA_5_4_OFFSET, &data1);
+		retVal = Fir_apbBurstFlush(burst);
 		if (retVal != MSD_OK)
 		{
-			MSD_DBG_ERROR(("MACSecRead function returned: %s.\n", msdDisplayStatus(retVal)));
-			return retVal;
+			break;
 		}
 
-		if ((tempData & (MSD_U32)0xff) == (MSD_U32)0xff)
+		if (((tempData & (MSD_U32)0xff) == (MSD_U32)0xff) && (data1 == (MSD_U32)0xffff))
 		{
-			MSD_U32 data1;
-			retVal = Fir_gmacsecRead(*dev, regAddr + FIR_MSEC_TCAM_DA_5_4_OFFSET, &data1);
-			if (retVal != MSD_OK)
-			{
-				MSD_DBG_ERROR(("MACSecRead function returned: %s.\n", msdDisplayStatus(retVal)));
-				return retVal;
-			}
-			if (data1 == (MSD_U32)0xffff)
-			{
-				/* No higher valid TCAM entry */
-				return MSD_NO_SUCH;
-			}
-			else
-			{
-				/* The highest valid TCAM entry found*/
-			}
+			/* No higher valid TCAM entry */
+			retVal = MSD_NO_SUCH;
+			break;
 		}
 
 		/* Get next entry and read the entry */
-		retVal = MACSec_GetMEMData(*dev, memType, opData);   
+		retVal = MACSec_GetMEMData(burst, memType, opData);
 		if (retVal != MSD_OK)
 		{
-			return retVal;
+			break;
 		}
 
-	}
-	case FIR_MACSec_READ_ENTRY:
-	{
-
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(burst, regAddr);
 		if (retVal != MSD_OK)
 		{
-			return retVal;
+			break;
 		}
-
+	}
+	case FIR_MACSec_READ_ENTRY:
+	{
 		tempData = 0;
 		tempData = (MSD_U32)((1 << 15) | (tcamOp << 12) | index);
-		retVal = Fir_gmacsecWrite(*dev, regAddr, tempData);
-		if (retVal != MSD_OK)
-		{
-			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
-			return retVal;
-		}
+		Fir_apbBurstWrite(burst, (MSD_U32)regAddr, tempData);
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
+		retVal = Fir_WaitOperationReady(burst, regAddr);
 		if (retVal != MSD_OK)
 		{
-			return retVal;
+			break;
 		}
 
-		retVal = MACSec_GetMEMData(*dev, memType, opData);   
+		retVal = MACSec_GetMEMData(burst, memType, opData);
 		if (retVal != MSD_OK)
 		{
-			return retVal;
+			break;
 		}
 
 		/* Wait until the tcam in ready. */
-		retVal = Fir_WaitOperationReady(*dev, regAddr);
-		if (retVal != MSD_OK)
-		{
-			return retVal;
-		}
+		retVal = Fir_WaitOperationReady(burst, regAddr);
 	}
 	break;
 
 	default:
-		return MSD_FAIL;
+		retVal = MSD_FAIL;
+		break;
 	}
 
 	return retVal;
@@ -2548,7 +2765,7 @@ static MSD_STATUS Fir_OperationPerform
 
 static MSD_STATUS MACSec_SetMEMData
 (
-	IN MSD_QD_DEV dev,
+	INOUT FIR_MACSEC_APB_BURST* burst,
 	IN FIR_MEMTYPE memType,
 	IN FIR_MACSec_DATA_HW* tcamDataP
 )
@@ -2571,7 +2788,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*Set TCAM data*/
 		for (i = 1; i < TCAM_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * i, array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2587,7 +2804,7 @@ static MSD_STATUS MACSec_SetMEMData
 		GET_MEM_ADDR(FIR_TYPE_ACTION, _regAddr);
 		regAddr = (MSD_U32)_regAddr;
 		/*Action Data*/
-		retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth, array[1]);
+		retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth, array[1]);
 		if (retVal != MSD_OK)
 		{
 			MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2604,7 +2821,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*RX SecY Data*/
 		for (i = 1; i < RX_SECY_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * i, array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2622,7 +2839,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*TX SecY Data*/
 		for (i = 1; i < TX_SECY_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * i, array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2640,7 +2857,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*RX SC Data*/
 		for (i = 1; i < RX_SC_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * i, array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2659,7 +2876,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*TX SC Data*/
 		for (i = 1; i < TX_SC_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * i, array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2678,7 +2895,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*RX SA Data*/
 		for (i = 1; i < RX_SA_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * i, array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2689,7 +2906,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*RX SAK Data*/
 		for (i = RX_SA_WIDTH + 1; i < RX_SA_WIDTH + SAK_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * (i - RX_SA_WIDTH), array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * (i - RX_SA_WIDTH), array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2708,7 +2925,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*TX SA Data*/
 		for (i = 1; i < TX_SA_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * i, array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * i, array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2719,7 +2936,7 @@ static MSD_STATUS MACSec_SetMEMData
 		/*TX SAK Data*/
 		for (i = TX_SA_WIDTH + 1; i < TX_SA_WIDTH + SAK_WIDTH; i++)
 		{
-			retVal = Fir_gmacsecWrite(dev, regAddr + regBusWidth * (i - TX_SA_WIDTH), array[i]);
+			retVal = Fir_apbBurstWrite(burst, regAddr + regBusWidth * (i - TX_SA_WIDTH), array[i]);
 			if (retVal != MSD_OK)
 			{
 				MSD_DBG_ERROR(("MACSecWrite function returned: %s.\n", msdDisplayStatus(retVal)));
@@ -2741,7 +2958,7 @@ static MSD_STATUS MACSec_SetMEMData
 
 static MSD_STATUS MACSec_GetMEMData
 (
-	IN  MSD_QD_DEV dev,
+	INOUT FIR_MACSEC_APB_BURST* burst,
 	IN FIR_MEMTYPE memType,
 	OUT FIR_MACSec_DATA_HW* tcamDataP
 )
@@ -2750,32 +2967,210 @@ static MSD_STATUS MACSec_GetMEMData
 	switch (memType)
 	{
 	case FIR_TYPE_RULE:
-		msdMemCpy(&(tcamDataP->rule), ConvertArrayToRule(dev), sizeof(FIR_MSEC_RULE));
+		msdMemCpy(&(tcamDataP->rule), ConvertArrayToRule(burst), sizeof(FIR_MSEC_RULE));
 		break;
 	case FIR_TYPE_ACTION:
-		msdMemCpy(&(tcamDataP->action), ConvertArrayToAction(dev), sizeof(FIR_MSEC_TCAM_ACTION));
+		msdMemCpy(&(tcamDataP->action), ConvertArrayToAction(burst), sizeof(FIR_MSEC_TCAM_ACTION));
 		break;
 	case FIR_TYPE_RX_SECY:
-		msdMemCpy(&(tcamDataP->rxSecy), ConvertArrayToRxSecY(dev), sizeof(FIR_SECY_INGRESS));
+		msdMemCpy(&(tcamDataP->rxSecy), ConvertArrayToRxSecY(burst), sizeof(FIR_SECY_INGRESS));
 		break;
 	case FIR_TYPE_TX_SECY:
-		msdMemCpy(&(tcamDataP->txSecy), ConvertArrayToTxSecY(dev), sizeof(FIR_SECY_EGRESS));
+		msdMemCpy(&(tcamDataP->txSecy), ConvertArrayToTxSecY(burst), sizeof(FIR_SECY_EGRESS));
 		break;
 	case FIR_TYPE_RX_SC:
-		msdMemCpy(&(tcamDataP->rxSc), ConvertArrayToRxSc(dev), sizeof(FIR_MSEC_RX_SC));
+		msdMemCpy(&(tcamDataP->rxSc), ConvertArrayToRxSc(burst), sizeof(FIR_MSEC_RX_SC));
 		break;
 	case FIR_TYPE_TX_SC:
-		msdMemCpy(&(tcamDataP->txSc), ConvertArrayToTxSc(dev), sizeof(FIR_MSEC_TX_SC));
+		msdMemCpy(&(tcamDataP->txSc), ConvertArrayToTxSc(burst), sizeof(FIR_MSEC_TX_SC));
 		break;
 	case FIR_TYPE_RX_SA:
-		msdMemCpy(&(tcamDataP->rxSa), ConvertArrayToRxSa(dev), sizeof(FIR_MSEC_RX_SA));
+		msdMemCpy(&(tcamDataP->rxSa), ConvertArrayToRxSa(burst), sizeof(FIR_MSEC_RX_SA));
 		break;
 	case FIR_TYPE_TX_SA:
-		msdMemCpy(&(tcamDataP->txSa), ConvertArrayToTxSa(dev), sizeof(FIR_MSEC_TX_SA));
+		msdMemCpy(&(tcamDataP->txSa), ConvertArrayToTxSa(burst), sizeof(FIR_MSEC_TX_SA));
 		break;
 	default:
 		retVal = MSD_FAIL;
 		break;
 	}
+	if (retVal == MSD_OK)
+	{
+		retVal = burst->status;
+	}
+	return retVal;
+}
+
+/*MACSec transaction*/
+static MSD_STATUS Fir_txnOpCheck
+(
+	IN FIR_MACSEC_TXN_OP* op
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	switch (op->opType)
+	{
+	case FIR_MACSEC_TXN_CREATE_RX_SECY:
+	case FIR_MACSEC_TXN_CREATE_TX_SECY:
+	case FIR_MACSEC_TXN_DELETE_RX_SECY:
+	case FIR_MACSEC_TXN_DELETE_TX_SECY:
+		if (op->index >= FIR_MAXSECYINDEX)
+		{
+			retVal = MSD_BAD_PARAM;
+		}
+		break;
+	case FIR_MACSEC_TXN_CREATE_RX_SC:
+	case FIR_MACSEC_TXN_CREATE_TX_SC:
+	case FIR_MACSEC_TXN_DELETE_RX_SC:
+	case FIR_MACSEC_TXN_DELETE_TX_SC:
+		if (op->index >= FIR_MAXSCINDEX)
+		{
+			retVal = MSD_BAD_PARAM;
+		}
+		break;
+	case FIR_MACSEC_TXN_CREATE_RX_SA:
+	case FIR_MACSEC_TXN_CREATE_TX_SA:
+	case FIR_MACSEC_TXN_DELETE_RX_SA:
+	case FIR_MACSEC_TXN_DELETE_TX_SA:
+		if (op->index >= FIR_MAXSAINDEX)
+		{
+			retVal = MSD_BAD_PARAM;
+		}
+		break;
+	case FIR_MACSEC_TXN_REKEY_RX_SA:
+	case FIR_MACSEC_TXN_REKEY_TX_SA:
+		if ((op->index >= FIR_MAXSAINDEX) || (op->scIndex >= FIR_MAXSCINDEX) || (op->an > 3U))
+		{
+			retVal = MSD_BAD_PARAM;
+		}
+		break;
+	default:
+		retVal = MSD_BAD_PARAM;
+		break;
+	}
+	return retVal;
+}
+
+/*
+* Rekey is make before break: the new SA is loaded first, then the SC entry
+* is rewritten once to take it. A Tx SC gets it in the inactive slot and
+* switches to it, an Rx SC gets it in a free slot, or else in the slot not
+* holding the previous AN so the SA still in use by the peer is kept.
+*/
+static MSD_STATUS Fir_txnOpApply
+(
+	INOUT FIR_MACSEC_APB_BURST* burst,
+	IN FIR_MACSEC_TXN_OP* op
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	FIR_MACSec_DATA_HW tmp;
+	msdMemSet(&tmp, 0, sizeof(FIR_MACSec_DATA_HW));
+
+	switch (op->opType)
+	{
+	case FIR_MACSEC_TXN_CREATE_RX_SECY:
+		msdMemCpy(&(tmp.rxSecy), &(op->data.rxSecY), sizeof(FIR_SECY_INGRESS));
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SECY, FIR_TYPE_RX_SECY, FIR_MACSec_LOAD_ENTRY, &tmp, op->index);
+		break;
+	case FIR_MACSEC_TXN_CREATE_TX_SECY:
+		msdMemCpy(&(tmp.txSecy), &(op->data.txSecY), sizeof(FIR_SECY_EGRESS));
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SECY, FIR_TYPE_TX_SECY, FIR_MACSec_LOAD_ENTRY, &tmp, op->index);
+		break;
+	case FIR_MACSEC_TXN_DELETE_RX_SECY:
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SECY, FIR_TYPE_RX_SECY, FIR_MACSec_FLUSH_ONE, NULL, op->index);
+		break;
+	case FIR_MACSEC_TXN_DELETE_TX_SECY:
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SECY, FIR_TYPE_TX_SECY, FIR_MACSec_FLUSH_ONE, NULL, op->index);
+		break;
+	case FIR_MACSEC_TXN_CREATE_RX_SC:
+		msdMemCpy(&(tmp.rxSc), &(op->data.rxSC), sizeof(FIR_MSEC_RX_SC));
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SC, FIR_TYPE_RX_SC, FIR_MACSec_LOAD_ENTRY, &tmp, op->index);
+		break;
+	case FIR_MACSEC_TXN_CREATE_TX_SC:
+		msdMemCpy(&(tmp.txSc), &(op->data.txSC), sizeof(FIR_MSEC_TX_SC));
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SC, FIR_TYPE_TX_SC, FIR_MACSec_LOAD_ENTRY, &tmp, op->index);
+		break;
+	case FIR_MACSEC_TXN_DELETE_RX_SC:
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SC, FIR_TYPE_RX_SC, FIR_MACSec_FLUSH_ONE, NULL, op->index);
+		break;
+	case FIR_MACSEC_TXN_DELETE_TX_SC:
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SC, FIR_TYPE_TX_SC, FIR_MACSec_FLUSH_ONE, NULL, op->index);
+		break;
+	case FIR_MACSEC_TXN_CREATE_RX_SA:
+		msdMemCpy(&(tmp.rxSa), &(op->data.rxSA), sizeof(FIR_MSEC_RX_SA));
+		retVal = Fir_burstCreateSA(burst, MSD_FALSE, op->index, &tmp);
+		break;
+	case FIR_MACSEC_TXN_CREATE_TX_SA:
+		msdMemCpy(&(tmp.txSa), &(op->data.txSA), sizeof(FIR_MSEC_TX_SA));
+		retVal = Fir_burstCreateSA(burst, MSD_TRUE, op->index, &tmp);
+		break;
+	case FIR_MACSEC_TXN_DELETE_RX_SA:
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SA, FIR_TYPE_RX_SA, FIR_MACSec_FLUSH_ONE, NULL, op->index);
+		break;
+	case FIR_MACSEC_TXN_DELETE_TX_SA:
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SA, FIR_TYPE_TX_SA, FIR_MACSec_FLUSH_ONE, NULL, op->index);
+		break;
+	case FIR_MACSEC_TXN_REKEY_RX_SA:
+		msdMemCpy(&(tmp.rxSa), &(op->data.rxSA), sizeof(FIR_MSEC_RX_SA));
+		retVal = Fir_burstCreateSA(burst, MSD_FALSE, op->index, &tmp);
+		if (retVal != MSD_OK)
+		{
+			break;
+		}
+		msdMemSet(&tmp, 0, sizeof(FIR_MACSec_DATA_HW));
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SC, FIR_TYPE_RX_SC, FIR_MACSec_READ_ENTRY, &tmp, op->scIndex);
+		if (retVal != MSD_OK)
+		{
+			break;
+		}
+		if ((tmp.rxSc.sa0Valid == MSD_TRUE) &&
+			((tmp.rxSc.sa1Valid == MSD_FALSE) || (tmp.rxSc.sa0An == ((op->an + 3U) & 0x3U))))
+		{
+			tmp.rxSc.sa1Valid = MSD_TRUE;
+			tmp.rxSc.sa1An = op->an;
+			tmp.rxSc.sa1Index = op->index;
+		}
+		else
+		{
+			tmp.rxSc.sa0Valid = MSD_TRUE;
+			tmp.rxSc.sa0An = op->an;
+			tmp.rxSc.sa0Index = op->index;
+		}
+		retVal = Fir_burstOperationPerform(burst, BASE_RX_SC, FIR_TYPE_RX_SC, FIR_MACSec_LOAD_ENTRY, &tmp, op->scIndex);
+		break;
+	case FIR_MACSEC_TXN_REKEY_TX_SA:
+		msdMemCpy(&(tmp.txSa), &(op->data.txSA), sizeof(FIR_MSEC_TX_SA));
+		retVal = Fir_burstCreateSA(burst, MSD_TRUE, op->index, &tmp);
+		if (retVal != MSD_OK)
+		{
+			break;
+		}
+		msdMemSet(&tmp, 0, sizeof(FIR_MACSec_DATA_HW));
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SC, FIR_TYPE_TX_SC, FIR_MACSec_READ_ENTRY, &tmp, op->scIndex);
+		if (retVal != MSD_OK)
+		{
+			break;
+		}
+		if (tmp.txSc.isActiveSA1 == MSD_TRUE)
+		{
+			tmp.txSc.sa0Valid = MSD_TRUE;
+			tmp.txSc.sa0An = op->an;
+			tmp.txSc.sa0Index = op->index;
+			tmp.txSc.isActiveSA1 = MSD_FALSE;
+		}
+		else
+		{
+			tmp.txSc.sa1Valid = MSD_TRUE;
+			tmp.txSc.sa1An = op->an;
+			tmp.txSc.sa1Index = op->index;
+			tmp.txSc.isActiveSA1 = MSD_TRUE;
+		}
+		retVal = Fir_burstOperationPerform(burst, BASE_TX_SC, FIR_TYPE_TX_SC, FIR_MACSec_LOAD_ENTRY, &tmp, op->scIndex);
+		break;
+	default:
+		retVal = MSD_BAD_PARAM;
+		break;
+	}
 	return retVal;
 }
@@ -23,6 +23,13 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
+
+#define PIRL_RES_REGS           9U
+/* RMU commands to write or to read back one resource */
+#define PIRL_RMU_WRITE_CMDS     (PIRL_RES_REGS * 3U)
+#define PIRL_RMU_READ_CMDS      ((PIRL_RES_REGS * 3U) + 1U)
+#define PIRL_RMU_READ_RES       (MSD_RMU_MAX_REGCMDS / PIRL_RMU_READ_CMDS)
 
 /*
  * Typedef: enum FIR_MSD_PIRL_OPERATION
@@ -84,6 +91,66 @@ IN    MSD_U32              irlReg,
 INOUT FIR_MSD_PIRL_OP_DATA     *opData
 );
 
+static void pirlDataToRegs
+(
+    IN  const FIR_MSD_PIRL_DATA *pirlData,
+    OUT MSD_U16              *data
+);
+static void pirlRegsToData
+(
+    IN  MSD_U16              *data,
+    OUT FIR_MSD_PIRL_DATA    *pirlData
+);
+static MSD_STATUS pirlProfileCheck
+(
+    IN  MSD_QD_DEV           *dev,
+    IN  const FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN  MSD_U32              numPorts
+);
+static void pirlReadBackRes
+(
+    IN  const FIR_MSD_PIRL_DATA *expected,
+    IN  MSD_U16              *data,
+    OUT FIR_MSD_PIRL_DATA    *pirlData,
+    INOUT MSD_U32            *numMismatches
+);
+static MSD_STATUS pirlProfileReadBack
+(
+    IN  MSD_QD_DEV           *dev,
+    IN  const FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN  MSD_U32              numPorts,
+    OUT FIR_MSD_PIRL_PORT_PROFILE *readPorts,
+    OUT MSD_U32              *numMismatches
+);
+static void pirlRmuAdd
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        opCode,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U16       data
+);
+static void pirlRmuAddWait
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd
+);
+static void pirlRmuWriteRes
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        port,
+    IN    MSD_U32       irlRes,
+    IN    MSD_U16       *data
+);
+static MSD_U32 pirlRmuReadRes
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        port,
+    IN    MSD_U32       irlRes
+);
+
 
 /*******************************************************************************
 * Fir_gpirlInitialize
@@ -388,31 +455,7 @@ MSD_STATUS Fir_gpirlReadResource
 
 			if (retVal != MSD_FAIL)
 			{
-				pirlData->bktTypeMask = (data[0]) & (MSD_U16)0xFFFF;
-				pirlData->tcamFlows = ((MSD_U16)(data[2] >> 13) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-				pirlData->priAndPt = ((MSD_U16)(data[1] >> 9) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-				pirlData->useFPri = ((MSD_U16)(data[1] >> 8) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-				pirlData->priSelect = (MSD_U8)(data[1] & (MSD_U16)0xff);
-
-				pirlData->colorAware = ((MSD_U16)(data[1] >> 13) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-
-				pirlData->accountGrnOverflow = ((MSD_U16)(data[1] >> 12) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-				pirlData->accountQConf = ((MSD_U16)(data[1] >> 11) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-				pirlData->accountFiltered = ((MSD_U16)(data[1] >> 10) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-
-				pirlData->samplingMode = ((MSD_U16)(data[1] >> 14) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
-
-				pirlData->actionMode = ((MSD_U16)(data[8] >> 11) & (MSD_U16)0x1) == 1U ? Fir_PIRL_ACTION_FC : Fir_PIRL_ACTION_DROP;
-				pirlData->fcMode = ((MSD_U16)(data[8] >> 12) & (MSD_U16)0x1) == 1U ? FIR_PIRL_FC_DEASSERT_EBS_LIMIT : FIR_PIRL_FC_DEASSERT_EMPTY;
-				pirlData->fcPriority = (MSD_U8)((data[8] >> 13) & (MSD_U16)0x7);
-
-				pirlData->customSetup.ebsLimit = ((MSD_U32)((MSD_U32)data[8] & (MSD_U32)0xFF) << 16) | ((MSD_U32)data[7] & (MSD_U32)0xFFFF);
-				pirlData->customSetup.cbsLimit = ((MSD_U32)((MSD_U32)data[5] & (MSD_U32)0xFF) << 16) | ((MSD_U32)data[4] & (MSD_U32)0xFFFF);
-				pirlData->customSetup.bktIncrement = (MSD_U32)data[2] & (MSD_U32)0x1FFF;
-				pirlData->customSetup.bktRateFactorGrn = (MSD_U32)data[3] & (MSD_U32)0xFFFF;
-				pirlData->customSetup.bktRateFactorYel = (MSD_U32)data[6] & (MSD_U32)0xFFFF;
-				pirlData->customSetup.countMode = (FIR_MSD_PIRL_COUNT_MODE)(MSD_U16)((MSD_U16)(data[2] >> 14) & (MSD_U16)3);
-				pirlData->customSetup.isValid = MSD_TRUE;
+				pirlRegsToData(data, pirlData);
 			}
 		}
 	}
@@ -477,44 +520,7 @@ MSD_STATUS Fir_gpirlWriteResource
 		}
 		else
 		{
-			/* reg0 data */
-			data[0] = (MSD_U16)(pirlData->bktTypeMask & (MSD_U32)0xFFFF);        /* Bit[15:0] : Traffic Type   */
-
-			/* reg1 data */
-			data[1] = (MSD_U16)((MSD_U16)((MSD_U16)((pirlData->samplingMode == MSD_TRUE) ? 1U : 0U) << 14) |	   /* Bit[14] : sampling Mode */
-				(MSD_U16)((MSD_U16)((pirlData->colorAware == MSD_TRUE) ? 1U : 0U) << 13) |			             /* Bit[13] : Color Aware */
-				(MSD_U16)((MSD_U16)((pirlData->accountGrnOverflow == MSD_TRUE) ? 1U : 0U) << 12) |             /* Bit[12] : AcctForGrnOvflow */
-				(MSD_U16)((MSD_U16)((pirlData->accountQConf == MSD_TRUE) ? 1U : 0U) << 11) |		           /* Bit[11] : AcctForQConf */
-				(MSD_U16)((MSD_U16)((pirlData->accountFiltered == MSD_TRUE) ? 1U : 0U) << 10) |              /* Bit[10] : AcctForFiltered */
-				(MSD_U16)((MSD_U16)((pirlData->priAndPt == MSD_TRUE) ? 1U : 0U) << 9) |			         /* Bit[9] : Priority And Packet Type */
-				(MSD_U16)((MSD_U16)((pirlData->useFPri == MSD_TRUE) ? 1U : 0U) << 8) |			             /* Bit[8] : Frame Priority vs Queue Priority */
-				(MSD_U16)(pirlData->priSelect & (MSD_U16)0xFF)); 					            /* Bit[7:0] : Priority Select */
-
-			/* reg2 data */
-			data[2] = (MSD_U16)((MSD_U16)((MSD_U16)pirlData->customSetup.countMode << 14) |
-				(MSD_U16)((MSD_U16)((pirlData->tcamFlows == MSD_TRUE) ? 1U : 0U) << 13) |
-				(MSD_U16)((pirlData->customSetup.bktIncrement) & (MSD_U16)0x1FFF));
-
-			/* reg3 data */
-			data[3] = (MSD_U16)(pirlData->customSetup.bktRateFactorGrn & (MSD_U16)0xFFFF);    /* Bit[15:0] : Bucket Rate Factor Green */
-
-			/* reg4 data */
-			data[4] = (MSD_U16)(pirlData->customSetup.cbsLimit & (MSD_U16)0xFFFF);   /* Bit[15:0] : CBS Limit[15:0] */
-
-			/* reg5 data */
-			data[5] = (MSD_U16)((MSD_U16)(pirlData->customSetup.cbsLimit >> 16) & (MSD_U16)0xFF);   /* Bit[7:0] : CBS Limit[23:16] */
-
-			/* reg6 data */
-			data[6] = (MSD_U16)(pirlData->customSetup.bktRateFactorYel & (MSD_U16)0xFFFF);		/* Bit[15:0] : Bucket Rate Factor Yellow */
-
-			/* reg7 data */
-			data[7] = (MSD_U16)(pirlData->customSetup.ebsLimit & (MSD_U16)0xFFFF);	/* Bit[15:0] : EBS Limit[15:0] */
-
-			/* reg8 data */
-			data[8] = (MSD_U16)((MSD_U16)(((MSD_U16)pirlData->fcPriority & (MSD_U16)0x7) << 13) |
-				(MSD_U16)((MSD_U16)pirlData->fcMode << 12) |
-				(MSD_U16)((MSD_U16)pirlData->actionMode << 11) |
-				(MSD_U16)((MSD_U32)(pirlData->customSetup.ebsLimit >> 16) & (MSD_U32)0xFF));
+			pirlDataToRegs(pirlData, data);
 
 			for (i = 0; i < 9; i++)
 			{
@@ -686,6 +692,234 @@ MSD_STATUS Fir_gpirlSetResReg
 	return retVal;
 }
 
+/*******************************************************************************
+* Fir_gpirlProfileApply
+*
+* DESCRIPTION:
+*       This function writes the PIRL resources selected in a list of port
+*       profiles. Resources with a target rate get their bucket parameters
+*       from Fir_gpirlCustomSetup_sr2c, all of them are computed and checked
+*       before anything is written. With RMU the resource registers go out in
+*       multi register frames, several resources per frame.
+*
+* INPUTS:
+*       ports    - port profiles
+*       numPorts - number of port profiles
+*       verify   - MSD_TRUE to read the resources back after writing them
+*
+* OUTPUTS:
+*       ports    - customSetup of the resources with a target rate
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error, or a resource read back differs from its profile
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Nothing is written when a port, a resource or a target rate is bad.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gpirlProfileApply
+(
+    IN    MSD_QD_DEV       *dev,
+    INOUT FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN    MSD_U32          numPorts,
+    IN    MSD_BOOL         verify
+)
+{
+    MSD_STATUS       retVal;
+    FIR_MSD_PIRL_RES_PROFILE *res;
+    MSD_RegCmd       regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd       *pRegCmd;
+    MSD_U16          data[PIRL_RES_REGS];
+    MSD_U32          nCmd = 0;
+    MSD_U32          numMismatches = 0;
+    MSD_U32          i;
+    MSD_U32          r;
+
+    MSD_DBG_INFO(("Fir_gpirlProfileApply Called.\n"));
+
+    retVal = pirlProfileCheck(dev, ports, numPorts);
+    for (i = 0; (i < numPorts) && (retVal == MSD_OK); i++)
+    {
+        for (r = 0; r < FIR_MSD_PIRL_MAX_RES; r++)
+        {
+            res = &ports[i].res[r];
+            if (((ports[i].resMask & (MSD_U8)(1U << r)) == 0U) || (res->tgtRate == 0U))
+            {
+                continue;
+            }
+            retVal = Fir_gpirlCustomSetup_sr2c(res->tgtRate, res->tgtBstSize, &res->pirlData.customSetup);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Port %u resource %u: no bucket setup for rate %u burst %u.\n",
+                    (unsigned int)ports[i].port, (unsigned int)r, (unsigned int)res->tgtRate, (unsigned int)res->tgtBstSize));
+                break;
+            }
+        }
+    }
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_INFO(("Fir_gpirlProfileApply Exit.\n"));
+        return retVal;
+    }
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; (i < numPorts) && (retVal == MSD_OK); i++)
+        {
+            for (r = 0; (r < FIR_MSD_PIRL_MAX_RES) && (retVal == MSD_OK); r++)
+            {
+                if ((ports[i].resMask & (MSD_U8)(1U << r)) != 0U)
+                {
+                    retVal = Fir_gpirlWriteResource(dev, ports[i].port, r, &ports[i].res[r].pirlData);
+                }
+            }
+        }
+    }
+    else
+    {
+        msdSemTake(dev->devNum, dev->pirlRegsSem, OS_WAIT_FOREVER);
+        for (i = 0; (i < numPorts) && (retVal == MSD_OK); i++)
+        {
+            for (r = 0; r < FIR_MSD_PIRL_MAX_RES; r++)
+            {
+                if ((ports[i].resMask & (MSD_U8)(1U << r)) == 0U)
+                {
+                    continue;
+                }
+                if (nCmd + PIRL_RMU_WRITE_CMDS > MSD_RMU_MAX_REGCMDS)
+                {
+                    pRegCmd = regCmd;
+                    retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+                    nCmd = 0;
+                    if (retVal != MSD_OK)
+                    {
+                        break;
+                    }
+                }
+                pirlDataToRegs(&ports[i].res[r].pirlData, data);
+                pirlRmuWriteRes(regCmd, &nCmd, (MSD_U8)MSD_LPORT_2_PORT(ports[i].port), r, data);
+            }
+        }
+        if ((retVal == MSD_OK) && (nCmd != 0U))
+        {
+            pRegCmd = regCmd;
+            retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+        }
+        msdSemGive(dev->devNum, dev->pirlRegsSem);
+    }
+
+    if ((retVal == MSD_OK) && (verify == MSD_TRUE))
+    {
+        retVal = Fir_gpirlProfileVerify(dev, ports, numPorts, &numMismatches);
+        if ((retVal == MSD_OK) && (numMismatches != 0U))
+        {
+            MSD_DBG_ERROR(("PIRL profile read back has %u mismatches.\n", (unsigned int)numMismatches));
+            retVal = MSD_FAIL;
+        }
+    }
+
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_gpirlProfileApply returned: %s.\n", msdDisplayStatus(retVal)));
+    }
+
+    MSD_DBG_INFO(("Fir_gpirlProfileApply Exit.\n"));
+    return retVal;
+}
+
+/*******************************************************************************
+* Fir_gpirlProfileRead
+*
+* DESCRIPTION:
+*       This function reads the PIRL resources selected in a list of port
+*       profiles. With RMU several resources are read per frame.
+*
+* INPUTS:
+*       ports    - port profiles, port and resMask
+*       numPorts - number of port profiles
+*
+* OUTPUTS:
+*       ports    - pirlData of the selected resources
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       tgtRate and tgtBstSize are not changed.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gpirlProfileRead
+(
+    IN    MSD_QD_DEV       *dev,
+    INOUT FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN    MSD_U32          numPorts
+)
+{
+    MSD_STATUS       retVal;
+
+    MSD_DBG_INFO(("Fir_gpirlProfileRead Called.\n"));
+
+    retVal = pirlProfileCheck(dev, ports, numPorts);
+    if (retVal == MSD_OK)
+    {
+        retVal = pirlProfileReadBack(dev, ports, numPorts, ports, NULL);
+    }
+
+    MSD_DBG_INFO(("Fir_gpirlProfileRead Exit.\n"));
+    return retVal;
+}
+
+/*******************************************************************************
+* Fir_gpirlProfileVerify
+*
+* DESCRIPTION:
+*       This function reads back the PIRL resources selected in a list of port
+*       profiles and counts the resource registers that differ from them.
+*
+* INPUTS:
+*       ports    - port profiles
+*       numPorts - number of port profiles
+*
+* OUTPUTS:
+*       numMismatches - number of resource registers that differ
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       customSetup is compared as given, run Fir_gpirlProfileApply first for
+*       resources with a target rate.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gpirlProfileVerify
+(
+    IN  MSD_QD_DEV       *dev,
+    IN  const FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN  MSD_U32          numPorts,
+    OUT MSD_U32          *numMismatches
+)
+{
+    MSD_STATUS       retVal;
+
+    MSD_DBG_INFO(("Fir_gpirlProfileVerify Called.\n"));
+
+    *numMismatches = 0;
+    retVal = pirlProfileCheck(dev, ports, numPorts);
+    if (retVal == MSD_OK)
+    {
+        retVal = pirlProfileReadBack(dev, ports, numPorts, NULL, numMismatches);
+    }
+
+    MSD_DBG_INFO(("Fir_gpirlProfileVerify Exit.\n"));
+    return retVal;
+}
+
 /*******************************************************************************
 * statsOperationPerform
 *
@@ -961,3 +1195,316 @@ static MSD_STATUS Fir_pirlOperationPerform
     msdSemGive(dev->devNum, dev->pirlRegsSem);
     return retVal;
 }
+
+
+/* Resource data to the 9 resource registers */
+static void pirlDataToRegs
+(
+    IN  const FIR_MSD_PIRL_DATA *pirlData,
+    OUT MSD_U16              *data
+)
+{
+    /* reg0 data */
+    data[0] = (MSD_U16)(pirlData->bktTypeMask & (MSD_U32)0xFFFF);        /* Bit[15:0] : Traffic Type   */
+
+    /* reg1 data */
+    data[1] = (MSD_U16)((MSD_U16)((MSD_U16)((pirlData->samplingMode == MSD_TRUE) ? 1U : 0U) << 14) |	   /* Bit[14] : sampling Mode */
+        (MSD_U16)((MSD_U16)((pirlData->colorAware == MSD_TRUE) ? 1U : 0U) << 13) |			             /* Bit[13] : Color Aware */
+        (MSD_U16)((MSD_U16)((pirlData->accountGrnOverflow == MSD_TRUE) ? 1U : 0U) << 12) |             /* Bit[12] : AcctForGrnOvflow */
+        (MSD_U16)((MSD_U16)((pirlData->accountQConf == MSD_TRUE) ? 1U : 0U) << 11) |		           /* Bit[11] : AcctForQConf */
+        (MSD_U16)((MSD_U16)((pirlData->accountFiltered == MSD_TRUE) ? 1U : 0U) << 10) |              /* Bit[10] : AcctForFiltered */
+        (MSD_U16)((MSD_U16)((pirlData->priAndPt == MSD_TRUE) ? 1U : 0U) << 9) |			         /* Bit[9] : Priority And Packet Type */
+        (MSD_U16)((MSD_U16)((pirlData->useFPri == MSD_TRUE) ? 1U : 0U) << 8) |			             /* Bit[8] : Frame Priority vs Queue Priority */
+        (MSD_U16)(pirlData->priSelect & (MSD_U16)0xFF)); 					            /* Bit[7:0] : Priority Select */
+
+    /* reg2 data */
+    data[2] = (MSD_U16)((MSD_U16)((MSD_U16)pirlData->customSetup.countMode << 14) |
+        (MSD_U16)((MSD_U16)((pirlData->tcamFlows == MSD_TRUE) ? 1U : 0U) << 13) |
+        (MSD_U16)((pirlData->customSetup.bktIncrement) & (MSD_U16)0x1FFF));
+
+    /* reg3 data */
+    data[3] = (MSD_U16)(pirlData->customSetup.bktRateFactorGrn & (MSD_U16)0xFFFF);    /* Bit[15:0] : Bucket Rate Factor Green */
+
+    /* reg4 data */
+    data[4] = (MSD_U16)(pirlData->customSetup.cbsLimit & (MSD_U16)0xFFFF);   /* Bit[15:0] : CBS Limit[15:0] */
+
+    /* reg5 data */
+    data[5] = (MSD_U16)((MSD_U16)(pirlData->customSetup.cbsLimit >> 16) & (MSD_U16)0xFF);   /* Bit[7:0] : CBS Limit[23:16] */
+
+    /* reg6 data */
+    data[6] = (MSD_U16)(pirlData->customSetup.bktRateFactorYel & (MSD_U16)0xFFFF);		/* Bit[15:0] : Bucket Rate Factor Yellow */
+
+    /* reg7 data */
+    data[7] = (MSD_U16)(pirlData->customSetup.ebsLimit & (MSD_U16)0xFFFF);	/* Bit[15:0] : EBS Limit[15:0] */
+
+    /* reg8 data */
+    data[8] = (MSD_U16)((MSD_U16)(((MSD_U16)pirlData->fcPriority & (MSD_U16)0x7) << 13) |
+        (MSD_U16)((MSD_U16)pirlData->fcMode << 12) |
+        (MSD_U16)((MSD_U16)pirlData->actionMode << 11) |
+        (MSD_U16)((MSD_U32)(pirlData->customSetup.ebsLimit >> 16) & (MSD_U32)0xFF));
+}
+
+static void pirlRegsToData
+(
+    IN  MSD_U16              *data,
+    OUT FIR_MSD_PIRL_DATA    *pirlData
+)
+{
+    pirlData->bktTypeMask = (data[0]) & (MSD_U16)0xFFFF;
+    pirlData->tcamFlows = ((MSD_U16)(data[2] >> 13) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+    pirlData->priAndPt = ((MSD_U16)(data[1] >> 9) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+    pirlData->useFPri = ((MSD_U16)(data[1] >> 8) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+    pirlData->priSelect = (MSD_U8)(data[1] & (MSD_U16)0xff);
+
+    pirlData->colorAware = ((MSD_U16)(data[1] >> 13) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+
+    pirlData->accountGrnOverflow = ((MSD_U16)(data[1] >> 12) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+    pirlData->accountQConf = ((MSD_U16)(data[1] >> 11) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+    pirlData->accountFiltered = ((MSD_U16)(data[1] >> 10) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+
+    pirlData->samplingMode = ((MSD_U16)(data[1] >> 14) & (MSD_U16)0x1) == 1U ? MSD_TRUE : MSD_FALSE;
+
+    pirlData->actionMode = ((MSD_U16)(data[8] >> 11) & (MSD_U16)0x1) == 1U ? Fir_PIRL_ACTION_FC : Fir_PIRL_ACTION_DROP;
+    pirlData->fcMode = ((MSD_U16)(data[8] >> 12) & (MSD_U16)0x1) == 1U ? FIR_PIRL_FC_DEASSERT_EBS_LIMIT : FIR_PIRL_FC_DEASSERT_EMPTY;
+    pirlData->fcPriority = (MSD_U8)((data[8] >> 13) & (MSD_U16)0x7);
+
+    pirlData->customSetup.ebsLimit = ((MSD_U32)((MSD_U32)data[8] & (MSD_U32)0xFF) << 16) | ((MSD_U32)data[7] & (MSD_U32)0xFFFF);
+    pirlData->customSetup.cbsLimit = ((MSD_U32)((MSD_U32)data[5] & (MSD_U32)0xFF) << 16) | ((MSD_U32)data[4] & (MSD_U32)0xFFFF);
+    pirlData->customSetup.bktIncrement = (MSD_U32)data[2] & (MSD_U32)0x1FFF;
+    pirlData->customSetup.bktRateFactorGrn = (MSD_U32)data[3] & (MSD_U32)0xFFFF;
+    pirlData->customSetup.bktRateFactorYel = (MSD_U32)data[6] & (MSD_U32)0xFFFF;
+    pirlData->customSetup.countMode = (FIR_MSD_PIRL_COUNT_MODE)(MSD_U16)((MSD_U16)(data[2] >> 14) & (MSD_U16)3);
+    pirlData->customSetup.isValid = MSD_TRUE;
+}
+
+static MSD_STATUS pirlProfileCheck
+(
+    IN  MSD_QD_DEV           *dev,
+    IN  const FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN  MSD_U32              numPorts
+)
+{
+    MSD_U32 i;
+
+    if ((ports == NULL) && (numPorts != 0U))
+    {
+        MSD_DBG_ERROR(("Input param ports is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    for (i = 0; i < numPorts; i++)
+    {
+        if (MSD_LPORT_2_PORT(ports[i].port) == MSD_INVALID_PORT)
+        {
+            MSD_DBG_ERROR(("Bad Port: %u.\n", (unsigned int)ports[i].port));
+            return MSD_BAD_PARAM;
+        }
+    }
+    return MSD_OK;
+}
+
+/* Store a resource read back, or count its registers that differ from expected */
+static void pirlReadBackRes
+(
+    IN  const FIR_MSD_PIRL_DATA *expected,
+    IN  MSD_U16              *data,
+    OUT FIR_MSD_PIRL_DATA    *pirlData,
+    INOUT MSD_U32            *numMismatches
+)
+{
+    FIR_MSD_PIRL_DATA readData;
+    MSD_U16 want[PIRL_RES_REGS];
+    MSD_U16 got[PIRL_RES_REGS];
+    MSD_U32 k;
+
+    if (pirlData != NULL)
+    {
+        msdMemSet((void*)pirlData, 0, sizeof(FIR_MSD_PIRL_DATA));
+        pirlRegsToData(data, pirlData);
+        return;
+    }
+
+    /* compare only the bits a resource keeps */
+    msdMemSet((void*)&readData, 0, sizeof(FIR_MSD_PIRL_DATA));
+    pirlRegsToData(data, &readData);
+    pirlDataToRegs(&readData, got);
+    pirlDataToRegs(expected, want);
+    for (k = 0; k < PIRL_RES_REGS; k++)
+    {
+        if (got[k] != want[k])
+        {
+            *numMismatches += 1U;
+        }
+    }
+}
+
+static MSD_STATUS pirlProfileReadBack
+(
+    IN  MSD_QD_DEV           *dev,
+    IN  const FIR_MSD_PIRL_PORT_PROFILE *ports,
+    IN  MSD_U32              numPorts,
+    OUT FIR_MSD_PIRL_PORT_PROFILE *readPorts,
+    OUT MSD_U32              *numMismatches
+)
+{
+    MSD_STATUS       retVal = MSD_OK;
+    FIR_MSD_PIRL_DATA pirlData;
+    MSD_RegCmd       regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd       *pRegCmd;
+    MSD_U16          data[PIRL_RES_REGS];
+    MSD_U32          pendPort[PIRL_RMU_READ_RES];
+    MSD_U32          pendRes[PIRL_RMU_READ_RES];
+    MSD_U32          pendFirst[PIRL_RMU_READ_RES];
+    MSD_U32          nPend = 0;
+    MSD_U32          nCmd = 0;
+    MSD_U32          i;
+    MSD_U32          r;
+    MSD_U32          n;
+    MSD_U32          k;
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; (i < numPorts) && (retVal == MSD_OK); i++)
+        {
+            for (r = 0; (r < FIR_MSD_PIRL_MAX_RES) && (retVal == MSD_OK); r++)
+            {
+                if ((ports[i].resMask & (MSD_U8)(1U << r)) == 0U)
+                {
+                    continue;
+                }
+                retVal = Fir_gpirlReadResource(dev, ports[i].port, r, &pirlData);
+                if (retVal == MSD_OK)
+                {
+                    pirlDataToRegs(&pirlData, data);
+                    pirlReadBackRes(&ports[i].res[r].pirlData, data,
+                        (readPorts != NULL) ? &readPorts[i].res[r].pirlData : NULL, numMismatches);
+                }
+            }
+        }
+        return retVal;
+    }
+
+    msdSemTake(dev->devNum, dev->pirlRegsSem, OS_WAIT_FOREVER);
+    for (i = 0; (i <= numPorts) && (retVal == MSD_OK); i++)
+    {
+        for (r = 0; r < FIR_MSD_PIRL_MAX_RES; r++)
+        {
+            /* one pass past the last port sends the last frame */
+            if ((i < numPorts) && ((ports[i].resMask & (MSD_U8)(1U << r)) == 0U))
+            {
+                continue;
+            }
+            if (((i == numPorts) && (nPend != 0U)) || (nPend == PIRL_RMU_READ_RES))
+            {
+                pRegCmd = regCmd;
+                retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+                if (retVal != MSD_OK)
+                {
+                    break;
+                }
+                for (n = 0; n < nPend; n++)
+                {
+                    for (k = 0; k < PIRL_RES_REGS; k++)
+                    {
+                        data[k] = regCmd[pendFirst[n] + (k * 3U)].data;
+                    }
+                    pirlReadBackRes(&ports[pendPort[n]].res[pendRes[n]].pirlData, data,
+                        (readPorts != NULL) ? &readPorts[pendPort[n]].res[pendRes[n]].pirlData : NULL, numMismatches);
+                }
+                nCmd = 0;
+                nPend = 0;
+            }
+            if (i == numPorts)
+            {
+                break;
+            }
+            pendPort[nPend] = i;
+            pendRes[nPend] = r;
+            pendFirst[nPend] = pirlRmuReadRes(regCmd, &nCmd, (MSD_U8)MSD_LPORT_2_PORT(ports[i].port), r);
+            nPend++;
+        }
+    }
+    msdSemGive(dev->devNum, dev->pirlRegsSem);
+
+    return retVal;
+}
+
+static void pirlRmuAdd
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        opCode,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U16       data
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+    regCmd[*nCmd].opCode = opCode;
+    regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+    regCmd[*nCmd].regAddr = regAddr;
+    regCmd[*nCmd].data = data;
+    *nCmd += 1U;
+}
+
+/* Wait until the pirl is ready */
+static void pirlRmuAddWait
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+    regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+    regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+    regCmd[*nCmd].regAddr = FIR_IGR_RATE_COMMAND;
+    regCmd[*nCmd].data = 15U;
+    *nCmd += 1U;
+}
+
+static void pirlRmuWriteRes
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        port,
+    IN    MSD_U32       irlRes,
+    IN    MSD_U16       *data
+)
+{
+    MSD_U32 k;
+
+    for (k = 0; k < PIRL_RES_REGS; k++)
+    {
+        pirlRmuAddWait(regCmd, nCmd);
+        pirlRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_IGR_RATE_DATA, data[k]);
+        pirlRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_IGR_RATE_COMMAND,
+            (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_PIRL_WRITE_RESOURCE << 13) | (MSD_U16)(((MSD_U16)port & (MSD_U16)0x1f) << 8) |
+            (MSD_U16)(((MSD_U16)irlRes & (MSD_U16)0x7) << 5) | (MSD_U16)((MSD_U16)k & (MSD_U16)0xF)));
+    }
+}
+
+/* Read the 9 resource registers, returns the index of the first read, the others follow every 3 */
+static MSD_U32 pirlRmuReadRes
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        port,
+    IN    MSD_U32       irlRes
+)
+{
+    MSD_U32 first = 0;
+    MSD_U32 k;
+
+    pirlRmuAddWait(regCmd, nCmd);
+    for (k = 0; k < PIRL_RES_REGS; k++)
+    {
+        pirlRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_IGR_RATE_COMMAND,
+            (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_PIRL_READ_RESOURCE << 13) | (MSD_U16)(((MSD_U16)port & (MSD_U16)0x1f) << 8) |
+            (MSD_U16)(((MSD_U16)irlRes & (MSD_U16)0x7) << 5) | (MSD_U16)((MSD_U16)k & (MSD_U16)0xF)));
+        pirlRmuAddWait(regCmd, nCmd);
+        if (k == 0U)
+        {
+            first = *nCmd;
+        }
+        pirlRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_IGR_RATE_DATA, 0);
+    }
+    return first;
+}
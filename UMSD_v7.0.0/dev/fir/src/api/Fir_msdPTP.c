@@ -22,6 +22,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 typedef enum
 {
@@ -74,6 +75,16 @@ typedef struct
     MSD_U32    nData;
 } FIR_MSD_PTP_OP_DATA;
 
+/* Time stamp register sets per port, and the RMU commands to read one set */
+#define FIR_PTP_HARVEST_TYPES               4U
+#define FIR_PTP_HARVEST_SLOT_CMDS           7U
+#define FIR_PTP_HARVEST_SLOTS_PER_FRAME     (MSD_RMU_MAX_REGCMDS / FIR_PTP_HARVEST_SLOT_CMDS)
+
+/* Port registers of FIR_PTP_PORT_CONFIG: 0, 2, 0x1c, 0x1d and 0x1e */
+#define FIR_PTP_PORTCFG_REGS                5U
+#define FIR_PTP_PORTCFG_READ_CMDS           12U
+#define FIR_PTP_PORTCFG_PORTS_PER_FRAME     (MSD_RMU_MAX_REGCMDS / FIR_PTP_PORTCFG_READ_CMDS)
+
 
 /********************************************************/
 /*     static function declaration                      */
@@ -222,6 +233,71 @@ static MSD_STATUS gtaiRegSet
     IN  MSD_U32     regOffset,
     IN  MSD_U16     data
 );
+static MSD_U32 gptpHarvestTimeAddr
+(
+    IN  MSD_U32     timeType
+);
+static MSD_U16 gptpRmuCommand
+(
+    IN  FIR_MSD_PTP_OPERATION   ptpOp,
+    IN  MSD_U32     hwPort,
+    IN  MSD_U32     addr
+);
+static void gptpRmuAdd
+(
+    IN  MSD_RegCmd  *regCmd,
+    INOUT MSD_U32   *nCmd,
+    IN  MSD_U8      opCode,
+    IN  MSD_U8      regAddr,
+    IN  MSD_U16     data
+);
+static void gptpRmuAddWait
+(
+    IN  MSD_RegCmd  *regCmd,
+    INOUT MSD_U32   *nCmd
+);
+static void gptpHarvestResult
+(
+    IN  MSD_LPORT   port,
+    IN  MSD_U32     timeType,
+    IN  const MSD_U32 *tsData,
+    IN  MSD_U64     hostTime,
+    OUT FIR_PTP_TS_HARVEST *result
+);
+static MSD_STATUS gptpCrossTsLatch
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_BOOL    useTodCapture,
+    IN  MSD_U32     todCtrl,
+    OUT FIR_PTP_CROSS_TS_SAMPLE *sample
+);
+static MSD_STATUS gptpCrossTsReadTod
+(
+    IN  MSD_QD_DEV  *dev,
+    OUT MSD_U64     *todTime
+);
+static MSD_U32 gptpPortCfgAddr
+(
+    IN  MSD_U32     index
+);
+static MSD_STATUS gptpPortCfgRead
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U32     numPorts,
+    IN  const FIR_PTP_PORT_CONFIG *portCfg,
+    OUT MSD_U16     regs[][FIR_PTP_PORTCFG_REGS]
+);
+static void gptpPortCfgToRegs
+(
+    IN  const FIR_PTP_PORT_CONFIG *portCfg,
+    IN  const MSD_U16 *curRegs,
+    OUT MSD_U16     *regs
+);
+static void gptpPortCfgFromRegs
+(
+    IN  const MSD_U16 *regs,
+    OUT FIR_PTP_PORT_CONFIG *portCfg
+);
 
 
 /********************************************************/
@@ -596,6 +672,162 @@ MSD_STATUS Fir_gptpGetIntStatus
     return retVal;
 }
 
+MSD_STATUS Fir_gptpHarvestTimeStamps
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    IN  const MSD_LPORT    *ports,
+    IN  MSD_U32    timeMask,
+    IN  MSD_U32    maxResults,
+    OUT FIR_PTP_TS_HARVEST    *results,
+    OUT MSD_U32    *numResults
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    FIR_MSD_PTP_OP_DATA opData;
+    MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd = &(regCmd[0]);
+    MSD_U32 slotIndex[FIR_PTP_HARVEST_SLOTS_PER_FRAME];
+    MSD_U32 slotFirst[FIR_PTP_HARVEST_SLOTS_PER_FRAME];
+    MSD_U32 clearPort[FIR_PTP_HARVEST_SLOTS_PER_FRAME];
+    MSD_U32 clearAddr[FIR_PTP_HARVEST_SLOTS_PER_FRAME];
+    MSD_U32 nClear = 0;
+    MSD_U32 nSlots;
+    MSD_U32 nFrame;
+    MSD_U32 nCmd;
+    MSD_U32 slot;
+    MSD_U32 i;
+    MSD_U64 hostTime;
+
+    MSD_DBG_INFO(("Fir_gptpHarvestTimeStamps Called.\n"));
+
+    if ((ports == NULL) || (results == NULL) || (numResults == NULL))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if ((timeMask == 0U) || ((timeMask & ~(MSD_U32)FIR_PTP_HARVEST_ALL) != 0U))
+    {
+        MSD_DBG_ERROR(("Invalid timeMask %x.\n", timeMask));
+        return MSD_BAD_PARAM;
+    }
+    for (i = 0; i < numPorts; i++)
+    {
+        if ((ports[i] == 0U) || (MSD_LPORT_2_PORT(ports[i]) == MSD_INVALID_PORT))
+        {
+            MSD_DBG_ERROR(("Failed (Bad Port %u).\n", (unsigned int)ports[i]));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    *numResults = 0;
+    nSlots = numPorts * FIR_PTP_HARVEST_TYPES;
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (slot = 0; (slot < nSlots) && (*numResults < maxResults); slot++)
+        {
+            if ((timeMask & ((MSD_U32)1 << (slot % FIR_PTP_HARVEST_TYPES))) == 0U)
+            {
+                continue;
+            }
+
+            /* Read and clear the valid bit in one operation */
+            opData.ptpPort = MSD_LPORT_2_PORT(ports[slot / FIR_PTP_HARVEST_TYPES]);
+            opData.ptpBlock = (MSD_U32)FIR_MSD_AVB_BLOCK_PTP;
+            opData.ptpAddr = gptpHarvestTimeAddr(slot % FIR_PTP_HARVEST_TYPES);
+            opData.nData = 4;
+            retVal = ptpOperationPerform(dev, FIR_PTP_READ_TIMESTAMP_DATA, &opData);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Failed ptpOperation.\n"));
+                return retVal;
+            }
+            hostTime = (dev->getTime != NULL) ? dev->getTime() : 0U;
+
+            if ((opData.ptpMultiData[0] & (MSD_U32)0x1) == (MSD_U32)1)
+            {
+                gptpHarvestResult(ports[slot / FIR_PTP_HARVEST_TYPES], slot % FIR_PTP_HARVEST_TYPES,
+                    opData.ptpMultiData, hostTime, &results[*numResults]);
+                *numResults += 1U;
+            }
+        }
+    }
+    else
+    {
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+        slot = 0;
+        while ((retVal == MSD_OK) && (((slot < nSlots) && (*numResults < maxResults)) || (nClear != 0U)))
+        {
+            /* Clear the slots consumed from the previous frame first */
+            nCmd = 0;
+            for (i = 0; i < nClear; i++)
+            {
+                gptpRmuAddWait(regCmd, &nCmd);
+                gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, 0);
+                gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+                    gptpRmuCommand(FIR_PTP_WRITE_DATA, clearPort[i], clearAddr[i]));
+            }
+            nClear = 0;
+
+            nFrame = 0;
+            while ((slot < nSlots) && (nCmd + FIR_PTP_HARVEST_SLOT_CMDS + 1U <= MSD_RMU_MAX_REGCMDS))
+            {
+                if ((timeMask & ((MSD_U32)1 << (slot % FIR_PTP_HARVEST_TYPES))) != 0U)
+                {
+                    gptpRmuAddWait(regCmd, &nCmd);
+                    gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+                        gptpRmuCommand(FIR_PTP_READ_MULTIPLE_DATA, MSD_LPORT_2_PORT(ports[slot / FIR_PTP_HARVEST_TYPES]),
+                        gptpHarvestTimeAddr(slot % FIR_PTP_HARVEST_TYPES)));
+                    gptpRmuAddWait(regCmd, &nCmd);
+                    slotFirst[nFrame] = nCmd;
+                    for (i = 0; i < 4U; i++)
+                    {
+                        gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+                    }
+                    slotIndex[nFrame] = slot;
+                    nFrame++;
+                }
+                slot++;
+            }
+            gptpRmuAddWait(regCmd, &nCmd);
+
+            retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+                break;
+            }
+            hostTime = (dev->getTime != NULL) ? dev->getTime() : 0U;
+
+            /* Sets read beyond maxResults stay valid for the next harvest */
+            for (i = 0; (i < nFrame) && (*numResults < maxResults); i++)
+            {
+                opData.ptpMultiData[0] = regCmd[slotFirst[i]].data;
+                if ((opData.ptpMultiData[0] & (MSD_U32)0x1) == (MSD_U32)1)
+                {
+                    opData.ptpMultiData[1] = regCmd[slotFirst[i] + 1U].data;
+                    opData.ptpMultiData[2] = regCmd[slotFirst[i] + 2U].data;
+                    opData.ptpMultiData[3] = regCmd[slotFirst[i] + 3U].data;
+                    gptpHarvestResult(ports[slotIndex[i] / FIR_PTP_HARVEST_TYPES], slotIndex[i] % FIR_PTP_HARVEST_TYPES,
+                        opData.ptpMultiData, hostTime, &results[*numResults]);
+                    *numResults += 1U;
+
+                    clearPort[nClear] = MSD_LPORT_2_PORT(ports[slotIndex[i] / FIR_PTP_HARVEST_TYPES]);
+                    clearAddr[nClear] = gptpHarvestTimeAddr(slotIndex[i] % FIR_PTP_HARVEST_TYPES);
+                    nClear++;
+                }
+            }
+        }
+
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+    }
+
+    MSD_DBG_INFO(("Fir_gptpHarvestTimeStamps Exit.\n"));
+    return retVal;
+}
+
 MSD_STATUS Fir_gptpSetMeanPathDelay
 (
     IN  MSD_QD_DEV* dev,
@@ -606,7 +838,7 @@ MSD_STATUS Fir_gptpSetMeanPathDelay
     MSD_STATUS retVal;
     MSD_DBG_INFO(("Fir_gptpSetMeanPathDelay Called.\n"));
 
-    retVal = gptpSetReg(dev, portNum, (MSD_U32)0x1c, (MSD_U32)delay);
+    retVal = Fir_gptpSetMeanPathDelays(dev, 1U, &portNum, &delay);
     if (retVal != MSD_OK)
     {
         MSD_DBG_ERROR(("Writing mean path delay error\n"));
@@ -731,6 +963,241 @@ MSD_STATUS Fir_gptpGetEgrPathDelayAsym
     return retVal;
 }
 
+MSD_STATUS Fir_gptpSetPortConfigs
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    IN  const FIR_PTP_PORT_CONFIG    *portCfg
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd = &(regCmd[0]);
+    MSD_U16 curRegs[FIR_PTP_PORTCFG_PORTS_PER_FRAME][FIR_PTP_PORTCFG_REGS];
+    MSD_U16 regs[FIR_PTP_PORTCFG_REGS];
+    MSD_U32 first;
+    MSD_U32 n;
+    MSD_U32 nCmd;
+    MSD_U32 hwPort;
+    MSD_U32 i;
+    MSD_U32 j;
+
+    MSD_DBG_INFO(("Fir_gptpSetPortConfigs Called.\n"));
+
+    if ((portCfg == NULL) && (numPorts != 0U))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    for (i = 0; i < numPorts; i++)
+    {
+        if ((portCfg[i].port == 0U) || (MSD_LPORT_2_PORT(portCfg[i].port) == MSD_INVALID_PORT) ||
+            (portCfg[i].transSpec > 0xFU) || (portCfg[i].oneStepCfg > 3U))
+        {
+            MSD_DBG_ERROR(("Failed (Bad config for port %u).\n", (unsigned int)portCfg[i].port));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    for (first = 0; (retVal == MSD_OK) && (first < numPorts); first += n)
+    {
+        n = numPorts - first;
+        if (n > FIR_PTP_PORTCFG_PORTS_PER_FRAME)
+        {
+            n = FIR_PTP_PORTCFG_PORTS_PER_FRAME;
+        }
+
+        retVal = gptpPortCfgRead(dev, n, &portCfg[first], curRegs);
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+
+        /* Write back only the registers that change */
+        nCmd = 0;
+        for (i = 0; (retVal == MSD_OK) && (i < n); i++)
+        {
+            hwPort = MSD_LPORT_2_PORT(portCfg[first + i].port);
+            gptpPortCfgToRegs(&portCfg[first + i], curRegs[i], regs);
+            for (j = 0; j < FIR_PTP_PORTCFG_REGS; j++)
+            {
+                if (regs[j] == curRegs[i][j])
+                {
+                    continue;
+                }
+
+                if (!(IS_RMU_SUPPORTED(dev)))
+                {
+                    retVal = gptpSetReg(dev, portCfg[first + i].port, gptpPortCfgAddr(j), (MSD_U32)regs[j]);
+                    if (retVal != MSD_OK)
+                    {
+                        MSD_DBG_ERROR(("Set the PTP register error\n"));
+                        break;
+                    }
+                    continue;
+                }
+
+                if (nCmd + 4U > MSD_RMU_MAX_REGCMDS)
+                {
+                    gptpRmuAddWait(regCmd, &nCmd);
+                    msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+                    retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+                    msdSemGive(dev->devNum, dev->ptpRegsSem);
+                    nCmd = 0;
+                    if (retVal != MSD_OK)
+                    {
+                        MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+                        break;
+                    }
+                }
+                gptpRmuAddWait(regCmd, &nCmd);
+                gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, regs[j]);
+                gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+                    gptpRmuCommand(FIR_PTP_WRITE_DATA, hwPort, gptpPortCfgAddr(j)));
+            }
+        }
+
+        if ((retVal == MSD_OK) && (nCmd != 0U))
+        {
+            gptpRmuAddWait(regCmd, &nCmd);
+            msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+            retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+            msdSemGive(dev->devNum, dev->ptpRegsSem);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+            }
+        }
+    }
+
+    MSD_DBG_INFO(("Fir_gptpSetPortConfigs Exit.\n"));
+    return retVal;
+}
+
+MSD_STATUS Fir_gptpGetPortConfigs
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    INOUT FIR_PTP_PORT_CONFIG    *portCfg
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_U16 regs[FIR_PTP_PORTCFG_PORTS_PER_FRAME][FIR_PTP_PORTCFG_REGS];
+    MSD_U32 first;
+    MSD_U32 n;
+    MSD_U32 i;
+
+    MSD_DBG_INFO(("Fir_gptpGetPortConfigs Called.\n"));
+
+    if ((portCfg == NULL) && (numPorts != 0U))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    for (i = 0; i < numPorts; i++)
+    {
+        if ((portCfg[i].port == 0U) || (MSD_LPORT_2_PORT(portCfg[i].port) == MSD_INVALID_PORT))
+        {
+            MSD_DBG_ERROR(("Failed (Bad Port %u).\n", (unsigned int)portCfg[i].port));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    for (first = 0; first < numPorts; first += n)
+    {
+        n = numPorts - first;
+        if (n > FIR_PTP_PORTCFG_PORTS_PER_FRAME)
+        {
+            n = FIR_PTP_PORTCFG_PORTS_PER_FRAME;
+        }
+
+        retVal = gptpPortCfgRead(dev, n, &portCfg[first], regs);
+        if (retVal != MSD_OK)
+        {
+            break;
+        }
+        for (i = 0; i < n; i++)
+        {
+            gptpPortCfgFromRegs(regs[i], &portCfg[first + i]);
+        }
+    }
+
+    MSD_DBG_INFO(("Fir_gptpGetPortConfigs Exit.\n"));
+    return retVal;
+}
+
+MSD_STATUS Fir_gptpSetMeanPathDelays
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    numPorts,
+    IN  const MSD_LPORT    *ports,
+    IN  const MSD_U16    *delays
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd = &(regCmd[0]);
+    MSD_U32 nCmd;
+    MSD_U32 i;
+
+    MSD_DBG_INFO(("Fir_gptpSetMeanPathDelays Called.\n"));
+
+    if (((ports == NULL) || (delays == NULL)) && (numPorts != 0U))
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    for (i = 0; i < numPorts; i++)
+    {
+        if ((ports[i] == 0U) || (MSD_LPORT_2_PORT(ports[i]) == MSD_INVALID_PORT))
+        {
+            MSD_DBG_ERROR(("Failed (Bad Port %u).\n", (unsigned int)ports[i]));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; i < numPorts; i++)
+        {
+            retVal = gptpSetReg(dev, ports[i], (MSD_U32)0x1c, (MSD_U32)delays[i]);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Writing mean path delay error\n"));
+                break;
+            }
+        }
+    }
+    else
+    {
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+        i = 0;
+        while ((retVal == MSD_OK) && (i < numPorts))
+        {
+            nCmd = 0;
+            while ((i < numPorts) && (nCmd + 4U <= MSD_RMU_MAX_REGCMDS))
+            {
+                gptpRmuAddWait(regCmd, &nCmd);
+                gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, delays[i]);
+                gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+                    gptpRmuCommand(FIR_PTP_WRITE_DATA, MSD_LPORT_2_PORT(ports[i]), 0x1cU));
+                i++;
+            }
+            gptpRmuAddWait(regCmd, &nCmd);
+
+            retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+            }
+        }
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+    }
+
+    MSD_DBG_INFO(("Fir_gptpSetMeanPathDelays Exit.\n"));
+    return retVal;
+}
+
 MSD_STATUS Fir_gptpGetTODBusyBitStatus
 (
     IN  MSD_QD_DEV* dev,
@@ -977,6 +1444,128 @@ MSD_STATUS Fir_gtaiGetPTPGlobalTime
     return retVal;
 }
 
+MSD_STATUS Fir_gptpCrossTimeStamp
+(
+    IN  MSD_QD_DEV* dev,
+    IN  MSD_U32    nSamples,
+    IN  MSD_BOOL   useTodCapture,
+    IN  MSD_U8     timeArrayIndex,
+    OUT FIR_PTP_CROSS_TS_SAMPLE    *samples,
+    OUT FIR_PTP_CROSS_TS    *crossTs
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    FIR_MSD_PTP_OP_DATA   opData;
+    FIR_PTP_CROSS_TS_SAMPLE sample;
+    MSD_BOOL todBusy;
+    MSD_U32 todCtrl = 0;
+    MSD_U64 window;
+    MSD_U32 i;
+
+    MSD_DBG_INFO(("Fir_gptpCrossTimeStamp Called.\n"));
+
+    if ((crossTs == NULL) || (nSamples == 0U))
+    {
+        MSD_DBG_ERROR(("Input param is invalid.\n"));
+        return MSD_BAD_PARAM;
+    }
+    if (dev->getTime == NULL)
+    {
+        MSD_DBG_ERROR(("No BSP getTime function registered.\n"));
+        return MSD_NOT_SUPPORTED;
+    }
+
+    if (useTodCapture != MSD_FALSE)
+    {
+        if (!(timeArrayIndex < (MSD_U8)2))
+        {
+            MSD_DBG_ERROR(("Time array index is over range.\n"));
+            return MSD_BAD_PARAM;
+        }
+
+        retVal = Fir_gptpGetTODBusyBitStatus(dev, &todBusy);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+        if (todBusy != MSD_FALSE)
+        {
+            return MSD_BUSY;
+        }
+
+        msdSemTake(dev->devNum, dev->ptpTodSem, OS_WAIT_FOREVER);
+
+        /* Build the capture word once so that each sample is a single write */
+        opData.ptpBlock = 0;
+        opData.ptpPort = 0x1F;    /* Global register */
+        opData.ptpAddr = 0x12;
+        retVal = ptpOperationPerform(dev, FIR_PTP_READ_DATA, &opData);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Failed reading ToD operation control.\n"));
+            msdSemGive(dev->devNum, dev->ptpTodSem);
+            return retVal;
+        }
+        todCtrl = ((MSD_U32)1 << 15) |
+            ((MSD_U32)4 << 12) |
+            (((MSD_U32)timeArrayIndex & 1U) << 9) |
+            (opData.ptpData & 0x89ffU);
+    }
+
+    for (i = 0; i < nSamples; i++)
+    {
+        retVal = gptpCrossTsLatch(dev, useTodCapture, todCtrl, &sample);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Failed latching switch time.\n"));
+            break;
+        }
+
+        if (useTodCapture != MSD_FALSE)
+        {
+            /* Read back the captured ToD, outside of the host time window */
+            retVal = gptpCrossTsReadTod(dev, &sample.switchTime);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Failed reading ToD.\n"));
+                break;
+            }
+        }
+
+        if (samples != NULL)
+        {
+            samples[i] = sample;
+        }
+        if ((i == 0U) ||
+            ((sample.hostAfter - sample.hostBefore) < (crossTs->best.hostAfter - crossTs->best.hostBefore)))
+        {
+            crossTs->best = sample;
+        }
+    }
+
+    if (useTodCapture != MSD_FALSE)
+    {
+        msdSemGive(dev->devNum, dev->ptpTodSem);
+    }
+
+    if (retVal == MSD_OK)
+    {
+        window = crossTs->best.hostAfter - crossTs->best.hostBefore;
+        crossTs->uncertainty = (window + 1U) / 2U;
+        if (useTodCapture != MSD_FALSE)
+        {
+            crossTs->offset = (MSD_64)(crossTs->best.switchTime - (crossTs->best.hostBefore + (window / 2U)));
+        }
+        else
+        {
+            crossTs->offset = 0;
+        }
+    }
+
+    MSD_DBG_INFO(("Fir_gptpCrossTimeStamp Exit.\n"));
+    return retVal;
+}
+
 MSD_STATUS Fir_gptpPortRegGet
 (
     IN  MSD_QD_DEV  *dev,
@@ -2728,3 +3317,422 @@ static MSD_STATUS gtaiRegSet
     MSD_LPORT portNum = 0x1EU;
     return gptpSetReg(dev, portNum, regOffset, (MSD_U32)data);
 }
+
+/************ Time stamp harvest   ***************/
+static MSD_U32 gptpHarvestTimeAddr
+(
+    IN  MSD_U32     timeType
+)
+{
+    MSD_U32 addr;
+
+    switch (timeType)
+    {
+        case (MSD_U32)FIR_PTP_ARR0_TIME:
+            addr = 8U;
+            break;
+        case (MSD_U32)FIR_PTP_ARR1_TIME:
+            addr = 12U;
+            break;
+        case (MSD_U32)FIR_PTP_DEP_TIME:
+            addr = 16U;
+            break;
+        default:
+            addr = 24U;
+            break;
+    }
+    return addr;
+}
+
+static MSD_U16 gptpRmuCommand
+(
+    IN  FIR_MSD_PTP_OPERATION   ptpOp,
+    IN  MSD_U32     hwPort,
+    IN  MSD_U32     addr
+)
+{
+    MSD_U16 ptpOperation;
+
+    ptpOperation = (MSD_U16)ptpOp;
+    ptpOperation &= 3U;
+    ptpOperation <<= 13;
+    return (MSD_U16)((MSD_U16)1 << 15) | ptpOperation |
+            (MSD_U16)(hwPort << 8) |
+            (MSD_U16)((MSD_U32)FIR_MSD_AVB_BLOCK_PTP << 5) |
+            (MSD_U16)(addr & 0x1FU);
+}
+
+static void gptpRmuAdd
+(
+    IN  MSD_RegCmd  *regCmd,
+    INOUT MSD_U32   *nCmd,
+    IN  MSD_U8      opCode,
+    IN  MSD_U8      regAddr,
+    IN  MSD_U16     data
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+    regCmd[*nCmd].opCode = opCode;
+    regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+    regCmd[*nCmd].regAddr = regAddr;
+    regCmd[*nCmd].data = data;
+    *nCmd += 1U;
+}
+
+/* Wait until the busy bit of the AVB command register clears */
+static void gptpRmuAddWait
+(
+    IN  MSD_RegCmd  *regCmd,
+    INOUT MSD_U32   *nCmd
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+    regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+    regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+    regCmd[*nCmd].regAddr = FIR_AVB_COMMAND;
+    regCmd[*nCmd].data = 15U;
+    *nCmd += 1U;
+}
+
+static void gptpHarvestResult
+(
+    IN  MSD_LPORT   port,
+    IN  MSD_U32     timeType,
+    IN  const MSD_U32 *tsData,
+    IN  MSD_U64     hostTime,
+    OUT FIR_PTP_TS_HARVEST *result
+)
+{
+    MSD_U32 temp;
+
+    result->port = port;
+    result->timeType = (FIR_PTP_TIME)timeType;
+    result->hostTime = hostTime;
+    result->tsStatus.isValid = MSD_TRUE;
+    temp = (tsData[0] >> 1) & (MSD_U32)0x3;
+    if (temp == (MSD_U32)0)
+    {
+        result->tsStatus.status = MSD_PTP_INT_NORMAL;
+    }
+    else if (temp == (MSD_U32)1)
+    {
+        result->tsStatus.status = MSD_PTP_INT_OVERWRITE;
+    }
+    else
+    {
+        result->tsStatus.status = MSD_PTP_INT_DROP;
+    }
+    result->tsStatus.timeStamped = FIRMSD_PTP_BUILD_TIME(tsData[2], tsData[1]);
+    result->tsStatus.ptpSeqId = tsData[3];
+}
+
+/* Latch the switch time once, bracketed by the BSP getTime function */
+static MSD_STATUS gptpCrossTsLatch
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_BOOL    useTodCapture,
+    IN  MSD_U32     todCtrl,
+    OUT FIR_PTP_CROSS_TS_SAMPLE *sample
+)
+{
+    MSD_STATUS retVal;
+    FIR_MSD_PTP_OP_DATA opData;
+    FIR_MSD_PTP_OPERATION op;
+    MSD_RegCmd regCmd[6];
+    MSD_RegCmd *pRegCmd = &(regCmd[0]);
+    MSD_U32 nCmd = 0;
+
+    opData.ptpBlock = 0;
+    if (useTodCapture != MSD_FALSE)
+    {
+        op = FIR_PTP_WRITE_DATA;
+        opData.ptpPort = 0x1F;    /* Global register */
+        opData.ptpAddr = 0x12;
+        opData.ptpData = todCtrl;
+    }
+    else
+    {
+        op = FIR_PTP_READ_MULTIPLE_DATA;
+        opData.ptpPort = 0x1E;    /* TAI Global */
+        opData.ptpAddr = 14;
+        opData.nData = 2;
+    }
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        sample->hostBefore = dev->getTime();
+        retVal = ptpOperationPerform(dev, op, &opData);
+        sample->hostAfter = dev->getTime();
+    }
+    else
+    {
+        /* Only one frame round trip inside the window */
+        gptpRmuAddWait(regCmd, &nCmd);
+        if (useTodCapture != MSD_FALSE)
+        {
+            gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, (MSD_U16)todCtrl);
+        }
+        gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+            gptpRmuCommand(op, opData.ptpPort, opData.ptpAddr));
+        gptpRmuAddWait(regCmd, &nCmd);
+        if (useTodCapture == MSD_FALSE)
+        {
+            gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+            gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+        }
+
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+        sample->hostBefore = dev->getTime();
+        retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+        sample->hostAfter = dev->getTime();
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+        opData.ptpMultiData[0] = regCmd[nCmd - 2U].data;
+        opData.ptpMultiData[1] = regCmd[nCmd - 1U].data;
+    }
+
+    if ((retVal == MSD_OK) && (useTodCapture == MSD_FALSE))
+    {
+        sample->switchTime = (opData.ptpMultiData[1] << 16) | opData.ptpMultiData[0];
+    }
+    else
+    {
+        sample->switchTime = 0;
+    }
+
+    return retVal;
+}
+
+/* Read the captured ToD as nanoseconds, in one frame over RMU */
+static MSD_STATUS gptpCrossTsReadTod
+(
+    IN  MSD_QD_DEV  *dev,
+    OUT MSD_U64     *todTime
+)
+{
+    MSD_STATUS retVal;
+    FIR_MSD_PTP_OP_DATA opData;
+    MSD_RegCmd regCmd[11];
+    MSD_RegCmd *pRegCmd = &(regCmd[0]);
+    MSD_U32 nCmd = 0;
+    MSD_U32 tod[5];
+    MSD_U32 i;
+    MSD_U64 seconds;
+
+    opData.ptpBlock = 0;
+    opData.ptpPort = 0x1F;    /* Global register */
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        opData.ptpAddr = 0x17;
+        retVal = ptpOperationPerform(dev, FIR_PTP_READ_DATA, &opData);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+        tod[4] = opData.ptpData;
+
+        opData.ptpAddr = 0x13;
+        opData.nData = 4;
+        retVal = ptpOperationPerform(dev, FIR_PTP_READ_MULTIPLE_DATA, &opData);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+        for (i = 0; i < 4U; i++)
+        {
+            tod[i] = opData.ptpMultiData[i];
+        }
+    }
+    else
+    {
+        gptpRmuAddWait(regCmd, &nCmd);
+        gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+            gptpRmuCommand(FIR_PTP_READ_MULTIPLE_DATA, 0x1FU, 0x13U));
+        gptpRmuAddWait(regCmd, &nCmd);
+        for (i = 0; i < 5U; i++)
+        {
+            /* ToD seconds high follows the 4 ToD words at 0x17 */
+            gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+        }
+        gptpRmuAddWait(regCmd, &nCmd);
+
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+        retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+        for (i = 0; i < 5U; i++)
+        {
+            tod[i] = regCmd[3U + i].data;
+        }
+    }
+
+    seconds = ((MSD_U64)(tod[4] & 0xffffU) << 32) |
+        ((tod[3] & 0xffffU) << 16) |
+        (tod[2] & 0xffffU);
+    *todTime = (seconds * (MSD_U64)1000000000U) +
+        (((tod[1] & 0xffffU) << 16) | (tod[0] & 0xffffU));
+
+    return MSD_OK;
+}
+
+static MSD_U32 gptpPortCfgAddr
+(
+    IN  MSD_U32     index
+)
+{
+    MSD_U32 addr;
+
+    switch (index)
+    {
+    case 0U:
+        addr = 0x0U;
+        break;
+    case 1U:
+        addr = 0x2U;
+        break;
+    default:
+        addr = 0x1aU + index;
+        break;
+    }
+    return addr;
+}
+
+/* Read port registers 0-2 and 0x1c-0x1e of up to FIR_PTP_PORTCFG_PORTS_PER_FRAME ports */
+static MSD_STATUS gptpPortCfgRead
+(
+    IN  MSD_QD_DEV  *dev,
+    IN  MSD_U32     numPorts,
+    IN  const FIR_PTP_PORT_CONFIG *portCfg,
+    OUT MSD_U16     regs[][FIR_PTP_PORTCFG_REGS]
+)
+{
+    MSD_STATUS retVal;
+    FIR_MSD_PTP_OP_DATA opData;
+    MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd = &(regCmd[0]);
+    MSD_U32 nCmd = 0;
+    MSD_U32 hwPort;
+    MSD_U32 i;
+    MSD_U32 j;
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; i < numPorts; i++)
+        {
+            opData.ptpPort = MSD_LPORT_2_PORT(portCfg[i].port);
+            opData.ptpBlock = (MSD_U32)FIR_MSD_AVB_BLOCK_PTP;
+            opData.ptpAddr = 0x0U;
+            opData.nData = 3;
+            retVal = ptpOperationPerform(dev, FIR_PTP_READ_MULTIPLE_DATA, &opData);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Failed ptpOperation.\n"));
+                return retVal;
+            }
+            regs[i][0] = (MSD_U16)opData.ptpMultiData[0];
+            regs[i][1] = (MSD_U16)opData.ptpMultiData[2];
+
+            opData.ptpAddr = 0x1cU;
+            retVal = ptpOperationPerform(dev, FIR_PTP_READ_MULTIPLE_DATA, &opData);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Failed ptpOperation.\n"));
+                return retVal;
+            }
+            for (j = 0; j < 3U; j++)
+            {
+                regs[i][2U + j] = (MSD_U16)opData.ptpMultiData[j];
+            }
+        }
+        return MSD_OK;
+    }
+
+    for (i = 0; i < numPorts; i++)
+    {
+        hwPort = MSD_LPORT_2_PORT(portCfg[i].port);
+        gptpRmuAddWait(regCmd, &nCmd);
+        gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+            gptpRmuCommand(FIR_PTP_READ_MULTIPLE_DATA, hwPort, 0x0U));
+        gptpRmuAddWait(regCmd, &nCmd);
+        for (j = 0; j < 3U; j++)
+        {
+            gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+        }
+        gptpRmuAddWait(regCmd, &nCmd);
+        gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+            gptpRmuCommand(FIR_PTP_READ_MULTIPLE_DATA, hwPort, 0x1cU));
+        gptpRmuAddWait(regCmd, &nCmd);
+        for (j = 0; j < 3U; j++)
+        {
+            gptpRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+        }
+    }
+
+    msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+    retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+    msdSemGive(dev->devNum, dev->ptpRegsSem);
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+        return retVal;
+    }
+
+    for (i = 0; i < numPorts; i++)
+    {
+        nCmd = i * FIR_PTP_PORTCFG_READ_CMDS;
+        regs[i][0] = regCmd[nCmd + 3U].data;
+        regs[i][1] = regCmd[nCmd + 5U].data;
+        for (j = 0; j < 3U; j++)
+        {
+            regs[i][2U + j] = regCmd[nCmd + 9U + j].data;
+        }
+    }
+
+    return MSD_OK;
+}
+
+static void gptpPortCfgToRegs
+(
+    IN  const FIR_PTP_PORT_CONFIG *portCfg,
+    IN  const MSD_U16 *curRegs,
+    OUT MSD_U16     *regs
+)
+{
+    regs[0] = curRegs[0];
+    MSD_BF_SET(regs[0], (portCfg->ptpEn == MSD_TRUE) ? 0U : 1U, 0, 1);
+    MSD_BF_SET(regs[0], portCfg->oneStepCfg, 6, 2);
+    MSD_BF_SET(regs[0], (portCfg->oneStepSync == MSD_TRUE) ? 1U : 0U, 8, 1);
+    MSD_BF_SET(regs[0], portCfg->transSpec, 12, 4);
+
+    regs[1] = curRegs[1];
+    MSD_BF_SET(regs[1], (portCfg->intEn.ptpArrIntEn == MSD_TRUE) ? 1U : 0U, 0, 1);
+    MSD_BF_SET(regs[1], (portCfg->intEn.ptpDepIntEn == MSD_TRUE) ? 1U : 0U, 1, 1);
+    MSD_BF_SET(regs[1], (portCfg->hwAccel == MSD_TRUE) ? 1U : 0U, 6, 1);
+
+    regs[2] = portCfg->meanPathDelay;
+    regs[3] = portCfg->igrPathDelayAsym;
+    regs[4] = portCfg->egrPathDelayAsym;
+}
+
+static void gptpPortCfgFromRegs
+(
+    IN  const MSD_U16 *regs,
+    OUT FIR_PTP_PORT_CONFIG *portCfg
+)
+{
+    portCfg->ptpEn = (MSD_BF_GET(regs[0], 0, 1) == 0U) ? MSD_TRUE : MSD_FALSE;
+    portCfg->oneStepCfg = (MSD_U8)MSD_BF_GET(regs[0], 6, 2);
+    portCfg->oneStepSync = (MSD_BF_GET(regs[0], 8, 1) == 1U) ? MSD_TRUE : MSD_FALSE;
+    portCfg->transSpec = (MSD_U8)MSD_BF_GET(regs[0], 12, 4);
+
+    portCfg->intEn.ptpArrIntEn = (MSD_BF_GET(regs[1], 0, 1) == 1U) ? MSD_TRUE : MSD_FALSE;
+    portCfg->intEn.ptpDepIntEn = (MSD_BF_GET(regs[1], 1, 1) == 1U) ? MSD_TRUE : MSD_FALSE;
+    portCfg->hwAccel = (MSD_BF_GET(regs[1], 6, 1) == 1U) ? MSD_TRUE : MSD_FALSE;
+
+    portCfg->meanPathDelay = regs[2];
+    portCfg->igrPathDelayAsym = regs[3];
+    portCfg->egrPathDelayAsym = regs[4];
+}
@@ -24,6 +24,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 
 /**********************************************************************************************
@@ -164,6 +165,69 @@ IN  MSD_U8        op,
 IN  MSD_U8        flowMeterId
 );
 
+#if !(defined(__KERNEL__) && defined(LINUX))
+static MSD_STATUS Fir_flowMeterRateTune
+(
+IN  MSD_U32       tgtRate,
+OUT MSD_U16       *bktDec,
+OUT MSD_U16       *bktTokenFactorGrn,
+OUT MSD_U16       *bktByteFactorGrn
+);
+#endif
+
+/* bulk provisioning, register writes collected into RMU frames */
+typedef struct
+{
+	MSD_RegCmd	regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_U32		nCmd;
+	MSD_U32		opStatus[MSD_RMU_MAX_REGCMDS];
+	MSD_U32		nOp;
+} FIR_QCI_BULK;
+
+static MSD_STATUS Fir_qciBulkWrite
+(
+IN    MSD_QD_DEV    *dev,
+INOUT FIR_QCI_BULK  *bulk,
+IN    MSD_U8        qciBlock,
+IN    MSD_U8        regAddr,
+IN    MSD_U16       dataVal,
+IN    MSD_BOOL      isOp
+);
+
+static MSD_STATUS Fir_qciBulkFlush
+(
+IN    MSD_QD_DEV    *dev,
+INOUT FIR_QCI_BULK  *bulk
+);
+
+static MSD_U8 Fir_qciAllocId
+(
+INOUT MSD_U32       *inUse,
+IN    MSD_U32       numIds
+);
+
+static MSD_U16 Fir_qciAvbCommand
+(
+IN  MSD_U16       avbOp,
+IN  MSD_U8        qciBlock,
+IN  MSD_U8        regAddr
+);
+
+static void Fir_qciRmuAdd
+(
+IN    MSD_RegCmd    *regCmd,
+INOUT MSD_U32       *nCmd,
+IN    MSD_U8        opCode,
+IN    MSD_U8        regAddr,
+IN    MSD_U16       data
+);
+
+static void Fir_qciRmuAddWait
+(
+IN    MSD_RegCmd    *regCmd,
+INOUT MSD_U32       *nCmd
+);
+
 /************************************************************************************************************************************/
 /****************************************** below is public function ***************************************************************/
 /***********************************************************************************************************************************/
@@ -2311,20 +2375,11 @@ IN  MSD_U8  countMode
 	MSD_U8 regAdr;
 	MSD_U16 tempData;
 
-	MSD_U32 flowMeter_constant = (MSD_U32)500000000;
-	MSD_U16 bktDecrement = (MSD_U16)0x2000;
 	MSD_U16 bktDec = 0U;
 	MSD_U16 bktTokenFactorGrn = 0U;
 	MSD_U16 bktByteFactorGrn = 0U;
-	MSD_U16 tmpBktTokenFactorGrn = 0U;
-	MSD_U16 tmpBktByteFactorGrn = 0U;
 	MSD_U32 cbsLimit = (MSD_U32)(2U * bstSize);
 
-	MSD_DOUBLE Rate = 0.0;
-	MSD_DOUBLE delta = 1.0, deltaMin = 1.0, mode = 1.0;
-	MSD_DOUBLE tgRate = (MSD_DOUBLE)(tgtRate * 1000.0);
-	MSD_U32 j;
-
 	MSD_DBG_INFO(("Fir_gqciFlowMeterAdvConfig Called.\n"));
 
 	if (tgtRate > 0U && tgtRate < 61)
@@ -2341,52 +2396,11 @@ IN  MSD_U8  countMode
 
 	if (tgtRate != 0)
 	{
-		for (j = 1U; j < bktDecrement; j++)
-		{
-			tmpBktByteFactorGrn = (MSD_U16)(tgRate / flowMeter_constant);
-
-			if ((MSD_U32)((tgRate / flowMeter_constant) * j * mode + 0.5) < (MSD_U32)0xFFFF)
-			{
-				tmpBktTokenFactorGrn = (MSD_U16)(((tgRate / flowMeter_constant) - tmpBktByteFactorGrn) * j * mode + 0.5);
-			}
-			else
-			{
-				continue;
-			}
-
-			Rate = (MSD_DOUBLE)(((MSD_DOUBLE)flowMeter_constant / mode) * ((MSD_DOUBLE)tmpBktByteFactorGrn + (MSD_DOUBLE)(tmpBktTokenFactorGrn / (j * mode))));
-			delta = (MSD_DOUBLE)(((tgRate * mode) - Rate) / tgRate);
-			if (delta < (MSD_DOUBLE)0)
-			{
-				delta = (MSD_DOUBLE)0 - delta;
-			}
-
-			if (deltaMin > delta)
-			{
-				deltaMin = delta;
-				bktDec = (MSD_U16)j;
-				bktTokenFactorGrn = tmpBktTokenFactorGrn;
-				bktByteFactorGrn = tmpBktByteFactorGrn;
-
-				if (bktTokenFactorGrn >= bktDec)
-				{
-					continue;
-				}
-
-				if (delta == (MSD_DOUBLE)0)
-				{
-					break;
-				}
-			}
-		}
-
-		if (deltaMin == (MSD_DOUBLE)1)
+		retVal = Fir_flowMeterRateTune(tgtRate, &bktDec, &bktTokenFactorGrn, &bktByteFactorGrn);
+		if (retVal != MSD_OK)
 		{
-			MSD_DBG_ERROR(("Failed (Fir_gqciFlowMeterAdvConfig tune failed).\n"));
-			return MSD_FAIL;
+			return retVal;
 		}
-
-		MSD_DBG_INFO(("delta((tgtRate - rate)/tgtRate) = %f", deltaMin));
 	}
 
 	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
@@ -2546,6 +2560,583 @@ IN  MSD_U8  countMode
 
 
 
+/******************************************************************************
+* Fir_gqciStreamsProvision
+*
+* DESCRIPTION:
+*        This routine provisions a list of streams in one call. Each stream
+*        gets a stream filter, a stream gate with its gate control list when
+*        numGateEntries is not 0, and a flow meter when meterEn is set. The
+*        gate time generations of the request are shared by the gated streams.
+*        Instances are taken from the free ones in resources, lowest first,
+*        and all register writes are sent in RMU frames when RMU is in use.
+*
+* INPUTS:
+*        numTimeGens     - number of gate time generations
+*        timeGens        - gate time generations
+*        numStreams      - number of streams
+*        streams         - streams to provision
+*        resources       - instances already in use
+*
+* OUTPUTS:
+*        timeGenIds      - time generation instance of each timeGens entry
+*        resources       - updated with the instances taken
+*        ids             - instances of each stream
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NO_SPACE - if there are not enough free instances, nothing is
+*                       written in this case
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The instances taken must be free (flushed): their registers are
+*        written whole instead of read, modified and written back. Flow meter
+*        tuning and instance allocation are done before any register write.
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciStreamsProvision
+(
+IN    MSD_QD_DEV	*dev,
+IN    MSD_U32	numTimeGens,
+IN    const FIR_MSD_QCI_TIME_GEN	*timeGens,
+OUT   MSD_U8	*timeGenIds,
+IN    MSD_U32	numStreams,
+IN    const FIR_MSD_QCI_STREAM	*streams,
+INOUT FIR_MSD_QCI_RESOURCES	*resources,
+OUT   FIR_MSD_QCI_STREAM_IDS	*ids
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	FIR_QCI_BULK bulk;
+	const FIR_MSD_QCI_STREAM *st;
+	MSD_U32 filterInUse;
+	MSD_U32 gateInUse;
+	MSD_U32 timeGenInUse;
+	MSD_U32 meterInUse[FIR_QCI_MAX_FLOW_METERS / 32U];
+	MSD_U16 bktDec;
+	MSD_U16 bktTokenFactorGrn;
+	MSD_U16 bktByteFactorGrn;
+	MSD_U32 cbsLimit;
+	MSD_U32 cycleTime;
+	MSD_U16 dataVal;
+	MSD_U8 trigSel = 0;
+	MSD_U8 gateId;
+	MSD_U32 i;
+	MSD_U32 j;
+
+	MSD_DBG_INFO(("Fir_gqciStreamsProvision Called.\n"));
+
+	if ((resources == NULL) || ((numStreams != 0U) && ((streams == NULL) || (ids == NULL))) ||
+		((numTimeGens != 0U) && ((timeGens == NULL) || (timeGenIds == NULL))))
+	{
+		MSD_DBG_ERROR(("Input param is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	for (i = 0; i < numStreams; i++)
+	{
+		st = &streams[i];
+		if ((st->maxSDUSize > (MSD_U16)0x3FFF) || (st->numGateEntries > FIR_QCI_MAX_GATE_ENTRIES) ||
+			((st->numGateEntries != 0U) && (st->timeGen >= numTimeGens)))
+		{
+			MSD_DBG_ERROR(("Bad stream %u.\n", (unsigned int)i));
+			return MSD_BAD_PARAM;
+		}
+		if (st->meterEn == MSD_TRUE)
+		{
+#if defined(__KERNEL__) && defined(LINUX)
+			return MSD_NOT_SUPPORTED;
+#else
+			if (((st->tgtRate > 0U) && (st->tgtRate < 61U)) || (st->countMode > 2U))
+			{
+				MSD_DBG_ERROR(("Bad flow meter of stream %u.\n", (unsigned int)i));
+				return MSD_BAD_PARAM;
+			}
+			if (st->tgtRate != 0U)
+			{
+				retVal = Fir_flowMeterRateTune(st->tgtRate, &bktDec, &bktTokenFactorGrn, &bktByteFactorGrn);
+				if (retVal != MSD_OK)
+				{
+					return retVal;
+				}
+			}
+#endif
+		}
+	}
+
+	/* take all instances up front, nothing is written when one runs out */
+	filterInUse = resources->streamFilters;
+	gateInUse = resources->streamGates;
+	timeGenInUse = resources->timeGens;
+	for (i = 0; i < FIR_QCI_MAX_FLOW_METERS / 32U; i++)
+	{
+		meterInUse[i] = resources->flowMeters[i];
+	}
+	for (i = 0; i < numTimeGens; i++)
+	{
+		timeGenIds[i] = Fir_qciAllocId(&timeGenInUse, FIR_QCI_MAX_TIME_GENS);
+		if (timeGenIds[i] == (MSD_U8)FIR_QCI_NO_ID)
+		{
+			retVal = MSD_NO_SPACE;
+		}
+	}
+	for (i = 0; i < numStreams; i++)
+	{
+		ids[i].streamFilterId = Fir_qciAllocId(&filterInUse, FIR_QCI_MAX_STREAM_FILTERS);
+		ids[i].streamGateId = (MSD_U8)FIR_QCI_NO_ID;
+		ids[i].flowMeterId = (MSD_U8)FIR_QCI_NO_ID;
+		if (ids[i].streamFilterId == (MSD_U8)FIR_QCI_NO_ID)
+		{
+			retVal = MSD_NO_SPACE;
+		}
+		if (streams[i].numGateEntries != 0U)
+		{
+			ids[i].streamGateId = Fir_qciAllocId(&gateInUse, FIR_QCI_MAX_STREAM_GATES);
+			if (ids[i].streamGateId == (MSD_U8)FIR_QCI_NO_ID)
+			{
+				retVal = MSD_NO_SPACE;
+			}
+		}
+		if (streams[i].meterEn == MSD_TRUE)
+		{
+			ids[i].flowMeterId = Fir_qciAllocId(meterInUse, FIR_QCI_MAX_FLOW_METERS);
+			if (ids[i].flowMeterId == (MSD_U8)FIR_QCI_NO_ID)
+			{
+				retVal = MSD_NO_SPACE;
+			}
+		}
+	}
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Not enough free Qci instances.\n"));
+		return retVal;
+	}
+
+	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+
+	bulk.nCmd = 0;
+	bulk.nOp = 0;
+
+	/* the unit of the cycle time follows TrigGenTimeSel (see TAI offset 0x12) */
+	if (numTimeGens != 0U)
+	{
+		retVal = Fir_taiBasicRead(dev, (MSD_U8)0x12, &dataVal);
+		trigSel = (MSD_U8)((dataVal & (MSD_U16)0x60) >> 5);
+		if ((retVal == MSD_OK) && (trigSel == 3U))
+		{
+			MSD_DBG_ERROR(("TrigGenTimeSel is reseved, please check.\n"));
+			retVal = MSD_BAD_PARAM;
+		}
+	}
+
+	for (i = 0; (i < numTimeGens) && (retVal == MSD_OK); i++)
+	{
+		cycleTime = (trigSel == 0U) ? (timeGens[i].gateCycleTime / 4U) : timeGens[i].gateCycleTime;
+		retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE_TIME_GEN, 2U, (MSD_U16)(cycleTime & (MSD_U32)0xFFFF), MSD_FALSE);
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE_TIME_GEN, 3U, (MSD_U16)((cycleTime >> 16) & (MSD_U32)0xFF), MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE_TIME_GEN, 4U, (MSD_U16)(timeGens[i].gateBaseTime & (MSD_U32)0xFFFF), MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE_TIME_GEN, 5U, (MSD_U16)((timeGens[i].gateBaseTime >> 16) & (MSD_U32)0xFFFF), MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE_TIME_GEN, 6U, (MSD_U16)((timeGens[i].gateBaseTime >> 32) & (MSD_U32)0xFF), MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE_TIME_GEN, 1U, 1U, MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE_TIME_GEN, 0U,
+				(MSD_U16)((MSD_U16)0x8000 | ((MSD_U16)timeGenIds[i] & (MSD_U16)0x3)), MSD_TRUE);
+		}
+	}
+
+	for (i = 0; (i < numStreams) && (retVal == MSD_OK); i++)
+	{
+		st = &streams[i];
+
+		/* stream gate: gate control list first, then the gate instance */
+		if (st->numGateEntries != 0U)
+		{
+			gateId = ids[i].streamGateId;
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 0U, (MSD_U16)gateId, MSD_FALSE);
+			for (j = 0; (j < st->numGateEntries) && (retVal == MSD_OK); j++)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 5U,
+					(MSD_U16)((MSD_U16)(((MSD_U16)st->gateEntries[j].gateState & (MSD_U16)0x1) << 4) |
+					(MSD_U16)(((MSD_U16)st->gateEntries[j].gateIPVEn & (MSD_U16)0x1) << 3) |
+					(MSD_U16)((MSD_U16)st->gateEntries[j].gateIPV & (MSD_U16)0x7)), MSD_FALSE);
+				if (retVal == MSD_OK)
+				{
+					retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 6U, st->gateEntries[j].gateWindowTime, MSD_FALSE);
+				}
+				if (retVal == MSD_OK)
+				{
+					retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 7U, st->gateEntries[j].gateAllowedBytes, MSD_FALSE);
+				}
+				if (retVal == MSD_OK)
+				{
+					retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 4U, (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)j), MSD_TRUE);
+				}
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 1U,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)(((MSD_U16)st->defGateState & (MSD_U16)0x1) << 12) |
+					(MSD_U16)(((MSD_U16)st->defGateIPVEn & (MSD_U16)0x1) << 11) | (MSD_U16)(((MSD_U16)st->defGateIPV & (MSD_U16)0x7) << 8)), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 2U,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)(((MSD_U16)st->timeScale & (MSD_U16)0x3) << 10) |
+					(MSD_U16)(((MSD_U16)st->byteScale & (MSD_U16)0x3) << 8) | (MSD_U16)((MSD_U16)timeGenIds[st->timeGen] & (MSD_U16)0x3)), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_GATE, 0U,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)LOAD << 12) | (MSD_U16)gateId), MSD_TRUE);
+			}
+		}
+
+		/* stream filter */
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_FILTER, 1U, (MSD_U16)((MSD_U16)st->blockEn & (MSD_U16)0x1), MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			dataVal = (st->numGateEntries != 0U) ? (MSD_U16)((MSD_U16)0x80 | (MSD_U16)ids[i].streamGateId) : (MSD_U16)0;
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_FILTER, 2U, dataVal, MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_FILTER, 3U, st->maxSDUSize, MSD_FALSE);
+		}
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)STREAM_FILTER, 0U,
+				(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)LOAD << 12) | (MSD_U16)ids[i].streamFilterId), MSD_TRUE);
+		}
+
+#if !(defined(__KERNEL__) && defined(LINUX))
+		/* flow meter */
+		if ((retVal == MSD_OK) && (st->meterEn == MSD_TRUE))
+		{
+			bktDec = 0U;
+			bktTokenFactorGrn = 0U;
+			bktByteFactorGrn = 0U;
+			if (st->tgtRate != 0U)
+			{
+				retVal = Fir_flowMeterRateTune(st->tgtRate, &bktDec, &bktTokenFactorGrn, &bktByteFactorGrn);
+			}
+			cbsLimit = (MSD_U32)(2U * st->bstSize);
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)FLOW_METER, 1U,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)(((MSD_U16)st->countMode & (MSD_U16)0x3) << 12) |
+					(MSD_U16)(((MSD_U16)st->dropOnYel & (MSD_U16)0x1) << 10) | (MSD_U16)(((MSD_U16)st->coupleFlag & (MSD_U16)0x1) << 9) |
+					(MSD_U16)((MSD_U16)st->redBlockEn & (MSD_U16)0x1)), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)FLOW_METER, 2U, (MSD_U16)(bktDec & (MSD_U16)0x1FFF), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)FLOW_METER, 3U, (MSD_U16)(bktTokenFactorGrn & (MSD_U16)0x1FFF), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)FLOW_METER, 5U, (MSD_U16)(bktByteFactorGrn & (MSD_U16)0x3F), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)FLOW_METER, 6U, (MSD_U16)(cbsLimit & (MSD_U32)0xFFFF), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)FLOW_METER, 7U, (MSD_U16)((cbsLimit >> 16) & (MSD_U32)0xFF), MSD_FALSE);
+			}
+			if (retVal == MSD_OK)
+			{
+				retVal = Fir_qciBulkWrite(dev, &bulk, (MSD_U8)FLOW_METER, 0U,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)LOAD << 12) | (MSD_U16)ids[i].flowMeterId), MSD_TRUE);
+			}
+		}
+#endif
+	}
+
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_qciBulkFlush(dev, &bulk);
+	}
+
+	msdSemGive(dev->devNum, dev->qciRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Qci provisioning returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	resources->streamFilters = (MSD_U16)filterInUse;
+	resources->streamGates = (MSD_U16)gateInUse;
+	resources->timeGens = (MSD_U8)timeGenInUse;
+	for (i = 0; i < FIR_QCI_MAX_FLOW_METERS / 32U; i++)
+	{
+		resources->flowMeters[i] = meterInUse[i];
+	}
+
+	MSD_DBG_INFO(("Fir_gqciStreamsProvision Exit.\n"));
+	return retVal;
+}
+
+
+/******************************************************************************
+* Fir_gqciCountersSnapshot
+*
+* DESCRIPTION:
+*        This routine reads the matching, filtered, stream gate filtered and
+*        flow meter filtered frames counters of stream filters firstId to
+*        firstId + numIds - 1. With RMU all counters are read in two frames
+*        at most, so the values are close to each other in time.
+*
+* INPUTS:
+*        firstId         - first stream filter instance identifier
+*        numIds          - number of stream filter instances
+*
+* OUTPUTS:
+*        snapshot        - counters and the time they were read
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        None
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciCountersSnapshot
+(
+IN  MSD_QD_DEV	*dev,
+IN  MSD_U8	firstId,
+IN  MSD_U8	numIds,
+OUT FIR_MSD_QCI_SNAPSHOT	*snapshot
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = regCmd;
+	MSD_U32 nCmd;
+	MSD_U32 first[FIR_QCI_MAX_STREAM_FILTERS];
+	MSD_U16 ctr[4];
+	MSD_U32 i;
+	MSD_U32 n;
+	MSD_U32 k;
+	MSD_U8 id;
+
+	MSD_DBG_INFO(("Fir_gqciCountersSnapshot Called.\n"));
+
+	if ((snapshot == NULL) || (numIds == 0U) || ((MSD_U32)firstId + (MSD_U32)numIds > FIR_QCI_MAX_STREAM_FILTERS))
+	{
+		MSD_DBG_ERROR(("Input param is invalid.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	msdSemTake(dev->devNum, dev->qciRegsSem, OS_WAIT_FOREVER);
+
+	if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; (i < numIds) && (retVal == MSD_OK); i++)
+		{
+			retVal = Fir_streamFilterOperation(dev, (MSD_U8)READ, (MSD_U8)(firstId + i));
+			for (k = 0; (k < 4U) && (retVal == MSD_OK); k++)
+			{
+				retVal = Fir_streamFilterBasicRead(dev, (MSD_U8)(4U + k), &ctr[k]);
+			}
+			if (retVal == MSD_OK)
+			{
+				snapshot->counters[i].matchCtr = ctr[0];
+				snapshot->counters[i].filterCtr = ctr[1];
+				snapshot->counters[i].gateFiltCtr = ctr[2];
+				snapshot->counters[i].meterFiltCtr = ctr[3];
+			}
+		}
+	}
+	else
+	{
+		msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+		i = 0;
+		while ((i < numIds) && (retVal == MSD_OK))
+		{
+			/* read operation, then registers 0 (operation status) to 7 in one post increment read */
+			nCmd = 0;
+			n = 0;
+			while ((i + n < numIds) && (nCmd + 15U <= MSD_RMU_MAX_REGCMDS))
+			{
+				id = (MSD_U8)(firstId + i + n);
+				Fir_qciRmuAddWait(regCmd, &nCmd);
+				Fir_qciRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)READ << 12) | (MSD_U16)id));
+				Fir_qciRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND, Fir_qciAvbCommand(0x3U, (MSD_U8)STREAM_FILTER, 0));
+				Fir_qciRmuAddWait(regCmd, &nCmd);
+				Fir_qciRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND, Fir_qciAvbCommand(0x2U, (MSD_U8)STREAM_FILTER, 0));
+				Fir_qciRmuAddWait(regCmd, &nCmd);
+				first[n] = nCmd;
+				for (k = 0; k < 8U; k++)
+				{
+					Fir_qciRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+				}
+				n++;
+			}
+
+			retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			if (retVal != MSD_OK)
+			{
+				MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+				break;
+			}
+
+			for (k = 0; k < n; k++)
+			{
+				if ((regCmd[first[k]].data & (MSD_U16)0x8000) != 0U)
+				{
+					MSD_DBG_ERROR(("Stream filter read still busy in RMU frame.\n"));
+					retVal = MSD_FAIL;
+					break;
+				}
+				snapshot->counters[i + k].matchCtr = regCmd[first[k] + 4U].data;
+				snapshot->counters[i + k].filterCtr = regCmd[first[k] + 5U].data;
+				snapshot->counters[i + k].gateFiltCtr = regCmd[first[k] + 6U].data;
+				snapshot->counters[i + k].meterFiltCtr = regCmd[first[k] + 7U].data;
+			}
+			i += n;
+		}
+
+		msdSemGive(dev->devNum, dev->ptpRegsSem);
+	}
+
+	msdSemGive(dev->devNum, dev->qciRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Qci counter snapshot returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	snapshot->timeStamp = (dev->getTime != NULL) ? dev->getTime() : 0U;
+	snapshot->firstId = firstId;
+	snapshot->numIds = numIds;
+
+	MSD_DBG_INFO(("Fir_gqciCountersSnapshot Exit.\n"));
+	return retVal;
+}
+
+
+/******************************************************************************
+* Fir_gqciCountersDelta
+*
+* DESCRIPTION:
+*        This routine takes a new snapshot of the stream filters of a previous
+*        snapshot and reports the stream filters whose counters changed, with
+*        the increase of each counter.
+*
+* INPUTS:
+*        snapshot        - previous snapshot, from Fir_gqciCountersSnapshot
+*
+* OUTPUTS:
+*        snapshot        - replaced by the new snapshot
+*        deltas          - changed stream filters, room for snapshot->numIds
+*        numDeltas       - number of entries in deltas
+*
+* RETURNS:
+*        MSD_OK      - on success
+*        MSD_FAIL    - on error
+*        MSD_BAD_PARAM - if input parameters are beyond range.
+*        MSD_NOT_SUPPORTED - if current device does not support this feature.
+*
+* COMMENTS:
+*        The counters are 16 bits, a counter that advanced by 65536 or more
+*        between the two snapshots is reported short.
+*
+******************************************************************************/
+MSD_STATUS Fir_gqciCountersDelta
+(
+IN    MSD_QD_DEV	*dev,
+INOUT FIR_MSD_QCI_SNAPSHOT	*snapshot,
+OUT   FIR_MSD_QCI_COUNTER_DELTA	*deltas,
+OUT   MSD_U32	*numDeltas
+)
+{
+	MSD_STATUS retVal;
+	FIR_MSD_QCI_COUNTERS prev[FIR_QCI_MAX_STREAM_FILTERS];
+	FIR_MSD_QCI_COUNTERS *cur;
+	FIR_MSD_QCI_COUNTER_DELTA *d;
+	MSD_U32 i;
+
+	MSD_DBG_INFO(("Fir_gqciCountersDelta Called.\n"));
+
+	if ((snapshot == NULL) || (deltas == NULL) || (numDeltas == NULL))
+	{
+		MSD_DBG_ERROR(("Input param is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+	if ((snapshot->numIds == 0U) || ((MSD_U32)snapshot->firstId + (MSD_U32)snapshot->numIds > FIR_QCI_MAX_STREAM_FILTERS))
+	{
+		MSD_DBG_ERROR(("Bad snapshot range.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	for (i = 0; i < snapshot->numIds; i++)
+	{
+		prev[i] = snapshot->counters[i];
+	}
+
+	retVal = Fir_gqciCountersSnapshot(dev, snapshot->firstId, snapshot->numIds, snapshot);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	*numDeltas = 0;
+	for (i = 0; i < snapshot->numIds; i++)
+	{
+		cur = &snapshot->counters[i];
+		if ((cur->matchCtr == prev[i].matchCtr) && (cur->filterCtr == prev[i].filterCtr) &&
+			(cur->gateFiltCtr == prev[i].gateFiltCtr) && (cur->meterFiltCtr == prev[i].meterFiltCtr))
+		{
+			continue;
+		}
+
+		d = &deltas[*numDeltas];
+		d->streamFilterId = (MSD_U8)(snapshot->firstId + i);
+		d->delta.matchCtr = (MSD_U16)(cur->matchCtr - prev[i].matchCtr);
+		d->delta.filterCtr = (MSD_U16)(cur->filterCtr - prev[i].filterCtr);
+		d->delta.gateFiltCtr = (MSD_U16)(cur->gateFiltCtr - prev[i].gateFiltCtr);
+		d->delta.meterFiltCtr = (MSD_U16)(cur->meterFiltCtr - prev[i].meterFiltCtr);
+		*numDeltas += 1U;
+	}
+
+	MSD_DBG_INFO(("Fir_gqciCountersDelta Exit.\n"));
+	return MSD_OK;
+}
+
+
 /* TSN basic read/write */
 static MSD_STATUS Fir_TSNBasicRead
 (
@@ -3228,4 +3819,247 @@ IN  MSD_U8        flowMeterId
 	}
 
 	return retVal;
-}
\ No newline at end of file
+}
+
+
+#if !(defined(__KERNEL__) && defined(LINUX))
+/* flow meter bktDec, BTRF and BBRF closest to the target rate */
+static MSD_STATUS Fir_flowMeterRateTune
+(
+IN  MSD_U32       tgtRate,
+OUT MSD_U16       *bktDec,
+OUT MSD_U16       *bktTokenFactorGrn,
+OUT MSD_U16       *bktByteFactorGrn
+)
+{
+	MSD_U32 flowMeter_constant = (MSD_U32)500000000;
+	MSD_U16 bktDecrement = (MSD_U16)0x2000;
+	MSD_U16 tmpBktTokenFactorGrn = 0U;
+	MSD_U16 tmpBktByteFactorGrn = 0U;
+
+	MSD_DOUBLE Rate = 0.0;
+	MSD_DOUBLE delta = 1.0, deltaMin = 1.0, mode = 1.0;
+	MSD_DOUBLE tgRate = (MSD_DOUBLE)(tgtRate * 1000.0);
+	MSD_U32 j;
+
+	*bktDec = 0U;
+	*bktTokenFactorGrn = 0U;
+	*bktByteFactorGrn = 0U;
+
+	for (j = 1U; j < bktDecrement; j++)
+	{
+		tmpBktByteFactorGrn = (MSD_U16)(tgRate / flowMeter_constant);
+
+		if ((MSD_U32)((tgRate / flowMeter_constant) * j * mode + 0.5) < (MSD_U32)0xFFFF)
+		{
+			tmpBktTokenFactorGrn = (MSD_U16)(((tgRate / flowMeter_constant) - tmpBktByteFactorGrn) * j * mode + 0.5);
+		}
+		else
+		{
+			continue;
+		}
+
+		Rate = (MSD_DOUBLE)(((MSD_DOUBLE)flowMeter_constant / mode) * ((MSD_DOUBLE)tmpBktByteFactorGrn + (MSD_DOUBLE)(tmpBktTokenFactorGrn / (j * mode))));
+		delta = (MSD_DOUBLE)(((tgRate * mode) - Rate) / tgRate);
+		if (delta < (MSD_DOUBLE)0)
+		{
+			delta = (MSD_DOUBLE)0 - delta;
+		}
+
+		if (deltaMin > delta)
+		{
+			deltaMin = delta;
+			*bktDec = (MSD_U16)j;
+			*bktTokenFactorGrn = tmpBktTokenFactorGrn;
+			*bktByteFactorGrn = tmpBktByteFactorGrn;
+
+			if (*bktTokenFactorGrn >= *bktDec)
+			{
+				continue;
+			}
+
+			if (delta == (MSD_DOUBLE)0)
+			{
+				break;
+			}
+		}
+	}
+
+	if (deltaMin == (MSD_DOUBLE)1)
+	{
+		MSD_DBG_ERROR(("Failed (flow meter rate tune failed).\n"));
+		return MSD_FAIL;
+	}
+
+	MSD_DBG_INFO(("delta((tgtRate - rate)/tgtRate) = %f", deltaMin));
+
+	return MSD_OK;
+}
+#endif
+
+static MSD_STATUS Fir_qciBulkFlush
+(
+IN    MSD_QD_DEV    *dev,
+INOUT FIR_QCI_BULK  *bulk
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd *pRegCmd = bulk->regCmd;
+	MSD_U32 i;
+
+	if (bulk->nCmd == 0U)
+	{
+		return MSD_OK;
+	}
+
+	/* wait until the last AVB command is done */
+	Fir_qciRmuAddWait(bulk->regCmd, &bulk->nCmd);
+
+	msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+	retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, bulk->nCmd);
+	msdSemGive(dev->devNum, dev->ptpRegsSem);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	/* every Qci operation has to be done before the next register write of the frame */
+	for (i = 0; i < bulk->nOp; i++)
+	{
+		if ((bulk->regCmd[bulk->opStatus[i]].data & (MSD_U16)0x8000) != 0U)
+		{
+			MSD_DBG_ERROR(("Qci operation still busy in RMU frame.\n"));
+			return MSD_FAIL;
+		}
+	}
+
+	bulk->nCmd = 0;
+	bulk->nOp = 0;
+	return MSD_OK;
+}
+
+static MSD_STATUS Fir_qciBulkWrite
+(
+IN    MSD_QD_DEV    *dev,
+INOUT FIR_QCI_BULK  *bulk,
+IN    MSD_U8        qciBlock,
+IN    MSD_U8        regAddr,
+IN    MSD_U16       dataVal,
+IN    MSD_BOOL      isOp
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	FIR_MSD_TSN_OP_DATA	opData;
+
+	if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		if (isOp == MSD_TRUE)
+		{
+			retVal = Fir_waitQciBusyBitClear(dev, regAddr, qciBlock);
+		}
+		if (retVal == MSD_OK)
+		{
+			opData.tsnBlock = 0x4;
+			opData.tsnPort = qciBlock;
+			opData.tsnAddr = regAddr;
+			opData.tsnData = dataVal;
+			retVal = Fir_TSNBasicWrite(dev, &opData);
+		}
+		if ((retVal == MSD_OK) && (isOp == MSD_TRUE))
+		{
+			retVal = Fir_waitQciBusyBitClear(dev, regAddr, qciBlock);
+		}
+		return retVal;
+	}
+
+	/* data and command writes, the operation status read back, and the final wait */
+	if (bulk->nCmd + 8U > MSD_RMU_MAX_REGCMDS)
+	{
+		retVal = Fir_qciBulkFlush(dev, bulk);
+		if (retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	Fir_qciRmuAddWait(bulk->regCmd, &bulk->nCmd);
+	Fir_qciRmuAdd(bulk->regCmd, &bulk->nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, dataVal);
+	Fir_qciRmuAdd(bulk->regCmd, &bulk->nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND, Fir_qciAvbCommand(0x3U, qciBlock, regAddr));
+	if (isOp == MSD_TRUE)
+	{
+		/* read back the operation register */
+		Fir_qciRmuAddWait(bulk->regCmd, &bulk->nCmd);
+		Fir_qciRmuAdd(bulk->regCmd, &bulk->nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND, Fir_qciAvbCommand(0x0U, qciBlock, regAddr));
+		Fir_qciRmuAddWait(bulk->regCmd, &bulk->nCmd);
+		bulk->opStatus[bulk->nOp] = bulk->nCmd;
+		bulk->nOp++;
+		Fir_qciRmuAdd(bulk->regCmd, &bulk->nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+	}
+
+	return MSD_OK;
+}
+
+static MSD_U8 Fir_qciAllocId
+(
+INOUT MSD_U32       *inUse,
+IN    MSD_U32       numIds
+)
+{
+	MSD_U32 id;
+
+	for (id = 0; id < numIds; id++)
+	{
+		if ((inUse[id / 32U] & ((MSD_U32)1 << (id % 32U))) == 0U)
+		{
+			inUse[id / 32U] |= (MSD_U32)1 << (id % 32U);
+			return (MSD_U8)id;
+		}
+	}
+
+	return (MSD_U8)FIR_QCI_NO_ID;
+}
+
+/* AVB command of a Qci register, avbOp 0 read, 2 read with post increment, 3 write */
+static MSD_U16 Fir_qciAvbCommand
+(
+IN  MSD_U16       avbOp,
+IN  MSD_U8        qciBlock,
+IN  MSD_U8        regAddr
+)
+{
+	return (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((avbOp & (MSD_U16)0x3) << 13) | (MSD_U16)((MSD_U16)qciBlock << 8) |
+		(MSD_U16)((MSD_U16)0x4 << 5) | (MSD_U16)((MSD_U16)regAddr & (MSD_U16)0x1F));
+}
+
+static void Fir_qciRmuAdd
+(
+IN    MSD_RegCmd    *regCmd,
+INOUT MSD_U32       *nCmd,
+IN    MSD_U8        opCode,
+IN    MSD_U8        regAddr,
+IN    MSD_U16       data
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
+
+/* Wait until the busy bit of the AVB command register clears */
+static void Fir_qciRmuAddWait
+(
+IN    MSD_RegCmd    *regCmd,
+INOUT MSD_U32       *nCmd
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = FIR_AVB_COMMAND;
+	regCmd[*nCmd].data = 15U;
+	*nCmd += 1U;
+}
@@ -18,6 +18,9 @@
 ******************************************************************************/
 #include <fir/include/api/Fir_msdQcr.h>
 #include <fir/include/api/Fir_msdQueueCtrl.h>
+#include <fir/include/api/Fir_msdQav.h>
+#include <fir/include/api/Fir_msdRMU.h>
+#include <fir/include/api/Fir_msdApiInternal.h>
 #include <fir/include/driver/Fir_msdHwAccess.h>
 #include <fir/include/driver/Fir_msdDrvSwRegs.h>
 #include <utils/msdUtils.h>
@@ -26,6 +29,15 @@
 
 #define TIME_INTERVAL 16U
 #define TIME_FACTOR (8000000/(TIME_INTERVAL))
+#define ATS_AVB_PORT                4U
+#define ATS_AVB_BLOCK               4U
+#define QAV_AVB_BLOCK               2U
+#define ATS_QUEUE_EN_POINTER        0x07U
+/* RMU commands per scheduler and per port, for writing and for reading back */
+#define ATS_RMU_SCHED_CMDS          32U
+#define ATS_RMU_PORT_CMDS           50U
+#define ATS_RMU_SCHED_READ_CMDS     26U
+#define ATS_RMU_PORT_READ_CMDS      22U
 typedef enum
 {
     NOP = 0x0,
@@ -135,6 +147,72 @@ static MSD_STATUS atsGetEntry
     OUT    FIR_MSD_ATS_SCHEDULER*       entry
 );
 
+static MSD_STATUS atsRateToBrf
+(
+    IN    MSD_U32       rateLimit,
+    OUT   MSD_U16*      atsSchedBrf,
+    OUT   MSD_U16*      atsSchedBktDec
+);
+static MSD_STATUS atsProfileCheck
+(
+    IN    MSD_QD_DEV*   dev,
+    IN    const FIR_MSD_SHAPING_PROFILE* profile
+);
+static MSD_U32 atsSchedMismatch
+(
+    IN    const FIR_MSD_ATS_SCHED_PROFILE* sched,
+    IN    FIR_MSD_ATS_SCHEDULER*  entry
+);
+static MSD_U32 atsPortMismatch
+(
+    IN    const FIR_MSD_SHAPING_PORT_PROFILE* portProfile,
+    IN    MSD_U8        atsQueueEnables,
+    IN    MSD_U32*      qavRate,
+    IN    MSD_U16*      qavHiLimit
+);
+static void atsRmuAdd
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        opCode,
+    IN    MSD_U8        devAddr,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U16       data
+);
+static void atsRmuAddWait
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        devAddr,
+    IN    MSD_U8        regAddr
+);
+static void atsRmuAvbWrite
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U16       avbPort,
+    IN    MSD_U16       avbBlock,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U16       data
+);
+static MSD_U32 atsRmuAvbRead
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U16       avbPort,
+    IN    MSD_U16       avbBlock,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U32       numRegs
+);
+static MSD_STATUS atsRmuFlush
+(
+    IN    MSD_QD_DEV*   dev,
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U32*      opStatus,
+    INOUT MSD_U32*      nOpStatus
+);
+
 
 /******************************************************************************
 * Fir global API
@@ -454,7 +532,6 @@ IN  MSD_U32             rateLimit
 {
     MSD_STATUS retVal = MSD_OK;
     MSD_U16 bucketRateFactor = 0;
-    MSD_U64 d_bktdec = 0;
     MSD_U16 bktdec = 0;
     FIR_MSD_ATS_SCHEDULER atsEntry;
     if (atsEntryId >= (MSD_U16)16)
@@ -463,35 +540,13 @@ IN  MSD_U32             rateLimit
     }
     else
     {
-        if ((rateLimit < (MSD_U32)8) || (rateLimit >(MSD_U32)10000000))
+        retVal = atsRateToBrf(rateLimit, &bucketRateFactor, &bktdec);
+        if (retVal != MSD_OK)
 	    {
             retVal = MSD_BAD_PARAM;
 	    }
         else
         {
-            for (bucketRateFactor = (MSD_U16)15; ; bucketRateFactor--)
-            {
-                /*Formular: d_bktdec = (MSD_DOUBLE)(((MSD_U64)8000000 * (1 << bucketRateFactor)) / (rateLimit * TIME_INTERVAL)); */
-                d_bktdec = (MSD_U64)(TIME_FACTOR * ((MSD_U64)1 << bucketRateFactor));
-                d_bktdec = (d_bktdec * 10) / (MSD_U64)rateLimit;
-                if (d_bktdec >= (MSD_U64)655350 || d_bktdec <= (MSD_U64)0)
-                {
-                    if (bucketRateFactor == (MSD_U16)0)
-                    {
-                        return MSD_BAD_PARAM;
-                    }
-                    continue;
-                }
-                if ((d_bktdec % 10) >= 5)
-                {
-                    bktdec = (MSD_U16)(d_bktdec / (MSD_U64)10 + (MSD_U64)1);
-                }
-                else
-                {
-                    bktdec = (MSD_U16)(d_bktdec / (MSD_U64)10);
-                }
-                break;
-            }
             msdSemTake(dev->devNum, dev->qcrRegsSem, OS_WAIT_FOREVER);
             atsEntry.atsSchedID = atsEntryId;
             retVal = atsGetEntry(dev, &atsEntry);
@@ -785,6 +840,383 @@ OUT MSD_BOOL*           status
     }
     return retVal;
 }
+/*******************************************************************************
+* Fir_gatsShapingProfileApply
+*
+* DESCRIPTION:
+*       This routine writes the ATS schedulers, the ATS queue enables and the
+*       Qav queue shapers of a shaping profile. The whole profile is checked
+*       first: field ranges, and for each port the sum of its Qav rates and of
+*       the rates of the ATS schedulers charged to it against linkRate. With
+*       RMU the registers are written whole, without read-modify-write, in
+*       multi register frames.
+*
+* INPUTS:
+*       profile - shaping profile
+*       verify  - MSD_TRUE to read the profile back after writing it
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error, or a register read back differs from the profile
+*       MSD_BAD_PARAM - if invalid parameter is given or a port is over booked
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Nothing is written when the profile does not pass the checks.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gatsShapingProfileApply
+(
+IN  MSD_QD_DEV* const   dev,
+IN  const FIR_MSD_SHAPING_PROFILE   *profile,
+IN  MSD_BOOL            verify
+)
+{
+    MSD_STATUS retVal;
+    FIR_MSD_ATS_SCHEDULER atsEntry;
+    const FIR_MSD_ATS_SCHED_PROFILE *sched;
+    const FIR_MSD_SHAPING_PORT_PROFILE *portProfile;
+    MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_U32 opStatus[MSD_RMU_MAX_REGCMDS];
+    MSD_U32 nCmd = 0;
+    MSD_U32 nOpStatus = 0;
+    MSD_U32 numMismatches = 0;
+    MSD_U32 rate;
+    MSD_U32 i;
+    MSD_U32 q;
+    MSD_U16 hwPort;
+
+    MSD_DBG_INFO(("Fir_gatsShapingProfileApply Called.\n"));
+
+    retVal = atsProfileCheck(dev, profile);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    msdSemTake(dev->devNum, dev->qcrRegsSem, OS_WAIT_FOREVER);
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; (i < profile->numScheds) && (retVal == MSD_OK); i++)
+        {
+            sched = &profile->scheds[i];
+            atsEntry.atsSchedID = sched->schedId;
+            atsEntry.atsSchedGrpID = sched->grpId;
+            atsEntry.cbsLimit = sched->cbsLimit;
+            atsEntry.maxTimeScale = sched->maxTimeScale;
+            atsEntry.maxResidenceTime = sched->maxResidenceTime;
+            retVal = atsRateToBrf(sched->rateLimit, &atsEntry.brf, &atsEntry.bucketDec);
+            if (retVal == MSD_OK)
+            {
+                retVal = atsSetEntry(dev, atsEntry);
+            }
+        }
+        for (i = 0; (i < profile->numPorts) && (retVal == MSD_OK); i++)
+        {
+            portProfile = &profile->ports[i];
+            retVal = Fir_gprtSetQueueCtrl(dev, portProfile->port, ATS_QUEUE_EN_POINTER, portProfile->atsQueueEnables);
+            for (q = 0; (q < FIR_SHAPING_MAX_QUEUES) && (retVal == MSD_OK); q++)
+            {
+                if ((portProfile->qavQueues & (MSD_U8)(1U << q)) == 0U)
+                {
+                    continue;
+                }
+                retVal = Fir_gqavSetPortQpriXRate(dev, portProfile->port, (MSD_U8)q, portProfile->qavRate[q]);
+                if (retVal == MSD_OK)
+                {
+                    retVal = Fir_gqavSetPortQpriXHiLimit(dev, portProfile->port, (MSD_U8)q, portProfile->qavHiLimit[q]);
+                }
+            }
+        }
+    }
+    else
+    {
+        msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+        for (i = 0; (i < profile->numScheds) && (retVal == MSD_OK); i++)
+        {
+            if (nCmd + ATS_RMU_SCHED_CMDS > MSD_RMU_MAX_REGCMDS)
+            {
+                retVal = atsRmuFlush(dev, regCmd, &nCmd, opStatus, &nOpStatus);
+                if (retVal != MSD_OK)
+                {
+                    break;
+                }
+            }
+
+            sched = &profile->scheds[i];
+            retVal = atsRateToBrf(sched->rateLimit, &atsEntry.brf, &atsEntry.bucketDec);
+            if (retVal != MSD_OK)
+            {
+                break;
+            }
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 1, (MSD_U16)((MSD_U16)0x8000 | (sched->grpId & (MSD_U16)0xF)));
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 2, atsEntry.bucketDec);
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 3, (MSD_U16)(atsEntry.brf & (MSD_U16)0xF));
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 4, (MSD_U16)(sched->cbsLimit & (MSD_U32)0xFFFF));
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 5, (MSD_U16)((sched->cbsLimit & (MSD_U32)0xFF0000) >> 16));
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 6,
+                (MSD_U16)((sched->maxResidenceTime & (MSD_U16)0xFFF) | ((sched->maxTimeScale & (MSD_U16)0x3) << 12)));
+
+            /* LOAD then NOP as atsSetEntry does, each checked for completion */
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0,
+                (MSD_U16)((MSD_U16)0x8000 | ((MSD_U16)LOAD << 12) | (sched->schedId & (MSD_U16)0xF)));
+            opStatus[nOpStatus] = atsRmuAvbRead(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0, 1);
+            nOpStatus++;
+            atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0,
+                (MSD_U16)((MSD_U16)0x8000 | ((MSD_U16)NOP << 12) | (sched->schedId & (MSD_U16)0xF)));
+            opStatus[nOpStatus] = atsRmuAvbRead(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0, 1);
+            nOpStatus++;
+        }
+
+        for (i = 0; (i < profile->numPorts) && (retVal == MSD_OK); i++)
+        {
+            if (nCmd + ATS_RMU_PORT_CMDS > MSD_RMU_MAX_REGCMDS)
+            {
+                retVal = atsRmuFlush(dev, regCmd, &nCmd, opStatus, &nOpStatus);
+                if (retVal != MSD_OK)
+                {
+                    break;
+                }
+            }
+
+            portProfile = &profile->ports[i];
+            hwPort = (MSD_U16)MSD_LPORT_2_PORT(portProfile->port);
+            atsRmuAddWait(regCmd, &nCmd, (MSD_U8)FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort), FIR_Q_CONTROL);
+            atsRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort), FIR_Q_CONTROL,
+                (MSD_U16)((MSD_U16)0x8000 | ((MSD_U16)ATS_QUEUE_EN_POINTER << 8) | (MSD_U16)portProfile->atsQueueEnables));
+            for (q = 0; q < FIR_SHAPING_MAX_QUEUES; q++)
+            {
+                if ((portProfile->qavQueues & (MSD_U8)(1U << q)) == 0U)
+                {
+                    continue;
+                }
+                rate = portProfile->qavRate[q] / (MSD_U32)32;
+                atsRmuAvbWrite(regCmd, &nCmd, hwPort, QAV_AVB_BLOCK, (MSD_U8)(q * 2U), (MSD_U16)(rate & (MSD_U32)0xFFFF));
+                atsRmuAvbWrite(regCmd, &nCmd, hwPort, QAV_AVB_BLOCK, (MSD_U8)((q * 2U) + 1U),
+                    (MSD_U16)((((rate & (MSD_U32)0x10000) >> 16) << 15) | (portProfile->qavHiLimit[q] & (MSD_U16)0x3FFF)));
+            }
+        }
+
+        if ((retVal == MSD_OK) && (nCmd != 0U))
+        {
+            retVal = atsRmuFlush(dev, regCmd, &nCmd, opStatus, &nOpStatus);
+        }
+
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+        msdSemGive(dev->devNum, dev->tblRegsSem);
+    }
+
+    msdSemGive(dev->devNum, dev->qcrRegsSem);
+
+    if ((retVal == MSD_OK) && (verify == MSD_TRUE))
+    {
+        retVal = Fir_gatsShapingProfileVerify(dev, profile, &numMismatches);
+        if ((retVal == MSD_OK) && (numMismatches != 0U))
+        {
+            MSD_DBG_ERROR(("Shaping profile read back has %u mismatches.\n", (unsigned int)numMismatches));
+            retVal = MSD_FAIL;
+        }
+    }
+
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_gatsShapingProfileApply returned: %s.\n", msdDisplayStatus(retVal)));
+    }
+
+    MSD_DBG_INFO(("Fir_gatsShapingProfileApply Exit.\n"));
+    return retVal;
+}
+
+/*******************************************************************************
+* Fir_gatsShapingProfileVerify
+*
+* DESCRIPTION:
+*       This routine reads back the ATS schedulers, ATS queue enables and Qav
+*       queue shapers of a shaping profile and counts the values that differ.
+*
+* INPUTS:
+*       profile - shaping profile
+*
+* OUTPUTS:
+*       numMismatches - number of values that differ from the profile
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       ATS rates are compared as the register values Fir_gatsSetRateLimit
+*       would write.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gatsShapingProfileVerify
+(
+IN  MSD_QD_DEV* const   dev,
+IN  const FIR_MSD_SHAPING_PROFILE   *profile,
+OUT MSD_U32             *numMismatches
+)
+{
+    MSD_STATUS retVal;
+    FIR_MSD_ATS_SCHEDULER atsEntry;
+    const FIR_MSD_SHAPING_PORT_PROFILE *portProfile;
+    MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+    MSD_RegCmd *pRegCmd;
+    MSD_U32 opStatus[MSD_RMU_MAX_REGCMDS];
+    MSD_U32 first[MSD_RMU_MAX_REGCMDS / ATS_RMU_PORT_READ_CMDS];
+    MSD_U32 qCtrl[MSD_RMU_MAX_REGCMDS / ATS_RMU_PORT_READ_CMDS];
+    MSD_U32 qavRate[FIR_SHAPING_MAX_QUEUES];
+    MSD_U16 qavHiLimit[FIR_SHAPING_MAX_QUEUES];
+    MSD_U16 hiReg;
+    MSD_U8 qEnables;
+    MSD_U32 nCmd = 0;
+    MSD_U32 nOpStatus = 0;
+    MSD_U32 i;
+    MSD_U32 n;
+    MSD_U32 k;
+    MSD_U32 q;
+    MSD_U16 hwPort;
+
+    MSD_DBG_INFO(("Fir_gatsShapingProfileVerify Called.\n"));
+
+    if (numMismatches == NULL)
+    {
+        MSD_DBG_ERROR(("Input param is NULL.\n"));
+        return MSD_BAD_PARAM;
+    }
+    retVal = atsProfileCheck(dev, profile);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    *numMismatches = 0;
+    msdMemSet(qavRate, 0, sizeof(qavRate));
+    msdMemSet(qavHiLimit, 0, sizeof(qavHiLimit));
+
+    msdSemTake(dev->devNum, dev->qcrRegsSem, OS_WAIT_FOREVER);
+
+    if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; (i < profile->numScheds) && (retVal == MSD_OK); i++)
+        {
+            atsEntry.atsSchedID = profile->scheds[i].schedId;
+            retVal = atsGetEntry(dev, &atsEntry);
+            if (retVal == MSD_OK)
+            {
+                *numMismatches += atsSchedMismatch(&profile->scheds[i], &atsEntry);
+            }
+        }
+        for (i = 0; (i < profile->numPorts) && (retVal == MSD_OK); i++)
+        {
+            portProfile = &profile->ports[i];
+            retVal = Fir_gprtGetQueueCtrl(dev, portProfile->port, ATS_QUEUE_EN_POINTER, &qEnables);
+            for (q = 0; (q < FIR_SHAPING_MAX_QUEUES) && (retVal == MSD_OK); q++)
+            {
+                if ((portProfile->qavQueues & (MSD_U8)(1U << q)) == 0U)
+                {
+                    continue;
+                }
+                retVal = Fir_gqavGetPortQpriXRate(dev, portProfile->port, (MSD_U8)q, &qavRate[q]);
+                if (retVal == MSD_OK)
+                {
+                    retVal = Fir_gqavGetPortQpriXHiLimit(dev, portProfile->port, (MSD_U8)q, &qavHiLimit[q]);
+                }
+            }
+            if (retVal == MSD_OK)
+            {
+                *numMismatches += atsPortMismatch(portProfile, qEnables, qavRate, qavHiLimit);
+            }
+        }
+    }
+    else
+    {
+        msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+        msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+        i = 0;
+        while ((i < profile->numScheds) && (retVal == MSD_OK))
+        {
+            /* ATS enable, READ, registers 1 to 6 in one post increment read, then NOP as atsGetEntry does */
+            n = 0;
+            while ((i + n < profile->numScheds) && (nCmd + ATS_RMU_SCHED_READ_CMDS <= MSD_RMU_MAX_REGCMDS))
+            {
+                atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 1, (MSD_U16)0x8000);
+                atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0,
+                    (MSD_U16)((MSD_U16)0x8000 | ((MSD_U16)READ << 12) | (profile->scheds[i + n].schedId & (MSD_U16)0xF)));
+                opStatus[nOpStatus] = atsRmuAvbRead(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0, 1);
+                nOpStatus++;
+                first[n] = atsRmuAvbRead(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 1, 6);
+                atsRmuAvbWrite(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0,
+                    (MSD_U16)((MSD_U16)0x8000 | ((MSD_U16)NOP << 12) | (profile->scheds[i + n].schedId & (MSD_U16)0xF)));
+                opStatus[nOpStatus] = atsRmuAvbRead(regCmd, &nCmd, ATS_AVB_PORT, ATS_AVB_BLOCK, 0, 1);
+                nOpStatus++;
+                n++;
+            }
+
+            retVal = atsRmuFlush(dev, regCmd, &nCmd, opStatus, &nOpStatus);
+            for (k = 0; (k < n) && (retVal == MSD_OK); k++)
+            {
+                pRegCmd = &regCmd[first[k]];
+                atsEntry.atsSchedGrpID = pRegCmd[0].data & (MSD_U16)0xF;
+                atsEntry.bucketDec = pRegCmd[1].data;
+                atsEntry.brf = pRegCmd[2].data & (MSD_U16)0xF;
+                atsEntry.cbsLimit = ((MSD_U32)pRegCmd[3].data & (MSD_U32)0xFFFF) | (((MSD_U32)pRegCmd[4].data & (MSD_U32)0xFF) << 16);
+                atsEntry.maxTimeScale = (pRegCmd[5].data & (MSD_U16)0x3000) >> 12;
+                atsEntry.maxResidenceTime = pRegCmd[5].data & (MSD_U16)0xFFF;
+                *numMismatches += atsSchedMismatch(&profile->scheds[i + k], &atsEntry);
+            }
+            i += n;
+        }
+
+        i = 0;
+        while ((i < profile->numPorts) && (retVal == MSD_OK))
+        {
+            /* queue enables, then Qav registers 0 to 15 in one post increment read */
+            n = 0;
+            while ((i + n < profile->numPorts) && (nCmd + ATS_RMU_PORT_READ_CMDS <= MSD_RMU_MAX_REGCMDS))
+            {
+                hwPort = (MSD_U16)MSD_LPORT_2_PORT(profile->ports[i + n].port);
+                atsRmuAddWait(regCmd, &nCmd, (MSD_U8)FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort), FIR_Q_CONTROL);
+                atsRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort), FIR_Q_CONTROL,
+                    (MSD_U16)((MSD_U16)ATS_QUEUE_EN_POINTER << 8));
+                qCtrl[n] = nCmd;
+                atsRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, (MSD_U8)FIR_MSD_CALC_SMI_DEV_ADDR(dev, hwPort), FIR_Q_CONTROL, 0);
+                first[n] = atsRmuAvbRead(regCmd, &nCmd, hwPort, QAV_AVB_BLOCK, 0, FIR_SHAPING_MAX_QUEUES * 2U);
+                n++;
+            }
+
+            retVal = atsRmuFlush(dev, regCmd, &nCmd, opStatus, &nOpStatus);
+            for (k = 0; (k < n) && (retVal == MSD_OK); k++)
+            {
+                pRegCmd = &regCmd[first[k]];
+                for (q = 0; q < FIR_SHAPING_MAX_QUEUES; q++)
+                {
+                    hiReg = pRegCmd[(q * 2U) + 1U].data;
+                    qavRate[q] = ((((MSD_U32)hiReg & (MSD_U32)0x8000) << 1) | (MSD_U32)pRegCmd[q * 2U].data) * (MSD_U32)32;
+                    qavHiLimit[q] = hiReg & (MSD_U16)0x3FFF;
+                }
+                *numMismatches += atsPortMismatch(&profile->ports[i + k], (MSD_U8)(regCmd[qCtrl[k]].data & (MSD_U16)0xFF), qavRate, qavHiLimit);
+            }
+            i += n;
+        }
+
+        msdSemGive(dev->devNum, dev->ptpRegsSem);
+        msdSemGive(dev->devNum, dev->tblRegsSem);
+    }
+
+    msdSemGive(dev->devNum, dev->qcrRegsSem);
+
+    MSD_DBG_INFO(("Fir_gatsShapingProfileVerify Exit.\n"));
+    return retVal;
+}
 /******************************************************************************
 * Fir static API
 ******************************************************************************/
@@ -1335,3 +1767,306 @@ static MSD_STATUS atsGetEntry
 
 	return retVal;
 }
+
+static MSD_STATUS atsRateToBrf
+(
+    IN    MSD_U32       rateLimit,
+    OUT   MSD_U16*      atsSchedBrf,
+    OUT   MSD_U16*      atsSchedBktDec
+)
+{
+    MSD_U16 bucketRateFactor;
+    MSD_U64 d_bktdec;
+
+    if ((rateLimit < (MSD_U32)8) || (rateLimit > (MSD_U32)10000000))
+    {
+        return MSD_BAD_PARAM;
+    }
+    for (bucketRateFactor = (MSD_U16)15; ; bucketRateFactor--)
+    {
+        /*Formular: d_bktdec = (MSD_DOUBLE)(((MSD_U64)8000000 * (1 << bucketRateFactor)) / (rateLimit * TIME_INTERVAL)); */
+        d_bktdec = (MSD_U64)(TIME_FACTOR * ((MSD_U64)1 << bucketRateFactor));
+        d_bktdec = (d_bktdec * 10) / (MSD_U64)rateLimit;
+        if (d_bktdec >= (MSD_U64)655350 || d_bktdec <= (MSD_U64)0)
+        {
+            if (bucketRateFactor == (MSD_U16)0)
+            {
+                return MSD_BAD_PARAM;
+            }
+            continue;
+        }
+        if ((d_bktdec % 10) >= 5)
+        {
+            *atsSchedBktDec = (MSD_U16)(d_bktdec / (MSD_U64)10 + (MSD_U64)1);
+        }
+        else
+        {
+            *atsSchedBktDec = (MSD_U16)(d_bktdec / (MSD_U64)10);
+        }
+        break;
+    }
+    *atsSchedBrf = bucketRateFactor;
+    return MSD_OK;
+}
+
+/* Range checks and per port bandwidth sums of a shaping profile */
+static MSD_STATUS atsProfileCheck
+(
+    IN    MSD_QD_DEV*   dev,
+    IN    const FIR_MSD_SHAPING_PROFILE* profile
+)
+{
+    const FIR_MSD_ATS_SCHED_PROFILE *sched;
+    const FIR_MSD_SHAPING_PORT_PROFILE *portProfile;
+    MSD_U16 schedMask = 0;
+    MSD_U32 portMask = 0;
+    MSD_U16 brf;
+    MSD_U16 bktDec;
+    MSD_U64 sum;
+    MSD_U32 hwPort;
+    MSD_U32 i;
+    MSD_U32 q;
+
+    if ((profile == NULL) ||
+        ((profile->numScheds != 0U) && (profile->scheds == NULL)) ||
+        ((profile->numPorts != 0U) && (profile->ports == NULL)) ||
+        (profile->numScheds > FIR_ATS_MAX_SCHEDULERS) || (profile->numPorts > (MSD_U32)dev->numOfPorts))
+    {
+        MSD_DBG_ERROR(("Bad shaping profile.\n"));
+        return MSD_BAD_PARAM;
+    }
+
+    for (i = 0; i < profile->numScheds; i++)
+    {
+        sched = &profile->scheds[i];
+        if ((sched->schedId >= (MSD_U16)FIR_ATS_MAX_SCHEDULERS) || (sched->grpId > (MSD_U16)0xF) ||
+            ((schedMask & (MSD_U16)(1U << sched->schedId)) != 0U) ||
+            (sched->cbsLimit > (MSD_U32)0xFFFFFF) || (sched->maxTimeScale > (MSD_U16)0x3) ||
+            (sched->maxResidenceTime > (MSD_U16)0xFFF) ||
+            (MSD_LPORT_2_PORT(sched->port) == (MSD_U32)MSD_INVALID_PORT) ||
+            (atsRateToBrf(sched->rateLimit, &brf, &bktDec) != MSD_OK))
+        {
+            MSD_DBG_ERROR(("Bad ATS scheduler %u in shaping profile.\n", (unsigned int)sched->schedId));
+            return MSD_BAD_PARAM;
+        }
+        schedMask |= (MSD_U16)(1U << sched->schedId);
+    }
+
+    for (i = 0; i < profile->numPorts; i++)
+    {
+        portProfile = &profile->ports[i];
+        hwPort = MSD_LPORT_2_PORT(portProfile->port);
+        if ((hwPort == (MSD_U32)MSD_INVALID_PORT) || ((portMask & ((MSD_U32)1 << hwPort)) != 0U))
+        {
+            MSD_DBG_ERROR(("Bad port %u in shaping profile.\n", (unsigned int)portProfile->port));
+            return MSD_BAD_PARAM;
+        }
+        portMask |= (MSD_U32)1 << hwPort;
+
+        sum = 0;
+        for (q = 0; q < FIR_SHAPING_MAX_QUEUES; q++)
+        {
+            if ((portProfile->qavQueues & (MSD_U8)(1U << q)) == 0U)
+            {
+                continue;
+            }
+            if (((portProfile->qavRate[q] % (MSD_U32)32) != 0U) ||
+                ((portProfile->qavRate[q] / (MSD_U32)32) > (MSD_U32)0x1FFFF) ||
+                (portProfile->qavHiLimit[q] > (MSD_U16)0x3FFF))
+            {
+                MSD_DBG_ERROR(("Bad Qav queue %u of port %u in shaping profile.\n", (unsigned int)q, (unsigned int)portProfile->port));
+                return MSD_BAD_PARAM;
+            }
+            sum += portProfile->qavRate[q];
+        }
+        for (q = 0; q < profile->numScheds; q++)
+        {
+            if (profile->scheds[q].port == portProfile->port)
+            {
+                sum += profile->scheds[q].rateLimit;
+            }
+        }
+        if (sum > (MSD_U64)portProfile->linkRate)
+        {
+            MSD_DBG_ERROR(("Port %u over booked: %u of %u kbps reserved.\n", (unsigned int)portProfile->port,
+                (unsigned int)sum, (unsigned int)portProfile->linkRate));
+            return MSD_BAD_PARAM;
+        }
+    }
+
+    return MSD_OK;
+}
+
+static MSD_U32 atsSchedMismatch
+(
+    IN    const FIR_MSD_ATS_SCHED_PROFILE* sched,
+    IN    FIR_MSD_ATS_SCHEDULER*  entry
+)
+{
+    MSD_U32 count = 0;
+    MSD_U16 brf = 0;
+    MSD_U16 bktDec = 0;
+
+    (void)atsRateToBrf(sched->rateLimit, &brf, &bktDec);
+    if (entry->atsSchedGrpID != sched->grpId)
+    {
+        count++;
+    }
+    if ((entry->brf != brf) || (entry->bucketDec != bktDec))
+    {
+        count++;
+    }
+    if (entry->cbsLimit != sched->cbsLimit)
+    {
+        count++;
+    }
+    if ((entry->maxTimeScale != sched->maxTimeScale) || (entry->maxResidenceTime != sched->maxResidenceTime))
+    {
+        count++;
+    }
+    return count;
+}
+
+static MSD_U32 atsPortMismatch
+(
+    IN    const FIR_MSD_SHAPING_PORT_PROFILE* portProfile,
+    IN    MSD_U8        atsQueueEnables,
+    IN    MSD_U32*      qavRate,
+    IN    MSD_U16*      qavHiLimit
+)
+{
+    MSD_U32 count = 0;
+    MSD_U32 q;
+
+    if (atsQueueEnables != portProfile->atsQueueEnables)
+    {
+        count++;
+    }
+    for (q = 0; q < FIR_SHAPING_MAX_QUEUES; q++)
+    {
+        if ((portProfile->qavQueues & (MSD_U8)(1U << q)) == 0U)
+        {
+            continue;
+        }
+        if (qavRate[q] != portProfile->qavRate[q])
+        {
+            count++;
+        }
+        if (qavHiLimit[q] != portProfile->qavHiLimit[q])
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+static void atsRmuAdd
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        opCode,
+    IN    MSD_U8        devAddr,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U16       data
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+    regCmd[*nCmd].opCode = opCode;
+    regCmd[*nCmd].devAddr = devAddr;
+    regCmd[*nCmd].regAddr = regAddr;
+    regCmd[*nCmd].data = data;
+    *nCmd += 1U;
+}
+
+/* Wait until bit 15 of the register clears */
+static void atsRmuAddWait
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U8        devAddr,
+    IN    MSD_U8        regAddr
+)
+{
+    regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+    regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+    regCmd[*nCmd].devAddr = devAddr;
+    regCmd[*nCmd].regAddr = regAddr;
+    regCmd[*nCmd].data = 15U;
+    *nCmd += 1U;
+}
+
+static void atsRmuAvbWrite
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U16       avbPort,
+    IN    MSD_U16       avbBlock,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U16       data
+)
+{
+    atsRmuAddWait(regCmd, nCmd, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND);
+    atsRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_DATA, data);
+    atsRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND,
+        (MSD_U16)((MSD_U16)0xE000 | (avbPort << 8) | (avbBlock << 5) | ((MSD_U16)regAddr & (MSD_U16)0x1F)));
+}
+
+/* Read numRegs AVB registers from regAddr up, returns the index of the first read */
+static MSD_U32 atsRmuAvbRead
+(
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U16       avbPort,
+    IN    MSD_U16       avbBlock,
+    IN    MSD_U8        regAddr,
+    IN    MSD_U32       numRegs
+)
+{
+    MSD_U16 avbOp;
+    MSD_U32 first;
+    MSD_U32 r;
+
+    avbOp = (numRegs > 1U) ? (MSD_U16)0xC000 : (MSD_U16)0x8000;
+    atsRmuAddWait(regCmd, nCmd, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND);
+    atsRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND,
+        (MSD_U16)(avbOp | (avbPort << 8) | (avbBlock << 5) | ((MSD_U16)regAddr & (MSD_U16)0x1F)));
+    atsRmuAddWait(regCmd, nCmd, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND);
+    first = *nCmd;
+    for (r = 0; r < numRegs; r++)
+    {
+        atsRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_DATA, 0);
+    }
+    return first;
+}
+
+/* Send the frame and check the ATS operations in it completed */
+static MSD_STATUS atsRmuFlush
+(
+    IN    MSD_QD_DEV*   dev,
+    IN    MSD_RegCmd*   regCmd,
+    INOUT MSD_U32*      nCmd,
+    IN    MSD_U32*      opStatus,
+    INOUT MSD_U32*      nOpStatus
+)
+{
+    MSD_STATUS retVal;
+    MSD_RegCmd *pRegCmd = regCmd;
+    MSD_U32 i;
+
+    retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, *nCmd);
+    if (retVal != MSD_OK)
+    {
+        MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+    }
+    for (i = 0; (i < *nOpStatus) && (retVal == MSD_OK); i++)
+    {
+        if ((regCmd[opStatus[i]].data & (MSD_U16)0x8000) != 0U)
+        {
+            MSD_DBG_ERROR(("ATS operation still busy in RMU frame.\n"));
+            retVal = MSD_BUSY;
+        }
+    }
+    *nCmd = 0;
+    *nOpStatus = 0;
+    return retVal;
+}
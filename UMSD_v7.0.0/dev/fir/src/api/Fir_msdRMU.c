@@ -53,6 +53,7 @@ static MSD_U32 dump_TCAMPacket
 	IN		MSD_U8 *packet,
 	IN		MSD_U32 pkt_size,
 	OUT	    MSD_U32 *numOfEntry,
+	OUT	    MSD_U32 *tcamPointer,
 	OUT		FIR_MSD_TCAM_DATA **tcamEntry
 );
 
@@ -629,6 +630,9 @@ MSD_STATUS Fir_msdRmuMultiRegAccess
 		return MSD_FAIL;
 	}
 
+	/* The commands may start SMI PHY accesses */
+	dev->smiState &= (MSD_U8)~MSD_SMI_STATE_PHY_CMD_IDLE;
+
 	if (dev->rmuMode == MSD_RMU_ETHERT_TYPE_DSA_MODE)
 	{
 		delta = 0;
@@ -723,6 +727,41 @@ MSD_STATUS Fir_msdRmuTCAMDump
 	OUT MSD_U32 *numOfEntry,
 	OUT FIR_MSD_TCAM_DATA **tcamEntry
 )
+{
+	return Fir_msdRmuTCAMDumpEntry(dev, startAddr, numOfEntry, NULL, tcamEntry);
+}
+
+/*******************************************************************************
+* Fir_msdRmuTCAMDumpEntry
+*
+* DESCRIPTION:
+*       Dump valid TCAM entries together with their entry numbers.
+*
+* INPUTS:
+*       startAddr - starting address to search the valid tcam entryies
+*
+* OUTPUTS:
+*       startAddr - continue code for the next search, 0 when no more entries
+*		numOfEntry - number of returned valued entries
+*       tcamPointer - array of entry numbers, may be NULL
+*       tcamEntry - array of tcam Entries.
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error.
+*
+* COMMENTS:
+*       Both arrays must hold MSD_RMU_MAX_TCAMS elements.
+*
+*******************************************************************************/
+MSD_STATUS Fir_msdRmuTCAMDumpEntry
+(
+	IN MSD_QD_DEV *dev,
+	INOUT MSD_U32 *startAddr,
+	OUT MSD_U32 *numOfEntry,
+	OUT MSD_U32 *tcamPointer,
+	OUT FIR_MSD_TCAM_DATA **tcamEntry
+)
 {
 	MSD_Packet ReqPkt;
 	MSD_U8 reqEthPacket[512];
@@ -735,7 +774,7 @@ MSD_STATUS Fir_msdRmuTCAMDump
 
 	MSD_U8 *rspEthPacketPtr = &(rspEthPacket[0]);
 
-	MSD_DBG_INFO(("Fir_msdRmuTCAMDump Called.\n"));
+	MSD_DBG_INFO(("Fir_msdRmuTCAMDumpEntry Called.\n"));
 
 	if ((startAddr == NULL) || (numOfEntry == NULL))
 	{
@@ -791,9 +830,9 @@ MSD_STATUS Fir_msdRmuTCAMDump
 	}
 
 	/* Receive Packet*/
-	*startAddr = dump_TCAMPacket(delta, rspEthPacketPtr, rsp_pktlen, numOfEntry, tcamEntry);
+	*startAddr = dump_TCAMPacket(delta, rspEthPacketPtr, rsp_pktlen, numOfEntry, tcamPointer, tcamEntry);
 
-	MSD_DBG_INFO(("Fir_msdRmuTCAMDump Exit.\n"));
+	MSD_DBG_INFO(("Fir_msdRmuTCAMDumpEntry Exit.\n"));
 	return MSD_OK;
 }
 
@@ -900,12 +939,130 @@ MSD_STATUS Fir_msdRmuTCAMWrite
 	}
 
 	/* Receive Packet*/
-	dump_TCAMPacket(delta, rspEthPacketPtr, rsp_pktlen, &nCmd, &tcamEntry);
+	dump_TCAMPacket(delta, rspEthPacketPtr, rsp_pktlen, &nCmd, NULL, &tcamEntry);
 
 	MSD_DBG_INFO(("Fir_msdRmuTCAMWrite Exit.\n"));
 	return MSD_OK;
 }
 
+/*******************************************************************************
+* Fir_msdRmuTCAMWriteMulti
+*
+* DESCRIPTION:
+*       Load up to MSD_RMU_MAX_TCAMS TCAM entries with a single request.
+*
+* INPUTS:
+*       nEntry - number of entries
+*       entries - entry numbers and data
+*
+* OUTPUTS:
+*       NONE
+*
+* RETURNS:
+*       MSD_OK      - on success.
+*       MSD_FAIL    - on error .
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*
+*******************************************************************************/
+MSD_STATUS Fir_msdRmuTCAMWriteMulti
+(
+	IN MSD_QD_DEV *dev,
+	IN MSD_U32 nEntry,
+	IN FIR_MSD_TCAM_IGR_IMAGE *entries
+)
+{
+	MSD_Packet ReqPkt;
+	MSD_U8 reqEthPacket[512];
+	MSD_U8 rspEthPacket[512];
+	MSD_U32 req_pktlen, rsp_pktlen;
+	MSD_RMU_TCAM_RW_ENTRY tcamRWData;
+	MSD_STATUS retVal = 0;
+	MSD_U32 i;
+    MSD_U8 delta;
+
+	MSD_RMU_CMD cmd = MSD_TCAMRW;
+
+	MSD_U8 *rspEthPacketPtr = &(rspEthPacket[0]);
+
+	MSD_DBG_INFO(("Fir_msdRmuTCAMWriteMulti Called.\n"));
+
+	if ((nEntry == 0U) || (nEntry > MSD_RMU_MAX_TCAMS) || (entries == NULL))
+	{
+		MSD_DBG_ERROR(("Bad nEntry %u OR entries is NULL.\n", nEntry));
+		return MSD_BAD_PARAM;
+	}
+
+	for (i = 0; i < nEntry; i++)
+	{
+		if (entries[i].tcamPointer >= FIR_MAX_IGR_TCAM_ENTRY)
+		{
+			MSD_DBG_ERROR(("tcamPointer: %u.\n", entries[i].tcamPointer));
+			return MSD_BAD_PARAM;
+		}
+	}
+
+	if (dev->rmuMode == MSD_RMU_ETHERT_TYPE_DSA_MODE)
+	{
+		delta = 0;
+	}
+	else if (dev->rmuMode == MSD_RMU_DSA_MODE)
+	{
+		delta = (MSD_U8)4;
+	}
+	else
+	{
+		delta = 0;
+	}
+
+	/*Request Packet*/
+	retVal = msdRmuReqPktCreate(dev, cmd, &ReqPkt);
+	if (retVal != MSD_OK) 
+	{
+		MSD_DBG_ERROR(("msdRmuReqPktCreate returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	for (i = 0; i < nEntry; i++)
+	{
+		retVal = msdRmuTcamPack(MSD_RMU_TCAM_OPCODE_WRITE, entries[i].tcamPointer, &entries[i].tcamData, &tcamRWData);
+		if (retVal != MSD_OK) 
+		{
+			MSD_DBG_ERROR(("msdRmuTcamPack returned: %s.\n", msdDisplayStatus(retVal)));
+			return retVal;
+		}
+		msdMemCpy((void*)&ReqPkt.reqData._tcamRWData.tcamEntry[i], &tcamRWData, sizeof(MSD_RMU_TCAM_RW_ENTRY));
+	}
+	ReqPkt.reqData._tcamRWData.nEntry = nEntry;
+
+	msdMemSet(reqEthPacket, 0, sizeof(reqEthPacket));
+	retVal = msdRmuPackEthReqPkt(&ReqPkt, cmd, reqEthPacket);
+	if (retVal != MSD_OK) 
+	{
+		MSD_DBG_ERROR(("msdRmuPackEthReqPkt returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	req_pktlen = (MSD_U32)((MSD_U32)(MSD_RMU_PACKET_PREFIX_SIZE - (MSD_U32)delta) + ((nEntry * MSD_RMU_TCAM_ENTRY_OP_SIZE) + 2U));
+
+	retVal = msdRmuTxRxPkt(dev, reqEthPacket, req_pktlen, &rspEthPacketPtr, &rsp_pktlen);
+	if ((retVal != MSD_OK) || (rsp_pktlen == 0U))
+	{
+		MSD_DBG_ERROR(("rmu_tx_rx returned: %s with rsp_pktLen %u.\n", msdDisplayStatus(retVal), rsp_pktlen));
+		return MSD_FAIL;
+	}
+
+	if (rsp_pktlen < req_pktlen)
+	{
+		MSD_DBG_ERROR(("response_pktlen [%d] < request_pktlen [%d]\n", rsp_pktlen, req_pktlen));
+		return MSD_FAIL;
+	}
+
+	MSD_DBG_INFO(("Fir_msdRmuTCAMWriteMulti Exit.\n"));
+	return MSD_OK;
+}
+
 /*******************************************************************************
 * msdRmuTCAMRead
 *
@@ -1009,7 +1166,7 @@ MSD_STATUS Fir_msdRmuTCAMRead
 	}
 
 	/* Receive Packet*/
-	dump_TCAMPacket(delta, rspEthPacketPtr, rsp_pktlen, &nCmd, &tcamEntry);
+	dump_TCAMPacket(delta, rspEthPacketPtr, rsp_pktlen, &nCmd, NULL, &tcamEntry);
 
 	MSD_DBG_INFO(("Fir_msdRmuTCAMRead Exit.\n"));
 	return MSD_OK;
@@ -1666,6 +1823,7 @@ static MSD_U32 dump_TCAMPacket
 	IN		MSD_U8 *packet,
 	IN		MSD_U32 pkt_size,
 	OUT	    MSD_U32 *numOfEntry,
+	OUT	    MSD_U32 *tcamPointer,
 	OUT		FIR_MSD_TCAM_DATA **tcamEntry
 )
 {
@@ -1695,6 +1853,11 @@ static MSD_U32 dump_TCAMPacket
 		tcam_temp |= ((*ptr) & 0xff) << 0; 
 		ptr++;
 
+		if (tcamPointer != NULL)
+		{
+			tcamPointer[tcam_cnt] = (MSD_U32)tcam_temp & (MSD_U32)0x1ff;
+		}
+
 		ptr += 10; /* rsvd 8 byte? */
 
 		/*if (idx == 0)*/
@@ -24,6 +24,26 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
+
+/* AVB command operations and blocks used by the Qbv schedule functions */
+#define FIR_AVB_OP_READ             0x0U
+#define FIR_AVB_OP_READ_MULTIPLE    0x2U
+#define FIR_AVB_OP_WRITE            0x3U
+#define FIR_AVB_BLOCK_PTP           0x0U
+#define FIR_AVB_BLOCK_QBV           0x3U
+#define FIR_AVB_PORT_TAI            0x1EU
+
+/* Qbv port registers, TAI trigger generator registers */
+#define FIR_QBV_REG_ENTRY           0x2U
+#define FIR_QBV_REG_WINDOW_TIME     0x3U
+#define FIR_TAI_REG_CONFIG          0x0U
+#define FIR_TAI_REG_TRIG_GEN_AMT    0x2U
+#define FIR_TAI_REG_GLOBAL_TIME     0xEU
+#define FIR_TAI_REG_TRIG_GEN_TIME   0x10U
+
+/* Minimum distance of a committed cycle start from the current global time, 1ms at 250MHz */
+#define FIR_QBV_COMMIT_LEAD         0x3D090U
 
 static MSD_STATUS Fir_gsysGetSMISetup_MultiChip
 (
@@ -38,6 +58,48 @@ IN MSD_QD_DEV    *dev,
 IN MSD_LPORT  portNum,
 IN MSD_U16		  data
 );
+static MSD_U16 Fir_gsysAvbCommand
+(
+IN MSD_U16		op,
+IN MSD_U8		avbPort,
+IN MSD_U8		avbBlock,
+IN MSD_U8		avbRegAddr
+);
+static void Fir_gsysRmuAdd
+(
+IN MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd,
+IN MSD_U8		opCode,
+IN MSD_U8		regAddr,
+IN MSD_U16		data
+);
+static void Fir_gsysRmuAddWait
+(
+IN MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd
+);
+static MSD_STATUS Fir_gsysAvbWait
+(
+IN MSD_QD_DEV	*dev
+);
+static MSD_STATUS Fir_gsysAvbWrite
+(
+IN MSD_QD_DEV	*dev,
+IN MSD_U8		avbPort,
+IN MSD_U8		avbBlock,
+IN MSD_U8		avbRegAddr,
+IN MSD_U16		data
+);
+static MSD_STATUS Fir_gsysAvbRead
+(
+IN MSD_QD_DEV	*dev,
+IN MSD_U16		op,
+IN MSD_U8		avbPort,
+IN MSD_U8		avbBlock,
+IN MSD_U8		avbRegAddr,
+IN MSD_U32		nData,
+OUT MSD_U16		*data
+);
 
 
 /*******************************************************************************
@@ -1516,6 +1578,285 @@ OUT MSD_U16      *data
 	return MSD_OK;
 }
 
+/*******************************************************************************
+* Fir_gsysQbvLoadSchedules
+*
+* DESCRIPTION:
+*       This routine programs the Qbv gate control lists of several ports.
+*       Each entry takes a window time write (Qbv register 3) followed by an
+*       entry write (Qbv register 2). With RMU the writes of all ports are
+*       packed into multi register frames, up to 19 entries per frame.
+*
+* INPUTS:
+*       numSchedules - number of schedules
+*       schedules    - gate control list per port
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       The gate control table has a single set, entries take effect as soon
+*       as they are written. Load the lists before Fir_gsysQbvCommitCycle so
+*       the new lists run from a cycle boundary.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gsysQbvLoadSchedules
+(
+IN MSD_QD_DEV    *dev,
+IN MSD_U32       numSchedules,
+IN const FIR_QBV_SCHEDULE *schedules
+)
+{
+	MSD_STATUS       retVal = MSD_OK;
+	MSD_RegCmd       regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd       *pRegCmd = regCmd;
+	MSD_U32          nCmd;
+	MSD_U32          i;
+	MSD_U32          j;
+	MSD_U8           hwPort;
+	const FIR_QBV_GCL_ENTRY *entry;
+
+	MSD_DBG_INFO(("Fir_gsysQbvLoadSchedules Called.\n"));
+
+	if (schedules == NULL)
+	{
+		MSD_DBG_ERROR(("Input param schedules is NULL.\n"));
+		return MSD_BAD_PARAM;
+	}
+	for (i = 0; i < numSchedules; i++)
+	{
+		if (MSD_LPORT_2_PORT(schedules[i].port) == MSD_INVALID_PORT)
+		{
+			MSD_DBG_ERROR(("Failed (Bad Port %u).\n", (unsigned int)schedules[i].port));
+			return MSD_BAD_PARAM;
+		}
+		if ((schedules[i].entries == NULL) || (schedules[i].numEntries == 0U) ||
+			(schedules[i].numEntries > FIR_QBV_MAX_GCL_ENTRIES))
+		{
+			MSD_DBG_ERROR(("Bad gate control list for port %u.\n", (unsigned int)schedules[i].port));
+			return MSD_BAD_PARAM;
+		}
+	}
+
+	msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+	nCmd = 0;
+	for (i = 0; (i < numSchedules) && (retVal == MSD_OK); i++)
+	{
+		hwPort = MSD_LPORT_2_PORT(schedules[i].port);
+		for (j = 0; (j < schedules[i].numEntries) && (retVal == MSD_OK); j++)
+		{
+			entry = &schedules[i].entries[j];
+			if (!(IS_RMU_SUPPORTED(dev)))
+			{
+				retVal = Fir_gsysAvbWrite(dev, hwPort, (MSD_U8)FIR_AVB_BLOCK_QBV, (MSD_U8)FIR_QBV_REG_WINDOW_TIME, entry->interval);
+				if (retVal == MSD_OK)
+				{
+					retVal = Fir_gsysAvbWrite(dev, hwPort, (MSD_U8)FIR_AVB_BLOCK_QBV, (MSD_U8)FIR_QBV_REG_ENTRY,
+						(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)(j << 8) | (MSD_U16)entry->gateStates));
+				}
+				continue;
+			}
+
+			/* Wait, data and command for each of the two words, plus the final wait */
+			if (nCmd + 7U > MSD_RMU_MAX_REGCMDS)
+			{
+				Fir_gsysRmuAddWait(regCmd, &nCmd);
+				retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+				nCmd = 0;
+				if (retVal != MSD_OK)
+				{
+					break;
+				}
+			}
+			Fir_gsysRmuAddWait(regCmd, &nCmd);
+			Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, entry->interval);
+			Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+				Fir_gsysAvbCommand((MSD_U16)FIR_AVB_OP_WRITE, hwPort, (MSD_U8)FIR_AVB_BLOCK_QBV, (MSD_U8)FIR_QBV_REG_WINDOW_TIME));
+			Fir_gsysRmuAddWait(regCmd, &nCmd);
+			Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA,
+				(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)(j << 8) | (MSD_U16)entry->gateStates));
+			Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+				Fir_gsysAvbCommand((MSD_U16)FIR_AVB_OP_WRITE, hwPort, (MSD_U8)FIR_AVB_BLOCK_QBV, (MSD_U8)FIR_QBV_REG_ENTRY));
+		}
+	}
+	if ((retVal == MSD_OK) && (nCmd != 0U))
+	{
+		Fir_gsysRmuAddWait(regCmd, &nCmd);
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+	}
+
+	msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Qbv gate control list write returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+
+	MSD_DBG_INFO(("Fir_gsysQbvLoadSchedules Exit.\n"));
+	return MSD_OK;
+}
+
+/*******************************************************************************
+* Fir_gsysQbvCommitCycle
+*
+* DESCRIPTION:
+*       This routine sets the Qbv cycle time and starts the next cycle at a
+*       boundary of baseTime. The cycle is driven by the TAI trigger generator:
+*       TrigGenAmt is set to cycleTime and TrigGenTime to baseTime, or, when
+*       baseTime is less than one cycle and 1ms ahead of the current PTP global
+*       time, to the first baseTime + N * cycleTime that is. Then the trigger
+*       generator is requested.
+*
+* INPUTS:
+*       cycleTime - cycle time in PTP clock cycles
+*       baseTime  - PTP global time of a cycle boundary
+*
+* OUTPUTS:
+*       startTime - PTP global time at which the new cycle starts
+*
+* RETURNS:
+*       MSD_OK - on success,
+*       MSD_FAIL - on error.
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       With RMU the global time read and the trigger update take two frames.
+*       The TAI global time counter is 32 bits, baseTime must be within half
+*       of its range from the current global time.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gsysQbvCommitCycle
+(
+IN MSD_QD_DEV    *dev,
+IN MSD_U32       cycleTime,
+IN MSD_U32       baseTime,
+OUT MSD_U32      *startTime
+)
+{
+	MSD_STATUS       retVal;
+	MSD_RegCmd       regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd       *pRegCmd = regCmd;
+	MSD_U32          nCmd;
+	MSD_U16          timeData[2];
+	MSD_U16          taiConfig;
+	MSD_U32          now;
+	MSD_U32          lead;
+	MSD_U32          start;
+	MSD_U32          ahead;
+	MSD_U8           addr[5];
+	MSD_U16          data[5];
+	MSD_U32          i;
+
+	MSD_DBG_INFO(("Fir_gsysQbvCommitCycle Called.\n"));
+
+	if ((startTime == NULL) || (cycleTime == 0U) || (cycleTime > (MSD_U32)0x7FFFFFFF))
+	{
+		MSD_DBG_ERROR(("Input param is invalid.\n"));
+		return MSD_BAD_PARAM;
+	}
+
+	msdSemTake(dev->devNum, dev->ptpRegsSem, OS_WAIT_FOREVER);
+
+	/* Global time and the TAI config word to merge TrigGenReq into */
+	if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		retVal = Fir_gsysAvbRead(dev, (MSD_U16)FIR_AVB_OP_READ_MULTIPLE, (MSD_U8)FIR_AVB_PORT_TAI, (MSD_U8)FIR_AVB_BLOCK_PTP,
+			(MSD_U8)FIR_TAI_REG_GLOBAL_TIME, 2U, timeData);
+		if (retVal == MSD_OK)
+		{
+			retVal = Fir_gsysAvbRead(dev, (MSD_U16)FIR_AVB_OP_READ, (MSD_U8)FIR_AVB_PORT_TAI, (MSD_U8)FIR_AVB_BLOCK_PTP,
+				(MSD_U8)FIR_TAI_REG_CONFIG, 1U, &taiConfig);
+		}
+	}
+	else
+	{
+		nCmd = 0;
+		Fir_gsysRmuAddWait(regCmd, &nCmd);
+		Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+			Fir_gsysAvbCommand((MSD_U16)FIR_AVB_OP_READ_MULTIPLE, (MSD_U8)FIR_AVB_PORT_TAI, (MSD_U8)FIR_AVB_BLOCK_PTP, (MSD_U8)FIR_TAI_REG_GLOBAL_TIME));
+		Fir_gsysRmuAddWait(regCmd, &nCmd);
+		Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+		Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+		Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+			Fir_gsysAvbCommand((MSD_U16)FIR_AVB_OP_READ, (MSD_U8)FIR_AVB_PORT_TAI, (MSD_U8)FIR_AVB_BLOCK_PTP, (MSD_U8)FIR_TAI_REG_CONFIG));
+		Fir_gsysRmuAddWait(regCmd, &nCmd);
+		Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_AVB_DATA, 0);
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		timeData[0] = regCmd[3].data;
+		timeData[1] = regCmd[4].data;
+		taiConfig = regCmd[7].data;
+	}
+	if (retVal != MSD_OK)
+	{
+		msdSemGive(dev->devNum, dev->ptpRegsSem);
+		MSD_DBG_ERROR(("Read TAI global time returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+	now = ((MSD_U32)timeData[1] << 16) | (MSD_U32)timeData[0];
+
+	/* baseTime, or its first boundary at least lead cycles ahead of now */
+	lead = (cycleTime > (MSD_U32)FIR_QBV_COMMIT_LEAD) ? cycleTime : (MSD_U32)FIR_QBV_COMMIT_LEAD;
+	start = baseTime;
+	ahead = start - now;
+	if ((ahead < lead) || (ahead > (MSD_U32)0x7FFFFFFF))
+	{
+		start += ((MSD_U32)(lead - ahead) + cycleTime - 1U) / cycleTime * cycleTime;
+	}
+
+	addr[0] = (MSD_U8)FIR_TAI_REG_TRIG_GEN_AMT;
+	data[0] = (MSD_U16)(cycleTime & 0xFFFFU);
+	addr[1] = (MSD_U8)(FIR_TAI_REG_TRIG_GEN_AMT + 1U);
+	data[1] = (MSD_U16)(cycleTime >> 16);
+	addr[2] = (MSD_U8)FIR_TAI_REG_TRIG_GEN_TIME;
+	data[2] = (MSD_U16)(start & 0xFFFFU);
+	addr[3] = (MSD_U8)(FIR_TAI_REG_TRIG_GEN_TIME + 1U);
+	data[3] = (MSD_U16)(start >> 16);
+	/* TrigMode 0 (periodic clock), TrigGenReq */
+	addr[4] = (MSD_U8)FIR_TAI_REG_CONFIG;
+	data[4] = (MSD_U16)((taiConfig & (MSD_U16)0xFFFC) | (MSD_U16)0x1);
+
+	if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; (i < 5U) && (retVal == MSD_OK); i++)
+		{
+			retVal = Fir_gsysAvbWrite(dev, (MSD_U8)FIR_AVB_PORT_TAI, (MSD_U8)FIR_AVB_BLOCK_PTP, addr[i], data[i]);
+		}
+	}
+	else
+	{
+		nCmd = 0;
+		for (i = 0; i < 5U; i++)
+		{
+			Fir_gsysRmuAddWait(regCmd, &nCmd);
+			Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_DATA, data[i]);
+			Fir_gsysRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_AVB_COMMAND,
+				Fir_gsysAvbCommand((MSD_U16)FIR_AVB_OP_WRITE, (MSD_U8)FIR_AVB_PORT_TAI, (MSD_U8)FIR_AVB_BLOCK_PTP, addr[i]));
+		}
+		Fir_gsysRmuAddWait(regCmd, &nCmd);
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+	}
+
+	msdSemGive(dev->devNum, dev->ptpRegsSem);
+
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Write TAI trigger generator returned: %s.\n", msdDisplayStatus(retVal)));
+		return retVal;
+	}
+	*startTime = start;
+
+	MSD_DBG_INFO(("Fir_gsysQbvCommitCycle Exit.\n"));
+	return MSD_OK;
+}
+
 /*******************************************************************************
 * Fir_gsysDevIntEnableSet
 *
@@ -1817,4 +2158,127 @@ OUT MSD_U16      *status
 
 	MSD_DBG_INFO(("Fir_gsysActiveIntStatusGet Exit.\n"));
 	return retVal;
-}
\ No newline at end of file
+}
+
+static MSD_U16 Fir_gsysAvbCommand
+(
+IN MSD_U16		op,
+IN MSD_U8		avbPort,
+IN MSD_U8		avbBlock,
+IN MSD_U8		avbRegAddr
+)
+{
+	return (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((op & (MSD_U16)0x3) << 13) |
+		(MSD_U16)(((MSD_U16)avbPort & (MSD_U16)0x1F) << 8) | (MSD_U16)(((MSD_U16)avbBlock & (MSD_U16)0x7) << 5) |
+		(MSD_U16)((MSD_U16)avbRegAddr & (MSD_U16)0x1F));
+}
+
+static void Fir_gsysRmuAdd
+(
+IN MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd,
+IN MSD_U8		opCode,
+IN MSD_U8		regAddr,
+IN MSD_U16		data
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
+
+/* Wait until the busy bit of the AVB command register clears */
+static void Fir_gsysRmuAddWait
+(
+IN MSD_RegCmd	*regCmd,
+INOUT MSD_U32	*nCmd
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = FIR_AVB_COMMAND;
+	regCmd[*nCmd].data = 15U;
+	*nCmd += 1U;
+}
+
+static MSD_STATUS Fir_gsysAvbWait
+(
+IN MSD_QD_DEV	*dev
+)
+{
+	MSD_STATUS		retVal;
+	MSD_U16			tmpdata;
+
+	tmpdata = (MSD_U16)1;
+	while (tmpdata == (MSD_U16)1)
+	{
+		retVal = msdGetAnyRegField(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND, (MSD_U8)15, (MSD_U8)1, &tmpdata);
+		if (retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	return MSD_OK;
+}
+
+static MSD_STATUS Fir_gsysAvbWrite
+(
+IN MSD_QD_DEV	*dev,
+IN MSD_U8		avbPort,
+IN MSD_U8		avbBlock,
+IN MSD_U8		avbRegAddr,
+IN MSD_U16		data
+)
+{
+	MSD_STATUS		retVal;
+
+	retVal = Fir_gsysAvbWait(dev);
+	if (retVal == MSD_OK)
+	{
+		retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_DATA, data);
+	}
+	if (retVal == MSD_OK)
+	{
+		retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND,
+			Fir_gsysAvbCommand((MSD_U16)FIR_AVB_OP_WRITE, avbPort, avbBlock, avbRegAddr));
+	}
+
+	return retVal;
+}
+
+static MSD_STATUS Fir_gsysAvbRead
+(
+IN MSD_QD_DEV	*dev,
+IN MSD_U16		op,
+IN MSD_U8		avbPort,
+IN MSD_U8		avbBlock,
+IN MSD_U8		avbRegAddr,
+IN MSD_U32		nData,
+OUT MSD_U16		*data
+)
+{
+	MSD_STATUS		retVal;
+	MSD_U32			i;
+
+	retVal = Fir_gsysAvbWait(dev);
+	if (retVal == MSD_OK)
+	{
+		retVal = msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_COMMAND,
+			Fir_gsysAvbCommand(op, avbPort, avbBlock, avbRegAddr));
+	}
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_gsysAvbWait(dev);
+	}
+	for (i = 0; (i < nData) && (retVal == MSD_OK); i++)
+	{
+		retVal = msdGetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, FIR_AVB_DATA, &data[i]);
+	}
+
+	return retVal;
+}
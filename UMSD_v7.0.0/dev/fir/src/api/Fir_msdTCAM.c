@@ -23,6 +23,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 /****************************************************************************/
 /* Internal TCAM structure declaration.                                    */
 /****************************************************************************/
@@ -98,6 +99,19 @@ typedef enum
 	Fir_TCAM_READ_ENTRY = 0x5
 } FIR_MSD_TCAM_OPERATION;
 
+/* Rule compiler: continue code chaining an entry to its extension, key bits
+   identifying an extension entry, and the flattened key used for merging */
+#define FIR_TCAM_RULE_CONTINUE      0x4U
+#define FIR_TCAM_RULE_EXT_ID_MASK   0x1FFU
+#define FIR_TCAM_RULE_KEY_FIELDS    53U
+#define FIR_TCAM_RULE_KEY_SPV       2U
+
+/* Shadow: page 0 key register 1 of a flushed ingress entry, number of staging
+   registers per page, and the egress pointer starting a search */
+#define FIR_TCAM_SHADOW_FLUSHED     0x00FFU
+#define FIR_TCAM_SHADOW_PAGE_REGS   26U
+#define FIR_TCAM_SHADOW_EGR_START   0x3FU
+
 /****************************************************************************/
 /* TCAM operation function declaration.                                    */
 /****************************************************************************/
@@ -114,6 +128,20 @@ static MSD_STATUS Fir_tcamEgrOperationPerform
     IN   FIR_MSD_TCAM_OPERATION    tcamOp,
     INOUT FIR_MSD_TCAM_EGR_OP_DATA    *opData
 );
+
+static MSD_STATUS Fir_tcamHwOperationPerform
+(
+    IN   MSD_QD_DEV             *dev,
+    IN   FIR_MSD_TCAM_OPERATION    tcamOp,
+    INOUT FIR_MSD_TCAM_OP_DATA    *opData
+);
+
+static MSD_STATUS Fir_tcamEgrHwOperationPerform
+(
+    IN   MSD_QD_DEV             *dev,
+    IN   FIR_MSD_TCAM_OPERATION    tcamOp,
+    INOUT FIR_MSD_TCAM_EGR_OP_DATA    *opData
+);
 static MSD_STATUS Fir_setTcamHWData
 (
     IN	const FIR_MSD_TCAM_DATA	*iData,
@@ -154,6 +182,31 @@ static MSD_STATUS Fir_tcamGetPage2Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_DATA_
 static MSD_STATUS Fir_tcamGetPage3Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_EGR_DATA_HW *tcamDataPtr);
 static MSD_STATUS Fir_waitTcamReady(const MSD_QD_DEV *dev);
 
+static MSD_STATUS Fir_tcamRuleSerialize(const FIR_MSD_TCAM_RULE *rule, MSD_U8 *octet, MSD_U8 *octetMask, MSD_U32 *keyLen);
+static MSD_BOOL Fir_tcamRuleMerge(FIR_MSD_TCAM_DATA *dst, const FIR_MSD_TCAM_DATA *src);
+static MSD_STATUS Fir_tcamRuleEgrPointer(const FIR_MSD_TCAM_RULE *rule, FIR_MSD_TCAM_RULE_IMAGE *image, MSD_U8 *egActPoint);
+static void Fir_tcamRuleRemoveSlot(FIR_MSD_TCAM_RULE_IMAGE *image, MSD_U32 slot, MSD_U32 primCount, MSD_U32 numRules, MSD_U32 *ruleSlot);
+static void Fir_tcamRulePut(MSD_U8 *octet, MSD_U8 *octetMask, MSD_U32 offset, MSD_U32 data, MSD_U32 dataMask, MSD_U32 size);
+static void Fir_tcamRuleKeyGet(const FIR_MSD_TCAM_DATA *tcamData, MSD_U16 *key, MSD_U16 *keyMask);
+static void Fir_tcamRuleKeySet(FIR_MSD_TCAM_DATA *tcamData, const MSD_U16 *key, const MSD_U16 *keyMask);
+
+static MSD_STATUS Fir_tcamShadowLoad(const MSD_QD_DEV *dev, FIR_MSD_TCAM_SHADOW *shadow, FIR_MSD_TCAM_OP_DATA *opData);
+static MSD_STATUS Fir_tcamShadowScan(MSD_QD_DEV *dev, FIR_MSD_TCAM_SHADOW *shadow, MSD_BOOL update, MSD_U32 *mismatch);
+static MSD_U16 *Fir_tcamShadowHwPage(FIR_MSD_TCAM_DATA_HW *tcamDataPtr, MSD_U32 page);
+static MSD_BOOL Fir_tcamShadowRegUsed(MSD_U32 page, MSD_U32 reg);
+static MSD_BOOL Fir_tcamShadowIgrValid(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry);
+static MSD_BOOL Fir_tcamShadowEgrValid(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U8 hwPort, MSD_U32 entry);
+static void Fir_tcamShadowFlushIgr(FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry);
+static void Fir_tcamShadowGetIgr(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry, FIR_MSD_TCAM_DATA_HW *tcamDataPtr);
+static void Fir_tcamRmuAdd(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 opCode, MSD_U8 regAddr, MSD_U16 data);
+static void Fir_tcamRmuAddWait(MSD_RegCmd *regCmd, MSD_U32 *nCmd);
+static MSD_STATUS Fir_tcamRmuReadEntry(MSD_QD_DEV *dev, FIR_MSD_TCAM_OP_DATA *opData);
+static MSD_STATUS Fir_tcamRmuReadPerform(MSD_QD_DEV *dev, FIR_MSD_TCAM_OPERATION tcamOp, FIR_MSD_TCAM_OP_DATA *opData);
+static MSD_STATUS Fir_tcamEgrRmuReadPerform(MSD_QD_DEV *dev, FIR_MSD_TCAM_OPERATION tcamOp, FIR_MSD_TCAM_EGR_OP_DATA *opData);
+static void Fir_tcamShadowPutIgr(FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr);
+static MSD_BOOL Fir_tcamShadowIgrEqual(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr);
+static MSD_STATUS Fir_tcamRmuLoadEntry(MSD_QD_DEV *dev, FIR_MSD_TCAM_OP_DATA *opData);
+
 
 /*******************************************************************************
 * Fir_gtcamFlushAll
@@ -1246,19 +1299,18 @@ MSD_STATUS Fir_gtcamDump
     MSD_STATUS status = MSD_OK;
     MSD_U32    tcamPointer;
     FIR_MSD_TCAM_DATA  tcamData;
+    FIR_MSD_TCAM_ITER  iter;
 
     MSD_DBG_INFO(("Fir_gtcamDump Called.\n"));
 
-    tcamPointer = (MSD_U32)0xff;
-
+    status = Fir_gtcamIterInit(dev, &iter);
     while (status == MSD_OK)
     {
-		status = Fir_gtcamGetNextTCAMData(dev, &tcamPointer, &tcamData);
-        MSG(("find the next valid TCAM entry number is %u\n", tcamPointer));
-        displayTcamData(&tcamData);
-        if ((tcamPointer & (MSD_U32)0x00ff) == (MSD_U32)0xff)
+        status = Fir_gtcamIterNext(dev, &iter, &tcamPointer, &tcamData);
+        if (status == MSD_OK)
         {
-            break;
+            MSG(("find the next valid TCAM entry number is %u\n", tcamPointer));
+            displayTcamData(&tcamData);
         }
     }
 
@@ -1428,571 +1480,1492 @@ MSD_STATUS Fir_gtcamAdvConfig
 }
 
 
-/****************************************************************************/
-/* Internal functions.                                                  */
-/****************************************************************************/
-static MSD_STATUS Fir_setTcamHWData
+/*******************************************************************************
+* Fir_gtcamRuleCompile
+*
+* DESCRIPTION:
+*       This routine compiles a set of high level match/action rules into TCAM
+*       entry images ready to be loaded. Frame offsets are computed from the
+*       header stack of each rule, a rule is extended into a second or third
+*       chained entry only when it matches beyond the first 48 bytes, and rules
+*       of the same priority with the same action are merged whenever their
+*       keys can be expressed by one ternary entry.
+*
+* INPUTS:
+*       mode      - TCAM key mode the ports are configured with (Fir_gtcamSetMode)
+*       baseEntry - first TCAM entry to place the rules at
+*       numRules  - number of rules
+*       rules     - rule array
+*       image     - igrSize, igrImage, egrSize and egrImage provided by the caller
+*
+* OUTPUTS:
+*       ruleEntry - TCAM entry each rule starts at, may be NULL
+*       image     - igrCount and egrCount images filled in
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_BAD_PARAM - if invalid parameter is given or a rule does not fit
+*                       in the key mode
+*       MSD_NO_SPACE  - if the rules need more TCAM entries or egress action
+*                       pointers than available
+*
+* COMMENTS:
+*       Rules are placed from baseEntry in ascending priority, extension
+*       entries follow the last primary entry. Only rules of equal priority
+*       are merged, so rules whose relative order matters must use distinct
+*       priorities. No hardware access is done.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRuleCompile
 (
-	IN	const FIR_MSD_TCAM_DATA	*iData,
-	OUT	FIR_MSD_TCAM_DATA_HW	*oData
+    IN    FIR_MSD_TCAM_MODE mode,
+    IN    MSD_U32 baseEntry,
+    IN    MSD_U32 numRules,
+    IN    const FIR_MSD_TCAM_RULE *rules,
+    OUT   MSD_U32 *ruleEntry,
+    INOUT FIR_MSD_TCAM_RULE_IMAGE *image
 )
 {
-	MSD_16 i;
-	
-	msdMemSet(oData,0,sizeof(FIR_MSD_TCAM_DATA_HW));
-
-	/*key*/
-	MSD_BF_SET(oData->pg0.frame[0],iData->frameTypeMask, 14, 2);
-	MSD_BF_SET(oData->pg0.frame[0],iData->frameType, 6, 2);
-	MSD_BF_SET(oData->pg0.frame[0], iData->timeKeyMask, 13, 1);
-	MSD_BF_SET(oData->pg0.frame[0], iData->timeKey, 5, 1);
-	MSD_BF_SET(oData->pg0.frame[0],((iData->spvMask&0x300)>>8), 8, 2);
-	MSD_BF_SET(oData->pg0.frame[0],((iData->spv&0x300)>>8), 0, 2);
-
-	MSD_BF_SET(oData->pg0.frame[1],(iData->spvMask&0xff), 8, 8);
-	MSD_BF_SET(oData->pg0.frame[1],(iData->spv&0xff), 0, 8);
-
-	MSD_BF_SET(oData->pg0.frame[2],iData->ppriMask, 12, 4);
-	MSD_BF_SET(oData->pg0.frame[2],iData->ppri, 4, 4);
-	MSD_BF_SET(oData->pg0.frame[2],((iData->pvidMask&0xf00)>>8), 8, 4);
-	MSD_BF_SET(oData->pg0.frame[2],((iData->pvid&0xf00)>>8), 0, 4);
-
-	MSD_BF_SET(oData->pg0.frame[3],(iData->pvidMask&0xff), 8, 8);
-	MSD_BF_SET(oData->pg0.frame[3],(iData->pvid&0xff), 0, 8);
-
-	/*Page 0 (0~21) bytes*/
-	for(i=4; i<26; i++)
-	{
-		MSD_BF_SET(oData->pg0.frame[i],iData->frameOctetMask[i-4],8,8);
-		MSD_BF_SET(oData->pg0.frame[i],iData->frameOctet[i-4],0,8);
-	}
-
-	/*Page 1 (22~47) bytes*/
-	for(i = 0; i < 26; i++)
-	{
-		MSD_BF_SET(oData->pg1.frame[i],iData->frameOctetMask[22+i],8,8);
-		MSD_BF_SET(oData->pg1.frame[i],iData->frameOctet[22+i],0,8);
-	}
+    MSD_STATUS retVal = MSD_OK;
+    MSD_U8 octet[FIR_MSD_TCAM_RULE_KEY_SIZE];
+    MSD_U8 octetMask[FIR_MSD_TCAM_RULE_KEY_SIZE];
+    FIR_MSD_TCAM_DATA tcamData;
+    FIR_MSD_TCAM_DATA *entryPtr;
+    FIR_MSD_TCAM_IGR_IMAGE tmpImage;
+    const FIR_MSD_TCAM_RULE *rule;
+    MSD_U32 maxSeg;
+    MSD_U32 keyLen = 0;
+    MSD_U32 numSeg = 0;
+    MSD_U32 primCount = 0;
+    MSD_U32 extCount = 0;
+    MSD_U32 groupStart = 0;
+    MSD_U32 done;
+    MSD_U32 cur = 0;
+    MSD_U32 next;
+    MSD_U32 slot = 0;
+    MSD_U32 seg;
+    MSD_U32 tail;
+    MSD_U32 i;
+    MSD_U32 j;
+    MSD_U8 egActPoint = 0;
+    MSD_BOOL merged;
+
+    MSD_DBG_INFO(("Fir_gtcamRuleCompile Called.\n"));
+
+    switch (mode)
+    {
+    case FIR_MSD_TCAM_MODE_ENABLE_48:
+    case FIR_MSD_TCAM_MODE_WITHOUT_FIFO_DELAY:
+        maxSeg = 1U;
+        break;
+    case FIR_MSD_TCAM_MODE_ENABLE_96:
+        maxSeg = 2U;
+        break;
+    case FIR_MSD_TCAM_MODE_ENABLE_144:
+        maxSeg = 3U;
+        break;
+    default:
+        maxSeg = 0;
+        break;
+    }
 
-	/*Action*/
-	MSD_BF_SET(oData->pg2.frame[0],iData->continu, 13, 3);
-	MSD_BF_SET(oData->pg2.frame[0],(MSD_U16)(iData->vidOverride), 12, 1);
-	MSD_BF_SET(oData->pg2.frame[0],iData->vidData, 0, 12);
+    if ((rules == NULL) || (image == NULL) || (image->igrImage == NULL) || (numRules == 0U))
+    {
+        MSD_DBG_ERROR(("Input param rules or image is NULL or numRules is 0.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else if ((maxSeg == 0U) || (baseEntry >= FIR_MAX_IGR_TCAM_ENTRY))
+    {
+        MSD_DBG_ERROR(("Bad Tcam Mode %d or baseEntry %u out of range.\n", (int)mode, baseEntry));
+        retVal = MSD_BAD_PARAM;
+    }
+    else
+    {
+        image->igrCount = 0;
+        image->egrCount = 0;
 
-	/* MSD_BF_SET(oData->pg2.frame[1],iData->nextId, 8, 8); */
-	MSD_BF_SET(oData->pg2.frame[1],(MSD_U16)(iData->qpriOverride), 7, 1);
-	MSD_BF_SET(oData->pg2.frame[1],iData->qpriData, 4, 3);
-	MSD_BF_SET(oData->pg2.frame[1],(MSD_U16)(iData->fpriOverride), 3, 1);
-	MSD_BF_SET(oData->pg2.frame[1],iData->fpriData, 0, 3);
+        for (done = 0; (done < numRules) && (retVal == MSD_OK); done++)
+        {
+            /* Pick the next rule in (priority, index) order */
+            next = numRules;
+            for (i = 0; i < numRules; i++)
+            {
+                if ((done == 0U) || (rules[i].priority > rules[cur].priority) ||
+                    ((rules[i].priority == rules[cur].priority) && (i > cur)))
+                {
+                    if ((next == numRules) || (rules[i].priority < rules[next].priority))
+                    {
+                        next = i;
+                    }
+                }
+            }
+            if ((done != 0U) && (rules[next].priority != rules[cur].priority))
+            {
+                groupStart = primCount;
+            }
+            cur = next;
+            rule = &rules[cur];
+
+            retVal = Fir_tcamRuleSerialize(rule, octet, octetMask, &keyLen);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Bad ruleType %d for rule %u.\n", (int)rule->ruleType, cur));
+            }
+            else
+            {
+                numSeg = (keyLen + 47U) / 48U;
+                if (numSeg == 0U)
+                {
+                    numSeg = 1U;
+                }
+                if (numSeg > maxSeg)
+                {
+                    MSD_DBG_ERROR(("Rule %u matches %u bytes, more than the Tcam Mode allows.\n", cur, keyLen));
+                    retVal = MSD_BAD_PARAM;
+                }
+                else if (rule->egrActionEn == MSD_TRUE)
+                {
+                    retVal = Fir_tcamRuleEgrPointer(rule, image, &egActPoint);
+                }
+                else
+                {
+                    egActPoint = rule->action.egActPoint;
+                }
+            }
+
+            if (retVal == MSD_OK)
+            {
+                msdMemSet(&tcamData, 0, sizeof(FIR_MSD_TCAM_DATA));
+                tcamData.frameType = rule->key.frameType;
+                tcamData.timeKey = rule->key.timeKey;
+                tcamData.spv = rule->key.spv;
+                tcamData.ppri = rule->key.ppri;
+                tcamData.pvid = rule->key.pvid;
+                tcamData.frameTypeMask = rule->keyMask.frameType;
+                tcamData.timeKeyMask = rule->keyMask.timeKey;
+                tcamData.spvMask = rule->keyMask.spv;
+                tcamData.ppriMask = rule->keyMask.ppri;
+                tcamData.pvidMask = rule->keyMask.pvid;
+                for (i = 0; i < 48U; i++)
+                {
+                    tcamData.frameOctet[i] = octet[i];
+                    tcamData.frameOctetMask[i] = octetMask[i];
+                }
+
+                merged = MSD_FALSE;
+                if (numSeg == 1U)
+                {
+                    mappingActionToTcam(&tcamData, &rule->action);
+                    tcamData.egActPoint = egActPoint;
+
+                    for (slot = groupStart; slot < primCount; slot++)
+                    {
+                        if ((image->igrImage[slot].tcamData.continu == 0U) &&
+                            (Fir_tcamRuleMerge(&image->igrImage[slot].tcamData, &tcamData) == MSD_TRUE))
+                        {
+                            merged = MSD_TRUE;
+                            break;
+                        }
+                    }
+                }
+
+                if (merged == MSD_TRUE)
+                {
+                    if (ruleEntry != NULL)
+                    {
+                        ruleEntry[cur] = slot;
+                    }
+
+                    /* The widened entry may now absorb other entries of its group */
+                    j = groupStart;
+                    while (j < primCount)
+                    {
+                        if ((j != slot) && (image->igrImage[j].tcamData.continu == 0U) &&
+                            (Fir_tcamRuleMerge(&image->igrImage[slot].tcamData, &image->igrImage[j].tcamData) == MSD_TRUE))
+                        {
+                            if (ruleEntry != NULL)
+                            {
+                                for (i = 0; i < numRules; i++)
+                                {
+                                    if (ruleEntry[i] == j)
+                                    {
+                                        ruleEntry[i] = slot;
+                                    }
+                                }
+                            }
+                            Fir_tcamRuleRemoveSlot(image, j, primCount, numRules, ruleEntry);
+                            primCount--;
+                            if (j < slot)
+                            {
+                                slot--;
+                            }
+                            j = groupStart;
+                        }
+                        else
+                        {
+                            j++;
+                        }
+                    }
+                }
+                else if (((primCount + extCount + numSeg) > image->igrSize) ||
+                         ((baseEntry + primCount + extCount + numSeg) > FIR_MAX_IGR_TCAM_ENTRY))
+                {
+                    MSD_DBG_ERROR(("No TCAM entry left for rule %u.\n", cur));
+                    retVal = MSD_NO_SPACE;
+                }
+                else
+                {
+                    slot = primCount;
+                    primCount++;
+                    image->igrImage[slot].tcamData = tcamData;
+                    entryPtr = &image->igrImage[slot].tcamData;
+
+                    /* Chain the bytes beyond 48 into extension entries taken from the tail */
+                    for (seg = 1U; seg < numSeg; seg++)
+                    {
+                        tail = image->igrSize - 1U - extCount;
+                        extCount++;
+
+                        entryPtr->continu = FIR_TCAM_RULE_CONTINUE;
+                        entryPtr->nextId = (MSD_U16)tail;
+
+                        entryPtr = &image->igrImage[tail].tcamData;
+                        msdMemSet(entryPtr, 0, sizeof(FIR_MSD_TCAM_DATA));
+                        entryPtr->pvid = (MSD_U16)tail;
+                        entryPtr->pvidMask = FIR_TCAM_RULE_EXT_ID_MASK;
+                        for (i = 0; i < 48U; i++)
+                        {
+                            entryPtr->frameOctet[i] = octet[(seg * 48U) + i];
+                            entryPtr->frameOctetMask[i] = octetMask[(seg * 48U) + i];
+                        }
+                    }
+                    if (numSeg > 1U)
+                    {
+                        mappingActionToTcam(entryPtr, &rule->action);
+                        entryPtr->egActPoint = egActPoint;
+                    }
+
+                    if (ruleEntry != NULL)
+                    {
+                        ruleEntry[cur] = slot;
+                    }
+                }
+            }
+        }
 
-	MSD_BF_SET(oData->pg2.frame[2],iData->dpvSF, 11, 1);
-	MSD_BF_SET(oData->pg2.frame[2],(MSD_U16)(iData->dpvData), 0, 10);
+        if (retVal == MSD_OK)
+        {
+            /* Move the extension entries right behind the primary entries, in allocation order */
+            i = image->igrSize - extCount;
+            j = image->igrSize - 1U;
+            while (i < j)
+            {
+                tmpImage = image->igrImage[i];
+                image->igrImage[i] = image->igrImage[j];
+                image->igrImage[j] = tmpImage;
+                i++;
+                j--;
+            }
+            for (i = 0; i < extCount; i++)
+            {
+                image->igrImage[primCount + i] = image->igrImage[(image->igrSize - extCount) + i];
+            }
+
+            /* Translate the tail indexes used while compiling into TCAM entries */
+            image->igrCount = primCount + extCount;
+            for (i = 0; i < image->igrCount; i++)
+            {
+                entryPtr = &image->igrImage[i].tcamData;
+                image->igrImage[i].tcamPointer = baseEntry + i;
+                if (entryPtr->continu == FIR_TCAM_RULE_CONTINUE)
+                {
+                    entryPtr->nextId = (MSD_U16)(baseEntry + primCount + (image->igrSize - 1U - entryPtr->nextId));
+                }
+                if (i >= primCount)
+                {
+                    entryPtr->pvid = (MSD_U16)(baseEntry + primCount + (image->igrSize - 1U - entryPtr->pvid));
+                }
+            }
+
+            if (ruleEntry != NULL)
+            {
+                for (i = 0; i < numRules; i++)
+                {
+                    ruleEntry[i] = baseEntry + ruleEntry[i];
+                }
+            }
+        }
+    }
 
-	/* MSD_BF_SET(oData->pg2.frame[3], (((iData->dpvData) & 0x0800) >> 11), 0, 1); */
+    MSD_DBG_INFO(("Fir_gtcamRuleCompile Exit.\n"));
+    return retVal;
+}
 
-	MSD_BF_SET(oData->pg2.frame[4],iData->dpvMode, 14, 2);
-	MSD_BF_SET(oData->pg2.frame[4],iData->colorMode, 12, 2);
-	MSD_BF_SET(oData->pg2.frame[4],(MSD_U16)(iData->vtuPageOverride), 11, 1);
-	MSD_BF_SET(oData->pg2.frame[4],iData->vtuPage, 10, 1);
-	MSD_BF_SET(oData->pg2.frame[4],iData->unKnownFilter, 8, 2);
-	MSD_BF_SET(oData->pg2.frame[4],iData->egActPoint, 0, 6);
+/*******************************************************************************
+* Fir_gtcamRuleLoad
+*
+* DESCRIPTION:
+*       This routine loads the TCAM images produced by Fir_gtcamRuleCompile.
+*       Egress entries are loaded first, then ingress entries from the last
+*       one to the first one, so that extension entries and lower priority
+*       entries are in place before the entries chaining to them go live.
+*
+* INPUTS:
+*       image - compiled images
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRuleLoad
+(
+    IN  MSD_QD_DEV *dev,
+    IN  const FIR_MSD_TCAM_RULE_IMAGE *image
+)
+{
+    MSD_STATUS retVal = MSD_OK;
+    FIR_MSD_TCAM_DATA tcamData;
+    FIR_MSD_TCAM_EGR_DATA tcamEgrData;
+    MSD_U32 i;
+    MSD_LPORT port;
 
-	MSD_BF_SET(oData->pg2.frame[5],(MSD_U16)(iData->ldBalanceOverride), 15, 1);
-	MSD_BF_SET(oData->pg2.frame[5],iData->ldBalanceData, 12, 3);
-	MSD_BF_SET(oData->pg2.frame[5], iData->tcamTunnel, 10, 1);
-	MSD_BF_SET(oData->pg2.frame[5], iData->ipMulticast, 9, 1);
-	MSD_BF_SET(oData->pg2.frame[5], iData->ip2me, 8, 1);
-	MSD_BF_SET(oData->pg2.frame[5], iData->routeEntry, 7, 1);
-	MSD_BF_SET(oData->pg2.frame[5],(MSD_U16)(iData->DSCPOverride), 6, 1);
-	MSD_BF_SET(oData->pg2.frame[5],iData->DSCP, 0, 6);
+    MSD_DBG_INFO(("Fir_gtcamRuleLoad Called.\n"));
 
-	MSD_BF_SET(oData->pg2.frame[6],(MSD_U16)(iData->factionOverride), 15, 1);
-	MSD_BF_SET(oData->pg2.frame[6],iData->factionData, 0, 15);
+    if ((image == NULL) || ((image->igrCount != 0U) && (image->igrImage == NULL)) ||
+        ((image->egrCount != 0U) && (image->egrImage == NULL)))
+    {
+        MSD_DBG_ERROR(("Input param image is NULL.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else
+    {
+        for (i = 0; (i < image->egrCount) && (retVal == MSD_OK); i++)
+        {
+            tcamEgrData = image->egrImage[i].tcamEgrData;
+            for (port = 0; (port < dev->numOfPorts) && (retVal == MSD_OK); port++)
+            {
+                if ((image->egrImage[i].portVec & ((MSD_U32)1 << port)) != 0U)
+                {
+                    retVal = Fir_gtcamEgrLoadEntry(dev, port, image->egrImage[i].egActPoint, &tcamEgrData);
+                    if (retVal != MSD_OK)
+                    {
+                        MSD_DBG_ERROR(("Fir_gtcamEgrLoadEntry for port %u returned: %s.\n", port, msdDisplayStatus(retVal)));
+                    }
+                }
+            }
+        }
 
-    MSD_BF_SET(oData->pg2.frame[7], iData->nextId, 0, 9);
+        for (i = image->igrCount; (i > 0U) && (retVal == MSD_OK); i--)
+        {
+            tcamData = image->igrImage[i - 1U].tcamData;
+            retVal = Fir_gtcamLoadEntry(dev, image->igrImage[i - 1U].tcamPointer, &tcamData);
+            if (retVal != MSD_OK)
+            {
+                MSD_DBG_ERROR(("Fir_gtcamLoadEntry for entry %u returned: %s.\n", image->igrImage[i - 1U].tcamPointer, msdDisplayStatus(retVal)));
+            }
+        }
+    }
 
-    MSD_BF_SET(oData->pg2.frame[8], iData->frerSctrInc, 15, 1);
-    MSD_BF_SET(oData->pg2.frame[8], iData->frerSctrIndex, 8, 5);
-    MSD_BF_SET(oData->pg2.frame[8], iData->frerStreamSplitEn, 3, 1);
-    MSD_BF_SET(oData->pg2.frame[8], iData->frerSeqGenEn, 2, 1);
-    MSD_BF_SET(oData->pg2.frame[8], iData->frerSeqEncType, 0, 1);
-    
-    MSD_BF_SET(oData->pg2.frame[9], iData->frerSeqRcvyEn, 15, 1);
-    MSD_BF_SET(oData->pg2.frame[9], iData->frerSeqRcvyIndex, 8, 7);
-    MSD_BF_SET(oData->pg2.frame[9], iData->frerIndvRcvyEn, 7, 1);
-    MSD_BF_SET(oData->pg2.frame[9], iData->frerIndvRcvyId, 0, 7);
+    MSD_DBG_INFO(("Fir_gtcamRuleLoad Exit.\n"));
+    return retVal;
+}
 
-    MSD_BF_SET(oData->pg2.frame[10], iData->flowMeterEn, 7, 1);
-    MSD_BF_SET(oData->pg2.frame[10], iData->flowMeterId, 0, 7);
+/*******************************************************************************
+* Fir_gtcamShadowEnable
+*
+* DESCRIPTION:
+*       This routine attaches a host copy of the TCAM to the device and fills
+*       it from the hardware. While the shadow is attached, entry loads only
+*       write the pages and registers that differ from the last programmed
+*       image, and entry reads and searches are served from the shadow
+*       without accessing the hardware.
+*
+* INPUTS:
+*       shadow - shadow storage, must stay valid until Fir_gtcamShadowDisable
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       TCAM updates done outside of this module, such as by RMU frames or by
+*       another agent, are not seen by the shadow. Use Fir_gtcamShadowVerify
+*       and Fir_gtcamShadowSync to detect and repair them.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowEnable
+(
+    IN  MSD_QD_DEV *dev,
+    IN  FIR_MSD_TCAM_SHADOW *shadow
+)
+{
+    MSD_STATUS retVal;
 
-    MSD_BF_SET(oData->pg2.frame[11], iData->tsDomain, 15, 1);
-    MSD_BF_SET(oData->pg2.frame[11], iData->tsFormat, 13, 2);
-    MSD_BF_SET(oData->pg2.frame[11], iData->depTsEn, 12, 1);
-    MSD_BF_SET(oData->pg2.frame[11], iData->arrTsEn, 11, 1);
-    MSD_BF_SET(oData->pg2.frame[11], iData->streamFilterEn, 7, 1);
-    MSD_BF_SET(oData->pg2.frame[11], iData->streamFilterId, 0, 4);
+    MSD_DBG_INFO(("Fir_gtcamShadowEnable Called.\n"));
 
+    if (shadow == NULL)
+    {
+        MSD_DBG_ERROR(("Input param shadow is NULL.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else
+    {
+        dev->tcamShadow = NULL;
+        retVal = Fir_tcamShadowScan(dev, shadow, MSD_TRUE, NULL);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Fir_tcamShadowScan returned: %s.\n", msdDisplayStatus(retVal)));
+        }
+        else
+        {
+            dev->tcamShadow = (void *)shadow;
+        }
+    }
 
-	MSD_BF_SET(oData->pg2.frame[25], iData->interrupt, 15, 1);
-	MSD_BF_SET(oData->pg2.frame[25], iData->IncTcamCtr, 14, 1);
-	MSD_BF_SET(oData->pg2.frame[25], iData->tcamCtr, 12, 2);
-	
-	return MSD_OK;
+    MSD_DBG_INFO(("Fir_gtcamShadowEnable Exit.\n"));
+    return retVal;
 }
 
-static MSD_STATUS Fir_getTcamHWData
+/*******************************************************************************
+* Fir_gtcamShadowDisable
+*
+* DESCRIPTION:
+*       This routine detaches the TCAM shadow from the device. All following
+*       TCAM operations access the hardware directly.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowDisable
 (
-	IN	const FIR_MSD_TCAM_DATA_HW	*iData,
-	OUT	FIR_MSD_TCAM_DATA	*oData
+    IN  MSD_QD_DEV *dev
 )
 {
-	MSD_16 i;
-	/*key*/
-	oData->frameTypeMask = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0],14, 2));
-	oData->frameType = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0],6, 2));
-	oData->timeKeyMask = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0], 13, 1));
-	oData->timeKey = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0], 5, 1));
-
-    oData->spvMask = (MSD_BF_GET(iData->pg0.frame[0], 8, 2) << 8) | MSD_BF_GET(iData->pg0.frame[1], 8, 8);
-	oData->spv = (MSD_BF_GET(iData->pg0.frame[0], 0, 2) << 8) | MSD_BF_GET(iData->pg0.frame[1], 0, 8);
-
-	oData->ppriMask = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[2],12, 4));
-	oData->ppri = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[2],4, 4));
-
-	oData->pvidMask = (MSD_BF_GET(iData->pg0.frame[2], 8, 4) << 8) | MSD_BF_GET(iData->pg0.frame[3],8, 8);
+    MSD_DBG_INFO(("Fir_gtcamShadowDisable Called.\n"));
 
-	oData->pvid = (MSD_BF_GET(iData->pg0.frame[2], 0, 4) << 8) | MSD_BF_GET(iData->pg0.frame[3], 0, 8);
+    msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+    dev->tcamShadow = NULL;
+    msdSemGive(dev->devNum, dev->tblRegsSem);
 
-	/*Page 0 (0~21) bytes*/
-	for(i=4; i<26; i++)
-	{
-		oData->frameOctetMask[i-4] = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[i],8, 8));
-		oData->frameOctet[i-4] = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[i],0,8));
-	}
+    MSD_DBG_INFO(("Fir_gtcamShadowDisable Exit.\n"));
+    return MSD_OK;
+}
 
-	/*Page 1 (22~47) bytes*/
-	for(i = 0; i < 26; i++)
-	{
-		oData->frameOctetMask[22+i] = (MSD_U8)(MSD_BF_GET(iData->pg1.frame[i],8,8));
-		oData->frameOctet[22+i] = (MSD_U8)(MSD_BF_GET(iData->pg1.frame[i],0,8));
-	}
+/*******************************************************************************
+* Fir_gtcamShadowSync
+*
+* DESCRIPTION:
+*       This routine reloads the attached TCAM shadow from the hardware,
+*       ingress entries and the egress entries of every port.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_FEATURE_NOT_ENABLE - if no shadow is attached
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowSync
+(
+    IN  MSD_QD_DEV *dev
+)
+{
+    MSD_STATUS retVal;
 
-	/*Action*/
-	oData->continu = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[0], 13, 3));
-	oData->vidOverride = MSD_BF_GET(iData->pg2.frame[0], 12, 1);
-	oData->vidData = MSD_BF_GET(iData->pg2.frame[0], 0, 12);
+    MSD_DBG_INFO(("Fir_gtcamShadowSync Called.\n"));
 
-	/* oData->nextId = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[1], 8, 8)); */
-	oData->qpriOverride = MSD_BF_GET(iData->pg2.frame[1], 7, 1);
-	oData->qpriData = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[1], 4, 3));
-	oData->fpriOverride = MSD_BF_GET(iData->pg2.frame[1], 3, 1);
-	oData->fpriData = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[1], 0, 3));
+    if (dev->tcamShadow == NULL)
+    {
+        MSD_DBG_ERROR(("TCAM shadow is not enabled.\n"));
+        retVal = MSD_FEATURE_NOT_ENABLE;
+    }
+    else
+    {
+        retVal = Fir_tcamShadowScan(dev, (FIR_MSD_TCAM_SHADOW *)dev->tcamShadow, MSD_TRUE, NULL);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Fir_tcamShadowScan returned: %s.\n", msdDisplayStatus(retVal)));
+        }
+    }
 
-	oData->dpvSF = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[2], 11, 1));
-	oData->dpvData = (MSD_BF_GET(iData->pg2.frame[2], 0, 10)) & 0x3ff;
+    MSD_DBG_INFO(("Fir_gtcamShadowSync Exit.\n"));
+    return retVal;
+}
 
-	oData->dpvMode = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 14, 2));
-	oData->colorMode = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 12, 2));
-	oData->vtuPageOverride = MSD_BF_GET(iData->pg2.frame[4], 11, 1);
-	oData->vtuPage = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 10, 1));
-	oData->unKnownFilter = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 8, 2));
-	oData->egActPoint = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 0, 6));
+/*******************************************************************************
+* Fir_gtcamShadowVerify
+*
+* DESCRIPTION:
+*       This routine compares the attached TCAM shadow with the hardware and
+*       counts the entries that differ. The shadow is not modified.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       mismatch - number of ingress and egress entries that differ
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_FEATURE_NOT_ENABLE - if no shadow is attached
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamShadowVerify
+(
+    IN  MSD_QD_DEV *dev,
+    OUT MSD_U32 *mismatch
+)
+{
+    MSD_STATUS retVal;
 
-	oData->ldBalanceOverride = MSD_BF_GET(iData->pg2.frame[5], 15, 1);
-	oData->ldBalanceData = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[5], 12, 3));
-	oData->tcamTunnel = MSD_BF_GET(iData->pg2.frame[5], 10, 1);
-	oData->ipMulticast = MSD_BF_GET(iData->pg2.frame[5], 9, 1);
-	oData->ip2me = MSD_BF_GET(iData->pg2.frame[5], 8, 1);
-	oData->routeEntry = MSD_BF_GET(iData->pg2.frame[5], 7, 1);
-	oData->DSCPOverride = MSD_BF_GET(iData->pg2.frame[5], 6, 1);
-	oData->DSCP = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[5], 0, 6));
+    MSD_DBG_INFO(("Fir_gtcamShadowVerify Called.\n"));
 
-	oData->factionOverride = MSD_BF_GET(iData->pg2.frame[6], 15, 1);
-	oData->factionData = MSD_BF_GET(iData->pg2.frame[6], 0, 15);
+    if (mismatch == NULL)
+    {
+        MSD_DBG_ERROR(("Input param mismatch is NULL.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else if (dev->tcamShadow == NULL)
+    {
+        MSD_DBG_ERROR(("TCAM shadow is not enabled.\n"));
+        retVal = MSD_FEATURE_NOT_ENABLE;
+    }
+    else
+    {
+        retVal = Fir_tcamShadowScan(dev, (FIR_MSD_TCAM_SHADOW *)dev->tcamShadow, MSD_FALSE, mismatch);
+        if (retVal != MSD_OK)
+        {
+            MSD_DBG_ERROR(("Fir_tcamShadowScan returned: %s.\n", msdDisplayStatus(retVal)));
+        }
+    }
 
-    oData->nextId = MSD_BF_GET(iData->pg2.frame[7], 0, 9);
-    oData->frerSctrInc = MSD_BF_GET(iData->pg2.frame[8], 15, 1);
-    oData->frerSctrIndex = MSD_BF_GET(iData->pg2.frame[8], 8, 5);
-    oData->frerStreamSplitEn = MSD_BF_GET(iData->pg2.frame[8], 3, 1);
-    oData->frerSeqGenEn = MSD_BF_GET(iData->pg2.frame[8], 2, 1);
-    oData->frerSeqEncType = MSD_BF_GET(iData->pg2.frame[8], 0, 1);
+    MSD_DBG_INFO(("Fir_gtcamShadowVerify Exit.\n"));
+    return retVal;
+}
 
-    oData->frerSeqRcvyEn = MSD_BF_GET(iData->pg2.frame[9], 15, 1);
-    oData->frerSeqRcvyIndex = MSD_BF_GET(iData->pg2.frame[9], 8, 7);
-    oData->frerIndvRcvyEn = MSD_BF_GET(iData->pg2.frame[9], 7, 1);
-    oData->frerIndvRcvyId = MSD_BF_GET(iData->pg2.frame[9], 0, 7);
+/*******************************************************************************
+* Fir_gtcamIterInit
+*
+* DESCRIPTION:
+*       This routine starts a walk over all valid ingress TCAM entries in
+*       ascending entry order.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       iter - walk state
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamIterInit
+(
+    IN  MSD_QD_DEV *dev,
+    OUT FIR_MSD_TCAM_ITER *iter
+)
+{
+    MSD_STATUS retVal = MSD_OK;
 
-    oData->flowMeterEn = MSD_BF_GET(iData->pg2.frame[10], 7, 1);
-    oData->flowMeterId = MSD_BF_GET(iData->pg2.frame[10], 0, 7);
+    MSD_DBG_INFO(("Fir_gtcamIterInit Called.\n"));
 
-    oData->tsDomain = MSD_BF_GET(iData->pg2.frame[11], 15, 1);
-    oData->tsFormat = MSD_BF_GET(iData->pg2.frame[11], 13, 2);
-    oData->depTsEn = MSD_BF_GET(iData->pg2.frame[11], 12, 1);
-    oData->arrTsEn = MSD_BF_GET(iData->pg2.frame[11], 11, 1);
-    oData->streamFilterEn = MSD_BF_GET(iData->pg2.frame[11], 7, 1);
-    oData->streamFilterId = MSD_BF_GET(iData->pg2.frame[11], 0, 4);
-    
-	oData->interrupt = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[25], 15, 1));
-	oData->IncTcamCtr = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[25], 14, 1));
-	oData->tcamCtr = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[25], 12, 2));
+    if (iter == NULL)
+    {
+        MSD_DBG_ERROR(("Input param iter is NULL.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else
+    {
+        msdMemSet((void*)iter, 0, sizeof(FIR_MSD_TCAM_ITER));
+        /* RMU dump starts from entry 0, get next from 0x1ff */
+        iter->contCode = ((IS_RMU_SUPPORTED(dev)) && (dev->tcamShadow == NULL)) ? 0U : 0x1ffU;
+        iter->done = MSD_FALSE;
+    }
 
-	return MSD_OK;
+    MSD_DBG_INFO(("Fir_gtcamIterInit Exit.\n"));
+    return retVal;
 }
 
-static MSD_STATUS Fir_setTcamEgrHWData
+/*******************************************************************************
+* Fir_gtcamIterNext
+*
+* DESCRIPTION:
+*       This routine returns the next valid ingress TCAM entry of a walk
+*       started by Fir_gtcamIterInit. Entries are fetched FIR_MSD_TCAM_ITER_SIZE
+*       at a time, with one TCAM dump frame when the device is accessed over
+*       RMU, from the shadow when one is attached, or by get next otherwise.
+*
+* INPUTS:
+*       iter - walk state
+*
+* OUTPUTS:
+*       iter        - walk state
+*       tcamPointer - entry number
+*       tcamData    - entry data
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NO_SUCH - no more valid entries
+*
+* COMMENTS:
+*       Entries changed during the walk may or may not be returned.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamIterNext
 (
-	IN	const FIR_MSD_TCAM_EGR_DATA	*iData,
-	OUT	FIR_MSD_TCAM_EGR_DATA_HW	*oData
+    IN    MSD_QD_DEV *dev,
+    INOUT FIR_MSD_TCAM_ITER *iter,
+    OUT   MSD_U32 *tcamPointer,
+    OUT   FIR_MSD_TCAM_DATA *tcamData
 )
 {
-	msdMemSet(oData,0,sizeof(FIR_MSD_TCAM_EGR_DATA_HW));
+    MSD_STATUS retVal = MSD_OK;
+    FIR_MSD_TCAM_DATA *pTcamData;
+    FIR_MSD_TCAM_OP_DATA tcamOpData;
 
-	MSD_BF_SET(oData->frame[0],(MSD_U16)(iData->frameModeOverride), 14, 1);
-	MSD_BF_SET(oData->frame[0],iData->frameMode, 12, 2);
-	MSD_BF_SET(oData->frame[0], iData->noTtlDec, 11, 1);
-	MSD_BF_SET(oData->frame[0],(MSD_U16)(iData->tagModeOverride), 10, 1);
-	MSD_BF_SET(oData->frame[0],iData->tagMode, 8, 2);
-	MSD_BF_SET(oData->frame[0],iData->daMode, 4, 2);
-	MSD_BF_SET(oData->frame[0],iData->saMode, 0, 3);
+    MSD_DBG_INFO(("Fir_gtcamIterNext Called.\n"));
 
-	MSD_BF_SET(oData->frame[1],(MSD_U16)(iData->egVidModeOverride), 14, 1);
-	MSD_BF_SET(oData->frame[1],iData->egVidMode, 12, 2);
-	MSD_BF_SET(oData->frame[1],iData->egVidData, 0, 12);
+    if ((iter == NULL) || (tcamPointer == NULL) || (tcamData == NULL))
+    {
+        MSD_DBG_ERROR(("Input param iter, tcamPointer or tcamData is NULL.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else
+    {
+        if ((iter->index == iter->count) && (iter->done == MSD_FALSE))
+        {
+            iter->index = 0;
+            iter->count = 0;
+            if ((IS_RMU_SUPPORTED(dev)) && (dev->tcamShadow == NULL))
+            {
+                pTcamData = iter->tcamData;
+                retVal = Fir_msdRmuTCAMDumpEntry(dev, &iter->contCode, &iter->count, iter->tcamPointer, &pTcamData);
+                if (retVal != MSD_OK)
+                {
+                    MSD_DBG_ERROR(("Fir_msdRmuTCAMDumpEntry returned: %s.\n", msdDisplayStatus(retVal)));
+                }
+                else if ((iter->count < FIR_MSD_TCAM_ITER_SIZE) || (iter->contCode == 0U))
+                {
+                    iter->done = MSD_TRUE;
+                }
+                else
+                {
+                    /* More entries may follow */
+                }
+            }
+            else
+            {
+                while ((iter->count < FIR_MSD_TCAM_ITER_SIZE) && (retVal == MSD_OK))
+                {
+                    msdMemSet((void*)&tcamOpData, 0, sizeof(tcamOpData));
+                    tcamOpData.tcamEntry = iter->contCode;
+                    retVal = Fir_tcamOperationPerform(dev, Fir_TCAM_GET_NEXT_ENTRY, &tcamOpData);
+                    if (retVal == MSD_OK)
+                    {
+                        iter->tcamPointer[iter->count] = tcamOpData.tcamEntry;
+                        retVal = Fir_getTcamHWData(&tcamOpData.tcamDataP, &iter->tcamData[iter->count]);
+                        iter->count++;
+                        iter->contCode = tcamOpData.tcamEntry;
+                        if (tcamOpData.tcamEntry == 0x1ffU)
+                        {
+                            iter->done = MSD_TRUE;
+                            break;
+                        }
+                    }
+                }
+                if (retVal == MSD_NO_SUCH)
+                {
+                    iter->done = MSD_TRUE;
+                    retVal = MSD_OK;
+                }
+                else if (retVal != MSD_OK)
+                {
+                    MSD_DBG_ERROR(("Fir_tcamOperationPerform GET_NEXT returned: %s.\n", msdDisplayStatus(retVal)));
+                }
+                else
+                {
+                    /* Batch filled */
+                }
+            }
+        }
 
-	MSD_BF_SET(oData->frame[2],iData->egDSCPMode, 14, 2);
-	MSD_BF_SET(oData->frame[2],iData->egDSCP, 8, 6);
-	MSD_BF_SET(oData->frame[2],(MSD_U16)(iData->egfpriModeOverride), 6, 1);
-	MSD_BF_SET(oData->frame[2],iData->egfpriMode, 4, 2);
-	MSD_BF_SET(oData->frame[2],iData->egEC, 3, 1);
-	MSD_BF_SET(oData->frame[2],iData->egFPRI, 0, 3);
+        if (retVal == MSD_OK)
+        {
+            if (iter->index == iter->count)
+            {
+                retVal = MSD_NO_SUCH;
+            }
+            else
+            {
+                *tcamPointer = iter->tcamPointer[iter->index];
+                msdMemCpy((void*)tcamData, (const void*)&iter->tcamData[iter->index], sizeof(FIR_MSD_TCAM_DATA));
+                iter->index++;
+            }
+        }
+    }
 
-    MSD_BF_SET(oData->frame[3], iData->egFrerSeqEncTypeOverride, 10, 1);
-    MSD_BF_SET(oData->frame[3], iData->egFrerSeqEncType, 8, 1);
-	MSD_BF_SET(oData->frame[3], iData->egSIDOverride, 6, 1);
-	MSD_BF_SET(oData->frame[3], iData->egSID, 0, 6);
-	
-	return MSD_OK;
+    MSD_DBG_INFO(("Fir_gtcamIterNext Exit.\n"));
+    return retVal;
 }
 
-static MSD_STATUS Fir_getTcamEgrHWData
+/*******************************************************************************
+* Fir_gtcamLoadEntries
+*
+* DESCRIPTION:
+*       This routine loads an ordered array of ingress TCAM entries. Over RMU
+*       the entries are sent MSD_RMU_MAX_TCAMS at a time with the multi TCAM
+*       request, and a batch the request fails for is retried one entry per
+*       register frame. Otherwise each entry is loaded as by
+*       Fir_gtcamLoadEntry.
+*
+* INPUTS:
+*       numEntries - number of entries
+*       entries    - entry numbers and data, loaded in array order
+*
+* OUTPUTS:
+*       entryStatus - load status of each entry
+*
+* RETURNS:
+*       MSD_OK  - if all entries are loaded
+*       MSD_FAIL  - if any entry failed, see entryStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       With the TCAM shadow attached, entries equal to the shadow are skipped
+*       and the shadow is updated with the loaded entries.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamLoadEntries
 (
-	IN	const FIR_MSD_TCAM_EGR_DATA_HW	*iData,
-	OUT	FIR_MSD_TCAM_EGR_DATA	*oData
+    IN  MSD_QD_DEV *dev,
+    IN  MSD_U32 numEntries,
+    IN  const FIR_MSD_TCAM_IGR_IMAGE *entries,
+    OUT MSD_STATUS *entryStatus
 )
 {
-	oData->frameModeOverride = MSD_BF_GET(iData->frame[0], 14, 1);
-	oData->frameMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 12, 2));
-	oData->noTtlDec = MSD_BF_GET(iData->frame[0], 11, 1);
-	oData->tagModeOverride = MSD_BF_GET(iData->frame[0], 10, 1);
-	oData->tagMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 8, 2));
-	oData->daMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 4, 2));
-	oData->saMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 0, 3));
-
-	oData->egVidModeOverride = MSD_BF_GET(iData->frame[1], 14, 1);
-	oData->egVidMode = (MSD_U8)(MSD_BF_GET(iData->frame[1], 12, 2));
-	oData->egVidData = MSD_BF_GET(iData->frame[1], 0, 12);
-
-	oData->egDSCPMode = (MSD_U8)MSD_BF_GET(iData->frame[2], 14, 2);
-	oData->egDSCP = (MSD_U8)(MSD_BF_GET(iData->frame[2], 8, 6));
-	oData->egfpriModeOverride = MSD_BF_GET(iData->frame[2], 6, 1);
-	oData->egfpriMode = (MSD_U8)(MSD_BF_GET(iData->frame[2], 4, 2));
-	oData->egEC = (MSD_U8)(MSD_BF_GET(iData->frame[2], 3, 1));
-	oData->egFPRI = (MSD_U8)(MSD_BF_GET(iData->frame[2], 0, 3));
+    MSD_STATUS retVal = MSD_OK;
+    FIR_MSD_TCAM_SHADOW *shadow;
+    FIR_MSD_TCAM_IGR_IMAGE batch[MSD_RMU_MAX_TCAMS];
+    FIR_MSD_TCAM_OP_DATA opData[MSD_RMU_MAX_TCAMS];
+    MSD_U32 index[MSD_RMU_MAX_TCAMS];
+    FIR_MSD_TCAM_DATA tcamData;
+    MSD_U32 nBatch;
+    MSD_U32 i;
+    MSD_U32 k;
+
+    MSD_DBG_INFO(("Fir_gtcamLoadEntries Called.\n"));
+
+    if (((numEntries != 0U) && (entries == NULL)) || ((numEntries != 0U) && (entryStatus == NULL)))
+    {
+        MSD_DBG_ERROR(("Input param entries or entryStatus is NULL.\n"));
+        retVal = MSD_BAD_PARAM;
+    }
+    else if (!(IS_RMU_SUPPORTED(dev)))
+    {
+        for (i = 0; i < numEntries; i++)
+        {
+            tcamData = entries[i].tcamData;
+            entryStatus[i] = Fir_gtcamLoadEntry(dev, entries[i].tcamPointer, &tcamData);
+            if (entryStatus[i] != MSD_OK)
+            {
+                retVal = MSD_FAIL;
+            }
+        }
+    }
+    else
+    {
+        i = 0;
+        while (i < numEntries)
+        {
+            msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+            shadow = (FIR_MSD_TCAM_SHADOW *)dev->tcamShadow;
+
+            /* Collect the next batch, skipping bad and unchanged entries */
+            nBatch = 0;
+            while ((i < numEntries) && (nBatch < MSD_RMU_MAX_TCAMS))
+            {
+                entryStatus[i] = MSD_OK;
+                if (entries[i].tcamPointer >= FIR_MAX_IGR_TCAM_ENTRY)
+                {
+                    MSD_DBG_ERROR(("Bad tcamPointer %u out of range.\n", entries[i].tcamPointer));
+                    entryStatus[i] = MSD_BAD_PARAM;
+                }
+                else
+                {
+                    opData[nBatch].tcamEntry = entries[i].tcamPointer;
+                    entryStatus[i] = Fir_setTcamHWData(&entries[i].tcamData, &opData[nBatch].tcamDataP);
+                }
+
+                if ((entryStatus[i] == MSD_OK) &&
+                    ((shadow == NULL) || (Fir_tcamShadowIgrEqual(shadow, entries[i].tcamPointer, &opData[nBatch].tcamDataP) == MSD_FALSE)))
+                {
+                    batch[nBatch] = entries[i];
+                    index[nBatch] = i;
+                    nBatch++;
+                }
+                i++;
+            }
+
+            if (nBatch != 0U)
+            {
+                if (Fir_msdRmuTCAMWriteMulti(dev, nBatch, batch) != MSD_OK)
+                {
+                    MSD_DBG_INFO(("Multi TCAM request failed, loading with register frames.\n"));
+                    for (k = 0; k < nBatch; k++)
+                    {
+                        entryStatus[index[k]] = Fir_tcamRmuLoadEntry(dev, &opData[k]);
+                    }
+                }
+            }
+
+            for (k = 0; k < nBatch; k++)
+            {
+                if (entryStatus[index[k]] == MSD_OK)
+                {
+                    if (shadow != NULL)
+                    {
+                        Fir_tcamShadowPutIgr(shadow, opData[k].tcamEntry, &opData[k].tcamDataP);
+                    }
+                }
+            }
+            msdSemGive(dev->devNum, dev->tblRegsSem);
+        }
 
-    oData->egFrerSeqEncTypeOverride = MSD_BF_GET(iData->frame[3], 10, 1);
-    oData->egFrerSeqEncType = MSD_BF_GET(iData->frame[3], 8, 1);
-	oData->egSIDOverride = MSD_BF_GET(iData->frame[3], 6, 1);
-	oData->egSID = (MSD_U8)(MSD_BF_GET(iData->frame[3], 0, 6));
+        for (i = 0; i < numEntries; i++)
+        {
+            if (entryStatus[i] != MSD_OK)
+            {
+                retVal = MSD_FAIL;
+            }
+        }
+    }
 
-	return MSD_OK;
+    MSD_DBG_INFO(("Fir_gtcamLoadEntries Exit.\n"));
+    return retVal;
 }
-static MSD_STATUS Fir_tcamSetPage0Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
-{
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
 
-	for(i = 2U; i < 0x1cU; i++)
-	{
-		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->pg0.frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
-	}
-
-	return MSD_OK;
-}
-static MSD_STATUS Fir_tcamSetPage1Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+/****************************************************************************/
+/* Internal functions.                                                  */
+/****************************************************************************/
+static MSD_STATUS Fir_setTcamHWData
+(
+	IN	const FIR_MSD_TCAM_DATA	*iData,
+	OUT	FIR_MSD_TCAM_DATA_HW	*oData
+)
 {
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
+	MSD_16 i;
+	
+	msdMemSet(oData,0,sizeof(FIR_MSD_TCAM_DATA_HW));
 
-	for(i = 2U; i < 0x1cU; i++)
-	{
-		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->pg1.frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
-	}
+	/*key*/
+	MSD_BF_SET(oData->pg0.frame[0],iData->frameTypeMask, 14, 2);
+	MSD_BF_SET(oData->pg0.frame[0],iData->frameType, 6, 2);
+	MSD_BF_SET(oData->pg0.frame[0], iData->timeKeyMask, 13, 1);
+	MSD_BF_SET(oData->pg0.frame[0], iData->timeKey, 5, 1);
+	MSD_BF_SET(oData->pg0.frame[0],((iData->spvMask&0x300)>>8), 8, 2);
+	MSD_BF_SET(oData->pg0.frame[0],((iData->spv&0x300)>>8), 0, 2);
 
-	return MSD_OK;
-}
+	MSD_BF_SET(oData->pg0.frame[1],(iData->spvMask&0xff), 8, 8);
+	MSD_BF_SET(oData->pg0.frame[1],(iData->spv&0xff), 0, 8);
 
-static MSD_STATUS Fir_tcamSetPage2Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
-{
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
+	MSD_BF_SET(oData->pg0.frame[2],iData->ppriMask, 12, 4);
+	MSD_BF_SET(oData->pg0.frame[2],iData->ppri, 4, 4);
+	MSD_BF_SET(oData->pg0.frame[2],((iData->pvidMask&0xf00)>>8), 8, 4);
+	MSD_BF_SET(oData->pg0.frame[2],((iData->pvid&0xf00)>>8), 0, 4);
 
-	for(i=2U; i<14U; i++)
+	MSD_BF_SET(oData->pg0.frame[3],(iData->pvidMask&0xff), 8, 8);
+	MSD_BF_SET(oData->pg0.frame[3],(iData->pvid&0xff), 0, 8);
+
+	/*Page 0 (0~21) bytes*/
+	for(i=4; i<26; i++)
 	{
-		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->pg2.frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
+		MSD_BF_SET(oData->pg0.frame[i],iData->frameOctetMask[i-4],8,8);
+		MSD_BF_SET(oData->pg0.frame[i],iData->frameOctet[i-4],0,8);
 	}
 
-	retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)0x1B, tcamDataPtr->pg2.frame[25]);
-	if (retVal != MSD_OK)
+	/*Page 1 (22~47) bytes*/
+	for(i = 0; i < 26; i++)
 	{
-		return retVal;
+		MSD_BF_SET(oData->pg1.frame[i],iData->frameOctetMask[22+i],8,8);
+		MSD_BF_SET(oData->pg1.frame[i],iData->frameOctet[22+i],0,8);
 	}
 
-	return MSD_OK;
-}
-static MSD_STATUS Fir_tcamSetPage3Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_EGR_DATA_HW *tcamDataPtr)
-{
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
+	/*Action*/
+	MSD_BF_SET(oData->pg2.frame[0],iData->continu, 13, 3);
+	MSD_BF_SET(oData->pg2.frame[0],(MSD_U16)(iData->vidOverride), 12, 1);
+	MSD_BF_SET(oData->pg2.frame[0],iData->vidData, 0, 12);
 
-	for(i=2U; i<6U; i++)
-	{
-		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
-	}
+	/* MSD_BF_SET(oData->pg2.frame[1],iData->nextId, 8, 8); */
+	MSD_BF_SET(oData->pg2.frame[1],(MSD_U16)(iData->qpriOverride), 7, 1);
+	MSD_BF_SET(oData->pg2.frame[1],iData->qpriData, 4, 3);
+	MSD_BF_SET(oData->pg2.frame[1],(MSD_U16)(iData->fpriOverride), 3, 1);
+	MSD_BF_SET(oData->pg2.frame[1],iData->fpriData, 0, 3);
 
-	return MSD_OK;
-}
-static MSD_STATUS Fir_tcamGetPage0Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
-{
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
+	MSD_BF_SET(oData->pg2.frame[2],iData->dpvSF, 11, 1);
+	MSD_BF_SET(oData->pg2.frame[2],(MSD_U16)(iData->dpvData), 0, 10);
 
+	/* MSD_BF_SET(oData->pg2.frame[3], (((iData->dpvData) & 0x0800) >> 11), 0, 1); */
 
-	for(i=2U; i<0x1cU; i++)
-	{
-		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->pg0.frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
-	}
+	MSD_BF_SET(oData->pg2.frame[4],iData->dpvMode, 14, 2);
+	MSD_BF_SET(oData->pg2.frame[4],iData->colorMode, 12, 2);
+	MSD_BF_SET(oData->pg2.frame[4],(MSD_U16)(iData->vtuPageOverride), 11, 1);
+	MSD_BF_SET(oData->pg2.frame[4],iData->vtuPage, 10, 1);
+	MSD_BF_SET(oData->pg2.frame[4],iData->unKnownFilter, 8, 2);
+	MSD_BF_SET(oData->pg2.frame[4],iData->egActPoint, 0, 6);
 
-	return MSD_OK;
-}
-static MSD_STATUS Fir_tcamGetPage1Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
-{
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
+	MSD_BF_SET(oData->pg2.frame[5],(MSD_U16)(iData->ldBalanceOverride), 15, 1);
+	MSD_BF_SET(oData->pg2.frame[5],iData->ldBalanceData, 12, 3);
+	MSD_BF_SET(oData->pg2.frame[5], iData->tcamTunnel, 10, 1);
+	MSD_BF_SET(oData->pg2.frame[5], iData->ipMulticast, 9, 1);
+	MSD_BF_SET(oData->pg2.frame[5], iData->ip2me, 8, 1);
+	MSD_BF_SET(oData->pg2.frame[5], iData->routeEntry, 7, 1);
+	MSD_BF_SET(oData->pg2.frame[5],(MSD_U16)(iData->DSCPOverride), 6, 1);
+	MSD_BF_SET(oData->pg2.frame[5],iData->DSCP, 0, 6);
 
+	MSD_BF_SET(oData->pg2.frame[6],(MSD_U16)(iData->factionOverride), 15, 1);
+	MSD_BF_SET(oData->pg2.frame[6],iData->factionData, 0, 15);
+
+    MSD_BF_SET(oData->pg2.frame[7], iData->nextId, 0, 9);
+
+    MSD_BF_SET(oData->pg2.frame[8], iData->frerSctrInc, 15, 1);
+    MSD_BF_SET(oData->pg2.frame[8], iData->frerSctrIndex, 8, 5);
+    MSD_BF_SET(oData->pg2.frame[8], iData->frerStreamSplitEn, 3, 1);
+    MSD_BF_SET(oData->pg2.frame[8], iData->frerSeqGenEn, 2, 1);
+    MSD_BF_SET(oData->pg2.frame[8], iData->frerSeqEncType, 0, 1);
+    
+    MSD_BF_SET(oData->pg2.frame[9], iData->frerSeqRcvyEn, 15, 1);
+    MSD_BF_SET(oData->pg2.frame[9], iData->frerSeqRcvyIndex, 8, 7);
+    MSD_BF_SET(oData->pg2.frame[9], iData->frerIndvRcvyEn, 7, 1);
+    MSD_BF_SET(oData->pg2.frame[9], iData->frerIndvRcvyId, 0, 7);
+
+    MSD_BF_SET(oData->pg2.frame[10], iData->flowMeterEn, 7, 1);
+    MSD_BF_SET(oData->pg2.frame[10], iData->flowMeterId, 0, 7);
+
+    MSD_BF_SET(oData->pg2.frame[11], iData->tsDomain, 15, 1);
+    MSD_BF_SET(oData->pg2.frame[11], iData->tsFormat, 13, 2);
+    MSD_BF_SET(oData->pg2.frame[11], iData->depTsEn, 12, 1);
+    MSD_BF_SET(oData->pg2.frame[11], iData->arrTsEn, 11, 1);
+    MSD_BF_SET(oData->pg2.frame[11], iData->streamFilterEn, 7, 1);
+    MSD_BF_SET(oData->pg2.frame[11], iData->streamFilterId, 0, 4);
 
-	for(i=2U; i<0x1cU; i++)
-	{
-		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->pg1.frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
-	}
 
+	MSD_BF_SET(oData->pg2.frame[25], iData->interrupt, 15, 1);
+	MSD_BF_SET(oData->pg2.frame[25], iData->IncTcamCtr, 14, 1);
+	MSD_BF_SET(oData->pg2.frame[25], iData->tcamCtr, 12, 2);
+	
 	return MSD_OK;
 }
-static MSD_STATUS Fir_tcamGetPage2Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+
+static MSD_STATUS Fir_getTcamHWData
+(
+	IN	const FIR_MSD_TCAM_DATA_HW	*iData,
+	OUT	FIR_MSD_TCAM_DATA	*oData
+)
 {
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
+	MSD_16 i;
+	/*key*/
+	oData->frameTypeMask = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0],14, 2));
+	oData->frameType = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0],6, 2));
+	oData->timeKeyMask = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0], 13, 1));
+	oData->timeKey = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[0], 5, 1));
 
-	for(i=2U; i<14U; i++)
-	{
-		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->pg2.frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
-	}
+    oData->spvMask = (MSD_BF_GET(iData->pg0.frame[0], 8, 2) << 8) | MSD_BF_GET(iData->pg0.frame[1], 8, 8);
+	oData->spv = (MSD_BF_GET(iData->pg0.frame[0], 0, 2) << 8) | MSD_BF_GET(iData->pg0.frame[1], 0, 8);
 
-	retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)0x1B, &tcamDataPtr->pg2.frame[25]);
-	if (retVal != MSD_OK)
+	oData->ppriMask = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[2],12, 4));
+	oData->ppri = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[2],4, 4));
+
+	oData->pvidMask = (MSD_BF_GET(iData->pg0.frame[2], 8, 4) << 8) | MSD_BF_GET(iData->pg0.frame[3],8, 8);
+
+	oData->pvid = (MSD_BF_GET(iData->pg0.frame[2], 0, 4) << 8) | MSD_BF_GET(iData->pg0.frame[3], 0, 8);
+
+	/*Page 0 (0~21) bytes*/
+	for(i=4; i<26; i++)
 	{
-		return retVal;
+		oData->frameOctetMask[i-4] = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[i],8, 8));
+		oData->frameOctet[i-4] = (MSD_U8)(MSD_BF_GET(iData->pg0.frame[i],0,8));
 	}
 
-	return MSD_OK;
-}
-static MSD_STATUS Fir_tcamGetPage3Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_EGR_DATA_HW *tcamDataPtr)
-{
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16 i;
-
-	for(i=2U; i<6U; i++)
+	/*Page 1 (22~47) bytes*/
+	for(i = 0; i < 26; i++)
 	{
-		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->frame[i - 2U]);
-		if(retVal != MSD_OK)
-		{
-			return retVal;
-		}
+		oData->frameOctetMask[22+i] = (MSD_U8)(MSD_BF_GET(iData->pg1.frame[i],8,8));
+		oData->frameOctet[22+i] = (MSD_U8)(MSD_BF_GET(iData->pg1.frame[i],0,8));
 	}
 
-	return MSD_OK;
-}
-static MSD_STATUS Fir_waitTcamReady(const MSD_QD_DEV *dev)
-{
-    MSD_STATUS       retVal;    /* Functions return value */
+	/*Action*/
+	oData->continu = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[0], 13, 3));
+	oData->vidOverride = MSD_BF_GET(iData->pg2.frame[0], 12, 1);
+	oData->vidData = MSD_BF_GET(iData->pg2.frame[0], 0, 12);
 
-    MSD_U16          data;     /* temporary Data storage */
+	/* oData->nextId = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[1], 8, 8)); */
+	oData->qpriOverride = MSD_BF_GET(iData->pg2.frame[1], 7, 1);
+	oData->qpriData = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[1], 4, 3));
+	oData->fpriOverride = MSD_BF_GET(iData->pg2.frame[1], 3, 1);
+	oData->fpriData = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[1], 0, 3));
 
-	data = 1U;
-	while (data == 1U)
-    {
-		retVal = msdGetAnyRegField(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, (MSD_U8)15, (MSD_U8)1, &data);
-        if(retVal != MSD_OK)
-        {
-            return retVal;
-        }
-    }
-    return MSD_OK;
-}
+	oData->dpvSF = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[2], 11, 1));
+	oData->dpvData = (MSD_BF_GET(iData->pg2.frame[2], 0, 10)) & 0x3ff;
 
-/*******************************************************************************
-* Fir_tcamOperationPerform
-*
-* DESCRIPTION:
-*       This function accesses TCAM Table
-*
-* INPUTS:
-*       tcamOp   - The tcam operation
-*       tcamData - address and data to be written into TCAM
-*
-* OUTPUTS:
-*       tcamData - data read from TCAM pointed by address
-*
-* RETURNS:
-*       MSD_OK on success,
-*       MSD_FAIL otherwise.
-*
-* COMMENTS:
-*
-*******************************************************************************/
-static MSD_STATUS Fir_tcamOperationPerform
+	oData->dpvMode = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 14, 2));
+	oData->colorMode = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 12, 2));
+	oData->vtuPageOverride = MSD_BF_GET(iData->pg2.frame[4], 11, 1);
+	oData->vtuPage = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 10, 1));
+	oData->unKnownFilter = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 8, 2));
+	oData->egActPoint = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[4], 0, 6));
+
+	oData->ldBalanceOverride = MSD_BF_GET(iData->pg2.frame[5], 15, 1);
+	oData->ldBalanceData = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[5], 12, 3));
+	oData->tcamTunnel = MSD_BF_GET(iData->pg2.frame[5], 10, 1);
+	oData->ipMulticast = MSD_BF_GET(iData->pg2.frame[5], 9, 1);
+	oData->ip2me = MSD_BF_GET(iData->pg2.frame[5], 8, 1);
+	oData->routeEntry = MSD_BF_GET(iData->pg2.frame[5], 7, 1);
+	oData->DSCPOverride = MSD_BF_GET(iData->pg2.frame[5], 6, 1);
+	oData->DSCP = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[5], 0, 6));
+
+	oData->factionOverride = MSD_BF_GET(iData->pg2.frame[6], 15, 1);
+	oData->factionData = MSD_BF_GET(iData->pg2.frame[6], 0, 15);
+
+    oData->nextId = MSD_BF_GET(iData->pg2.frame[7], 0, 9);
+    oData->frerSctrInc = MSD_BF_GET(iData->pg2.frame[8], 15, 1);
+    oData->frerSctrIndex = MSD_BF_GET(iData->pg2.frame[8], 8, 5);
+    oData->frerStreamSplitEn = MSD_BF_GET(iData->pg2.frame[8], 3, 1);
+    oData->frerSeqGenEn = MSD_BF_GET(iData->pg2.frame[8], 2, 1);
+    oData->frerSeqEncType = MSD_BF_GET(iData->pg2.frame[8], 0, 1);
+
+    oData->frerSeqRcvyEn = MSD_BF_GET(iData->pg2.frame[9], 15, 1);
+    oData->frerSeqRcvyIndex = MSD_BF_GET(iData->pg2.frame[9], 8, 7);
+    oData->frerIndvRcvyEn = MSD_BF_GET(iData->pg2.frame[9], 7, 1);
+    oData->frerIndvRcvyId = MSD_BF_GET(iData->pg2.frame[9], 0, 7);
+
+    oData->flowMeterEn = MSD_BF_GET(iData->pg2.frame[10], 7, 1);
+    oData->flowMeterId = MSD_BF_GET(iData->pg2.frame[10], 0, 7);
+
+    oData->tsDomain = MSD_BF_GET(iData->pg2.frame[11], 15, 1);
+    oData->tsFormat = MSD_BF_GET(iData->pg2.frame[11], 13, 2);
+    oData->depTsEn = MSD_BF_GET(iData->pg2.frame[11], 12, 1);
+    oData->arrTsEn = MSD_BF_GET(iData->pg2.frame[11], 11, 1);
+    oData->streamFilterEn = MSD_BF_GET(iData->pg2.frame[11], 7, 1);
+    oData->streamFilterId = MSD_BF_GET(iData->pg2.frame[11], 0, 4);
+    
+	oData->interrupt = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[25], 15, 1));
+	oData->IncTcamCtr = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[25], 14, 1));
+	oData->tcamCtr = (MSD_U8)(MSD_BF_GET(iData->pg2.frame[25], 12, 2));
+
+	return MSD_OK;
+}
+
+static MSD_STATUS Fir_setTcamEgrHWData
 (
-    IN    MSD_QD_DEV           *dev,
-    IN    FIR_MSD_TCAM_OPERATION   tcamOp,
-    INOUT FIR_MSD_TCAM_OP_DATA     *opData
+	IN	const FIR_MSD_TCAM_EGR_DATA	*iData,
+	OUT	FIR_MSD_TCAM_EGR_DATA_HW	*oData
 )
 {
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16          data;     /* temporary Data storage */
+	msdMemSet(oData,0,sizeof(FIR_MSD_TCAM_EGR_DATA_HW));
 
-	msdSemTake(dev->devNum,  dev->tblRegsSem, OS_WAIT_FOREVER);
+	MSD_BF_SET(oData->frame[0],(MSD_U16)(iData->frameModeOverride), 14, 1);
+	MSD_BF_SET(oData->frame[0],iData->frameMode, 12, 2);
+	MSD_BF_SET(oData->frame[0], iData->noTtlDec, 11, 1);
+	MSD_BF_SET(oData->frame[0],(MSD_U16)(iData->tagModeOverride), 10, 1);
+	MSD_BF_SET(oData->frame[0],iData->tagMode, 8, 2);
+	MSD_BF_SET(oData->frame[0],iData->daMode, 4, 2);
+	MSD_BF_SET(oData->frame[0],iData->saMode, 0, 3);
 
-	/* Wait until the tcam in ready. */
-	retVal = Fir_waitTcamReady(dev);
-	if(retVal != MSD_OK)
+	MSD_BF_SET(oData->frame[1],(MSD_U16)(iData->egVidModeOverride), 14, 1);
+	MSD_BF_SET(oData->frame[1],iData->egVidMode, 12, 2);
+	MSD_BF_SET(oData->frame[1],iData->egVidData, 0, 12);
+
+	MSD_BF_SET(oData->frame[2],iData->egDSCPMode, 14, 2);
+	MSD_BF_SET(oData->frame[2],iData->egDSCP, 8, 6);
+	MSD_BF_SET(oData->frame[2],(MSD_U16)(iData->egfpriModeOverride), 6, 1);
+	MSD_BF_SET(oData->frame[2],iData->egfpriMode, 4, 2);
+	MSD_BF_SET(oData->frame[2],iData->egEC, 3, 1);
+	MSD_BF_SET(oData->frame[2],iData->egFPRI, 0, 3);
+
+    MSD_BF_SET(oData->frame[3], iData->egFrerSeqEncTypeOverride, 10, 1);
+    MSD_BF_SET(oData->frame[3], iData->egFrerSeqEncType, 8, 1);
+	MSD_BF_SET(oData->frame[3], iData->egSIDOverride, 6, 1);
+	MSD_BF_SET(oData->frame[3], iData->egSID, 0, 6);
+	
+	return MSD_OK;
+}
+
+static MSD_STATUS Fir_getTcamEgrHWData
+(
+	IN	const FIR_MSD_TCAM_EGR_DATA_HW	*iData,
+	OUT	FIR_MSD_TCAM_EGR_DATA	*oData
+)
+{
+	oData->frameModeOverride = MSD_BF_GET(iData->frame[0], 14, 1);
+	oData->frameMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 12, 2));
+	oData->noTtlDec = MSD_BF_GET(iData->frame[0], 11, 1);
+	oData->tagModeOverride = MSD_BF_GET(iData->frame[0], 10, 1);
+	oData->tagMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 8, 2));
+	oData->daMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 4, 2));
+	oData->saMode = (MSD_U8)(MSD_BF_GET(iData->frame[0], 0, 3));
+
+	oData->egVidModeOverride = MSD_BF_GET(iData->frame[1], 14, 1);
+	oData->egVidMode = (MSD_U8)(MSD_BF_GET(iData->frame[1], 12, 2));
+	oData->egVidData = MSD_BF_GET(iData->frame[1], 0, 12);
+
+	oData->egDSCPMode = (MSD_U8)MSD_BF_GET(iData->frame[2], 14, 2);
+	oData->egDSCP = (MSD_U8)(MSD_BF_GET(iData->frame[2], 8, 6));
+	oData->egfpriModeOverride = MSD_BF_GET(iData->frame[2], 6, 1);
+	oData->egfpriMode = (MSD_U8)(MSD_BF_GET(iData->frame[2], 4, 2));
+	oData->egEC = (MSD_U8)(MSD_BF_GET(iData->frame[2], 3, 1));
+	oData->egFPRI = (MSD_U8)(MSD_BF_GET(iData->frame[2], 0, 3));
+
+    oData->egFrerSeqEncTypeOverride = MSD_BF_GET(iData->frame[3], 10, 1);
+    oData->egFrerSeqEncType = MSD_BF_GET(iData->frame[3], 8, 1);
+	oData->egSIDOverride = MSD_BF_GET(iData->frame[3], 6, 1);
+	oData->egSID = (MSD_U8)(MSD_BF_GET(iData->frame[3], 0, 6));
+
+	return MSD_OK;
+}
+static MSD_STATUS Fir_tcamSetPage0Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
+
+	for(i = 2U; i < 0x1cU; i++)
 	{
-		msdSemGive(dev->devNum,  dev->tblRegsSem);
-		return retVal;
+		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->pg0.frame[i - 2U]);
+		if(retVal != MSD_OK)
+		{
+			return retVal;
+		}
 	}
 
-	/* Set the TCAM Operation register */
-	switch (tcamOp)
+	return MSD_OK;
+}
+static MSD_STATUS Fir_tcamSetPage1Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
+
+	for(i = 2U; i < 0x1cU; i++)
 	{
-		case Fir_TCAM_FLUSH_ALL:
+		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->pg1.frame[i - 2U]);
+		if(retVal != MSD_OK)
 		{
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
-
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12));
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+			return retVal;
 		}
-		break;
+	}
 
-		case Fir_TCAM_FLUSH_ENTRY:
-		{
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+	return MSD_OK;
+}
 
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
-		}
-		break;
+static MSD_STATUS Fir_tcamSetPage2Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
 
-		case Fir_TCAM_LOAD_ENTRY:
-		/*    case Fir_TCAM_PURGE_ENTRY: */
+	for(i=2U; i<14U; i++)
+	{
+		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->pg2.frame[i - 2U]);
+		if(retVal != MSD_OK)
 		{
-			/* load Page 2 */
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
-			/*Access Ingress Actions from TCAM Frame matches */
-			retVal = Fir_setTcamExtensionReg(dev, 0, 0);
-			if (retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-
-			retVal = Fir_tcamSetPage2Data(dev, &opData->tcamDataP);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+			return retVal;
+		}
+	}
 
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)2 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
-			/* load Page 1 */
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+	retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)0x1B, tcamDataPtr->pg2.frame[25]);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
 
-			retVal = Fir_tcamSetPage1Data(dev, &opData->tcamDataP);
+	return MSD_OK;
+}
+static MSD_STATUS Fir_tcamSetPage3Data(const MSD_QD_DEV *dev, const FIR_MSD_TCAM_EGR_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
+
+	for(i=2U; i<6U; i++)
+	{
+		retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, tcamDataPtr->frame[i - 2U]);
+		if(retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	return MSD_OK;
+}
+static MSD_STATUS Fir_tcamGetPage0Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
+
+
+	for(i=2U; i<0x1cU; i++)
+	{
+		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->pg0.frame[i - 2U]);
+		if(retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	return MSD_OK;
+}
+static MSD_STATUS Fir_tcamGetPage1Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
+
+
+	for(i=2U; i<0x1cU; i++)
+	{
+		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->pg1.frame[i - 2U]);
+		if(retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	return MSD_OK;
+}
+static MSD_STATUS Fir_tcamGetPage2Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
+
+	for(i=2U; i<14U; i++)
+	{
+		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->pg2.frame[i - 2U]);
+		if(retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)0x1B, &tcamDataPtr->pg2.frame[25]);
+	if (retVal != MSD_OK)
+	{
+		return retVal;
+	}
+
+	return MSD_OK;
+}
+static MSD_STATUS Fir_tcamGetPage3Data(const MSD_QD_DEV *dev, FIR_MSD_TCAM_EGR_DATA_HW *tcamDataPtr)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16 i;
+
+	for(i=2U; i<6U; i++)
+	{
+		retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)i, &tcamDataPtr->frame[i - 2U]);
+		if(retVal != MSD_OK)
+		{
+			return retVal;
+		}
+	}
+
+	return MSD_OK;
+}
+static MSD_STATUS Fir_waitTcamReady(const MSD_QD_DEV *dev)
+{
+    MSD_STATUS       retVal;    /* Functions return value */
+
+    MSD_U16          data;     /* temporary Data storage */
+
+	data = 1U;
+	while (data == 1U)
+    {
+		retVal = msdGetAnyRegField(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, (MSD_U8)15, (MSD_U8)1, &data);
+        if(retVal != MSD_OK)
+        {
+            return retVal;
+        }
+    }
+    return MSD_OK;
+}
+
+/*******************************************************************************
+* Fir_tcamHwOperationPerform
+*
+* DESCRIPTION:
+*       This function accesses TCAM Table
+*
+* INPUTS:
+*       tcamOp   - The tcam operation
+*       tcamData - address and data to be written into TCAM
+*
+* OUTPUTS:
+*       tcamData - data read from TCAM pointed by address
+*
+* RETURNS:
+*       MSD_OK on success,
+*       MSD_FAIL otherwise.
+*
+* COMMENTS:
+*
+*******************************************************************************/
+static MSD_STATUS Fir_tcamHwOperationPerform
+(
+    IN    MSD_QD_DEV           *dev,
+    IN    FIR_MSD_TCAM_OPERATION   tcamOp,
+    INOUT FIR_MSD_TCAM_OP_DATA     *opData
+)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16          data;     /* temporary Data storage */
+
+	msdSemTake(dev->devNum,  dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	/* Over RMU use register frames instead of single accesses */
+	if ((IS_RMU_SUPPORTED(dev)) && ((tcamOp == Fir_TCAM_GET_NEXT_ENTRY) || (tcamOp == Fir_TCAM_READ_ENTRY) || (tcamOp == Fir_TCAM_LOAD_ENTRY)))
+	{
+		if (tcamOp == Fir_TCAM_LOAD_ENTRY)
+		{
+			retVal = Fir_tcamRmuLoadEntry(dev, opData);
+		}
+		else
+		{
+			retVal = Fir_tcamRmuReadPerform(dev, tcamOp, opData);
+		}
+		msdSemGive(dev->devNum, dev->tblRegsSem);
+		return retVal;
+	}
+
+	/* Wait until the tcam in ready. */
+	retVal = Fir_waitTcamReady(dev);
+	if(retVal != MSD_OK)
+	{
+		msdSemGive(dev->devNum,  dev->tblRegsSem);
+		return retVal;
+	}
+
+	/* Set the TCAM Operation register */
+	switch (tcamOp)
+	{
+		case Fir_TCAM_FLUSH_ALL:
+		{
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12));
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+		}
+		break;
+
+		case Fir_TCAM_FLUSH_ENTRY:
+		{
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+		}
+		break;
+
+		case Fir_TCAM_LOAD_ENTRY:
+		/*    case Fir_TCAM_PURGE_ENTRY: */
+		{
+			/* load Page 2 */
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+			/*Access Ingress Actions from TCAM Frame matches */
+			retVal = Fir_setTcamExtensionReg(dev, 0, 0);
+			if (retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = Fir_tcamSetPage2Data(dev, &opData->tcamDataP);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)2 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+			/* load Page 1 */
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = Fir_tcamSetPage1Data(dev, &opData->tcamDataP);
 			if(retVal != MSD_OK)
 			{
 				msdSemGive(dev->devNum,  dev->tblRegsSem);
@@ -2041,793 +3014,1992 @@ static MSD_STATUS Fir_tcamOperationPerform
 		}
 		break;
 
-		case Fir_TCAM_GET_NEXT_ENTRY:
-		{
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+		case Fir_TCAM_GET_NEXT_ENTRY:
+		{
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, &data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			if ((data & (MSD_U16)0x1ff) == (MSD_U16)0x1ff)
+			{
+				MSD_U16 data1;
+				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_P0_KEYS_1, &data1);
+				if(retVal != MSD_OK)
+				{
+					msdSemGive(dev->devNum,  dev->tblRegsSem);
+					return retVal;
+				}
+				if (data1 == (MSD_U16)0x00ff)
+				{
+					/* No higher valid TCAM entry */
+					msdSemGive(dev->devNum,  dev->tblRegsSem);
+					return MSD_NO_SUCH;
+				}
+				else
+				{
+					/* The highest valid TCAM entry found*/
+				}
+			}
+
+			/* Get next entry and read the entry */
+			opData->tcamEntry = (MSD_U32)data & (MSD_U32)0x1ff;
+
+		}
+		case Fir_TCAM_READ_ENTRY:
+		{
+			tcamOp = Fir_TCAM_READ_ENTRY;
+
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum,  dev->tblRegsSem);
+				return retVal;
+			}
+
+			/* Read page 0 */
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)0 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = Fir_tcamGetPage0Data(dev, &opData->tcamDataP);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/* Read page 1 */
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)1 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = Fir_tcamGetPage1Data(dev, &opData->tcamDataP);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/*Access Ingress Actions from TCAM Frame matches*/
+			retVal = Fir_setTcamExtensionReg(dev, 0, 0);
+			if (retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/* Read page 2 */
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)2 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = Fir_tcamGetPage2Data(dev, &opData->tcamDataP);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+		}
+		break;
+
+		default:
+			retVal = MSD_FAIL;
+			break;
+	}
+
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+	return retVal;
+}
+
+
+static MSD_STATUS Fir_tcamEgrHwOperationPerform
+(
+    IN    MSD_QD_DEV           *dev,
+    IN    FIR_MSD_TCAM_OPERATION   tcamOp,
+    INOUT FIR_MSD_TCAM_EGR_OP_DATA     *opData
+)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16          data;     /* temporary Data storage */
+
+	msdSemTake(dev->devNum,  dev->tblRegsSem, OS_WAIT_FOREVER);
+
+	/* Over RMU read back with register frames instead of single accesses */
+	if ((IS_RMU_SUPPORTED(dev)) && ((tcamOp == Fir_TCAM_GET_NEXT_ENTRY) || (tcamOp == Fir_TCAM_READ_ENTRY)))
+	{
+		retVal = Fir_tcamEgrRmuReadPerform(dev, tcamOp, opData);
+		msdSemGive(dev->devNum, dev->tblRegsSem);
+		return retVal;
+	}
+
+	/* Wait until the tcam in ready. */
+	retVal = Fir_waitTcamReady(dev);
+	if(retVal != MSD_OK)
+	{
+		msdSemGive(dev->devNum, dev->tblRegsSem);
+		return retVal;
+	}
+
+	/* Set the TCAM Operation register */
+	switch (tcamOp)
+	{
+		case Fir_TCAM_FLUSH_ENTRY:
+		{
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/*Access Egress Actions from Egress Action Pointer */
+			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
+			if (retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_PORT, 0);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+		}
+		break;
+
+		case Fir_TCAM_LOAD_ENTRY:
+		{
+			/* load Page 2 */
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/*Access Egress Actions from Egress Action Pointer */
+			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
+			if (retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = Fir_tcamSetPage3Data(dev, &opData->tcamDataP);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+		}
+		break;
+
+		case Fir_TCAM_GET_NEXT_ENTRY:
+		{
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/*Access Egress Actions from Egress Action Pointer */
+			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
+			if (retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if (retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, &data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			if ((data & (MSD_U16)0x3f) == (MSD_U16)0x3f)
+			{
+				MSD_U16 data1,data2,data3;
+				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_ACTION_1, &data1);
+				if(retVal != MSD_OK)
+				{
+					msdSemGive(dev->devNum, dev->tblRegsSem);
+					return retVal;
+				}
+
+				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_ACTION_2, &data2);
+				if(retVal != MSD_OK)
+				{
+					msdSemGive(dev->devNum, dev->tblRegsSem);
+					return retVal;
+				}
+
+				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_ACTION_3, &data3);
+				if(retVal != MSD_OK)
+				{
+					msdSemGive(dev->devNum, dev->tblRegsSem);
+					return retVal;
+				}
+
+				if((data1 == 0U) && (data2 == 0U) && (data3 == 0U))
+				{
+					/* No higher valid TCAM entry */
+					msdSemGive(dev->devNum, dev->tblRegsSem);
+					return MSD_NO_SUCH;
+				}
+				else
+				{
+					/* The highest valid TCAM entry found*/
+				}
+			}
+
+			/* Get next entry and read the entry */
+			opData->tcamEntry = (MSD_U32)(data & (MSD_U32)0xff);
+
+		}
+
+		case Fir_TCAM_READ_ENTRY:
+		{
+			tcamOp = Fir_TCAM_READ_ENTRY;
+
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/*Access Egress Actions from Egress Action Pointer */
+			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
+			if (retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/* Read page 3 */
+			data = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			retVal = Fir_tcamGetPage3Data(dev, &opData->tcamDataP);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+
+			/* Wait until the tcam in ready. */
+			retVal = Fir_waitTcamReady(dev);
+			if(retVal != MSD_OK)
+			{
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				return retVal;
+			}
+		}
+		break;
+
+		default:
+			retVal = MSD_FAIL;
+			break;
+	}
+
+	msdSemGive(dev->devNum, dev->tblRegsSem);
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_tcamOperationPerform
+*
+* DESCRIPTION:
+*       This function accesses TCAM Table, through the host shadow when one is
+*       attached to the device
+*
+* INPUTS:
+*       tcamOp   - The tcam operation
+*       tcamData - address and data to be written into TCAM
+*
+* OUTPUTS:
+*       tcamData - data read from TCAM pointed by address
+*
+* RETURNS:
+*       MSD_OK on success,
+*       MSD_FAIL otherwise.
+*
+* COMMENTS:
+*       Flush operations go to the hardware and then update the shadow, load
+*       only writes the pages that changed, reads are served from the shadow.
+*
+*******************************************************************************/
+static MSD_STATUS Fir_tcamOperationPerform
+(
+    IN    MSD_QD_DEV           *dev,
+    IN    FIR_MSD_TCAM_OPERATION   tcamOp,
+    INOUT FIR_MSD_TCAM_OP_DATA     *opData
+)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	FIR_MSD_TCAM_SHADOW *shadow;
+	MSD_U32          entry;
+
+	shadow = (FIR_MSD_TCAM_SHADOW *)dev->tcamShadow;
+	if ((shadow == NULL) || ((tcamOp != Fir_TCAM_FLUSH_ALL) && (opData->tcamEntry >= FIR_MAX_IGR_TCAM_ENTRY)))
+	{
+		return Fir_tcamHwOperationPerform(dev, tcamOp, opData);
+	}
+
+	switch (tcamOp)
+	{
+		case Fir_TCAM_FLUSH_ALL:
+		case Fir_TCAM_FLUSH_ENTRY:
+		{
+			retVal = Fir_tcamHwOperationPerform(dev, tcamOp, opData);
+			if (retVal == MSD_OK)
+			{
+				msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+				if (tcamOp == Fir_TCAM_FLUSH_ALL)
+				{
+					for (entry = 0; entry < FIR_MAX_IGR_TCAM_ENTRY; entry++)
+					{
+						Fir_tcamShadowFlushIgr(shadow, entry);
+					}
+				}
+				else
+				{
+					Fir_tcamShadowFlushIgr(shadow, opData->tcamEntry);
+				}
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+			}
+		}
+		break;
+
+		case Fir_TCAM_LOAD_ENTRY:
+		{
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			retVal = Fir_tcamShadowLoad(dev, shadow, opData);
+			msdSemGive(dev->devNum, dev->tblRegsSem);
+		}
+		break;
+
+		case Fir_TCAM_GET_NEXT_ENTRY:
+		{
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			/* 0x1ff starts the search from the first entry */
+			entry = (opData->tcamEntry == 0x1ffU) ? 0U : (opData->tcamEntry + 1U);
+			while ((entry < FIR_MAX_IGR_TCAM_ENTRY) && (Fir_tcamShadowIgrValid(shadow, entry) == MSD_FALSE))
+			{
+				entry++;
+			}
+			if (entry == FIR_MAX_IGR_TCAM_ENTRY)
+			{
+				retVal = MSD_NO_SUCH;
+			}
+			else
+			{
+				opData->tcamEntry = entry;
+				Fir_tcamShadowGetIgr(shadow, entry, &opData->tcamDataP);
+				retVal = MSD_OK;
+			}
+			msdSemGive(dev->devNum, dev->tblRegsSem);
+		}
+		break;
+
+		case Fir_TCAM_READ_ENTRY:
+		{
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			Fir_tcamShadowGetIgr(shadow, opData->tcamEntry, &opData->tcamDataP);
+			msdSemGive(dev->devNum, dev->tblRegsSem);
+			retVal = MSD_OK;
+		}
+		break;
+
+		default:
+			retVal = MSD_FAIL;
+			break;
+	}
+
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_tcamEgrOperationPerform
+*
+* DESCRIPTION:
+*       This function accesses Egress TCAM Table, through the host shadow when
+*       one is attached to the device
+*
+* INPUTS:
+*       tcamOp   - The tcam operation
+*       tcamData - port, address and data to be written into TCAM
+*
+* OUTPUTS:
+*       tcamData - data read from TCAM pointed by address
+*
+* RETURNS:
+*       MSD_OK on success,
+*       MSD_FAIL otherwise.
+*
+* COMMENTS:
+*       A load of unchanged data is skipped. Port 0x1F flushes the entry on
+*       all ports.
+*
+*******************************************************************************/
+static MSD_STATUS Fir_tcamEgrOperationPerform
+(
+    IN    MSD_QD_DEV           *dev,
+    IN    FIR_MSD_TCAM_OPERATION   tcamOp,
+    INOUT FIR_MSD_TCAM_EGR_OP_DATA     *opData
+)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	FIR_MSD_TCAM_SHADOW *shadow;
+	MSD_U32          entry;
+	MSD_U8           hwPort;
+	MSD_BOOL         changed;
+
+	shadow = (FIR_MSD_TCAM_SHADOW *)dev->tcamShadow;
+	hwPort = opData->port;
+	if ((shadow == NULL) || (opData->tcamEntry >= FIR_MAX_EGR_TCAM_ENTRY) ||
+		((hwPort >= MSD_MAX_SWITCH_PORTS) && ((tcamOp != Fir_TCAM_FLUSH_ENTRY) || (hwPort != 0x1FU))))
+	{
+		return Fir_tcamEgrHwOperationPerform(dev, tcamOp, opData);
+	}
+
+	switch (tcamOp)
+	{
+		case Fir_TCAM_FLUSH_ENTRY:
+		{
+			retVal = Fir_tcamEgrHwOperationPerform(dev, tcamOp, opData);
+			if (retVal == MSD_OK)
+			{
+				msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+				if (hwPort == 0x1FU)
+				{
+					for (hwPort = 0; hwPort < MSD_MAX_SWITCH_PORTS; hwPort++)
+					{
+						msdMemSet((void*)shadow->egrPage[hwPort][opData->tcamEntry], 0, sizeof(shadow->egrPage[hwPort][opData->tcamEntry]));
+					}
+				}
+				else
+				{
+					msdMemSet((void*)shadow->egrPage[hwPort][opData->tcamEntry], 0, sizeof(shadow->egrPage[hwPort][opData->tcamEntry]));
+				}
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+			}
+		}
+		break;
+
+		case Fir_TCAM_LOAD_ENTRY:
+		{
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			changed = MSD_FALSE;
+			for (entry = 0; entry < 4U; entry++)
+			{
+				if (shadow->egrPage[hwPort][opData->tcamEntry][entry] != opData->tcamDataP.frame[entry])
+				{
+					changed = MSD_TRUE;
+				}
+			}
+			msdSemGive(dev->devNum, dev->tblRegsSem);
+
+			retVal = MSD_OK;
+			if (changed == MSD_TRUE)
+			{
+				retVal = Fir_tcamEgrHwOperationPerform(dev, tcamOp, opData);
+				if (retVal == MSD_OK)
+				{
+					msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+					msdMemCpy((void*)shadow->egrPage[hwPort][opData->tcamEntry], (const void*)opData->tcamDataP.frame, sizeof(opData->tcamDataP.frame));
+					msdSemGive(dev->devNum, dev->tblRegsSem);
+				}
+			}
+		}
+		break;
+
+		case Fir_TCAM_GET_NEXT_ENTRY:
+		{
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			/* 0x3f starts the search from the first entry */
+			entry = (opData->tcamEntry == FIR_TCAM_SHADOW_EGR_START) ? 0U : (opData->tcamEntry + 1U);
+			while ((entry < FIR_MAX_EGR_TCAM_ENTRY) && (Fir_tcamShadowEgrValid(shadow, hwPort, entry) == MSD_FALSE))
+			{
+				entry++;
+			}
+			if (entry == FIR_MAX_EGR_TCAM_ENTRY)
+			{
+				retVal = MSD_NO_SUCH;
+			}
+			else
+			{
+				opData->tcamEntry = entry;
+				msdMemCpy((void*)opData->tcamDataP.frame, (const void*)shadow->egrPage[hwPort][entry], sizeof(opData->tcamDataP.frame));
+				retVal = MSD_OK;
+			}
+			msdSemGive(dev->devNum, dev->tblRegsSem);
+		}
+		break;
+
+		case Fir_TCAM_READ_ENTRY:
+		{
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			msdMemCpy((void*)opData->tcamDataP.frame, (const void*)shadow->egrPage[hwPort][opData->tcamEntry], sizeof(opData->tcamDataP.frame));
+			msdSemGive(dev->devNum, dev->tblRegsSem);
+			retVal = MSD_OK;
+		}
+		break;
+
+		default:
+			retVal = MSD_FAIL;
+			break;
+	}
+
+	return retVal;
+}
+
+static void displayTcamData(FIR_MSD_TCAM_DATA *tcamData)
+{
+	MSD_16 i;
+
+	MSG(("----- Key & Mask -----\n"));
+
+	MSG(("frameType         : %04x\n", tcamData->frameType));
+	MSG(("frameTypeMask     : %04x\n", tcamData->frameTypeMask));
+	MSG(("timeKey           : %04x\n", tcamData->timeKey));
+	MSG(("timeKeyMask       : %04x\n", tcamData->timeKeyMask));
+	MSG(("spv               : %04x\n", tcamData->spv));
+	MSG(("spvMask           : %04x\n", tcamData->spvMask));
+	MSG(("ppri              : %04x\n", tcamData->ppri));
+	MSG(("ppriMask          : %04x\n", tcamData->ppriMask));
+	MSG(("pvid              : %04x\n", tcamData->pvid));
+	MSG(("pvidMask          : %04x\n", tcamData->pvidMask));
+
+	MSG(("----- Ethernet Frame Content -----\n"));
+
+	for (i = 0; i<48; i++)
+	{
+		MSG(("frame data Octet %2d         : %4x\n", i + 1, tcamData->frameOctet[i]));
+		MSG(("frame data OctetMask %2d     : %4x\n", i + 1, tcamData->frameOctetMask[i]));
+	}
+
+	MSG(("----- Ingress Action -----\n"));
+
+	MSG(("continu           : %04x\n", tcamData->continu));
+	MSG(("interrupt         : %04x\n", tcamData->interrupt));
+	MSG(("IncTcamCtr        : %04x\n", tcamData->IncTcamCtr));
+	MSG(("vidOverride       : %04x\n", tcamData->vidOverride));
+	MSG(("vidData           : %04x\n", tcamData->vidData));
+
+
+	MSG(("qpriOverride      : %04x\n", tcamData->qpriOverride));
+	MSG(("qpriData          : %04x\n", tcamData->qpriData));
+	MSG(("fpriOverride      : %04x\n", tcamData->fpriOverride));
+	MSG(("fpriData          : %04x\n", tcamData->fpriData));
+
+	MSG(("dpvSF             : %04x\n", tcamData->dpvSF));
+	MSG(("dpvData           : %04x\n", (MSD_U32)tcamData->dpvData));
+	MSG(("dpvMode           : %04x\n", tcamData->dpvMode));
+
+	MSG(("unKnownFilter     : %04x\n", tcamData->unKnownFilter));
+
+	MSG(("ldBalanceOverride : %04x\n", tcamData->ldBalanceOverride));
+	MSG(("ldBalanceData     : %04x\n", tcamData->ldBalanceData));
+
+	MSG(("factionOverride   : %04x\n", tcamData->factionOverride));
+	MSG(("factionData       : %04x\n", tcamData->factionData));
+	MSG(("colorMode         : %04x\n", tcamData->colorMode));
+	MSG(("vtuPageOverride   : %04x\n", tcamData->vtuPageOverride));
+	MSG(("vtuPage           : %04x\n", tcamData->vtuPage));
+	MSG(("egActPoint        : %04x\n", tcamData->egActPoint));
+	MSG(("DSCPOverride      : %04x\n", tcamData->DSCPOverride));
+	MSG(("DSCP              : %04x\n", tcamData->DSCP));
+	MSG(("ipMulticast       : %04x\n", tcamData->ipMulticast));
+	MSG(("ip2me             : %04x\n", tcamData->ip2me));
+	MSG(("routeEntry        : %04x\n", tcamData->routeEntry));
+	MSG(("tcamCtr           : %04x\n", tcamData->tcamCtr));
+    MSG(("nextId            : %04x\n", tcamData->nextId));
+
+    MSG(("frerSctrInc       : %04x\n", tcamData->frerSctrInc));
+    MSG(("frerSctrIndex     : %04x\n", tcamData->frerSctrIndex));
+    MSG(("frerStreamSplitEn : %04x\n", tcamData->frerStreamSplitEn));
+    MSG(("frerSeqGenEn      : %04x\n", tcamData->frerSeqGenEn));
+    MSG(("frerSeqEncType    : %04x\n", tcamData->frerSeqEncType));
+    MSG(("frerSeqRcvyEn     : %04x\n", tcamData->frerSeqRcvyEn));
+    MSG(("frerSeqRcvyIndex  : %04x\n", tcamData->frerSeqRcvyIndex));
+    MSG(("frerIndvRcvyEn    : %04x\n", tcamData->frerIndvRcvyEn));
+    MSG(("frerIndvRcvyId    : %04x\n", tcamData->frerIndvRcvyId));
+    MSG(("flowMeterEn       : %04x\n", tcamData->flowMeterEn));
+    MSG(("flowMeterId       : %04x\n", tcamData->flowMeterId));
+    MSG(("tsDomain          : %04x\n", tcamData->tsDomain));
+    MSG(("tsFormat          : %04x\n", tcamData->tsFormat));
+    MSG(("depTsEn           : %04x\n", tcamData->depTsEn));
+    MSG(("arrTsEn           : %04x\n", tcamData->arrTsEn));
+    MSG(("streamFilterEn    : %04x\n", tcamData->streamFilterEn));
+    MSG(("streamFilterId    : %04x\n", tcamData->streamFilterId));
+}
+
+static MSD_BOOL checkEntry2Used(const FIR_MSD_TCAM_DATA *tcamData2)
+{
+    MSD_BOOL retVal = MSD_FALSE;
+    MSD_16 i;
+
+    for (i = 0; i < 48; i++)
+    {
+		if (tcamData2->frameOctetMask[i] != (MSD_U8)0)
+        {
+			retVal = MSD_TRUE;
+            break;
+        }
+    }
+	return retVal;
+}
+static void mappingTcpOverIpv4ToTcam(FIR_MSD_TCAM_DATA *tcamData, FIR_MSD_TCAM_DATA *tcamData2, const MSD_TCAM_ENT_TCP_UNT *pTcpData, const MSD_TCAM_ENT_TCP_UNT *pTcpMask)
+{
+	tcamData->frameOctet[38] = (MSD_U8)((MSD_U16)(pTcpData->srcPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[39] = (MSD_U8)(pTcpData->srcPort & (MSD_U16)0xff);
+	tcamData->frameOctet[40] = (MSD_U8)((MSD_U16)(pTcpData->destPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[41] = (MSD_U8)(pTcpData->destPort & (MSD_U16)0xff);
+	tcamData->frameOctet[42] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 24) & (MSD_U32)0xff);
+	tcamData->frameOctet[43] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 16) & (MSD_U32)0xff);
+	tcamData->frameOctet[44] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 8) & (MSD_U32)0xff);
+	tcamData->frameOctet[45] = (MSD_U8)(pTcpData->seqNum & (MSD_U32)0xff);
+	tcamData->frameOctet[46] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 24) & (MSD_U32)0xff);
+	tcamData->frameOctet[47] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 16) & (MSD_U32)0xff);
+	tcamData2->frameOctet[0] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 8) & (MSD_U32)0xff);
+	tcamData2->frameOctet[1] = (MSD_U8)(pTcpData->ackNum & (MSD_U32)0xff);
+	tcamData2->frameOctet[2] = (MSD_U8)(pTcpData->offset << 4);
+	tcamData2->frameOctet[3] = (MSD_U8)((pTcpData->flags) & (MSD_U16)0x3f);
+	tcamData2->frameOctet[4] = (MSD_U8)((MSD_U16)(pTcpData->windowSize >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[5] = (MSD_U8)((pTcpData->windowSize) & (MSD_U16)0xff);
+	tcamData2->frameOctet[6] = (MSD_U8)((MSD_U16)(pTcpData->chkSum >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[7] = (MSD_U8)((MSD_U16)pTcpData->chkSum & (MSD_U16)0xff);
+	tcamData2->frameOctet[8] = (MSD_U8)((MSD_U16)(pTcpData->urgPtr >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[9] = (MSD_U8)(pTcpData->urgPtr & (MSD_U16)0xff);
+
+	tcamData->frameOctetMask[38] = (MSD_U8)((MSD_U16)(pTcpMask->srcPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[39] = (MSD_U8)(pTcpMask->srcPort & (MSD_U16)0xff);
+	tcamData->frameOctetMask[40] = (MSD_U8)((MSD_U16)(pTcpMask->destPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[41] = (MSD_U8)(pTcpMask->destPort & (MSD_U16)0xff);
+	tcamData->frameOctetMask[42] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 24) & (MSD_U32)0xff);
+	tcamData->frameOctetMask[43] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 16) & (MSD_U32)0xff);
+	tcamData->frameOctetMask[44] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 8) & (MSD_U32)0xff);
+	tcamData->frameOctetMask[45] = (MSD_U8)(pTcpMask->seqNum & (MSD_U32)0xff);
+    tcamData->frameOctetMask[46] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 24) & (MSD_U32)0xff);
+    tcamData->frameOctetMask[47] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 16) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[0] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 8) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[1] = (MSD_U8)((pTcpMask->ackNum) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[2] = (MSD_U8)(pTcpMask->offset << 4);
+	tcamData2->frameOctetMask[3] = (MSD_U8)((pTcpMask->flags) & (MSD_U16)0x3f);
+	tcamData2->frameOctetMask[4] = (MSD_U8)((MSD_U16)(pTcpMask->windowSize >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[5] = (MSD_U8)((pTcpMask->windowSize) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[6] = (MSD_U8)((MSD_U16)(pTcpMask->chkSum >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[7] = (MSD_U8)((pTcpMask->chkSum) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[8] = (MSD_U8)((MSD_U16)(pTcpMask->urgPtr >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[9] = (MSD_U8)((pTcpMask->urgPtr) & (MSD_U16)0xff);
+}
+static void mappingTcpOverIpv6ToTcam(FIR_MSD_TCAM_DATA *tcamData2, const MSD_TCAM_ENT_TCP_UNT *pTcpData, const MSD_TCAM_ENT_TCP_UNT *pTcpMask)
+{
+	tcamData2->frameOctet[10] = (MSD_U8)((MSD_U16)(pTcpData->srcPort >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[11] = (MSD_U8)(pTcpData->srcPort & (MSD_U16)0xff);
+	tcamData2->frameOctet[12] = (MSD_U8)((MSD_U16)(pTcpData->destPort >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[13] = (MSD_U8)(pTcpData->destPort & (MSD_U16)0xff);
+    tcamData2->frameOctet[14] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 24) & (MSD_U32)0xff);
+    tcamData2->frameOctet[15] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 16) & (MSD_U32)0xff);
+	tcamData2->frameOctet[16] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 8) & (MSD_U32)0xff);
+	tcamData2->frameOctet[17] = (MSD_U8)(pTcpData->seqNum & (MSD_U32)0xff);
+	tcamData2->frameOctet[18] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 24) & (MSD_U32)0xff);
+	tcamData2->frameOctet[19] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 16) & (MSD_U32)0xff);
+	tcamData2->frameOctet[20] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 8) & (MSD_U32)0xff);
+	tcamData2->frameOctet[21] = (MSD_U8)(pTcpData->ackNum & (MSD_U32)0xff);
+	tcamData2->frameOctet[22] = (MSD_U8)(pTcpData->offset << 4);
+	tcamData2->frameOctet[23] = (MSD_U8)((pTcpData->flags) & (MSD_U16)0x3f);
+	tcamData2->frameOctet[24] = (MSD_U8)((MSD_U16)(pTcpData->windowSize >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[25] = (MSD_U8)(pTcpData->windowSize & (MSD_U16)0xff);
+	tcamData2->frameOctet[26] = (MSD_U8)((MSD_U16)(pTcpData->chkSum >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[27] = (MSD_U8)(pTcpData->chkSum & (MSD_U16)0xff);
+	tcamData2->frameOctet[28] = (MSD_U8)((MSD_U16)(pTcpData->urgPtr >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctet[29] = (MSD_U8)(pTcpData->urgPtr & (MSD_U16)0xff);
+
+	tcamData2->frameOctetMask[10] = (MSD_U8)((MSD_U16)(pTcpMask->srcPort >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[11] = (MSD_U8)(pTcpMask->srcPort & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[12] = (MSD_U8)((MSD_U16)(pTcpMask->destPort >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[13] = (MSD_U8)(pTcpMask->destPort & (MSD_U16)0xff);
+    tcamData2->frameOctetMask[14] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 24) & (MSD_U32)0xff);
+    tcamData2->frameOctetMask[15] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 16) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[16] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 8) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[17] = (MSD_U8)(pTcpMask->seqNum & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[18] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 24) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[19] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 16) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[20] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 8) & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[21] = (MSD_U8)(pTcpMask->ackNum & (MSD_U32)0xff);
+	tcamData2->frameOctetMask[22] = (MSD_U8)(pTcpMask->offset << 4);
+	tcamData2->frameOctetMask[23] = (MSD_U8)(pTcpMask->flags & (MSD_U16)0x3f);
+	tcamData2->frameOctetMask[24] = (MSD_U8)((MSD_U16)(pTcpMask->windowSize >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[25] = (MSD_U8)(pTcpMask->windowSize & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[26] = (MSD_U8)((MSD_U16)(pTcpMask->chkSum >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[27] = (MSD_U8)(pTcpMask->chkSum & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[28] = (MSD_U8)((MSD_U16)(pTcpMask->urgPtr >> 8) & (MSD_U16)0xff);
+	tcamData2->frameOctetMask[29] = (MSD_U8)(pTcpMask->urgPtr & (MSD_U16)0xff);
+}
+static void mappingIpv6ToTcam(FIR_MSD_TCAM_DATA *tcamData, FIR_MSD_TCAM_DATA *tcamData2, const MSD_TCAM_ENT_IPV6_UNT *pIpv6, const MSD_TCAM_ENT_IPV6_UNT *pIpv6Mask)
+{
+    MSD_32 i;
+    MSD_U16 data;
+
+    /*Data for tcamData*/
+	data = (MSD_U16)((MSD_U16)pIpv6->version << 12) | (MSD_U16)((MSD_U16)pIpv6->tc << 4) | (MSD_U16)(pIpv6->flowLbl >> 16);
+	tcamData->frameOctet[18] = (MSD_U8)((MSD_U16)(data >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[19] = (MSD_U8)(data & (MSD_U16)0xff);
+	tcamData->frameOctet[20] = (MSD_U8)((MSD_U32)(pIpv6->flowLbl >> 8) & (MSD_U32)0xff);
+	tcamData->frameOctet[21] = (MSD_U8)(pIpv6->flowLbl & (MSD_U32)0xff);
+	tcamData->frameOctet[22] = (MSD_U8)((MSD_U16)(pIpv6->payloadLen >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[23] = (MSD_U8)(pIpv6->payloadLen & (MSD_U16)0xff);
+    tcamData->frameOctet[24] = pIpv6->nextHdr;
+    tcamData->frameOctet[25] = pIpv6->hopLimit;
+    for (i = 0; i < 8; i++)
+    {
+		tcamData->frameOctet[26 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6->sip[i] >> 8) & (MSD_U16)0xff);
+		tcamData->frameOctet[26 + (2 * i) + 1] = (MSD_U8)((pIpv6->sip[i]) & (MSD_U16)0xff);
+    }
+    for (i = 0; i < 3; i++)
+    {
+		tcamData->frameOctet[42 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6->dip[i] >> 8) & (MSD_U16)0xff);
+		tcamData->frameOctet[42 + (2 * i) + 1] = (MSD_U8)((pIpv6->dip[i]) & (MSD_U16)0xff);
+    }
+    /*Data mask for tcamData*/
+	data = (MSD_U16)((MSD_U16)pIpv6Mask->version << 12) | (MSD_U16)((MSD_U16)pIpv6Mask->tc << 4) | (MSD_U16)(pIpv6Mask->flowLbl >> 16);
+	tcamData->frameOctetMask[18] = (MSD_U8)((MSD_U16)(data >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[19] = (MSD_U8)(data & (MSD_U16)0xff);
+	tcamData->frameOctetMask[20] = (MSD_U8)((MSD_U32)(pIpv6Mask->flowLbl >> 8) & (MSD_U32)0xff);
+	tcamData->frameOctetMask[21] = (MSD_U8)((pIpv6Mask->flowLbl) & (MSD_U32)0xff);
+	tcamData->frameOctetMask[22] = (MSD_U8)((MSD_U16)(pIpv6Mask->payloadLen >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[23] = (MSD_U8)(pIpv6Mask->payloadLen & (MSD_U16)0xff);
+    tcamData->frameOctetMask[24] = pIpv6Mask->nextHdr;
+    tcamData->frameOctetMask[25] = pIpv6Mask->hopLimit;
+    for (i = 0; i < 8; i++)
+    {
+		tcamData->frameOctetMask[26 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6Mask->sip[i] >> 8) & (MSD_U16)0xff);
+		tcamData->frameOctetMask[26 + (2 * i) + 1] = (MSD_U8)((pIpv6Mask->sip[i]) & (MSD_U16)0xff);
+    }
+    for (i = 0; i < 3; i++)
+    {
+		tcamData->frameOctetMask[42 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6Mask->dip[i] >> 8) & (MSD_U16)0xff);
+		tcamData->frameOctetMask[42 + (2 * i) + 1] = (MSD_U8)((pIpv6Mask->dip[i]) & (MSD_U16)0xff);
+    }
+
+    for (i = 0; i < 5; i++)
+    {
+		tcamData2->frameOctet[0 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6->dip[3 + i] >> 8) & (MSD_U16)0xff);
+		tcamData2->frameOctet[0 + (2 * i) + 1] = (MSD_U8)((pIpv6->dip[3 + i]) & (MSD_U16)0xff);
+		tcamData2->frameOctetMask[0 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6Mask->dip[3 + i] >> 8) & (MSD_U16)0xff);
+		tcamData2->frameOctetMask[0 + (2 * i) + 1] = (MSD_U8)((pIpv6Mask->dip[3 + i]) & (MSD_U16)0xff);
+    }
+}
+static void mappingIpv4ToTcam(FIR_MSD_TCAM_DATA *tcamData, const MSD_TCAM_ENT_IPV4_UNT *pIpv4Data, const MSD_TCAM_ENT_IPV4_UNT *pIpv4Mask)
+{
+    MSD_32 i;
+
+	tcamData->frameOctet[18] = (MSD_U8)(pIpv4Data->version << 4) | pIpv4Data->ihl;
+    tcamData->frameOctet[19] = pIpv4Data->tos;
+	tcamData->frameOctet[20] = (MSD_U8)((MSD_U16)(pIpv4Data->length >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[21] = (MSD_U8)(pIpv4Data->length & (MSD_U16)0xff);
+	tcamData->frameOctet[22] = (MSD_U8)((MSD_U16)(pIpv4Data->id >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[23] = (MSD_U8)(pIpv4Data->id & (MSD_U16)0xff);
+	tcamData->frameOctet[24] = (MSD_U8)((MSD_U16)(((MSD_U16)((MSD_U16)pIpv4Data->flag << 13) | pIpv4Data->fragOffset) >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[25] = (MSD_U8)(((MSD_U16)((MSD_U16)pIpv4Data->flag << 13) | pIpv4Data->fragOffset) & (MSD_U16)0xff);
+    tcamData->frameOctet[26] = pIpv4Data->ttl;
+    tcamData->frameOctet[27] = pIpv4Data->protocol;
+	tcamData->frameOctet[28] = (MSD_U8)((MSD_U16)(pIpv4Data->hdrChkSum >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[29] = (MSD_U8)((pIpv4Data->hdrChkSum) & (MSD_U16)0xff);
+    for (i = 0; i < 4; i++)
+    {
+        tcamData->frameOctet[30 + i] = pIpv4Data->sip[i];
+        tcamData->frameOctet[34 + i] = pIpv4Data->dip[i];
+    }
+
+	tcamData->frameOctetMask[18] = (MSD_U8)(pIpv4Mask->version << 4) | pIpv4Mask->ihl;
+    tcamData->frameOctetMask[19] = pIpv4Mask->tos;
+	tcamData->frameOctetMask[20] = (MSD_U8)((MSD_U16)(pIpv4Mask->length >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[21] = (MSD_U8)(pIpv4Mask->length & (MSD_U16)0xff);
+	tcamData->frameOctetMask[22] = (MSD_U8)((MSD_U16)(pIpv4Mask->id >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[23] = (MSD_U8)(pIpv4Mask->id & (MSD_U16)0xff);
+	tcamData->frameOctetMask[24] = (MSD_U8)((MSD_U16)(((MSD_U16)((MSD_U16)pIpv4Mask->flag << 13) | pIpv4Mask->fragOffset) >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[25] = (MSD_U8)(((MSD_U16)((MSD_U16)pIpv4Mask->flag << 13) | pIpv4Mask->fragOffset) & (MSD_U16)0xff);
+    tcamData->frameOctetMask[26] = pIpv4Mask->ttl;
+    tcamData->frameOctetMask[27] = pIpv4Mask->protocol;
+	tcamData->frameOctetMask[28] = (MSD_U8)((MSD_U16)(pIpv4Mask->hdrChkSum >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[29] = (MSD_U8)(pIpv4Mask->hdrChkSum & (MSD_U16)0xff);
+    for (i = 0; i < 4; i++)
+    {
+        tcamData->frameOctetMask[30 + i] = pIpv4Mask->sip[i];
+        tcamData->frameOctetMask[34 + i] = pIpv4Mask->dip[i];
+    }
+}
+static void mappingUdpToTcam(MSD_16 startIndex, FIR_MSD_TCAM_DATA *tcamData, const MSD_TCAM_ENT_UDP_UNT *pUdpData, const MSD_TCAM_ENT_UDP_UNT *pUdpMask)
+{
+	tcamData->frameOctet[startIndex + 0] = (MSD_U8)((MSD_U16)(pUdpData->srcPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[startIndex + 1] = (MSD_U8)(pUdpData->srcPort & (MSD_U16)0xff);
+	tcamData->frameOctet[startIndex + 2] = (MSD_U8)((MSD_U16)(pUdpData->destPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[startIndex + 3] = (MSD_U8)(pUdpData->destPort & (MSD_U16)0xff);
+	tcamData->frameOctet[startIndex + 4] = (MSD_U8)((MSD_U16)(pUdpData->length >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[startIndex + 5] = (MSD_U8)(pUdpData->length & (MSD_U16)0xff);
+	tcamData->frameOctet[startIndex + 6] = (MSD_U8)((MSD_U16)(pUdpData->chkSum >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctet[startIndex + 7] = (MSD_U8)(pUdpData->chkSum & (MSD_U16)0xff);
+
+	tcamData->frameOctetMask[startIndex + 0] = (MSD_U8)((MSD_U16)(pUdpMask->srcPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[startIndex + 1] = (MSD_U8)(pUdpMask->srcPort & (MSD_U16)0xff);
+	tcamData->frameOctetMask[startIndex + 2] = (MSD_U8)((MSD_U16)(pUdpMask->destPort >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[startIndex + 3] = (MSD_U8)(pUdpMask->destPort & (MSD_U16)0xff);
+	tcamData->frameOctetMask[startIndex + 4] = (MSD_U8)((MSD_U16)(pUdpMask->length >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[startIndex + 5] = (MSD_U8)(pUdpMask->length & (MSD_U16)0xff);
+	tcamData->frameOctetMask[startIndex + 6] = (MSD_U8)((MSD_U16)(pUdpMask->chkSum >> 8) & (MSD_U16)0xff);
+	tcamData->frameOctetMask[startIndex + 7] = (MSD_U8)(pUdpMask->chkSum & (MSD_U16)0xff);
+}
+static void mappingActionToTcam(FIR_MSD_TCAM_DATA *tcamData, const FIR_MSD_TCAM_ENT_ACT *actionPtr)
+{
+    tcamData->interrupt = actionPtr->interrupt;
+    tcamData->IncTcamCtr = actionPtr->IncTcamCtr;
+    tcamData->vidOverride = actionPtr->vidOverride;
+    tcamData->vidData = actionPtr->vidData;
+    tcamData->qpriOverride = actionPtr->qpriOverride;
+    tcamData->qpriData = actionPtr->qpriData;
+    tcamData->fpriOverride = actionPtr->fpriOverride;
+    tcamData->fpriData = actionPtr->fpriData;
+    tcamData->dpvSF = actionPtr->dpvSF;
+    tcamData->dpvData = actionPtr->dpvData;
+    tcamData->dpvMode = actionPtr->dpvMode;
+    tcamData->colorMode = actionPtr->colorMode;
+    tcamData->vtuPageOverride = actionPtr->vtuPageOverride;
+    tcamData->vtuPage = actionPtr->vtuPage;
+    tcamData->unKnownFilter = actionPtr->unKnownFilter;
+    tcamData->egActPoint = actionPtr->egActPoint;
+    tcamData->ldBalanceOverride = actionPtr->ldBalanceOverride;
+    tcamData->ldBalanceData = actionPtr->ldBalanceData;
+	tcamData->tcamTunnel = 0; /* reserved */
+	tcamData->ipMulticast = actionPtr->ipMulticast;
+	tcamData->ip2me = actionPtr->ip2me;
+	tcamData->routeEntry = actionPtr->routeEntry;
+    tcamData->DSCPOverride = actionPtr->DSCPOverride;
+    tcamData->DSCP = actionPtr->DSCP;
+    tcamData->factionOverride = actionPtr->factionOverride;
+    tcamData->factionData = actionPtr->factionData;
+    
+    tcamData->frerSctrInc = actionPtr->frerSctrInc;
+    tcamData->frerSctrIndex = actionPtr->frerSctrIndex;
+    tcamData->frerStreamSplitEn = actionPtr->frerStreamSplitEn;
+    tcamData->frerSeqGenEn = actionPtr->frerSeqGenEn;
+    tcamData->frerSeqEncType = actionPtr->frerSeqEncType;
+    tcamData->frerSeqRcvyEn = actionPtr->frerSeqRcvyEn;
+    tcamData->frerSeqRcvyIndex = actionPtr->frerSeqRcvyIndex;
+    tcamData->frerIndvRcvyEn = actionPtr->frerIndvRcvyEn;
+    tcamData->frerIndvRcvyId = actionPtr->frerIndvRcvyId;
+    tcamData->flowMeterEn = actionPtr->flowMeterEn;
+    tcamData->flowMeterId = actionPtr->flowMeterId;
+    tcamData->tsDomain = actionPtr->tsDomain;
+    tcamData->tsFormat = actionPtr->tsFormat;
+    tcamData->depTsEn = actionPtr->depTsEn;
+    tcamData->arrTsEn = actionPtr->arrTsEn;
+    tcamData->streamFilterEn = actionPtr->streamFilterEn;
+    tcamData->streamFilterId = actionPtr->streamFilterId;
+	tcamData->tcamCtr = actionPtr->tcamCtr;
+}
+static MSD_STATUS Fir_setTcamExtensionReg(const MSD_QD_DEV *dev, MSD_U8 block, MSD_U8 port)
+{
+	MSD_STATUS       retVal;    /* Functions return value */
+	MSD_U16  tmpData = 0;
+
+	tmpData = (MSD_U16)((MSD_U16)(((MSD_U16)block & (MSD_U16)0xF) << 12) | (port & (MSD_U16)0x1F));
 
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+	retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)1, tmpData);
+	if (retVal != MSD_OK)
+	{
+		MSD_DBG_ERROR(("Fir_setTcamExtensionReg returned: %s.\n", msdDisplayStatus(retVal)));
+	}
 
-			retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, &data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+	return retVal;
+}
+static void Fir_tcamRulePut(MSD_U8 *octet, MSD_U8 *octetMask, MSD_U32 offset, MSD_U32 data, MSD_U32 dataMask, MSD_U32 size)
+{
+	MSD_U32 i;
+	MSD_U32 shift;
 
-			if ((data & (MSD_U16)0x1ff) == (MSD_U16)0x1ff)
-			{
-				MSD_U16 data1;
-				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_P0_KEYS_1, &data1);
-				if(retVal != MSD_OK)
-				{
-					msdSemGive(dev->devNum,  dev->tblRegsSem);
-					return retVal;
-				}
-				if (data1 == (MSD_U16)0x00ff)
-				{
-					/* No higher valid TCAM entry */
-					msdSemGive(dev->devNum,  dev->tblRegsSem);
-					return MSD_NO_SUCH;
-				}
-				else
-				{
-					/* The highest valid TCAM entry found*/
-				}
-			}
+	/* Network byte order */
+	for (i = 0; i < size; i++)
+	{
+		shift = 8U * (size - 1U - i);
+		octet[offset + i] = (MSD_U8)((data >> shift) & 0xffU);
+		octetMask[offset + i] = (MSD_U8)((dataMask >> shift) & 0xffU);
+	}
+}
 
-			/* Get next entry and read the entry */
-			opData->tcamEntry = (MSD_U32)data & (MSD_U32)0x1ff;
+static MSD_STATUS Fir_tcamRuleSerialize(const FIR_MSD_TCAM_RULE *rule, MSD_U8 *octet, MSD_U8 *octetMask, MSD_U32 *keyLen)
+{
+	MSD_STATUS retVal = MSD_OK;
+	const MSD_TCAM_ENT_PKT_UNT *pData = &rule->pattern;
+	const MSD_TCAM_ENT_PKT_UNT *pMask = &rule->mask;
+	const MSD_TCAM_ENT_IPV4_UNT *pIpv4Data = &pData->pktUnit.ipv4Udp.ipv4;
+	const MSD_TCAM_ENT_IPV4_UNT *pIpv4Mask = &pMask->pktUnit.ipv4Udp.ipv4;
+	const MSD_TCAM_ENT_IPV6_UNT *pIpv6Data = &pData->pktUnit.ipv6Udp.ipv6;
+	const MSD_TCAM_ENT_IPV6_UNT *pIpv6Mask = &pMask->pktUnit.ipv6Udp.ipv6;
+	const MSD_TCAM_ENT_TCP_UNT *pTcpData = NULL;
+	const MSD_TCAM_ENT_TCP_UNT *pTcpMask = NULL;
+	const MSD_TCAM_ENT_UDP_UNT *pUdpData = NULL;
+	const MSD_TCAM_ENT_UDP_UNT *pUdpMask = NULL;
+	MSD_U32 offset;
+	MSD_U32 i;
+
+	msdMemSet(octet, 0, FIR_MSD_TCAM_RULE_KEY_SIZE);
+	msdMemSet(octetMask, 0, FIR_MSD_TCAM_RULE_KEY_SIZE);
+
+	/* DA SA [VlanTag] EtherType */
+	for (i = 0; i < 6U; i++)
+	{
+		octet[i] = pData->da.arEther[i];
+		octetMask[i] = pMask->da.arEther[i];
+		octet[6U + i] = pData->sa.arEther[i];
+		octetMask[6U + i] = pMask->sa.arEther[i];
+	}
+	offset = 12U;
+	if (rule->vlanTagged == MSD_TRUE)
+	{
+		Fir_tcamRulePut(octet, octetMask, offset, pData->vlanTag, pMask->vlanTag, 4U);
+		offset += 4U;
+	}
+	Fir_tcamRulePut(octet, octetMask, offset, pData->etherType, pMask->etherType, 2U);
+	offset += 2U;
 
+	/* L3 header */
+	switch (rule->ruleType)
+	{
+	case FIR_MSD_TCAM_RULE_L2:
+		break;
+	case FIR_MSD_TCAM_RULE_IPV4:
+	case FIR_MSD_TCAM_RULE_IPV4_TCP:
+	case FIR_MSD_TCAM_RULE_IPV4_UDP:
+		Fir_tcamRulePut(octet, octetMask, offset, ((MSD_U32)pIpv4Data->version << 4) | (pIpv4Data->ihl & 0xfU),
+			((MSD_U32)pIpv4Mask->version << 4) | (pIpv4Mask->ihl & 0xfU), 1U);
+		Fir_tcamRulePut(octet, octetMask, offset + 1U, pIpv4Data->tos, pIpv4Mask->tos, 1U);
+		Fir_tcamRulePut(octet, octetMask, offset + 2U, pIpv4Data->length, pIpv4Mask->length, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 4U, pIpv4Data->id, pIpv4Mask->id, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 6U, ((MSD_U32)pIpv4Data->flag << 13) | pIpv4Data->fragOffset,
+			((MSD_U32)pIpv4Mask->flag << 13) | pIpv4Mask->fragOffset, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 8U, pIpv4Data->ttl, pIpv4Mask->ttl, 1U);
+		Fir_tcamRulePut(octet, octetMask, offset + 9U, pIpv4Data->protocol, pIpv4Mask->protocol, 1U);
+		Fir_tcamRulePut(octet, octetMask, offset + 10U, pIpv4Data->hdrChkSum, pIpv4Mask->hdrChkSum, 2U);
+		for (i = 0; i < 4U; i++)
+		{
+			Fir_tcamRulePut(octet, octetMask, offset + 12U + i, pIpv4Data->sip[i], pIpv4Mask->sip[i], 1U);
+			Fir_tcamRulePut(octet, octetMask, offset + 16U + i, pIpv4Data->dip[i], pIpv4Mask->dip[i], 1U);
 		}
-		case Fir_TCAM_READ_ENTRY:
+		offset += 20U;
+		break;
+	case FIR_MSD_TCAM_RULE_IPV6:
+	case FIR_MSD_TCAM_RULE_IPV6_TCP:
+	case FIR_MSD_TCAM_RULE_IPV6_UDP:
+		Fir_tcamRulePut(octet, octetMask, offset,
+			((MSD_U32)pIpv6Data->version << 28) | ((MSD_U32)pIpv6Data->tc << 20) | (pIpv6Data->flowLbl & 0xfffffU),
+			((MSD_U32)pIpv6Mask->version << 28) | ((MSD_U32)pIpv6Mask->tc << 20) | (pIpv6Mask->flowLbl & 0xfffffU), 4U);
+		Fir_tcamRulePut(octet, octetMask, offset + 4U, pIpv6Data->payloadLen, pIpv6Mask->payloadLen, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 6U, pIpv6Data->nextHdr, pIpv6Mask->nextHdr, 1U);
+		Fir_tcamRulePut(octet, octetMask, offset + 7U, pIpv6Data->hopLimit, pIpv6Mask->hopLimit, 1U);
+		for (i = 0; i < 8U; i++)
 		{
-			tcamOp = Fir_TCAM_READ_ENTRY;
-
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum,  dev->tblRegsSem);
-				return retVal;
-			}
+			Fir_tcamRulePut(octet, octetMask, offset + 8U + (2U * i), pIpv6Data->sip[i], pIpv6Mask->sip[i], 2U);
+			Fir_tcamRulePut(octet, octetMask, offset + 24U + (2U * i), pIpv6Data->dip[i], pIpv6Mask->dip[i], 2U);
+		}
+		offset += 40U;
+		break;
+	default:
+		retVal = MSD_BAD_PARAM;
+		break;
+	}
 
-			/* Read page 0 */
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)0 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+	/* L4 header */
+	switch (rule->ruleType)
+	{
+	case FIR_MSD_TCAM_RULE_IPV4_TCP:
+		pTcpData = &pData->pktUnit.ipv4Tcp.tcp;
+		pTcpMask = &pMask->pktUnit.ipv4Tcp.tcp;
+		break;
+	case FIR_MSD_TCAM_RULE_IPV6_TCP:
+		pTcpData = &pData->pktUnit.ipv6Tcp.tcp;
+		pTcpMask = &pMask->pktUnit.ipv6Tcp.tcp;
+		break;
+	case FIR_MSD_TCAM_RULE_IPV4_UDP:
+		pUdpData = &pData->pktUnit.ipv4Udp.udp;
+		pUdpMask = &pMask->pktUnit.ipv4Udp.udp;
+		break;
+	case FIR_MSD_TCAM_RULE_IPV6_UDP:
+		pUdpData = &pData->pktUnit.ipv6Udp.udp;
+		pUdpMask = &pMask->pktUnit.ipv6Udp.udp;
+		break;
+	default:
+		break;
+	}
+	if ((pTcpData != NULL) && (pTcpMask != NULL))
+	{
+		Fir_tcamRulePut(octet, octetMask, offset, pTcpData->srcPort, pTcpMask->srcPort, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 2U, pTcpData->destPort, pTcpMask->destPort, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 4U, pTcpData->seqNum, pTcpMask->seqNum, 4U);
+		Fir_tcamRulePut(octet, octetMask, offset + 8U, pTcpData->ackNum, pTcpMask->ackNum, 4U);
+		Fir_tcamRulePut(octet, octetMask, offset + 12U, ((MSD_U32)pTcpData->offset << 4) & 0xf0U, ((MSD_U32)pTcpMask->offset << 4) & 0xf0U, 1U);
+		Fir_tcamRulePut(octet, octetMask, offset + 13U, pTcpData->flags & 0x3fU, pTcpMask->flags & 0x3fU, 1U);
+		Fir_tcamRulePut(octet, octetMask, offset + 14U, pTcpData->windowSize, pTcpMask->windowSize, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 16U, pTcpData->chkSum, pTcpMask->chkSum, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 18U, pTcpData->urgPtr, pTcpMask->urgPtr, 2U);
+	}
+	if ((pUdpData != NULL) && (pUdpMask != NULL))
+	{
+		Fir_tcamRulePut(octet, octetMask, offset, pUdpData->srcPort, pUdpMask->srcPort, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 2U, pUdpData->destPort, pUdpMask->destPort, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 4U, pUdpData->length, pUdpMask->length, 2U);
+		Fir_tcamRulePut(octet, octetMask, offset + 6U, pUdpData->chkSum, pUdpMask->chkSum, 2U);
+	}
 
-			retVal = Fir_tcamGetPage0Data(dev, &opData->tcamDataP);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+	/* Only bytes up to the last masked one need to be matched */
+	*keyLen = 0;
+	for (i = FIR_MSD_TCAM_RULE_KEY_SIZE; i > 0U; i--)
+	{
+		if (octetMask[i - 1U] != 0U)
+		{
+			*keyLen = i;
+			break;
+		}
+	}
 
-			/* Read page 1 */
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)1 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+	return retVal;
+}
 
-			retVal = Fir_tcamGetPage1Data(dev, &opData->tcamDataP);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+static void Fir_tcamRuleKeyGet(const FIR_MSD_TCAM_DATA *tcamData, MSD_U16 *key, MSD_U16 *keyMask)
+{
+	MSD_U32 i;
+
+	key[0] = tcamData->frameType;
+	key[1] = tcamData->timeKey;
+	key[FIR_TCAM_RULE_KEY_SPV] = tcamData->spv;
+	key[3] = tcamData->ppri;
+	key[4] = tcamData->pvid;
+	keyMask[0] = tcamData->frameTypeMask;
+	keyMask[1] = tcamData->timeKeyMask;
+	keyMask[FIR_TCAM_RULE_KEY_SPV] = tcamData->spvMask;
+	keyMask[3] = tcamData->ppriMask;
+	keyMask[4] = tcamData->pvidMask;
+	for (i = 0; i < 48U; i++)
+	{
+		key[5U + i] = tcamData->frameOctet[i];
+		keyMask[5U + i] = tcamData->frameOctetMask[i];
+	}
+}
 
-			/*Access Ingress Actions from TCAM Frame matches*/
-			retVal = Fir_setTcamExtensionReg(dev, 0, 0);
-			if (retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+static void Fir_tcamRuleKeySet(FIR_MSD_TCAM_DATA *tcamData, const MSD_U16 *key, const MSD_U16 *keyMask)
+{
+	MSD_U32 i;
+
+	tcamData->frameType = (MSD_U8)key[0];
+	tcamData->timeKey = (MSD_U8)key[1];
+	tcamData->spv = key[FIR_TCAM_RULE_KEY_SPV];
+	tcamData->ppri = (MSD_U8)key[3];
+	tcamData->pvid = key[4];
+	tcamData->frameTypeMask = (MSD_U8)keyMask[0];
+	tcamData->timeKeyMask = (MSD_U8)keyMask[1];
+	tcamData->spvMask = keyMask[FIR_TCAM_RULE_KEY_SPV];
+	tcamData->ppriMask = (MSD_U8)keyMask[3];
+	tcamData->pvidMask = keyMask[4];
+	for (i = 0; i < 48U; i++)
+	{
+		tcamData->frameOctet[i] = (MSD_U8)key[5U + i];
+		tcamData->frameOctetMask[i] = (MSD_U8)keyMask[5U + i];
+	}
+}
 
-			/* Read page 2 */
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)2 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+/* Merge src into dst when both carry the same action and one ternary key can
+   match exactly the union of both keys. */
+static MSD_BOOL Fir_tcamRuleMerge(FIR_MSD_TCAM_DATA *dst, const FIR_MSD_TCAM_DATA *src)
+{
+	FIR_MSD_TCAM_DATA_HW dstHw;
+	FIR_MSD_TCAM_DATA_HW srcHw;
+	MSD_U16 dstKey[FIR_TCAM_RULE_KEY_FIELDS];
+	MSD_U16 dstMask[FIR_TCAM_RULE_KEY_FIELDS];
+	MSD_U16 srcKey[FIR_TCAM_RULE_KEY_FIELDS];
+	MSD_U16 srcMask[FIR_TCAM_RULE_KEY_FIELDS];
+	MSD_BOOL merged = MSD_FALSE;
+	MSD_BOOL dstCovers = MSD_TRUE;
+	MSD_BOOL srcCovers = MSD_TRUE;
+	MSD_U32 numDiff = 0;
+	MSD_U32 diff = 0;
+	MSD_U16 bits;
+	MSD_U32 i;
+
+	(void)Fir_setTcamHWData(dst, &dstHw);
+	(void)Fir_setTcamHWData(src, &srcHw);
+	for (i = 0; i < 26U; i++)
+	{
+		if (dstHw.pg2.frame[i] != srcHw.pg2.frame[i])
+		{
+			return MSD_FALSE;
+		}
+	}
 
-			retVal = Fir_tcamGetPage2Data(dev, &opData->tcamDataP);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+	Fir_tcamRuleKeyGet(dst, dstKey, dstMask);
+	Fir_tcamRuleKeyGet(src, srcKey, srcMask);
+	for (i = 0; i < FIR_TCAM_RULE_KEY_FIELDS; i++)
+	{
+		dstKey[i] &= dstMask[i];
+		srcKey[i] &= srcMask[i];
+		if (((dstMask[i] & (MSD_U16)~srcMask[i]) != 0U) || (((dstKey[i] ^ srcKey[i]) & dstMask[i]) != 0U))
+		{
+			dstCovers = MSD_FALSE;
+		}
+		if (((srcMask[i] & (MSD_U16)~dstMask[i]) != 0U) || (((dstKey[i] ^ srcKey[i]) & srcMask[i]) != 0U))
+		{
+			srcCovers = MSD_FALSE;
+		}
+		if ((dstMask[i] != srcMask[i]) || (dstKey[i] != srcKey[i]))
+		{
+			numDiff++;
+			diff = i;
+		}
+	}
 
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
+	if (dstCovers == MSD_TRUE)
+	{
+		merged = MSD_TRUE;
+	}
+	else if (srcCovers == MSD_TRUE)
+	{
+		Fir_tcamRuleKeySet(dst, srcKey, srcMask);
+		merged = MSD_TRUE;
+	}
+	else if (numDiff == 1U)
+	{
+		if ((diff == FIR_TCAM_RULE_KEY_SPV) && (dstKey[diff] == 0U) && (srcKey[diff] == 0U))
+		{
+			/* Ports are included by clearing their mask bit, see Fir_gtcamAddEntryPort */
+			dstMask[diff] &= srcMask[diff];
+			merged = MSD_TRUE;
+		}
+		else if (dstMask[diff] == srcMask[diff])
+		{
+			bits = (MSD_U16)((dstKey[diff] ^ srcKey[diff]) & dstMask[diff]);
+			if ((bits != 0U) && ((bits & (MSD_U16)(bits - 1U)) == 0U))
 			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
+				dstMask[diff] &= (MSD_U16)~bits;
+				dstKey[diff] &= (MSD_U16)~bits;
+				merged = MSD_TRUE;
 			}
 		}
-		break;
+		else
+		{
+			/* Masks differ on more than one ternary bit */
+		}
 
-		default:
-			retVal = MSD_FAIL;
-			break;
+		if (merged == MSD_TRUE)
+		{
+			Fir_tcamRuleKeySet(dst, dstKey, dstMask);
+		}
+	}
+	else
+	{
+		/* Keys differ in more than one field */
 	}
 
-	msdSemGive(dev->devNum, dev->tblRegsSem);
-	return retVal;
+	return merged;
 }
 
-
-static MSD_STATUS Fir_tcamEgrOperationPerform
-(
-    IN    MSD_QD_DEV           *dev,
-    IN    FIR_MSD_TCAM_OPERATION   tcamOp,
-    INOUT FIR_MSD_TCAM_EGR_OP_DATA     *opData
-)
+static MSD_STATUS Fir_tcamRuleEgrPointer(const FIR_MSD_TCAM_RULE *rule, FIR_MSD_TCAM_RULE_IMAGE *image, MSD_U8 *egActPoint)
 {
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16          data;     /* temporary Data storage */
+	MSD_STATUS retVal = MSD_OK;
+	FIR_MSD_TCAM_EGR_DATA_HW ruleHw;
+	FIR_MSD_TCAM_EGR_DATA_HW imageHw;
+	MSD_BOOL found = MSD_FALSE;
+	MSD_U32 i;
 
-	msdSemTake(dev->devNum,  dev->tblRegsSem, OS_WAIT_FOREVER);
+	(void)Fir_setTcamEgrHWData(&rule->egrAction, &ruleHw);
 
-	/* Wait until the tcam in ready. */
-	retVal = Fir_waitTcamReady(dev);
-	if(retVal != MSD_OK)
+	/* Rules applying the same egress action on the same ports share one pointer */
+	for (i = 0; (i < image->egrCount) && (found == MSD_FALSE); i++)
 	{
-		msdSemGive(dev->devNum, dev->tblRegsSem);
-		return retVal;
+		(void)Fir_setTcamEgrHWData(&image->egrImage[i].tcamEgrData, &imageHw);
+		if ((image->egrImage[i].portVec == rule->egrPortVec) &&
+			(imageHw.frame[0] == ruleHw.frame[0]) && (imageHw.frame[1] == ruleHw.frame[1]) &&
+			(imageHw.frame[2] == ruleHw.frame[2]) && (imageHw.frame[3] == ruleHw.frame[3]))
+		{
+			*egActPoint = image->egrImage[i].egActPoint;
+			found = MSD_TRUE;
+		}
 	}
 
-	/* Set the TCAM Operation register */
-	switch (tcamOp)
+	if (found == MSD_FALSE)
 	{
-		case Fir_TCAM_FLUSH_ENTRY:
+		if (image->egrImage == NULL)
 		{
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-
-			/*Access Egress Actions from Egress Action Pointer */
-			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
-			if (retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_PORT, 0);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+			MSD_DBG_ERROR(("Input param egrImage is NULL.\n"));
+			retVal = MSD_BAD_PARAM;
 		}
-		break;
-
-		case Fir_TCAM_LOAD_ENTRY:
+		else if ((image->egrCount >= image->egrSize) || ((image->egrCount + 1U) >= FIR_MAX_EGR_TCAM_ENTRY))
 		{
-			/* load Page 2 */
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-
-			/*Access Egress Actions from Egress Action Pointer */
-			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
-			if (retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-
-			retVal = Fir_tcamSetPage3Data(dev, &opData->tcamDataP);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+			MSD_DBG_ERROR(("No egress action pointer left.\n"));
+			retVal = MSD_NO_SPACE;
+		}
+		else
+		{
+			*egActPoint = (MSD_U8)(image->egrCount + 1U);
+			image->egrImage[image->egrCount].egActPoint = *egActPoint;
+			image->egrImage[image->egrCount].portVec = rule->egrPortVec;
+			image->egrImage[image->egrCount].tcamEgrData = rule->egrAction;
+			image->egrCount++;
+		}
+	}
 
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+	return retVal;
+}
 
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+static void Fir_tcamRuleRemoveSlot(FIR_MSD_TCAM_RULE_IMAGE *image, MSD_U32 slot, MSD_U32 primCount, MSD_U32 numRules, MSD_U32 *ruleSlot)
+{
+	MSD_U32 i;
 
-		}
-		break;
+	for (i = slot; (i + 1U) < primCount; i++)
+	{
+		image->igrImage[i] = image->igrImage[i + 1U];
+	}
 
-		case Fir_TCAM_GET_NEXT_ENTRY:
+	if (ruleSlot != NULL)
+	{
+		for (i = 0; i < numRules; i++)
 		{
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
+			if ((ruleSlot[i] > slot) && (ruleSlot[i] < primCount))
 			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
+				ruleSlot[i]--;
 			}
+		}
+	}
+}
 
-			/*Access Egress Actions from Egress Action Pointer */
-			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
-			if (retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+static MSD_U16 *Fir_tcamShadowHwPage(FIR_MSD_TCAM_DATA_HW *tcamDataPtr, MSD_U32 page)
+{
+	MSD_U16 *frame;
 
-			data = (MSD_U16)((MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if (retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+	if (page == 0U)
+	{
+		frame = tcamDataPtr->pg0.frame;
+	}
+	else if (page == 1U)
+	{
+		frame = tcamDataPtr->pg1.frame;
+	}
+	else
+	{
+		frame = tcamDataPtr->pg2.frame;
+	}
 
-			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+	return frame;
+}
 
-			retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, &data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+/* Page 2 only uses staging registers 2 to 13 and 0x1B */
+static MSD_BOOL Fir_tcamShadowRegUsed(MSD_U32 page, MSD_U32 reg)
+{
+	return ((page != 2U) || (reg < 12U) || (reg == 25U)) ? MSD_TRUE : MSD_FALSE;
+}
 
-			if ((data & (MSD_U16)0x3f) == (MSD_U16)0x3f)
-			{
-				MSD_U16 data1,data2,data3;
-				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_ACTION_1, &data1);
-				if(retVal != MSD_OK)
-				{
-					msdSemGive(dev->devNum, dev->tblRegsSem);
-					return retVal;
-				}
+static MSD_BOOL Fir_tcamShadowIgrValid(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry)
+{
+	return (shadow->igrPage[entry][0][0] != (MSD_U16)FIR_TCAM_SHADOW_FLUSHED) ? MSD_TRUE : MSD_FALSE;
+}
 
-				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_ACTION_2, &data2);
-				if(retVal != MSD_OK)
-				{
-					msdSemGive(dev->devNum, dev->tblRegsSem);
-					return retVal;
-				}
+/* Same test as the hardware search: any of the action registers 1 to 3 set */
+static MSD_BOOL Fir_tcamShadowEgrValid(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U8 hwPort, MSD_U32 entry)
+{
+	const MSD_U16 *frame = shadow->egrPage[hwPort][entry];
 
-				retVal = msdGetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_EGR_ACTION_3, &data3);
-				if(retVal != MSD_OK)
-				{
-					msdSemGive(dev->devNum, dev->tblRegsSem);
-					return retVal;
-				}
+	return ((frame[0] != 0U) || (frame[1] != 0U) || (frame[2] != 0U)) ? MSD_TRUE : MSD_FALSE;
+}
 
-				if((data1 == 0U) && (data2 == 0U) && (data3 == 0U))
-				{
-					/* No higher valid TCAM entry */
-					msdSemGive(dev->devNum, dev->tblRegsSem);
-					return MSD_NO_SUCH;
-				}
-				else
-				{
-					/* The highest valid TCAM entry found*/
-				}
-			}
+static void Fir_tcamShadowFlushIgr(FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry)
+{
+	msdMemSet((void*)shadow->igrPage[entry], 0, sizeof(shadow->igrPage[entry]));
+	shadow->igrPage[entry][0][0] = (MSD_U16)FIR_TCAM_SHADOW_FLUSHED;
+}
 
-			/* Get next entry and read the entry */
-			opData->tcamEntry = (MSD_U32)(data & (MSD_U32)0xff);
+static void Fir_tcamShadowGetIgr(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry, FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
+{
+	msdMemCpy((void*)tcamDataPtr->pg0.frame, (const void*)shadow->igrPage[entry][0], sizeof(tcamDataPtr->pg0.frame));
+	msdMemCpy((void*)tcamDataPtr->pg1.frame, (const void*)shadow->igrPage[entry][1], sizeof(tcamDataPtr->pg1.frame));
+	msdMemCpy((void*)tcamDataPtr->pg2.frame, (const void*)shadow->igrPage[entry][2], sizeof(tcamDataPtr->pg2.frame));
+}
 
-		}
+/*
+ * Write only the pages of an ingress entry that differ from the shadow, in the
+ * page 2, 1, 0 order of a full load. The page registers are shared staging
+ * registers, so a register already holding the wanted value from a previous
+ * page of this load is not written again. Nothing is assumed about their
+ * content across calls since RMU or another agent may have used them.
+ * Called with tblRegsSem held.
+ */
+static MSD_STATUS Fir_tcamShadowLoad(const MSD_QD_DEV *dev, FIR_MSD_TCAM_SHADOW *shadow, FIR_MSD_TCAM_OP_DATA *opData)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_U16 *frame;
+	MSD_U16 *shadowFrame;
+	MSD_U16 stage[FIR_TCAM_SHADOW_PAGE_REGS];
+	MSD_U32 staged = 0;
+	MSD_U32 entry = opData->tcamEntry;
+	MSD_U32 page;
+	MSD_U32 reg;
+	MSD_U16 data;
+	MSD_BOOL changed;
+
+	for (page = 3U; (page > 0U) && (retVal == MSD_OK); page--)
+	{
+		frame = Fir_tcamShadowHwPage(&opData->tcamDataP, page - 1U);
+		shadowFrame = shadow->igrPage[entry][page - 1U];
 
-		case Fir_TCAM_READ_ENTRY:
+		changed = MSD_FALSE;
+		for (reg = 0; reg < FIR_TCAM_SHADOW_PAGE_REGS; reg++)
 		{
-			tcamOp = Fir_TCAM_READ_ENTRY;
-
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
+			if ((Fir_tcamShadowRegUsed(page - 1U, reg) == MSD_TRUE) && (frame[reg] != shadowFrame[reg]))
 			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
+				changed = MSD_TRUE;
 			}
+		}
+		if (changed == MSD_FALSE)
+		{
+			continue;
+		}
 
-			/*Access Egress Actions from Egress Action Pointer */
-			retVal = Fir_setTcamExtensionReg(dev, 0, opData->port);
-			if (retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
+		retVal = Fir_waitTcamReady(dev);
+		if ((retVal == MSD_OK) && (page == 3U))
+		{
+			/*Access Ingress Actions from TCAM Frame matches */
+			retVal = Fir_setTcamExtensionReg(dev, 0, 0);
+		}
 
-			/* Read page 3 */
-			data = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)tcamOp << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
-			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
-			if(retVal != MSD_OK)
-			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
-			}
-			/* Wait until the tcam in ready. */
-			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
+		for (reg = 0; (reg < FIR_TCAM_SHADOW_PAGE_REGS) && (retVal == MSD_OK); reg++)
+		{
+			if (Fir_tcamShadowRegUsed(page - 1U, reg) == MSD_FALSE)
 			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
+				continue;
 			}
-
-			retVal = Fir_tcamGetPage3Data(dev, &opData->tcamDataP);
-			if(retVal != MSD_OK)
+			if (((staged & ((MSD_U32)1 << reg)) == 0U) || (stage[reg] != frame[reg]))
 			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
+				retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)(reg + 2U), frame[reg]);
+				stage[reg] = frame[reg];
+				staged |= (MSD_U32)1 << reg;
 			}
+		}
 
-			/* Wait until the tcam in ready. */
+		if (retVal == MSD_OK)
+		{
+			data = (MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)(page - 1U) << 10) | (MSD_U16)entry);
+			retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, FIR_TCAM_OPERATION, data);
+		}
+		if (retVal == MSD_OK)
+		{
 			retVal = Fir_waitTcamReady(dev);
-			if(retVal != MSD_OK)
+		}
+		if (retVal == MSD_OK)
+		{
+			for (reg = 0; reg < FIR_TCAM_SHADOW_PAGE_REGS; reg++)
 			{
-				msdSemGive(dev->devNum, dev->tblRegsSem);
-				return retVal;
+				shadowFrame[reg] = (Fir_tcamShadowRegUsed(page - 1U, reg) == MSD_TRUE) ? frame[reg] : (MSD_U16)0;
 			}
 		}
-		break;
-
-		default:
-			retVal = MSD_FAIL;
-			break;
 	}
 
-	msdSemGive(dev->devNum, dev->tblRegsSem);
 	return retVal;
 }
 
-static void displayTcamData(FIR_MSD_TCAM_DATA *tcamData)
+/*
+ * Walk the valid entries of the hardware with GET_NEXT. With update set the
+ * shadow is rewritten from the hardware, otherwise the entries differing from
+ * the shadow are counted in mismatch.
+ */
+static MSD_STATUS Fir_tcamShadowScan(MSD_QD_DEV *dev, FIR_MSD_TCAM_SHADOW *shadow, MSD_BOOL update, MSD_U32 *mismatch)
 {
-	MSD_16 i;
-
-	MSG(("----- Key & Mask -----\n"));
+	MSD_STATUS retVal = MSD_OK;
+	FIR_MSD_TCAM_OP_DATA opData;
+	FIR_MSD_TCAM_EGR_OP_DATA egrOpData;
+	FIR_MSD_TCAM_DATA_HW shadowData;
+	MSD_U8 seen[FIR_MAX_IGR_TCAM_ENTRY / 8U];
+	MSD_U32 count = 0;
+	MSD_U32 start;
+	MSD_U32 entry;
+	MSD_U32 i;
+	MSD_BOOL first;
+	MSD_LPORT port;
+	MSD_U8 hwPort;
+
+	/* Ingress entries */
+	msdMemSet((void*)seen, 0, sizeof(seen));
+	start = 0x1ffU;
+	first = MSD_TRUE;
+	while (retVal == MSD_OK)
+	{
+		msdMemSet((void*)&opData, 0, sizeof(opData));
+		opData.tcamEntry = start;
+		retVal = Fir_tcamHwOperationPerform(dev, Fir_TCAM_GET_NEXT_ENTRY, &opData);
+		if (retVal != MSD_OK)
+		{
+			break;
+		}
 
-	MSG(("frameType         : %04x\n", tcamData->frameType));
-	MSG(("frameTypeMask     : %04x\n", tcamData->frameTypeMask));
-	MSG(("timeKey           : %04x\n", tcamData->timeKey));
-	MSG(("timeKeyMask       : %04x\n", tcamData->timeKeyMask));
-	MSG(("spv               : %04x\n", tcamData->spv));
-	MSG(("spvMask           : %04x\n", tcamData->spvMask));
-	MSG(("ppri              : %04x\n", tcamData->ppri));
-	MSG(("ppriMask          : %04x\n", tcamData->ppriMask));
-	MSG(("pvid              : %04x\n", tcamData->pvid));
-	MSG(("pvidMask          : %04x\n", tcamData->pvidMask));
+		entry = opData.tcamEntry & 0x1ffU;
+		if ((first == MSD_FALSE) && (entry <= start))
+		{
+			break;
+		}
+		first = MSD_FALSE;
+		seen[entry / 8U] |= (MSD_U8)(1U << (entry % 8U));
 
-	MSG(("----- Ethernet Frame Content -----\n"));
+		msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+		if (update == MSD_TRUE)
+		{
+			msdMemCpy((void*)shadow->igrPage[entry][0], (const void*)opData.tcamDataP.pg0.frame, sizeof(opData.tcamDataP.pg0.frame));
+			msdMemCpy((void*)shadow->igrPage[entry][1], (const void*)opData.tcamDataP.pg1.frame, sizeof(opData.tcamDataP.pg1.frame));
+			msdMemCpy((void*)shadow->igrPage[entry][2], (const void*)opData.tcamDataP.pg2.frame, sizeof(opData.tcamDataP.pg2.frame));
+		}
+		else
+		{
+			Fir_tcamShadowGetIgr(shadow, entry, &shadowData);
+			for (i = 0; i < FIR_TCAM_SHADOW_PAGE_REGS; i++)
+			{
+				if ((shadowData.pg0.frame[i] != opData.tcamDataP.pg0.frame[i]) ||
+					(shadowData.pg1.frame[i] != opData.tcamDataP.pg1.frame[i]) ||
+					(shadowData.pg2.frame[i] != opData.tcamDataP.pg2.frame[i]))
+				{
+					count++;
+					break;
+				}
+			}
+		}
+		msdSemGive(dev->devNum, dev->tblRegsSem);
 
-	for (i = 0; i<48; i++)
+		if (entry == 0x1ffU)
+		{
+			break;
+		}
+		start = entry;
+	}
+	if (retVal == MSD_NO_SUCH)
 	{
-		MSG(("frame data Octet %2d         : %4x\n", i + 1, tcamData->frameOctet[i]));
-		MSG(("frame data OctetMask %2d     : %4x\n", i + 1, tcamData->frameOctetMask[i]));
+		retVal = MSD_OK;
 	}
 
-	MSG(("----- Ingress Action -----\n"));
-
-	MSG(("continu           : %04x\n", tcamData->continu));
-	MSG(("interrupt         : %04x\n", tcamData->interrupt));
-	MSG(("IncTcamCtr        : %04x\n", tcamData->IncTcamCtr));
-	MSG(("vidOverride       : %04x\n", tcamData->vidOverride));
-	MSG(("vidData           : %04x\n", tcamData->vidData));
-
-
-	MSG(("qpriOverride      : %04x\n", tcamData->qpriOverride));
-	MSG(("qpriData          : %04x\n", tcamData->qpriData));
-	MSG(("fpriOverride      : %04x\n", tcamData->fpriOverride));
-	MSG(("fpriData          : %04x\n", tcamData->fpriData));
-
-	MSG(("dpvSF             : %04x\n", tcamData->dpvSF));
-	MSG(("dpvData           : %04x\n", (MSD_U32)tcamData->dpvData));
-	MSG(("dpvMode           : %04x\n", tcamData->dpvMode));
-
-	MSG(("unKnownFilter     : %04x\n", tcamData->unKnownFilter));
-
-	MSG(("ldBalanceOverride : %04x\n", tcamData->ldBalanceOverride));
-	MSG(("ldBalanceData     : %04x\n", tcamData->ldBalanceData));
+	if (retVal == MSD_OK)
+	{
+		msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+		for (entry = 0; entry < FIR_MAX_IGR_TCAM_ENTRY; entry++)
+		{
+			if ((seen[entry / 8U] & (MSD_U8)(1U << (entry % 8U))) != 0U)
+			{
+				continue;
+			}
+			if (update == MSD_TRUE)
+			{
+				Fir_tcamShadowFlushIgr(shadow, entry);
+			}
+			else if (Fir_tcamShadowIgrValid(shadow, entry) == MSD_TRUE)
+			{
+				count++;
+			}
+			else
+			{
+				/* Both invalid */
+			}
+		}
+		msdSemGive(dev->devNum, dev->tblRegsSem);
+	}
 
-	MSG(("factionOverride   : %04x\n", tcamData->factionOverride));
-	MSG(("factionData       : %04x\n", tcamData->factionData));
-	MSG(("colorMode         : %04x\n", tcamData->colorMode));
-	MSG(("vtuPageOverride   : %04x\n", tcamData->vtuPageOverride));
-	MSG(("vtuPage           : %04x\n", tcamData->vtuPage));
-	MSG(("egActPoint        : %04x\n", tcamData->egActPoint));
-	MSG(("DSCPOverride      : %04x\n", tcamData->DSCPOverride));
-	MSG(("DSCP              : %04x\n", tcamData->DSCP));
-	MSG(("ipMulticast       : %04x\n", tcamData->ipMulticast));
-	MSG(("ip2me             : %04x\n", tcamData->ip2me));
-	MSG(("routeEntry        : %04x\n", tcamData->routeEntry));
-	MSG(("tcamCtr           : %04x\n", tcamData->tcamCtr));
-    MSG(("nextId            : %04x\n", tcamData->nextId));
+	/* Egress entries of every port */
+	for (port = 0; (port < dev->numOfPorts) && (retVal == MSD_OK); port++)
+	{
+		hwPort = MSD_LPORT_2_PORT(port);
+		if (hwPort >= MSD_MAX_SWITCH_PORTS)
+		{
+			continue;
+		}
 
-    MSG(("frerSctrInc       : %04x\n", tcamData->frerSctrInc));
-    MSG(("frerSctrIndex     : %04x\n", tcamData->frerSctrIndex));
-    MSG(("frerStreamSplitEn : %04x\n", tcamData->frerStreamSplitEn));
-    MSG(("frerSeqGenEn      : %04x\n", tcamData->frerSeqGenEn));
-    MSG(("frerSeqEncType    : %04x\n", tcamData->frerSeqEncType));
-    MSG(("frerSeqRcvyEn     : %04x\n", tcamData->frerSeqRcvyEn));
-    MSG(("frerSeqRcvyIndex  : %04x\n", tcamData->frerSeqRcvyIndex));
-    MSG(("frerIndvRcvyEn    : %04x\n", tcamData->frerIndvRcvyEn));
-    MSG(("frerIndvRcvyId    : %04x\n", tcamData->frerIndvRcvyId));
-    MSG(("flowMeterEn       : %04x\n", tcamData->flowMeterEn));
-    MSG(("flowMeterId       : %04x\n", tcamData->flowMeterId));
-    MSG(("tsDomain          : %04x\n", tcamData->tsDomain));
-    MSG(("tsFormat          : %04x\n", tcamData->tsFormat));
-    MSG(("depTsEn           : %04x\n", tcamData->depTsEn));
-    MSG(("arrTsEn           : %04x\n", tcamData->arrTsEn));
-    MSG(("streamFilterEn    : %04x\n", tcamData->streamFilterEn));
-    MSG(("streamFilterId    : %04x\n", tcamData->streamFilterId));
-}
+		msdMemSet((void*)seen, 0, sizeof(seen));
+		start = FIR_TCAM_SHADOW_EGR_START;
+		first = MSD_TRUE;
+		while (retVal == MSD_OK)
+		{
+			msdMemSet((void*)&egrOpData, 0, sizeof(egrOpData));
+			egrOpData.port = hwPort;
+			egrOpData.tcamEntry = start;
+			retVal = Fir_tcamEgrHwOperationPerform(dev, Fir_TCAM_GET_NEXT_ENTRY, &egrOpData);
+			if (retVal != MSD_OK)
+			{
+				break;
+			}
 
-static MSD_BOOL checkEntry2Used(const FIR_MSD_TCAM_DATA *tcamData2)
-{
-    MSD_BOOL retVal = MSD_FALSE;
-    MSD_16 i;
+			entry = egrOpData.tcamEntry & FIR_TCAM_SHADOW_EGR_START;
+			if ((first == MSD_FALSE) && (entry <= start))
+			{
+				break;
+			}
+			first = MSD_FALSE;
+			seen[entry / 8U] |= (MSD_U8)(1U << (entry % 8U));
 
-    for (i = 0; i < 48; i++)
-    {
-		if (tcamData2->frameOctetMask[i] != (MSD_U8)0)
-        {
-			retVal = MSD_TRUE;
-            break;
-        }
-    }
-	return retVal;
-}
-static void mappingTcpOverIpv4ToTcam(FIR_MSD_TCAM_DATA *tcamData, FIR_MSD_TCAM_DATA *tcamData2, const MSD_TCAM_ENT_TCP_UNT *pTcpData, const MSD_TCAM_ENT_TCP_UNT *pTcpMask)
-{
-	tcamData->frameOctet[38] = (MSD_U8)((MSD_U16)(pTcpData->srcPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[39] = (MSD_U8)(pTcpData->srcPort & (MSD_U16)0xff);
-	tcamData->frameOctet[40] = (MSD_U8)((MSD_U16)(pTcpData->destPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[41] = (MSD_U8)(pTcpData->destPort & (MSD_U16)0xff);
-	tcamData->frameOctet[42] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 24) & (MSD_U32)0xff);
-	tcamData->frameOctet[43] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 16) & (MSD_U32)0xff);
-	tcamData->frameOctet[44] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 8) & (MSD_U32)0xff);
-	tcamData->frameOctet[45] = (MSD_U8)(pTcpData->seqNum & (MSD_U32)0xff);
-	tcamData->frameOctet[46] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 24) & (MSD_U32)0xff);
-	tcamData->frameOctet[47] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 16) & (MSD_U32)0xff);
-	tcamData2->frameOctet[0] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 8) & (MSD_U32)0xff);
-	tcamData2->frameOctet[1] = (MSD_U8)(pTcpData->ackNum & (MSD_U32)0xff);
-	tcamData2->frameOctet[2] = (MSD_U8)(pTcpData->offset << 4);
-	tcamData2->frameOctet[3] = (MSD_U8)((pTcpData->flags) & (MSD_U16)0x3f);
-	tcamData2->frameOctet[4] = (MSD_U8)((MSD_U16)(pTcpData->windowSize >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[5] = (MSD_U8)((pTcpData->windowSize) & (MSD_U16)0xff);
-	tcamData2->frameOctet[6] = (MSD_U8)((MSD_U16)(pTcpData->chkSum >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[7] = (MSD_U8)((MSD_U16)pTcpData->chkSum & (MSD_U16)0xff);
-	tcamData2->frameOctet[8] = (MSD_U8)((MSD_U16)(pTcpData->urgPtr >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[9] = (MSD_U8)(pTcpData->urgPtr & (MSD_U16)0xff);
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			if (update == MSD_TRUE)
+			{
+				msdMemCpy((void*)shadow->egrPage[hwPort][entry], (const void*)egrOpData.tcamDataP.frame, sizeof(egrOpData.tcamDataP.frame));
+			}
+			else
+			{
+				for (i = 0; i < 4U; i++)
+				{
+					if (shadow->egrPage[hwPort][entry][i] != egrOpData.tcamDataP.frame[i])
+					{
+						count++;
+						break;
+					}
+				}
+			}
+			msdSemGive(dev->devNum, dev->tblRegsSem);
 
-	tcamData->frameOctetMask[38] = (MSD_U8)((MSD_U16)(pTcpMask->srcPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[39] = (MSD_U8)(pTcpMask->srcPort & (MSD_U16)0xff);
-	tcamData->frameOctetMask[40] = (MSD_U8)((MSD_U16)(pTcpMask->destPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[41] = (MSD_U8)(pTcpMask->destPort & (MSD_U16)0xff);
-	tcamData->frameOctetMask[42] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 24) & (MSD_U32)0xff);
-	tcamData->frameOctetMask[43] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 16) & (MSD_U32)0xff);
-	tcamData->frameOctetMask[44] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 8) & (MSD_U32)0xff);
-	tcamData->frameOctetMask[45] = (MSD_U8)(pTcpMask->seqNum & (MSD_U32)0xff);
-    tcamData->frameOctetMask[46] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 24) & (MSD_U32)0xff);
-    tcamData->frameOctetMask[47] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 16) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[0] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 8) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[1] = (MSD_U8)((pTcpMask->ackNum) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[2] = (MSD_U8)(pTcpMask->offset << 4);
-	tcamData2->frameOctetMask[3] = (MSD_U8)((pTcpMask->flags) & (MSD_U16)0x3f);
-	tcamData2->frameOctetMask[4] = (MSD_U8)((MSD_U16)(pTcpMask->windowSize >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[5] = (MSD_U8)((pTcpMask->windowSize) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[6] = (MSD_U8)((MSD_U16)(pTcpMask->chkSum >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[7] = (MSD_U8)((pTcpMask->chkSum) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[8] = (MSD_U8)((MSD_U16)(pTcpMask->urgPtr >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[9] = (MSD_U8)((pTcpMask->urgPtr) & (MSD_U16)0xff);
-}
-static void mappingTcpOverIpv6ToTcam(FIR_MSD_TCAM_DATA *tcamData2, const MSD_TCAM_ENT_TCP_UNT *pTcpData, const MSD_TCAM_ENT_TCP_UNT *pTcpMask)
-{
-	tcamData2->frameOctet[10] = (MSD_U8)((MSD_U16)(pTcpData->srcPort >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[11] = (MSD_U8)(pTcpData->srcPort & (MSD_U16)0xff);
-	tcamData2->frameOctet[12] = (MSD_U8)((MSD_U16)(pTcpData->destPort >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[13] = (MSD_U8)(pTcpData->destPort & (MSD_U16)0xff);
-    tcamData2->frameOctet[14] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 24) & (MSD_U32)0xff);
-    tcamData2->frameOctet[15] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 16) & (MSD_U32)0xff);
-	tcamData2->frameOctet[16] = (MSD_U8)((MSD_U32)(pTcpData->seqNum >> 8) & (MSD_U32)0xff);
-	tcamData2->frameOctet[17] = (MSD_U8)(pTcpData->seqNum & (MSD_U32)0xff);
-	tcamData2->frameOctet[18] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 24) & (MSD_U32)0xff);
-	tcamData2->frameOctet[19] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 16) & (MSD_U32)0xff);
-	tcamData2->frameOctet[20] = (MSD_U8)((MSD_U32)(pTcpData->ackNum >> 8) & (MSD_U32)0xff);
-	tcamData2->frameOctet[21] = (MSD_U8)(pTcpData->ackNum & (MSD_U32)0xff);
-	tcamData2->frameOctet[22] = (MSD_U8)(pTcpData->offset << 4);
-	tcamData2->frameOctet[23] = (MSD_U8)((pTcpData->flags) & (MSD_U16)0x3f);
-	tcamData2->frameOctet[24] = (MSD_U8)((MSD_U16)(pTcpData->windowSize >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[25] = (MSD_U8)(pTcpData->windowSize & (MSD_U16)0xff);
-	tcamData2->frameOctet[26] = (MSD_U8)((MSD_U16)(pTcpData->chkSum >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[27] = (MSD_U8)(pTcpData->chkSum & (MSD_U16)0xff);
-	tcamData2->frameOctet[28] = (MSD_U8)((MSD_U16)(pTcpData->urgPtr >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctet[29] = (MSD_U8)(pTcpData->urgPtr & (MSD_U16)0xff);
+			if (entry == FIR_TCAM_SHADOW_EGR_START)
+			{
+				break;
+			}
+			start = entry;
+		}
+		if (retVal == MSD_NO_SUCH)
+		{
+			retVal = MSD_OK;
+		}
 
-	tcamData2->frameOctetMask[10] = (MSD_U8)((MSD_U16)(pTcpMask->srcPort >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[11] = (MSD_U8)(pTcpMask->srcPort & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[12] = (MSD_U8)((MSD_U16)(pTcpMask->destPort >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[13] = (MSD_U8)(pTcpMask->destPort & (MSD_U16)0xff);
-    tcamData2->frameOctetMask[14] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 24) & (MSD_U32)0xff);
-    tcamData2->frameOctetMask[15] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 16) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[16] = (MSD_U8)((MSD_U32)(pTcpMask->seqNum >> 8) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[17] = (MSD_U8)(pTcpMask->seqNum & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[18] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 24) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[19] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 16) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[20] = (MSD_U8)((MSD_U32)(pTcpMask->ackNum >> 8) & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[21] = (MSD_U8)(pTcpMask->ackNum & (MSD_U32)0xff);
-	tcamData2->frameOctetMask[22] = (MSD_U8)(pTcpMask->offset << 4);
-	tcamData2->frameOctetMask[23] = (MSD_U8)(pTcpMask->flags & (MSD_U16)0x3f);
-	tcamData2->frameOctetMask[24] = (MSD_U8)((MSD_U16)(pTcpMask->windowSize >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[25] = (MSD_U8)(pTcpMask->windowSize & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[26] = (MSD_U8)((MSD_U16)(pTcpMask->chkSum >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[27] = (MSD_U8)(pTcpMask->chkSum & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[28] = (MSD_U8)((MSD_U16)(pTcpMask->urgPtr >> 8) & (MSD_U16)0xff);
-	tcamData2->frameOctetMask[29] = (MSD_U8)(pTcpMask->urgPtr & (MSD_U16)0xff);
+		if (retVal == MSD_OK)
+		{
+			msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+			for (entry = 0; entry < FIR_MAX_EGR_TCAM_ENTRY; entry++)
+			{
+				if ((seen[entry / 8U] & (MSD_U8)(1U << (entry % 8U))) != 0U)
+				{
+					continue;
+				}
+				if (update == MSD_TRUE)
+				{
+					msdMemSet((void*)shadow->egrPage[hwPort][entry], 0, sizeof(shadow->egrPage[hwPort][entry]));
+				}
+				else if (Fir_tcamShadowEgrValid(shadow, hwPort, entry) == MSD_TRUE)
+				{
+					count++;
+				}
+				else
+				{
+					/* Both invalid */
+				}
+			}
+			msdSemGive(dev->devNum, dev->tblRegsSem);
+		}
+	}
+
+	if ((retVal == MSD_OK) && (mismatch != NULL))
+	{
+		*mismatch = count;
+	}
+
+	return retVal;
 }
-static void mappingIpv6ToTcam(FIR_MSD_TCAM_DATA *tcamData, FIR_MSD_TCAM_DATA *tcamData2, const MSD_TCAM_ENT_IPV6_UNT *pIpv6, const MSD_TCAM_ENT_IPV6_UNT *pIpv6Mask)
+
+static void Fir_tcamRmuAdd(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 opCode, MSD_U8 regAddr, MSD_U16 data)
 {
-    MSD_32 i;
-    MSD_U16 data;
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_TCAM_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
 
-    /*Data for tcamData*/
-	data = (MSD_U16)((MSD_U16)pIpv6->version << 12) | (MSD_U16)((MSD_U16)pIpv6->tc << 4) | (MSD_U16)(pIpv6->flowLbl >> 16);
-	tcamData->frameOctet[18] = (MSD_U8)((MSD_U16)(data >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[19] = (MSD_U8)(data & (MSD_U16)0xff);
-	tcamData->frameOctet[20] = (MSD_U8)((MSD_U32)(pIpv6->flowLbl >> 8) & (MSD_U32)0xff);
-	tcamData->frameOctet[21] = (MSD_U8)(pIpv6->flowLbl & (MSD_U32)0xff);
-	tcamData->frameOctet[22] = (MSD_U8)((MSD_U16)(pIpv6->payloadLen >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[23] = (MSD_U8)(pIpv6->payloadLen & (MSD_U16)0xff);
-    tcamData->frameOctet[24] = pIpv6->nextHdr;
-    tcamData->frameOctet[25] = pIpv6->hopLimit;
-    for (i = 0; i < 8; i++)
-    {
-		tcamData->frameOctet[26 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6->sip[i] >> 8) & (MSD_U16)0xff);
-		tcamData->frameOctet[26 + (2 * i) + 1] = (MSD_U8)((pIpv6->sip[i]) & (MSD_U16)0xff);
-    }
-    for (i = 0; i < 3; i++)
-    {
-		tcamData->frameOctet[42 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6->dip[i] >> 8) & (MSD_U16)0xff);
-		tcamData->frameOctet[42 + (2 * i) + 1] = (MSD_U8)((pIpv6->dip[i]) & (MSD_U16)0xff);
-    }
-    /*Data mask for tcamData*/
-	data = (MSD_U16)((MSD_U16)pIpv6Mask->version << 12) | (MSD_U16)((MSD_U16)pIpv6Mask->tc << 4) | (MSD_U16)(pIpv6Mask->flowLbl >> 16);
-	tcamData->frameOctetMask[18] = (MSD_U8)((MSD_U16)(data >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[19] = (MSD_U8)(data & (MSD_U16)0xff);
-	tcamData->frameOctetMask[20] = (MSD_U8)((MSD_U32)(pIpv6Mask->flowLbl >> 8) & (MSD_U32)0xff);
-	tcamData->frameOctetMask[21] = (MSD_U8)((pIpv6Mask->flowLbl) & (MSD_U32)0xff);
-	tcamData->frameOctetMask[22] = (MSD_U8)((MSD_U16)(pIpv6Mask->payloadLen >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[23] = (MSD_U8)(pIpv6Mask->payloadLen & (MSD_U16)0xff);
-    tcamData->frameOctetMask[24] = pIpv6Mask->nextHdr;
-    tcamData->frameOctetMask[25] = pIpv6Mask->hopLimit;
-    for (i = 0; i < 8; i++)
-    {
-		tcamData->frameOctetMask[26 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6Mask->sip[i] >> 8) & (MSD_U16)0xff);
-		tcamData->frameOctetMask[26 + (2 * i) + 1] = (MSD_U8)((pIpv6Mask->sip[i]) & (MSD_U16)0xff);
-    }
-    for (i = 0; i < 3; i++)
-    {
-		tcamData->frameOctetMask[42 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6Mask->dip[i] >> 8) & (MSD_U16)0xff);
-		tcamData->frameOctetMask[42 + (2 * i) + 1] = (MSD_U8)((pIpv6Mask->dip[i]) & (MSD_U16)0xff);
-    }
+/* Wait until the busy bit of the TCAM operation register clears */
+static void Fir_tcamRmuAddWait(MSD_RegCmd *regCmd, MSD_U32 *nCmd)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_TCAM_DEV_ADDR;
+	regCmd[*nCmd].regAddr = FIR_TCAM_OPERATION;
+	regCmd[*nCmd].data = 15U;
+	*nCmd += 1U;
+}
 
-    for (i = 0; i < 5; i++)
-    {
-		tcamData2->frameOctet[0 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6->dip[3 + i] >> 8) & (MSD_U16)0xff);
-		tcamData2->frameOctet[0 + (2 * i) + 1] = (MSD_U8)((pIpv6->dip[3 + i]) & (MSD_U16)0xff);
-		tcamData2->frameOctetMask[0 + (2 * i)] = (MSD_U8)((MSD_U16)(pIpv6Mask->dip[3 + i] >> 8) & (MSD_U16)0xff);
-		tcamData2->frameOctetMask[0 + (2 * i) + 1] = (MSD_U8)((pIpv6Mask->dip[3 + i]) & (MSD_U16)0xff);
-    }
+/*
+ * Read all pages of one ingress entry in a single RMU register frame, the
+ * same sequence as the READ operation. Called with tblRegsSem held.
+ */
+static MSD_STATUS Fir_tcamRmuReadEntry(MSD_QD_DEV *dev, FIR_MSD_TCAM_OP_DATA *opData)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 nCmd = 0;
+	MSD_U32 first[3];
+	MSD_U32 page;
+	MSD_U32 reg;
+	MSD_U16 *frame;
+
+	Fir_tcamRmuAddWait(regCmd, &nCmd);
+	for (page = 0; page < 3U; page++)
+	{
+		if (page == 2U)
+		{
+			/*Access Ingress Actions from TCAM Frame matches */
+			Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, 0);
+		}
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION,
+			(MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_READ_ENTRY << 12) | (MSD_U16)((MSD_U16)page << 10) | (MSD_U16)opData->tcamEntry));
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
+		first[page] = nCmd;
+		for (reg = 0; reg < FIR_TCAM_SHADOW_PAGE_REGS; reg++)
+		{
+			if (Fir_tcamShadowRegUsed(page, reg) == MSD_TRUE)
+			{
+				Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, (MSD_U8)(reg + 2U), 0);
+			}
+		}
+	}
+
+	retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+	if (retVal == MSD_OK)
+	{
+		msdMemSet((void*)&opData->tcamDataP, 0, sizeof(opData->tcamDataP));
+		for (page = 0; page < 3U; page++)
+		{
+			frame = Fir_tcamShadowHwPage(&opData->tcamDataP, page);
+			nCmd = first[page];
+			for (reg = 0; reg < FIR_TCAM_SHADOW_PAGE_REGS; reg++)
+			{
+				if (Fir_tcamShadowRegUsed(page, reg) == MSD_TRUE)
+				{
+					frame[reg] = regCmd[nCmd].data;
+					nCmd++;
+				}
+			}
+		}
+	}
+
+	return retVal;
 }
-static void mappingIpv4ToTcam(FIR_MSD_TCAM_DATA *tcamData, const MSD_TCAM_ENT_IPV4_UNT *pIpv4Data, const MSD_TCAM_ENT_IPV4_UNT *pIpv4Mask)
+
+/*
+ * READ and GET_NEXT of an ingress entry over RMU register frames: one frame
+ * for the read, one more frame to find the next entry. Called with
+ * tblRegsSem held.
+ */
+static MSD_STATUS Fir_tcamRmuReadPerform(MSD_QD_DEV *dev, FIR_MSD_TCAM_OPERATION tcamOp, FIR_MSD_TCAM_OP_DATA *opData)
 {
-    MSD_32 i;
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmd[5];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 nCmd = 0;
 
-	tcamData->frameOctet[18] = (MSD_U8)(pIpv4Data->version << 4) | pIpv4Data->ihl;
-    tcamData->frameOctet[19] = pIpv4Data->tos;
-	tcamData->frameOctet[20] = (MSD_U8)((MSD_U16)(pIpv4Data->length >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[21] = (MSD_U8)(pIpv4Data->length & (MSD_U16)0xff);
-	tcamData->frameOctet[22] = (MSD_U8)((MSD_U16)(pIpv4Data->id >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[23] = (MSD_U8)(pIpv4Data->id & (MSD_U16)0xff);
-	tcamData->frameOctet[24] = (MSD_U8)((MSD_U16)(((MSD_U16)((MSD_U16)pIpv4Data->flag << 13) | pIpv4Data->fragOffset) >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[25] = (MSD_U8)(((MSD_U16)((MSD_U16)pIpv4Data->flag << 13) | pIpv4Data->fragOffset) & (MSD_U16)0xff);
-    tcamData->frameOctet[26] = pIpv4Data->ttl;
-    tcamData->frameOctet[27] = pIpv4Data->protocol;
-	tcamData->frameOctet[28] = (MSD_U8)((MSD_U16)(pIpv4Data->hdrChkSum >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[29] = (MSD_U8)((pIpv4Data->hdrChkSum) & (MSD_U16)0xff);
-    for (i = 0; i < 4; i++)
-    {
-        tcamData->frameOctet[30 + i] = pIpv4Data->sip[i];
-        tcamData->frameOctet[34 + i] = pIpv4Data->dip[i];
-    }
+	if (tcamOp == Fir_TCAM_GET_NEXT_ENTRY)
+	{
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION,
+			(MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_GET_NEXT_ENTRY << 12) | (MSD_U16)opData->tcamEntry));
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_OPERATION, 0);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_P0_KEYS_1, 0);
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal == MSD_OK)
+		{
+			if (((regCmd[3].data & (MSD_U16)0x1ff) == (MSD_U16)0x1ff) && (regCmd[4].data == (MSD_U16)0x00ff))
+			{
+				/* No higher valid TCAM entry */
+				retVal = MSD_NO_SUCH;
+			}
+			else
+			{
+				opData->tcamEntry = (MSD_U32)(regCmd[3].data & (MSD_U32)0x1ff);
+			}
+		}
+	}
 
-	tcamData->frameOctetMask[18] = (MSD_U8)(pIpv4Mask->version << 4) | pIpv4Mask->ihl;
-    tcamData->frameOctetMask[19] = pIpv4Mask->tos;
-	tcamData->frameOctetMask[20] = (MSD_U8)((MSD_U16)(pIpv4Mask->length >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[21] = (MSD_U8)(pIpv4Mask->length & (MSD_U16)0xff);
-	tcamData->frameOctetMask[22] = (MSD_U8)((MSD_U16)(pIpv4Mask->id >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[23] = (MSD_U8)(pIpv4Mask->id & (MSD_U16)0xff);
-	tcamData->frameOctetMask[24] = (MSD_U8)((MSD_U16)(((MSD_U16)((MSD_U16)pIpv4Mask->flag << 13) | pIpv4Mask->fragOffset) >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[25] = (MSD_U8)(((MSD_U16)((MSD_U16)pIpv4Mask->flag << 13) | pIpv4Mask->fragOffset) & (MSD_U16)0xff);
-    tcamData->frameOctetMask[26] = pIpv4Mask->ttl;
-    tcamData->frameOctetMask[27] = pIpv4Mask->protocol;
-	tcamData->frameOctetMask[28] = (MSD_U8)((MSD_U16)(pIpv4Mask->hdrChkSum >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[29] = (MSD_U8)(pIpv4Mask->hdrChkSum & (MSD_U16)0xff);
-    for (i = 0; i < 4; i++)
-    {
-        tcamData->frameOctetMask[30 + i] = pIpv4Mask->sip[i];
-        tcamData->frameOctetMask[34 + i] = pIpv4Mask->dip[i];
-    }
+	if (retVal == MSD_OK)
+	{
+		retVal = Fir_tcamRmuReadEntry(dev, opData);
+	}
+
+	return retVal;
 }
-static void mappingUdpToTcam(MSD_16 startIndex, FIR_MSD_TCAM_DATA *tcamData, const MSD_TCAM_ENT_UDP_UNT *pUdpData, const MSD_TCAM_ENT_UDP_UNT *pUdpMask)
+
+/*
+ * READ and GET_NEXT of an egress entry over RMU register frames. Called with
+ * tblRegsSem held.
+ */
+static MSD_STATUS Fir_tcamEgrRmuReadPerform(MSD_QD_DEV *dev, FIR_MSD_TCAM_OPERATION tcamOp, FIR_MSD_TCAM_EGR_OP_DATA *opData)
 {
-	tcamData->frameOctet[startIndex + 0] = (MSD_U8)((MSD_U16)(pUdpData->srcPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[startIndex + 1] = (MSD_U8)(pUdpData->srcPort & (MSD_U16)0xff);
-	tcamData->frameOctet[startIndex + 2] = (MSD_U8)((MSD_U16)(pUdpData->destPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[startIndex + 3] = (MSD_U8)(pUdpData->destPort & (MSD_U16)0xff);
-	tcamData->frameOctet[startIndex + 4] = (MSD_U8)((MSD_U16)(pUdpData->length >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[startIndex + 5] = (MSD_U8)(pUdpData->length & (MSD_U16)0xff);
-	tcamData->frameOctet[startIndex + 6] = (MSD_U8)((MSD_U16)(pUdpData->chkSum >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctet[startIndex + 7] = (MSD_U8)(pUdpData->chkSum & (MSD_U16)0xff);
+	MSD_STATUS retVal = MSD_OK;
+	MSD_RegCmd regCmd[10];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 nCmd = 0;
+	MSD_U32 reg;
+	MSD_U16 data;
+
+	if (tcamOp == Fir_TCAM_GET_NEXT_ENTRY)
+	{
+		data = (MSD_U16)((MSD_U16)((MSD_U16)Fir_TCAM_GET_NEXT_ENTRY << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry);
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
+		/*Access Egress Actions from Egress Action Pointer */
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, (MSD_U16)(opData->port & (MSD_U8)0x1f));
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION, data);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION, (MSD_U16)(data | (MSD_U16)0x8000));
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_OPERATION, 0);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_EGR_ACTION_1, 0);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_EGR_ACTION_2, 0);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_EGR_ACTION_3, 0);
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal == MSD_OK)
+		{
+			if (((regCmd[5].data & (MSD_U16)0x3f) == (MSD_U16)0x3f) &&
+				(regCmd[6].data == 0U) && (regCmd[7].data == 0U) && (regCmd[8].data == 0U))
+			{
+				/* No higher valid TCAM entry */
+				retVal = MSD_NO_SUCH;
+			}
+			else
+			{
+				opData->tcamEntry = (MSD_U32)(regCmd[5].data & (MSD_U32)0xff);
+			}
+		}
+	}
 
-	tcamData->frameOctetMask[startIndex + 0] = (MSD_U8)((MSD_U16)(pUdpMask->srcPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[startIndex + 1] = (MSD_U8)(pUdpMask->srcPort & (MSD_U16)0xff);
-	tcamData->frameOctetMask[startIndex + 2] = (MSD_U8)((MSD_U16)(pUdpMask->destPort >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[startIndex + 3] = (MSD_U8)(pUdpMask->destPort & (MSD_U16)0xff);
-	tcamData->frameOctetMask[startIndex + 4] = (MSD_U8)((MSD_U16)(pUdpMask->length >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[startIndex + 5] = (MSD_U8)(pUdpMask->length & (MSD_U16)0xff);
-	tcamData->frameOctetMask[startIndex + 6] = (MSD_U8)((MSD_U16)(pUdpMask->chkSum >> 8) & (MSD_U16)0xff);
-	tcamData->frameOctetMask[startIndex + 7] = (MSD_U8)(pUdpMask->chkSum & (MSD_U16)0xff);
+	if (retVal == MSD_OK)
+	{
+		nCmd = 0;
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, (MSD_U16)(opData->port & (MSD_U8)0x1f));
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION,
+			(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_TCAM_READ_ENTRY << 12) | (MSD_U16)((MSD_U16)3 << 10) | (MSD_U16)opData->tcamEntry));
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
+		for (reg = 0; reg < 4U; reg++)
+		{
+			Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, (MSD_U8)(reg + 2U), 0);
+		}
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal == MSD_OK)
+		{
+			for (reg = 0; reg < 4U; reg++)
+			{
+				opData->tcamDataP.frame[reg] = regCmd[4U + reg].data;
+			}
+		}
+	}
+
+	return retVal;
 }
-static void mappingActionToTcam(FIR_MSD_TCAM_DATA *tcamData, const FIR_MSD_TCAM_ENT_ACT *actionPtr)
+
+static void Fir_tcamShadowPutIgr(FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
 {
-    tcamData->interrupt = actionPtr->interrupt;
-    tcamData->IncTcamCtr = actionPtr->IncTcamCtr;
-    tcamData->vidOverride = actionPtr->vidOverride;
-    tcamData->vidData = actionPtr->vidData;
-    tcamData->qpriOverride = actionPtr->qpriOverride;
-    tcamData->qpriData = actionPtr->qpriData;
-    tcamData->fpriOverride = actionPtr->fpriOverride;
-    tcamData->fpriData = actionPtr->fpriData;
-    tcamData->dpvSF = actionPtr->dpvSF;
-    tcamData->dpvData = actionPtr->dpvData;
-    tcamData->dpvMode = actionPtr->dpvMode;
-    tcamData->colorMode = actionPtr->colorMode;
-    tcamData->vtuPageOverride = actionPtr->vtuPageOverride;
-    tcamData->vtuPage = actionPtr->vtuPage;
-    tcamData->unKnownFilter = actionPtr->unKnownFilter;
-    tcamData->egActPoint = actionPtr->egActPoint;
-    tcamData->ldBalanceOverride = actionPtr->ldBalanceOverride;
-    tcamData->ldBalanceData = actionPtr->ldBalanceData;
-	tcamData->tcamTunnel = 0; /* reserved */
-	tcamData->ipMulticast = actionPtr->ipMulticast;
-	tcamData->ip2me = actionPtr->ip2me;
-	tcamData->routeEntry = actionPtr->routeEntry;
-    tcamData->DSCPOverride = actionPtr->DSCPOverride;
-    tcamData->DSCP = actionPtr->DSCP;
-    tcamData->factionOverride = actionPtr->factionOverride;
-    tcamData->factionData = actionPtr->factionData;
-    
-    tcamData->frerSctrInc = actionPtr->frerSctrInc;
-    tcamData->frerSctrIndex = actionPtr->frerSctrIndex;
-    tcamData->frerStreamSplitEn = actionPtr->frerStreamSplitEn;
-    tcamData->frerSeqGenEn = actionPtr->frerSeqGenEn;
-    tcamData->frerSeqEncType = actionPtr->frerSeqEncType;
-    tcamData->frerSeqRcvyEn = actionPtr->frerSeqRcvyEn;
-    tcamData->frerSeqRcvyIndex = actionPtr->frerSeqRcvyIndex;
-    tcamData->frerIndvRcvyEn = actionPtr->frerIndvRcvyEn;
-    tcamData->frerIndvRcvyId = actionPtr->frerIndvRcvyId;
-    tcamData->flowMeterEn = actionPtr->flowMeterEn;
-    tcamData->flowMeterId = actionPtr->flowMeterId;
-    tcamData->tsDomain = actionPtr->tsDomain;
-    tcamData->tsFormat = actionPtr->tsFormat;
-    tcamData->depTsEn = actionPtr->depTsEn;
-    tcamData->arrTsEn = actionPtr->arrTsEn;
-    tcamData->streamFilterEn = actionPtr->streamFilterEn;
-    tcamData->streamFilterId = actionPtr->streamFilterId;
-	tcamData->tcamCtr = actionPtr->tcamCtr;
+	MSD_U32 reg;
+
+	msdMemCpy((void*)shadow->igrPage[entry][0], (const void*)tcamDataPtr->pg0.frame, sizeof(tcamDataPtr->pg0.frame));
+	msdMemCpy((void*)shadow->igrPage[entry][1], (const void*)tcamDataPtr->pg1.frame, sizeof(tcamDataPtr->pg1.frame));
+	for (reg = 0; reg < FIR_TCAM_SHADOW_PAGE_REGS; reg++)
+	{
+		shadow->igrPage[entry][2][reg] = (Fir_tcamShadowRegUsed(2U, reg) == MSD_TRUE) ? tcamDataPtr->pg2.frame[reg] : (MSD_U16)0;
+	}
 }
-static MSD_STATUS Fir_setTcamExtensionReg(const MSD_QD_DEV *dev, MSD_U8 block, MSD_U8 port)
+
+static MSD_BOOL Fir_tcamShadowIgrEqual(const FIR_MSD_TCAM_SHADOW *shadow, MSD_U32 entry, const FIR_MSD_TCAM_DATA_HW *tcamDataPtr)
 {
-	MSD_STATUS       retVal;    /* Functions return value */
-	MSD_U16  tmpData = 0;
+	MSD_U32 reg;
+	MSD_BOOL equal = MSD_TRUE;
 
-	tmpData = (MSD_U16)((MSD_U16)(((MSD_U16)block & (MSD_U16)0xF) << 12) | (port & (MSD_U16)0x1F));
+	for (reg = 0; reg < FIR_TCAM_SHADOW_PAGE_REGS; reg++)
+	{
+		if ((shadow->igrPage[entry][0][reg] != tcamDataPtr->pg0.frame[reg]) ||
+			(shadow->igrPage[entry][1][reg] != tcamDataPtr->pg1.frame[reg]) ||
+			((Fir_tcamShadowRegUsed(2U, reg) == MSD_TRUE) && (shadow->igrPage[entry][2][reg] != tcamDataPtr->pg2.frame[reg])))
+		{
+			equal = MSD_FALSE;
+		}
+	}
 
-	retVal = msdSetAnyReg(dev->devNum, FIR_TCAM_DEV_ADDR, (MSD_U8)1, tmpData);
-	if (retVal != MSD_OK)
+	return equal;
+}
+
+/*
+ * Load all pages of one ingress entry in a single RMU register frame, the
+ * same sequence as the LOAD operation. Called with tblRegsSem held.
+ */
+static MSD_STATUS Fir_tcamRmuLoadEntry(MSD_QD_DEV *dev, FIR_MSD_TCAM_OP_DATA *opData)
+{
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 nCmd = 0;
+	MSD_U32 page;
+	MSD_U32 reg;
+	MSD_U16 *frame;
+
+	Fir_tcamRmuAddWait(regCmd, &nCmd);
+	for (page = 3U; page > 0U; page--)
 	{
-		MSD_DBG_ERROR(("Fir_setTcamExtensionReg returned: %s.\n", msdDisplayStatus(retVal)));
+		if (page == 3U)
+		{
+			/*Access Ingress Actions from TCAM Frame matches */
+			Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, 0);
+		}
+		frame = Fir_tcamShadowHwPage(&opData->tcamDataP, page - 1U);
+		for (reg = 0; reg < FIR_TCAM_SHADOW_PAGE_REGS; reg++)
+		{
+			if (Fir_tcamShadowRegUsed(page - 1U, reg) == MSD_TRUE)
+			{
+				Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)(reg + 2U), frame[reg]);
+			}
+		}
+		Fir_tcamRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION,
+			(MSD_U16)((MSD_U16)((MSD_U16)1 << 15) | (MSD_U16)((MSD_U16)Fir_TCAM_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)(page - 1U) << 10) | (MSD_U16)opData->tcamEntry));
+		Fir_tcamRmuAddWait(regCmd, &nCmd);
 	}
 
-	return retVal;
-}
\ No newline at end of file
+	return Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+}
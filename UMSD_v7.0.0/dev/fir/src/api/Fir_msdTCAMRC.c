@@ -24,6 +24,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 /****************************************************************************/
 /* Internal TCAM structure declaration.                                    */
@@ -58,6 +59,11 @@ typedef enum
 	Fir_TCAMRC_READ_ENTRY = 0x5
 } FIR_MSD_TCAM_RC_OPERATION;
 
+/* RMU commands of one entry LOAD or READ, and the entries that fit in a frame
+ * together with the leading wait and the trailing Block reset */
+#define FIR_TCAMRC_RMU_ENTRY_CMDS    21U
+#define FIR_TCAMRC_RMU_MAX_ENTRIES   ((MSD_RMU_MAX_REGCMDS - 2U) / FIR_TCAMRC_RMU_ENTRY_CMDS)
+
 /****************************************************************************/
 /* TCAM operation function declaration.                                    */
 /****************************************************************************/
@@ -84,6 +90,11 @@ INOUT FIR_MSD_TCAM_RC_OP_DATA     *opData
 );
 static void displayTcamRCData(FIR_MSD_TCAM_RC_DATA *tcamData);
 static MSD_STATUS Fir_setTcamExtensionReg(const MSD_QD_DEV *dev, MSD_U8 Block, MSD_U8 Port);
+static void Fir_tcamRCRmuAdd(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 opCode, MSD_U8 regAddr, MSD_U16 data);
+static void Fir_tcamRCRmuAddWait(MSD_RegCmd *regCmd, MSD_U32 *nCmd);
+static void Fir_tcamRCRmuAddLoad(MSD_RegCmd *regCmd, MSD_U32 *nCmd, const FIR_MSD_TCAM_RC_OP_DATA *opData);
+static void Fir_tcamRCRmuAddRead(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U32 rcEntryNum);
+static void Fir_tcamRCRmuGetRead(const MSD_RegCmd *regCmd, MSD_U32 first, FIR_MSD_TCAM_RC_DATA_HW *tcamDataPtr);
 
 /*******************************************************************************
 * Fir_gtcamRCFlushAllEntry
@@ -478,6 +489,415 @@ OUT	MSD_BOOL		  *found
 	return retVal;
 }
 
+/*******************************************************************************
+* Fir_gtcamRCLoadEntries
+*
+* DESCRIPTION:
+*       This routine loads an array of TCAM Range Check entries. Over RMU the
+*       register sequences of several entries are sent in one frame, otherwise
+*       each entry is loaded as by Fir_gtcamRCLoadEntry.
+*
+* INPUTS:
+*       numEntries - number of entries
+*       entries    - entry numbers and Range Check data, loaded in array order
+*
+* OUTPUTS:
+*       entryStatus - load status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are loaded
+*       MSD_FAIL    - if any entry failed, see entryStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCLoadEntries
+(
+IN  MSD_QD_DEV  *dev,
+IN  MSD_U32     numEntries,
+IN  const FIR_MSD_TCAM_RC_ENTRY *entries,
+OUT MSD_STATUS  *entryStatus
+)
+{
+	MSD_STATUS           retVal = MSD_OK;
+	MSD_STATUS           frameStatus;
+	FIR_MSD_TCAM_RC_DATA rcData;
+	FIR_MSD_TCAM_RC_OP_DATA     tcamrcOpData;
+	MSD_RegCmd           regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd           *pRegCmd = &(regCmd[0]);
+	MSD_U32              index[FIR_TCAMRC_RMU_MAX_ENTRIES];
+	MSD_U32              nCmd;
+	MSD_U32              nBatch;
+	MSD_U32              i;
+	MSD_U32              k;
+
+	MSD_DBG_INFO(("Fir_gtcamRCLoadEntries Called.\n"));
+
+	if ((numEntries != 0U) && ((entries == NULL) || (entryStatus == NULL)))
+	{
+		MSD_DBG_ERROR(("Input param entries or entryStatus is NULL.\n"));
+		retVal = MSD_BAD_PARAM;
+	}
+	else if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; i < numEntries; i++)
+		{
+			rcData = entries[i].rcData;
+			entryStatus[i] = Fir_gtcamRCLoadEntry(dev, entries[i].rcEntryNum, &rcData);
+			if (entryStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+	else
+	{
+		i = 0;
+		while (i < numEntries)
+		{
+			nCmd = 0;
+			nBatch = 0;
+			Fir_tcamRCRmuAddWait(regCmd, &nCmd);
+			while ((i < numEntries) && (nBatch < FIR_TCAMRC_RMU_MAX_ENTRIES))
+			{
+				if (entries[i].rcEntryNum >= FIR_MAX_IGR_TCAM_ENTRY)
+				{
+					MSD_DBG_ERROR(("Bad rcEntryNum %u out of range.\n", entries[i].rcEntryNum));
+					entryStatus[i] = MSD_BAD_PARAM;
+				}
+				else
+				{
+					tcamrcOpData.tcamEntry = entries[i].rcEntryNum;
+					(void)Fir_setTcamRCHWData(&entries[i].rcData, &tcamrcOpData.tcamDataP);
+					Fir_tcamRCRmuAddLoad(regCmd, &nCmd, &tcamrcOpData);
+					index[nBatch] = i;
+					nBatch++;
+				}
+				i++;
+			}
+
+			if (nBatch != 0U)
+			{
+				/*Change Block to 0, in case other misoperation*/
+				Fir_tcamRCRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, 0);
+
+				msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+				frameStatus = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				if (frameStatus != MSD_OK)
+				{
+					MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(frameStatus)));
+				}
+				for (k = 0; k < nBatch; k++)
+				{
+					entryStatus[index[k]] = frameStatus;
+				}
+			}
+		}
+
+		for (i = 0; i < numEntries; i++)
+		{
+			if (entryStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+
+	MSD_DBG_INFO(("Fir_gtcamRCLoadEntries Exit.\n"));
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_gtcamRCReadEntries
+*
+* DESCRIPTION:
+*       This routine reads an array of TCAM Range Check entries. Over RMU the
+*       register sequences of several entries are sent in one frame, otherwise
+*       each entry is read as by Fir_gtcamRCReadEntry.
+*
+* INPUTS:
+*       numEntries - number of entries
+*       entries    - rcEntryNum of each entry to read
+*
+* OUTPUTS:
+*       entries     - rcData of each entry
+*       entryStatus - read status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are read
+*       MSD_FAIL    - if any entry failed, see entryStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCReadEntries
+(
+IN    MSD_QD_DEV  *dev,
+IN    MSD_U32     numEntries,
+INOUT FIR_MSD_TCAM_RC_ENTRY *entries,
+OUT   MSD_STATUS  *entryStatus
+)
+{
+	MSD_STATUS           retVal = MSD_OK;
+	MSD_STATUS           frameStatus;
+	FIR_MSD_TCAM_RC_OP_DATA     tcamrcOpData;
+	MSD_RegCmd           regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd           *pRegCmd = &(regCmd[0]);
+	MSD_U32              index[FIR_TCAMRC_RMU_MAX_ENTRIES];
+	MSD_U32              first[FIR_TCAMRC_RMU_MAX_ENTRIES];
+	MSD_U32              nCmd;
+	MSD_U32              nBatch;
+	MSD_U32              i;
+	MSD_U32              k;
+
+	MSD_DBG_INFO(("Fir_gtcamRCReadEntries Called.\n"));
+
+	if ((numEntries != 0U) && ((entries == NULL) || (entryStatus == NULL)))
+	{
+		MSD_DBG_ERROR(("Input param entries or entryStatus is NULL.\n"));
+		retVal = MSD_BAD_PARAM;
+	}
+	else if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; i < numEntries; i++)
+		{
+			entryStatus[i] = Fir_gtcamRCReadEntry(dev, entries[i].rcEntryNum, &entries[i].rcData);
+			if (entryStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+	else
+	{
+		i = 0;
+		while (i < numEntries)
+		{
+			nCmd = 0;
+			nBatch = 0;
+			Fir_tcamRCRmuAddWait(regCmd, &nCmd);
+			while ((i < numEntries) && (nBatch < FIR_TCAMRC_RMU_MAX_ENTRIES))
+			{
+				if (entries[i].rcEntryNum >= FIR_MAX_IGR_TCAM_ENTRY)
+				{
+					MSD_DBG_ERROR(("Bad rcEntryNum %u out of range.\n", entries[i].rcEntryNum));
+					entryStatus[i] = MSD_BAD_PARAM;
+				}
+				else
+				{
+					first[nBatch] = nCmd;
+					Fir_tcamRCRmuAddRead(regCmd, &nCmd, entries[i].rcEntryNum);
+					index[nBatch] = i;
+					nBatch++;
+				}
+				i++;
+			}
+
+			if (nBatch != 0U)
+			{
+				/*Change Block to 0, in case other misoperation*/
+				Fir_tcamRCRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, 0);
+
+				msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+				frameStatus = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				if (frameStatus != MSD_OK)
+				{
+					MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(frameStatus)));
+				}
+				for (k = 0; k < nBatch; k++)
+				{
+					entryStatus[index[k]] = frameStatus;
+					if (frameStatus == MSD_OK)
+					{
+						Fir_tcamRCRmuGetRead(regCmd, first[k], &tcamrcOpData.tcamDataP);
+						(void)Fir_getTcamRCHWData(&tcamrcOpData.tcamDataP, &entries[index[k]].rcData);
+					}
+				}
+			}
+		}
+
+		for (i = 0; i < numEntries; i++)
+		{
+			if (entryStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+
+	MSD_DBG_INFO(("Fir_gtcamRCReadEntries Exit.\n"));
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_gtcamRCGetNextEntries
+*
+* DESCRIPTION:
+*       This routine finds up to maxEntries valid TCAM Range Check entries with
+*       entry numbers higher than rcEntryNum and reads them. Over RMU the read
+*       of each entry found shares its frame with the search for the next one,
+*       so n entries take n + 1 frames.
+*
+* INPUTS:
+*       rcEntryNum - entry to search from, 0xFF to start from the lowest entry
+*       maxEntries - size of the entries array
+*
+* OUTPUTS:
+*       rcEntryNum - last entry found, to continue the search from
+*       entries    - entry numbers and Range Check data found
+*       numEntries - number of entries found
+*
+* RETURNS:
+*       MSD_OK      - on success
+*       MSD_NO_SUCH - no higher valid entry
+*       MSD_FAIL    - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       Fewer than maxEntries entries returned with MSD_OK do not mean the
+*       search is done; it is done when MSD_NO_SUCH is returned or the last
+*       entry found is 0xFF.
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCGetNextEntries
+(
+IN    MSD_QD_DEV  *dev,
+INOUT MSD_U32     *rcEntryNum,
+IN    MSD_U32     maxEntries,
+OUT   FIR_MSD_TCAM_RC_ENTRY *entries,
+OUT   MSD_U32     *numEntries
+)
+{
+	MSD_STATUS           retVal = MSD_OK;
+	FIR_MSD_TCAM_RC_OP_DATA     tcamrcOpData;
+	MSD_RegCmd           regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd           *pRegCmd = &(regCmd[0]);
+	MSD_U32              nCmd;
+	MSD_U32              first;
+	MSD_U32              opIndex = 0;
+	MSD_U32              entry = 0;
+	MSD_BOOL             found;
+	MSD_BOOL             search;
+
+	MSD_DBG_INFO(("Fir_gtcamRCGetNextEntries Called.\n"));
+
+	if ((rcEntryNum == NULL) || (entries == NULL) || (numEntries == NULL) || (maxEntries == 0U))
+	{
+		MSD_DBG_ERROR(("Input param is NULL or maxEntries is 0.\n"));
+		retVal = MSD_BAD_PARAM;
+	}
+	else if (*rcEntryNum >= FIR_MAX_IGR_TCAM_ENTRY)
+	{
+		MSD_DBG_ERROR(("Bad rcEntryNum value %u out of range.\n", *rcEntryNum));
+		retVal = MSD_BAD_PARAM;
+	}
+	else if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		*numEntries = 0;
+		entry = *rcEntryNum;
+		while ((retVal == MSD_OK) && (*numEntries < maxEntries))
+		{
+			retVal = Fir_gtcamRCGetNextEntry(dev, &entry, &entries[*numEntries].rcData);
+			if (retVal == MSD_OK)
+			{
+				entries[*numEntries].rcEntryNum = entry;
+				*numEntries += 1U;
+				*rcEntryNum = entry;
+				if ((entry & (MSD_U32)0xff) == (MSD_U32)0xff)
+				{
+					break;
+				}
+			}
+		}
+		if ((retVal == MSD_NO_SUCH) && (*numEntries != 0U))
+		{
+			retVal = MSD_OK;
+		}
+	}
+	else
+	{
+		*numEntries = 0;
+		found = MSD_FALSE;
+		search = MSD_TRUE;
+
+		msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+		while ((retVal == MSD_OK) && ((found == MSD_TRUE) || (search == MSD_TRUE)))
+		{
+			nCmd = 0;
+			Fir_tcamRCRmuAddWait(regCmd, &nCmd);
+			first = nCmd;
+			if (found == MSD_TRUE)
+			{
+				Fir_tcamRCRmuAddRead(regCmd, &nCmd, entry);
+				/* Stop at the highest entry or when the output is full */
+				if (((entry & (MSD_U32)0xff) == (MSD_U32)0xff) || ((*numEntries + 1U) >= maxEntries))
+				{
+					search = MSD_FALSE;
+				}
+			}
+			if (search == MSD_TRUE)
+			{
+				/*Change Block to 7, indicate Range Check Page */
+				Fir_tcamRCRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, (MSD_U16)((MSD_U16)7 << 12));
+				Fir_tcamRCRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION,
+					(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_TCAMRC_GET_NEXT_ENTRY << 12) | (MSD_U16)((MSD_U16)2 << 10) | (MSD_U16)((found == MSD_TRUE) ? entry : *rcEntryNum)));
+				Fir_tcamRCRmuAddWait(regCmd, &nCmd);
+				opIndex = nCmd;
+				Fir_tcamRCRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_OPERATION, 0);
+				Fir_tcamRCRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, FIR_TCAM_P0_KEYS_1, 0);
+			}
+			/*Change Block to 0, in case other misoperation*/
+			Fir_tcamRCRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, 0);
+
+			retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			if (retVal != MSD_OK)
+			{
+				MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+			}
+			else
+			{
+				if (found == MSD_TRUE)
+				{
+					Fir_tcamRCRmuGetRead(regCmd, first, &tcamrcOpData.tcamDataP);
+					(void)Fir_getTcamRCHWData(&tcamrcOpData.tcamDataP, &entries[*numEntries].rcData);
+					entries[*numEntries].rcEntryNum = entry;
+					*numEntries += 1U;
+					*rcEntryNum = entry;
+					found = MSD_FALSE;
+				}
+				if (search == MSD_TRUE)
+				{
+					if (((regCmd[opIndex].data & (MSD_U16)0xff) == (MSD_U16)0xff) && (regCmd[opIndex + 1U].data == (MSD_U16)0x00ff))
+					{
+						/* No higher valid TCAM entry */
+						search = MSD_FALSE;
+					}
+					else
+					{
+						entry = (MSD_U32)regCmd[opIndex].data & (MSD_U32)0xff;
+						found = MSD_TRUE;
+					}
+				}
+			}
+		}
+		msdSemGive(dev->devNum, dev->tblRegsSem);
+
+		if ((retVal == MSD_OK) && (*numEntries == 0U))
+		{
+			retVal = MSD_NO_SUCH;
+		}
+	}
+
+	MSD_DBG_INFO(("Fir_gtcamRCGetNextEntries Exit.\n"));
+	return retVal;
+}
+
 /*******************************************************************************
 * Fir_gtcamRCEntryDump
 *
@@ -507,16 +927,25 @@ IN  MSD_QD_DEV *dev
 {
 	MSD_STATUS status = MSD_OK;
 	MSD_U32    tcamPointer;
-	FIR_MSD_TCAM_RC_DATA  tcamData;
+	FIR_MSD_TCAM_RC_ENTRY  entries[FIR_TCAMRC_RMU_MAX_ENTRIES];
+	MSD_U32    numEntries = 0;
+	MSD_U32    i;
 
 	MSD_DBG_INFO(("Fir_gtcamDump Called.\n"));
 	tcamPointer = (MSD_U32)0xff;
 
 	while (status == MSD_OK)
 	{
-		status = Fir_gtcamRCGetNextEntry(dev, &tcamPointer, &tcamData);
-		MSG(("find the next valid TCAM entry number is %u\n", tcamPointer));
-		displayTcamRCData(&tcamData);
+		status = Fir_gtcamRCGetNextEntries(dev, &tcamPointer, FIR_TCAMRC_RMU_MAX_ENTRIES, entries, &numEntries);
+		if (status != MSD_OK)
+		{
+			break;
+		}
+		for (i = 0; i < numEntries; i++)
+		{
+			MSG(("find the next valid TCAM entry number is %u\n", entries[i].rcEntryNum));
+			displayTcamRCData(&entries[i].rcData);
+		}
 		if ((tcamPointer & (MSD_U32)0x00ff) == (MSD_U32)0xff)
 		{
 			break;
@@ -1203,4 +1632,101 @@ static MSD_STATUS Fir_setTcamExtensionReg(const MSD_QD_DEV *dev, MSD_U8 Block, M
 	}
 
 	return retVal;
-}
\ No newline at end of file
+}
+
+static void Fir_tcamRCRmuAdd(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 opCode, MSD_U8 regAddr, MSD_U16 data)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_TCAM_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
+
+/* Wait until the busy bit of the TCAM operation register clears */
+static void Fir_tcamRCRmuAddWait(MSD_RegCmd *regCmd, MSD_U32 *nCmd)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_TCAM_DEV_ADDR;
+	regCmd[*nCmd].regAddr = FIR_TCAM_OPERATION;
+	regCmd[*nCmd].data = 15U;
+	*nCmd += 1U;
+}
+
+/*
+ * Append the LOAD sequence of one Range Check entry, Block 7 then Block 1,
+ * FIR_TCAMRC_RMU_ENTRY_CMDS commands. The TCAM must be ready.
+ */
+static void Fir_tcamRCRmuAddLoad(MSD_RegCmd *regCmd, MSD_U32 *nCmd, const FIR_MSD_TCAM_RC_OP_DATA *opData)
+{
+	MSD_U16 data;
+	MSD_U8 i;
+
+	data = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_TCAMRC_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)2 << 10) | (MSD_U16)opData->tcamEntry);
+
+	/*Access Range Check from TCAM Range Frame */
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, (MSD_U16)((MSD_U16)7 << 12));
+	for (i = 2; i < 4U; i++)
+	{
+		Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, i, opData->tcamDataP.frame[i + 14U]);
+	}
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION, data);
+	Fir_tcamRCRmuAddWait(regCmd, nCmd);
+
+	/*Access Range Check Ingress Actions from TCAM Range Frame matches */
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, (MSD_U16)((MSD_U16)1 << 12));
+	for (i = 2; i < 14U; i++)
+	{
+		Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, i, opData->tcamDataP.frame[i - 2U]);
+	}
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)0x1B, opData->tcamDataP.frame[25]);
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION, data);
+	Fir_tcamRCRmuAddWait(regCmd, nCmd);
+}
+
+/*
+ * Append the READ sequence of one Range Check entry, Block 7 then Block 1,
+ * FIR_TCAMRC_RMU_ENTRY_CMDS commands. The TCAM must be ready. The data is
+ * picked up from the response by Fir_tcamRCRmuGetRead.
+ */
+static void Fir_tcamRCRmuAddRead(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U32 rcEntryNum)
+{
+	MSD_U16 data;
+	MSD_U8 i;
+
+	data = (MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_TCAMRC_READ_ENTRY << 12) | (MSD_U16)((MSD_U16)2 << 10) | (MSD_U16)rcEntryNum);
+
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, (MSD_U16)((MSD_U16)7 << 12));
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION, data);
+	Fir_tcamRCRmuAddWait(regCmd, nCmd);
+	for (i = 2; i < 4U; i++)
+	{
+		Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_READ, i, 0);
+	}
+
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, (MSD_U16)((MSD_U16)1 << 12));
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION, data);
+	Fir_tcamRCRmuAddWait(regCmd, nCmd);
+	for (i = 2; i < 14U; i++)
+	{
+		Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_READ, i, 0);
+	}
+	Fir_tcamRCRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_READ, (MSD_U8)0x1B, 0);
+}
+
+/* Pick up the data of a READ sequence appended at regCmd[first] */
+static void Fir_tcamRCRmuGetRead(const MSD_RegCmd *regCmd, MSD_U32 first, FIR_MSD_TCAM_RC_DATA_HW *tcamDataPtr)
+{
+	MSD_U32 i;
+
+	msdMemSet((void*)tcamDataPtr, 0, sizeof(FIR_MSD_TCAM_RC_DATA_HW));
+	tcamDataPtr->frame[16] = regCmd[first + 3U].data;
+	tcamDataPtr->frame[17] = regCmd[first + 4U].data;
+	for (i = 0; i < 12U; i++)
+	{
+		tcamDataPtr->frame[i] = regCmd[first + 8U + i].data;
+	}
+	tcamDataPtr->frame[25] = regCmd[first + 20U].data;
+}
@@ -22,6 +22,7 @@
 #include <utils/msdUtils.h>
 #include <platform/msdSem.h>
 #include <driver/msdHwAccess.h>
+#include <fir/include/api/Fir_msdRMU.h>
 
 /****************************************************************************/
 /* Internal TCAM structure declaration.                                    */
@@ -56,6 +57,11 @@ typedef enum
 	Fir_TCAMRCComp_READ_ENTRY = 0x5
 } FIR_MSD_TCAM_RC_COMP_OPERATION;
 
+/* RMU commands of one port LOAD or READ, and the ports that fit in a frame
+ * together with the leading wait and the trailing Block reset */
+#define FIR_TCAMRC_COMP_RMU_PORT_CMDS    27U
+#define FIR_TCAMRC_COMP_RMU_MAX_PORTS    ((MSD_RMU_MAX_REGCMDS - 2U) / FIR_TCAMRC_COMP_RMU_PORT_CMDS)
+
 static MSD_STATUS Fir_setTcamRCCompHWData
 (
 IN	const FIR_MSD_TCAM_RC_COMP_DATA	*iData,
@@ -77,6 +83,10 @@ IN    FIR_MSD_TCAM_RC_COMP_OPERATION   compOp,
 INOUT FIR_MSD_TCAM_RC_COMP_OP_DATA     *opData
 );
 static MSD_STATUS Fir_setTcamExtensionReg(const MSD_QD_DEV *dev, MSD_U8 Block, MSD_U8 Port);
+static void Fir_tcamRCCompRmuAdd(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 opCode, MSD_U8 regAddr, MSD_U16 data);
+static void Fir_tcamRCCompRmuAddWait(MSD_RegCmd *regCmd, MSD_U32 *nCmd);
+static void Fir_tcamRCCompRmuAddLoad(MSD_RegCmd *regCmd, MSD_U32 *nCmd, const FIR_MSD_TCAM_RC_COMP_OP_DATA *opData);
+static void Fir_tcamRCCompRmuAddRead(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 phyPort);
 
 
 /*******************************************************************************
@@ -308,6 +318,261 @@ OUT FIR_MSD_TCAM_RC_COMP_DATA *tcamRCCompData
 	return retVal;
 }
 
+/*******************************************************************************
+* Fir_gtcamRCCompLoadPorts
+*
+* DESCRIPTION:
+*       This routine configures the Range Check Comparators of an array of
+*       ports. Over RMU the register sequences of several ports are sent in one
+*       frame, otherwise each port is loaded as by Fir_gtcamRCCompLoad.
+*
+* INPUTS:
+*       numPorts - number of entries
+*       entries  - logical port numbers and Range Check Comparator Data
+*
+* OUTPUTS:
+*       portStatus - load status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are loaded
+*       MSD_FAIL    - if any entry failed, see portStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCCompLoadPorts
+(
+IN  MSD_QD_DEV  *dev,
+IN  MSD_U32     numPorts,
+IN  const FIR_MSD_TCAM_RC_COMP_ENTRY *entries,
+OUT MSD_STATUS  *portStatus
+)
+{
+	MSD_STATUS       retVal = MSD_OK;
+	MSD_STATUS       frameStatus;
+	MSD_U8           phyPort;        /* Physical port.               */
+	FIR_MSD_TCAM_RC_COMP_DATA        compData;
+	FIR_MSD_TCAM_RC_COMP_OP_DATA     CompOpData;
+	MSD_RegCmd       regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd       *pRegCmd = &(regCmd[0]);
+	MSD_U32          index[FIR_TCAMRC_COMP_RMU_MAX_PORTS];
+	MSD_U32          nCmd;
+	MSD_U32          nBatch;
+	MSD_U32          i;
+	MSD_U32          k;
+
+	MSD_DBG_INFO(("Fir_gtcamRCCompLoadPorts Called.\n"));
+
+	if ((numPorts != 0U) && ((entries == NULL) || (portStatus == NULL)))
+	{
+		MSD_DBG_ERROR(("Input param entries or portStatus is NULL.\n"));
+		retVal = MSD_BAD_PARAM;
+	}
+	else if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; i < numPorts; i++)
+		{
+			compData = entries[i].compData;
+			portStatus[i] = Fir_gtcamRCCompLoad(dev, entries[i].portNum, &compData);
+			if (portStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+	else
+	{
+		i = 0;
+		while (i < numPorts)
+		{
+			nCmd = 0;
+			nBatch = 0;
+			Fir_tcamRCCompRmuAddWait(regCmd, &nCmd);
+			while ((i < numPorts) && (nBatch < FIR_TCAMRC_COMP_RMU_MAX_PORTS))
+			{
+				phyPort = MSD_LPORT_2_PORT(entries[i].portNum);
+				if (phyPort == MSD_INVALID_PORT)
+				{
+					MSD_DBG_ERROR(("Failed (Bad Port).\n"));
+					portStatus[i] = MSD_BAD_PARAM;
+				}
+				else
+				{
+					CompOpData.CompPort = phyPort;
+					(void)Fir_setTcamRCCompHWData(&entries[i].compData, &CompOpData.CompDataP);
+					Fir_tcamRCCompRmuAddLoad(regCmd, &nCmd, &CompOpData);
+					index[nBatch] = i;
+					nBatch++;
+				}
+				i++;
+			}
+
+			if (nBatch != 0U)
+			{
+				/*Change Block to 0, in case other misoperation*/
+				Fir_tcamRCCompRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, 0);
+
+				msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+				frameStatus = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				if (frameStatus != MSD_OK)
+				{
+					MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(frameStatus)));
+				}
+				for (k = 0; k < nBatch; k++)
+				{
+					portStatus[index[k]] = frameStatus;
+				}
+			}
+		}
+
+		for (i = 0; i < numPorts; i++)
+		{
+			if (portStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+
+	MSD_DBG_INFO(("Fir_gtcamRCCompLoadPorts Exit.\n"));
+	return retVal;
+}
+
+/*******************************************************************************
+* Fir_gtcamRCCompReadPorts
+*
+* DESCRIPTION:
+*       This routine reads the Range Check Comparators of an array of ports.
+*       Over RMU the register sequences of several ports are sent in one frame,
+*       otherwise each port is read as by Fir_gtcamRCCompRead.
+*
+* INPUTS:
+*       numPorts - number of entries
+*       entries  - portNum of each entry to read
+*
+* OUTPUTS:
+*       entries    - compData of each entry
+*       portStatus - read status of each entry
+*
+* RETURNS:
+*       MSD_OK      - if all entries are read
+*       MSD_FAIL    - if any entry failed, see portStatus
+*       MSD_BAD_PARAM - if invalid parameter is given
+*
+* COMMENTS:
+*       None
+*
+*******************************************************************************/
+MSD_STATUS Fir_gtcamRCCompReadPorts
+(
+IN    MSD_QD_DEV  *dev,
+IN    MSD_U32     numPorts,
+INOUT FIR_MSD_TCAM_RC_COMP_ENTRY *entries,
+OUT   MSD_STATUS  *portStatus
+)
+{
+	MSD_STATUS       retVal = MSD_OK;
+	MSD_STATUS       frameStatus;
+	MSD_U8           phyPort;        /* Physical port.               */
+	FIR_MSD_TCAM_RC_COMP_DATA_HW     compDataP;
+	MSD_RegCmd       regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd       *pRegCmd = &(regCmd[0]);
+	MSD_U32          index[FIR_TCAMRC_COMP_RMU_MAX_PORTS];
+	MSD_U32          first[FIR_TCAMRC_COMP_RMU_MAX_PORTS];
+	MSD_U32          nCmd;
+	MSD_U32          nBatch;
+	MSD_U32          i;
+	MSD_U32          k;
+
+	MSD_DBG_INFO(("Fir_gtcamRCCompReadPorts Called.\n"));
+
+	if ((numPorts != 0U) && ((entries == NULL) || (portStatus == NULL)))
+	{
+		MSD_DBG_ERROR(("Input param entries or portStatus is NULL.\n"));
+		retVal = MSD_BAD_PARAM;
+	}
+	else if (!(IS_RMU_SUPPORTED(dev)))
+	{
+		for (i = 0; i < numPorts; i++)
+		{
+			portStatus[i] = Fir_gtcamRCCompRead(dev, entries[i].portNum, &entries[i].compData);
+			if (portStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+	else
+	{
+		i = 0;
+		while (i < numPorts)
+		{
+			nCmd = 0;
+			nBatch = 0;
+			Fir_tcamRCCompRmuAddWait(regCmd, &nCmd);
+			while ((i < numPorts) && (nBatch < FIR_TCAMRC_COMP_RMU_MAX_PORTS))
+			{
+				phyPort = MSD_LPORT_2_PORT(entries[i].portNum);
+				if (phyPort == MSD_INVALID_PORT)
+				{
+					MSD_DBG_ERROR(("Failed (Bad Port).\n"));
+					portStatus[i] = MSD_BAD_PARAM;
+				}
+				else
+				{
+					first[nBatch] = nCmd;
+					Fir_tcamRCCompRmuAddRead(regCmd, &nCmd, phyPort);
+					index[nBatch] = i;
+					nBatch++;
+				}
+				i++;
+			}
+
+			if (nBatch != 0U)
+			{
+				/*Change Block to 0, in case other misoperation*/
+				Fir_tcamRCCompRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT, 0);
+
+				msdSemTake(dev->devNum, dev->tblRegsSem, OS_WAIT_FOREVER);
+				frameStatus = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+				msdSemGive(dev->devNum, dev->tblRegsSem);
+				if (frameStatus != MSD_OK)
+				{
+					MSD_DBG_ERROR(("Fir_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(frameStatus)));
+				}
+				for (k = 0; k < nBatch; k++)
+				{
+					portStatus[index[k]] = frameStatus;
+					if (frameStatus == MSD_OK)
+					{
+						msdMemSet((void*)&compDataP, 0, sizeof(compDataP));
+						/* The 24 register reads follow Block select, operation and wait */
+						for (nCmd = 0; nCmd < 24U; nCmd++)
+						{
+							compDataP.frame[nCmd] = regCmd[first[k] + 3U + nCmd].data;
+						}
+						(void)Fir_getTcamRCCompHWData(&compDataP, &entries[index[k]].compData);
+					}
+				}
+			}
+		}
+
+		for (i = 0; i < numPorts; i++)
+		{
+			if (portStatus[i] != MSD_OK)
+			{
+				retVal = MSD_FAIL;
+			}
+		}
+	}
+
+	MSD_DBG_INFO(("Fir_gtcamRCCompReadPorts Exit.\n"));
+	return retVal;
+}
+
 /****************************************************************************/
 /* Internal functions.                                                  */
 /****************************************************************************/
@@ -712,4 +977,64 @@ static MSD_STATUS Fir_setTcamExtensionReg(const MSD_QD_DEV *dev, MSD_U8 Block, M
 	}
 
 	return retVal;
-}
\ No newline at end of file
+}
+
+static void Fir_tcamRCCompRmuAdd(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 opCode, MSD_U8 regAddr, MSD_U16 data)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_TCAM_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
+
+/* Wait until the busy bit of the TCAM operation register clears */
+static void Fir_tcamRCCompRmuAddWait(MSD_RegCmd *regCmd, MSD_U32 *nCmd)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_TCAM_DEV_ADDR;
+	regCmd[*nCmd].regAddr = FIR_TCAM_OPERATION;
+	regCmd[*nCmd].data = 15U;
+	*nCmd += 1U;
+}
+
+/*
+ * Append the LOAD sequence of the comparators of one port, Block 6,
+ * FIR_TCAMRC_COMP_RMU_PORT_CMDS commands. The TCAM must be ready.
+ */
+static void Fir_tcamRCCompRmuAddLoad(MSD_RegCmd *regCmd, MSD_U32 *nCmd, const FIR_MSD_TCAM_RC_COMP_OP_DATA *opData)
+{
+	MSD_U8 i;
+
+	/*Access Range Check from TCAM Range Frame */
+	Fir_tcamRCCompRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT,
+		(MSD_U16)((MSD_U16)((MSD_U16)6 << 12) | ((MSD_U16)opData->CompPort & (MSD_U16)0x1F)));
+	for (i = 2; i < 26U; i++)
+	{
+		Fir_tcamRCCompRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, i, opData->CompDataP.frame[i - 2U]);
+	}
+	Fir_tcamRCCompRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION,
+		(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_TCAMRCComp_LOAD_ENTRY << 12) | (MSD_U16)((MSD_U16)2 << 10)));
+	Fir_tcamRCCompRmuAddWait(regCmd, nCmd);
+}
+
+/*
+ * Append the READ sequence of the comparators of one port, Block 6,
+ * FIR_TCAMRC_COMP_RMU_PORT_CMDS commands. The TCAM must be ready.
+ */
+static void Fir_tcamRCCompRmuAddRead(MSD_RegCmd *regCmd, MSD_U32 *nCmd, MSD_U8 phyPort)
+{
+	MSD_U8 i;
+
+	Fir_tcamRCCompRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_EGR_PORT,
+		(MSD_U16)((MSD_U16)((MSD_U16)6 << 12) | ((MSD_U16)phyPort & (MSD_U16)0x1F)));
+	Fir_tcamRCCompRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_WRITE, FIR_TCAM_OPERATION,
+		(MSD_U16)((MSD_U16)0x8000 | (MSD_U16)((MSD_U16)Fir_TCAMRCComp_READ_ENTRY << 12) | (MSD_U16)((MSD_U16)2 << 10)));
+	Fir_tcamRCCompRmuAddWait(regCmd, nCmd);
+	for (i = 2; i < 26U; i++)
+	{
+		Fir_tcamRCCompRmuAdd(regCmd, nCmd, MSD_RMU_REQ_OPCODE_READ, i, 0);
+	}
+}
@@ -21,6 +21,7 @@
 #include <fir/include/driver/Fir_msdHwAccess.h>
 #include <fir/include/driver/Fir_msdDrvSwRegs.h>
 #include <fir/include/api/Fir_msdApiInternal.h>
+#include <fir/include/api/Fir_msdRMU.h>
 #include <driver/msdHwAccess.h>
 #include <platform/msdSem.h>
 #include <utils/msdUtils.h>
@@ -1094,6 +1095,335 @@ MSD_STATUS Fir_msdGetSMIPhyXMDIOReg
 	return MSD_OK;
 }
 
+/****************************************************************************/
+/* Block reads of consecutive Clause 45 registers.                          */
+/****************************************************************************/
+static MSD_STATUS Fir_smiPhyGetReg
+(
+	IN  MSD_QD_DEV* dev,
+	IN  MSD_U8     regAddr,
+	OUT MSD_U16* data
+)
+{
+	if (IS_SMI_MULTICHIP_SUPPORTED(dev))
+	{
+		return Fir_msdDirectGetMultiChipReg(dev, regAddr, data);
+	}
+	return msdGetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, regAddr, data);
+}
+
+static MSD_STATUS Fir_smiPhySetReg
+(
+	IN  MSD_QD_DEV* dev,
+	IN  MSD_U8     regAddr,
+	IN  MSD_U16    data
+)
+{
+	if (IS_SMI_MULTICHIP_SUPPORTED(dev))
+	{
+		return Fir_msdDirectSetMultiChipReg(dev, regAddr, data);
+	}
+	return msdSetAnyReg(dev->devNum, FIR_GLOBAL2_DEV_ADDR, regAddr, data);
+}
+
+static MSD_STATUS Fir_smiPhyWaitReady
+(
+	IN  MSD_QD_DEV* dev
+)
+{
+	unsigned int timeOut;
+	MSD_U16 smiReg;
+
+	timeOut = MSD_SMI_ACCESS_LOOP; /* initialize the loop count */
+
+	do
+	{
+		if (Fir_smiPhyGetReg(dev, FIR_SMI_PHY_CMD, &smiReg) != MSD_OK)
+		{
+			MSD_DBG_ERROR(("read FIR_SMI_PHY_CMD register returned: %s.\n", msdDisplayStatus(MSD_FAIL)));
+			return MSD_FAIL;
+		}
+		if (timeOut-- < 1)
+		{
+			MSD_DBG_ERROR(("read FIR_SMI_PHY_CMD register Timed Out\n"));
+			return MSD_FAIL;
+		}
+	} while (smiReg & MSD_SMI_BUSY);
+
+	return MSD_OK;
+}
+
+static void Fir_smiPhyRmuAdd
+(
+	IN    MSD_RegCmd*   regCmd,
+	INOUT MSD_U32*      nCmd,
+	IN    MSD_U8        opCode,
+	IN    MSD_U8        regAddr,
+	IN    MSD_U16       data
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+	regCmd[*nCmd].opCode = opCode;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = regAddr;
+	regCmd[*nCmd].data = data;
+	*nCmd += 1U;
+}
+
+/* Wait until the SMI PHY busy bit self clears */
+static void Fir_smiPhyRmuAddWait
+(
+	IN    MSD_RegCmd*   regCmd,
+	INOUT MSD_U32*      nCmd
+)
+{
+	regCmd[*nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_TRUE;
+	regCmd[*nCmd].opCode = MSD_RMU_WAIT_ON_BIT_VAL0;
+	regCmd[*nCmd].devAddr = FIR_GLOBAL2_DEV_ADDR;
+	regCmd[*nCmd].regAddr = (MSD_U8)FIR_SMI_PHY_CMD;
+	regCmd[*nCmd].data = (MSD_U16)15;
+	*nCmd += 1U;
+}
+
+/*
+* Sends the setup commands, then count times the SMI PHY command readCmd,
+* a wait and a read of the data register, packed in as few RMU frames as
+* fit. The setup must leave the SMI PHY unit idle.
+*/
+static MSD_STATUS Fir_smiPhyRmuReadBlock
+(
+	IN  MSD_QD_DEV* dev,
+	IN  MSD_RegCmd* setup,
+	IN  MSD_U32     nSetup,
+	IN  MSD_U16     readCmd,
+	IN  MSD_U32     count,
+	OUT MSD_U16*    data
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 i, k, nCmd, nReg, first;
+
+	for (i = 0; i < count; i += nReg)
+	{
+		nCmd = 0;
+		if (i == 0)
+		{
+			for (k = 0; k < nSetup; k++)
+			{
+				regCmd[nCmd++] = setup[k];
+			}
+		}
+		first = nCmd;
+
+		nReg = (MSD_RMU_MAX_REGCMDS - nCmd) / 3U;
+		if (nReg > count - i)
+		{
+			nReg = count - i;
+		}
+		for (k = 0; k < nReg; k++)
+		{
+			Fir_smiPhyRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)FIR_SMI_PHY_CMD, readCmd);
+			Fir_smiPhyRmuAddWait(regCmd, &nCmd);
+			Fir_smiPhyRmuAdd(regCmd, &nCmd, MSD_RMU_REQ_OPCODE_READ, (MSD_U8)FIR_SMI_PHY_DATA, 0);
+		}
+
+		retVal = Fir_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+		if (retVal != MSD_OK)
+		{
+			return retVal;
+		}
+
+		for (k = 0; k < nReg; k++)
+		{
+			data[i + k] = regCmd[first + k * 3U + 2U].data;
+		}
+	}
+
+	return MSD_OK;
+}
+
+/*****************************************************************************
+* msdGetSMIC45PhyRegBlock
+*
+* DESCRIPTION:
+*       This function indirectly reads consecutive Clause 45 registers through
+*       SMI PHY command. The address cycle is issued once, each register is
+*       read with a post read increment command.
+*
+* INPUTS:
+*       devAddr - The device address.
+*       phyAddr - The PHY address.
+*       regAddr - The first register address to read.
+*       count   - The number of registers to read.
+*
+* OUTPUTS:
+*       data    - The storage of count registers.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*
+* COMMENTS:
+*       Over RMU the whole range is read in as few frames as fit.
+*
+*******************************************************************************/
+MSD_STATUS Fir_msdGetSMIC45PhyRegBlock
+(
+	IN  MSD_QD_DEV* dev,
+	IN  MSD_U8     devAddr,
+	IN  MSD_U8     phyAddr,
+	IN  MSD_U16    regAddr,
+	IN  MSD_U32    count,
+	OUT MSD_U16* data
+)
+{
+	MSD_RegCmd setup[4];
+	MSD_U32 nSetup, i;
+	MSD_U16 addrCmd, incCmd;
+
+	if ((count == 0) || (data == NULL))
+	{
+		return MSD_BAD_PARAM;
+	}
+
+	addrCmd = MSD_SMI_BUSY | (phyAddr << MSD_SMI_DEV_ADDR_BIT) | (MSD_SMI_WRITE_ADDR << MSD_SMI_OP_BIT) |
+		(devAddr << MSD_SMI_REG_ADDR_BIT) | (MSD_SMI_CLAUSE45 << MSD_SMI_MODE_BIT);
+	incCmd = MSD_SMI_BUSY | (phyAddr << MSD_SMI_DEV_ADDR_BIT) | (MSD_SMI_READ_INC << MSD_SMI_OP_BIT) |
+		(devAddr << MSD_SMI_REG_ADDR_BIT) | (MSD_SMI_CLAUSE45 << MSD_SMI_MODE_BIT);
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		nSetup = 0;
+		Fir_smiPhyRmuAddWait(setup, &nSetup);
+		Fir_smiPhyRmuAdd(setup, &nSetup, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)FIR_SMI_PHY_DATA, regAddr);
+		Fir_smiPhyRmuAdd(setup, &nSetup, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)FIR_SMI_PHY_CMD, addrCmd);
+		Fir_smiPhyRmuAddWait(setup, &nSetup);
+		return Fir_smiPhyRmuReadBlock(dev, setup, nSetup, incCmd, count, data);
+	}
+
+	if ((Fir_smiPhyWaitReady(dev) != MSD_OK) ||
+		(Fir_smiPhySetReg(dev, FIR_SMI_PHY_DATA, regAddr) != MSD_OK) ||
+		(Fir_smiPhySetReg(dev, FIR_SMI_PHY_CMD, addrCmd) != MSD_OK))
+	{
+		MSD_DBG_ERROR(("Write SMI Phy C45 address cycle Failed\n"));
+		return MSD_FAIL;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		if ((Fir_smiPhyWaitReady(dev) != MSD_OK) ||
+			(Fir_smiPhySetReg(dev, FIR_SMI_PHY_CMD, incCmd) != MSD_OK) ||
+			(Fir_smiPhyWaitReady(dev) != MSD_OK) ||
+			(Fir_smiPhyGetReg(dev, FIR_SMI_PHY_DATA, &data[i]) != MSD_OK))
+		{
+			MSD_DBG_ERROR(("Read SMI Phy C45 register 0x%04x Failed\n", (MSD_U16)(regAddr + i)));
+			return MSD_FAIL;
+		}
+	}
+
+	return MSD_OK;
+}
+
+/*****************************************************************************
+* msdGetSMIPhyXMDIORegBlock
+*
+* DESCRIPTION:
+*       This function reads consecutive internal PHY XMDIO registers through
+*       the Clause 22 MMD access registers. The MMD address is set once with
+*       post increment, then register 14 is read count times.
+*
+* INPUTS:
+*       portNum - The PHY address.
+*       devAddr - The Clause45 device address.
+*       regAddr - The first register address to read.
+*       count   - The number of registers to read.
+*
+* OUTPUTS:
+*       data    - The storage of count registers.
+*
+* RETURNS:
+*       MSD_OK   - on success
+*       MSD_FAIL - on error
+*
+* COMMENTS:
+*       Over RMU the whole range is read in as few frames as fit.
+*
+*******************************************************************************/
+MSD_STATUS Fir_msdGetSMIPhyXMDIORegBlock
+(
+	IN  MSD_QD_DEV* dev,
+	IN  MSD_U8     portNum,
+	IN  MSD_U8     devAddr,
+	IN  MSD_U16    regAddr,
+	IN  MSD_U32    count,
+	OUT MSD_U16* data
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd setup[13];
+	MSD_U32 nSetup, i;
+	MSD_U8 mmdReg[4];
+	MSD_U16 mmdData[4];
+	MSD_U16 readCmd;
+
+	if ((count == 0) || (data == NULL))
+	{
+		return MSD_BAD_PARAM;
+	}
+
+	/* page 0, MMD address, MMD data with post increment */
+	mmdReg[0] = 22;
+	mmdData[0] = 0;
+	mmdReg[1] = 13;
+	mmdData[1] = MSD_PHY_MMD_ADDR | devAddr;
+	mmdReg[2] = 14;
+	mmdData[2] = regAddr;
+	mmdReg[3] = 13;
+	mmdData[3] = MSD_PHY_MMD_DATA_RW_INC | devAddr;
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		nSetup = 0;
+		for (i = 0; i < 4U; i++)
+		{
+			Fir_smiPhyRmuAddWait(setup, &nSetup);
+			Fir_smiPhyRmuAdd(setup, &nSetup, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)FIR_SMI_PHY_DATA, mmdData[i]);
+			Fir_smiPhyRmuAdd(setup, &nSetup, MSD_RMU_REQ_OPCODE_WRITE, (MSD_U8)FIR_SMI_PHY_CMD,
+				(MSD_U16)(MSD_SMI_BUSY | (portNum << MSD_SMI_DEV_ADDR_BIT) | (MSD_SMI_WRITE << MSD_SMI_OP_BIT) |
+				(mmdReg[i] << MSD_SMI_REG_ADDR_BIT) | (MSD_SMI_CLAUSE22 << MSD_SMI_MODE_BIT)));
+		}
+		Fir_smiPhyRmuAddWait(setup, &nSetup);
+
+		readCmd = MSD_SMI_BUSY | (portNum << MSD_SMI_DEV_ADDR_BIT) | (MSD_SMI_READ_22 << MSD_SMI_OP_BIT) |
+			((MSD_U16)14 << MSD_SMI_REG_ADDR_BIT) | (MSD_SMI_CLAUSE22 << MSD_SMI_MODE_BIT);
+		return Fir_smiPhyRmuReadBlock(dev, setup, nSetup, readCmd, count, data);
+	}
+
+	for (i = 0; i < 4U; i++)
+	{
+		retVal = Fir_msdSetSMIPhyReg(dev, portNum, mmdReg[i], mmdData[i]);
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("ERROR to Set MMD access register %d.\n", mmdReg[i]));
+			return retVal;
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		retVal = Fir_msdGetSMIPhyReg(dev, portNum, 14, &data[i]);
+		if (retVal != MSD_OK)
+		{
+			MSD_DBG_ERROR(("ERROR to Read MMD access Data.\n"));
+			return retVal;
+		}
+	}
+
+	return MSD_OK;
+}
+
 /*******************************************************************************
 * msdPhyReset
 *
@@ -1195,6 +1525,11 @@ MSD_STATUS Fir_msdPhyReset
 	return MSD_OK;
 }
 
+/*
+* The SMI PHY command register is kept in dev->smiPhyCmd once it was read not
+* busy. Until the next command write, the busy polls before an indirect PHY
+* access are then answered without an SMI transaction.
+*/
 MSD_STATUS Fir_msdDirectSetMultiChipReg
 (
 	IN  MSD_QD_DEV* dev,
@@ -1202,6 +1537,10 @@ MSD_STATUS Fir_msdDirectSetMultiChipReg
 	IN  MSD_U16 data
 )
 {
+	if (regAddr == FIR_SMI_PHY_CMD)
+	{
+		dev->smiState &= (MSD_U8)~MSD_SMI_STATE_PHY_CMD_IDLE;
+	}
 	return dev->fgtWriteMii(dev->devNum, dev->phyAddr, regAddr, data);
 }
 MSD_STATUS Fir_msdDirectGetMultiChipReg
@@ -1211,7 +1550,22 @@ MSD_STATUS Fir_msdDirectGetMultiChipReg
 	OUT MSD_U16* data
 )
 {
-	return dev->fgtReadMii(dev->devNum, dev->phyAddr, regAddr, data);
+	MSD_STATUS retVal;
+
+	if ((regAddr == FIR_SMI_PHY_CMD) && ((dev->smiState & MSD_SMI_STATE_PHY_CMD_IDLE) != 0U))
+	{
+		*data = dev->smiPhyCmd;
+		return MSD_OK;
+	}
+
+	retVal = dev->fgtReadMii(dev->devNum, dev->phyAddr, regAddr, data);
+	if ((retVal == MSD_OK) && (regAddr == FIR_SMI_PHY_CMD) && ((*data & MSD_SMI_BUSY) == 0U))
+	{
+		dev->smiPhyCmd = *data;
+		dev->smiState |= MSD_SMI_STATE_PHY_CMD_IDLE;
+	}
+
+	return retVal;
 }
 MSD_STATUS Fir_msdDirectSetMultiChipRegField
 (
@@ -18,6 +18,7 @@
 *******************************************************************************/
 
 #include <peridot/include/api/Peridot_msdIMP.h>
+#include <peridot/include/api/Peridot_msdRMU.h>
 #include <peridot/include/api/Peridot_msdApiInternal.h>
 #include <peridot/include/driver/Peridot_msdHwAccess.h>
 #include <peridot/include/driver/Peridot_msdDrvSwRegs.h>
@@ -77,6 +78,13 @@ static MSD_STATUS Peridot_IMP_Download
 	IN	MSD_U8	*data
 );
 
+static MSD_STATUS Peridot_IMP_DownloadRmu
+(
+	IN	MSD_QD_DEV	*dev,
+	IN	MSD_U32	datasize,
+	IN	MSD_U8	*data
+);
+
 /*******************************************************************************
 * Peridot_impRun
 *
@@ -612,12 +620,68 @@ static MSD_STATUS Peridot_IMP_Download
 		return MSD_FAIL;
 	}
 
-	if (datasize > 0)
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		retVal = Peridot_IMP_DownloadRmu(dev, datasize, data);
+	}
+	else
 	{
 		for (Idx = 0; Idx < datasize; Idx++)
 		{
-			Peridot_IMP_Write(dev, pointer_WrData, (MSD_U16)data[Idx]);
-			Peridot_IMP_De_Next(dev);
+			retVal = Peridot_IMP_Write(dev, pointer_WrData, (MSD_U16)data[Idx]);
+			retVal |= Peridot_IMP_De_Next(dev);
+			if (retVal != MSD_OK)
+			{
+				break;
+			}
+		}
+	}
+
+	if (retVal != MSD_OK)
+	{
+		return MSD_FAIL;
+	}
+
+	return MSD_OK;
+}
+
+/* Write and deposit-next pairs, queued into as few RMU frames as possible */
+static MSD_STATUS Peridot_IMP_DownloadRmu
+(
+	IN	MSD_QD_DEV	*dev,
+	IN	MSD_U32	datasize,
+	IN	MSD_U8	*data
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 Idx, nCmd;
+
+	MSD_U16 pointer_WrData = 0x0c;
+	MSD_U16 pointer = 0x8;
+
+	nCmd = 0;
+	for (Idx = 0; Idx < datasize; Idx++)
+	{
+		regCmd[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+		regCmd[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+		regCmd[nCmd].devAddr = PERIDOT_GLOBAL2_DEV_ADDR;
+		regCmd[nCmd].regAddr = 0x13;
+		regCmd[nCmd].data = 0x8000 | ((0x7F & pointer_WrData) << 8) | data[Idx];
+		regCmd[nCmd + 1] = regCmd[nCmd];
+		regCmd[nCmd + 1].data = 0x8000 | ((0x7F & pointer) << 8) | 0x6;
+		nCmd += 2;
+
+		if ((nCmd + 2 > MSD_RMU_MAX_REGCMDS) || (Idx == datasize - 1))
+		{
+			retVal = Peridot_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			if (retVal != MSD_OK)
+			{
+				MSD_DBG_ERROR(("Peridot_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+				return retVal;
+			}
+			nCmd = 0;
 		}
 	}
 
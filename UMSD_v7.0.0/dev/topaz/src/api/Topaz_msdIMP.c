@@ -18,6 +18,7 @@
 *******************************************************************************/
 
 #include <topaz/include/api/Topaz_msdIMP.h>
+#include <topaz/include/api/Topaz_msdRMU.h>
 #include <topaz/include/api/Topaz_msdApiInternal.h>
 #include <topaz/include/driver/Topaz_msdHwAccess.h>
 #include <topaz/include/driver/Topaz_msdDrvSwRegs.h>
@@ -78,6 +79,13 @@ static MSD_STATUS Topaz_IMP_Download
 	IN	MSD_U8	*data
 );
 
+static MSD_STATUS Topaz_IMP_DownloadRmu
+(
+	IN	MSD_QD_DEV	*dev,
+	IN	MSD_U32	datasize,
+	IN	MSD_U8	*data
+);
+
 /*******************************************************************************
 * Topaz_impRun
 *
@@ -613,12 +621,68 @@ static MSD_STATUS Topaz_IMP_Download
 		return MSD_FAIL;
 	}
 
-	if (datasize > 0)
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		retVal = Topaz_IMP_DownloadRmu(dev, datasize, data);
+	}
+	else
 	{
 		for (Idx = 0; Idx < datasize; Idx++)
 		{
-			Topaz_IMP_Write(dev, pointer_WrData, (MSD_U16)data[Idx]);
-			Topaz_IMP_De_Next(dev);
+			retVal = Topaz_IMP_Write(dev, pointer_WrData, (MSD_U16)data[Idx]);
+			retVal |= Topaz_IMP_De_Next(dev);
+			if (retVal != MSD_OK)
+			{
+				break;
+			}
+		}
+	}
+
+	if (retVal != MSD_OK)
+	{
+		return MSD_FAIL;
+	}
+
+	return MSD_OK;
+}
+
+/* Write and deposit-next pairs, queued into as few RMU frames as possible */
+static MSD_STATUS Topaz_IMP_DownloadRmu
+(
+	IN	MSD_QD_DEV	*dev,
+	IN	MSD_U32	datasize,
+	IN	MSD_U8	*data
+)
+{
+	MSD_STATUS retVal;
+	MSD_RegCmd regCmd[MSD_RMU_MAX_REGCMDS];
+	MSD_RegCmd *pRegCmd = &(regCmd[0]);
+	MSD_U32 Idx, nCmd;
+
+	MSD_U16 pointer_WrData = 0x0c;
+	MSD_U16 pointer = 0x8;
+
+	nCmd = 0;
+	for (Idx = 0; Idx < datasize; Idx++)
+	{
+		regCmd[nCmd].isWaitOnBit = MSD_RMU_WAIT_ON_BIT_FALSE;
+		regCmd[nCmd].opCode = MSD_RMU_REQ_OPCODE_WRITE;
+		regCmd[nCmd].devAddr = TOPAZ_GLOBAL2_DEV_ADDR;
+		regCmd[nCmd].regAddr = 0x13;
+		regCmd[nCmd].data = 0x8000 | ((0x7F & pointer_WrData) << 8) | data[Idx];
+		regCmd[nCmd + 1] = regCmd[nCmd];
+		regCmd[nCmd + 1].data = 0x8000 | ((0x7F & pointer) << 8) | 0x6;
+		nCmd += 2;
+
+		if ((nCmd + 2 > MSD_RMU_MAX_REGCMDS) || (Idx == datasize - 1))
+		{
+			retVal = Topaz_msdRmuMultiRegAccess(dev, &pRegCmd, nCmd);
+			if (retVal != MSD_OK)
+			{
+				MSD_DBG_ERROR(("Topaz_msdRmuMultiRegAccess returned: %s.\n", msdDisplayStatus(retVal)));
+				return retVal;
+			}
+			nCmd = 0;
 		}
 	}
 
@@ -435,6 +435,10 @@ int macsecGetNextTxSCIntStatus(void);
 int enableHwSemaphore(void);
 /* Disable hardware semaphore */
 int disableHwSemaphore(void);
+#ifndef WIN32
+/* Start or stop the PTP hardware clock emulation service */
+int phcServerOperation(void);
+#endif
 
 static int fullChipReset(void);
 static int setPortU32U32(void);
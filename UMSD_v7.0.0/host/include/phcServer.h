@@ -0,0 +1,51 @@
+#ifndef __PHCSERVER_H__
+#define __PHCSERVER_H__
+
+#include <stdint.h>
+
+/*
+* PTP hardware clock emulation over a Unix datagram socket.
+*
+* The clock is a software time counter on top of the 32 bit TAI global time
+* counter, the same way the Linux mv88e6xxx driver runs its PHC. Each request
+* is one UMSD_PHC_REQ datagram answered by one UMSD_PHC_RSP datagram sent back
+* to the client address, so clients must bind their own socket path.
+*/
+
+#define UMSD_PHC_OP_GETTIME     1   /* PHC time, from cache if read recently */
+#define UMSD_PHC_OP_SYS_OFFSET  2   /* PHC time read from hardware, bracketed by CLOCK_REALTIME */
+#define UMSD_PHC_OP_SETTIME     3   /* arg: PHC time in ns */
+#define UMSD_PHC_OP_ADJTIME     4   /* arg: signed ns step */
+#define UMSD_PHC_OP_ADJFINE     5   /* arg: frequency offset in scaled ppm, as adjtimex */
+#define UMSD_PHC_OP_PPS         6   /* arg: 1 enables, 0 disables the 1PPS output */
+#define UMSD_PHC_OP_PEROUT      7   /* arg: period in ns, 0 disables; only 1s is supported */
+
+typedef struct
+{
+    uint32_t    op;
+    uint32_t    reserved;
+    int64_t     arg;
+} UMSD_PHC_REQ;
+
+typedef struct
+{
+    int32_t     status;     /* MSD_STATUS */
+    uint32_t    reserved;
+    uint64_t    time;       /* PHC time in ns */
+    uint64_t    sysBefore;  /* CLOCK_REALTIME before the hardware read, 0 if cached */
+    uint64_t    sysAfter;   /* CLOCK_REALTIME after the hardware read, 0 if cached */
+} UMSD_PHC_RSP;
+
+typedef struct
+{
+    uint8_t     timeArrayIndex; /* ToD time array following the PHC */
+    uint32_t    clkPeriodPs;    /* TAI clock period in ps */
+    uint32_t    minIntervalUs;  /* minimum time between hardware accesses */
+    int32_t     maxAdjPpb;      /* adjfine limit */
+    uint8_t     ppsOnSelect;    /* ptp1ppsSelect written to enable 1PPS */
+    uint8_t     ppsOffSelect;   /* ptp1ppsSelect written to disable 1PPS */
+} UMSD_PHC_CONFIG;
+
+int phcServerStart(uint8_t devNum, const char *path, const UMSD_PHC_CONFIG *cfg);
+int phcServerStop(void);
+#endif /*__PHCSERVER_H__*/
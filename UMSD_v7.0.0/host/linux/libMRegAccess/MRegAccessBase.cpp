@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <string.h>
+#include "cyusb.h"
+#include "MRegAccessClass.h"
+
+static void LIBUSB_CALL BulkDone(struct libusb_transfer *transfer)
+{
+	MRegAccessBaseClass::BulkXfer *xfer = (MRegAccessBaseClass::BulkXfer *)transfer->user_data;
+
+	xfer->transferred = transfer->actual_length;
+	switch(transfer->status){
+	case LIBUSB_TRANSFER_COMPLETED:
+		xfer->status = LIBUSB_SUCCESS;
+		break;
+	case LIBUSB_TRANSFER_TIMED_OUT:
+		xfer->status = LIBUSB_ERROR_TIMEOUT;
+		break;
+	case LIBUSB_TRANSFER_STALL:
+		xfer->status = LIBUSB_ERROR_PIPE;
+		break;
+	case LIBUSB_TRANSFER_NO_DEVICE:
+		xfer->status = LIBUSB_ERROR_NO_DEVICE;
+		break;
+	case LIBUSB_TRANSFER_OVERFLOW:
+		xfer->status = LIBUSB_ERROR_OVERFLOW;
+		break;
+	case LIBUSB_TRANSFER_CANCELLED:
+		xfer->status = LIBUSB_ERROR_INTERRUPTED;
+		break;
+	default:
+		xfer->status = LIBUSB_ERROR_IO;
+		break;
+	}
+	xfer->done = 1;
+}
+
+int MRegAccessBaseClass::SubmitBulk(BulkXfer *xfer)
+{
+	int ret;
+
+	xfer->transferred = 0;
+	xfer->status = LIBUSB_SUCCESS;
+	xfer->done = 0;
+	xfer->transfer = libusb_alloc_transfer(0);
+	if(xfer->transfer == NULL){
+		xfer->status = LIBUSB_ERROR_NO_MEM;
+		xfer->done = 1;
+		return xfer->status;
+	}
+
+	libusb_fill_bulk_transfer(xfer->transfer, _usb_handle, xfer->endpoint, xfer->data, xfer->length, BulkDone, xfer, _timeout);
+	ret = libusb_submit_transfer(xfer->transfer);
+	if(ret < 0){
+		libusb_free_transfer(xfer->transfer);
+		xfer->transfer = NULL;
+		xfer->status = ret;
+		xfer->done = 1;
+	}
+
+	return ret;
+}
+
+int MRegAccessBaseClass::WaitBulk(BulkXfer *xfer)
+{
+	int ret;
+
+	while(!xfer->done){
+		ret = libusb_handle_events_completed(NULL, &xfer->done);
+		if(ret < 0 && ret != LIBUSB_ERROR_INTERRUPTED && !xfer->done){
+			// the transfer still has to be reaped before it can be freed
+			libusb_cancel_transfer(xfer->transfer);
+		}
+	}
+
+	if(xfer->transfer != NULL){
+		libusb_free_transfer(xfer->transfer);
+		xfer->transfer = NULL;
+	}
+
+	return xfer->status;
+}
+
+void MRegAccessBaseClass::CancelBulk(BulkXfer *xfer)
+{
+	if(!xfer->done && xfer->transfer != NULL)
+		libusb_cancel_transfer(xfer->transfer);
+}
+
+void MRegAccessBaseClass::RecoverEndpoints(int status)
+{
+	unsigned char data[512];
+	int len, i;
+
+	if(status == LIBUSB_ERROR_NO_DEVICE)
+		return;
+
+	if(status == LIBUSB_ERROR_PIPE){
+		cyusb_clear_halt(_usb_handle, ENDPOINT2);
+		cyusb_clear_halt(_usb_handle, ENDPOINT6);
+	}
+
+	// Results of bursts sent but not read would shift every later read
+	for(i = 0; i < 16; i++){
+		if(cyusb_bulk_transfer(_usb_handle, ENDPOINT6, data, sizeof(data), &len, 20) != 0 || len == 0)
+			break;
+	}
+}
@@ -1,6 +1,7 @@
 #ifndef __MREGACCESSCLASS_H_H_
 #define __MREGACCESSCLASS_H_H_
 #include "cyusb.h"
+#include "libMRegAccess.h"
 
 class MRegAccessBaseClass{
 private:
@@ -47,6 +48,52 @@ public:
 	
 	virtual int XMDIOReadRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr){return 0;};
 	virtual int XMDIOWriteRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int data){return 0;};
+
+	// Adapters without SMI burst support run the batch one access at a time
+	virtual int MDIOBatchAccess(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count){
+		int ret = 0;
+		for(unsigned int i = 0; i < count; i++){
+			switch(ops[i].type){
+			case MREG_MDIO_READ:
+				ret = MDIOReadRegister(SMIPort, ops[i].phyAddr, ops[i].regAddr);
+				break;
+			case MREG_MDIO_WRITE:
+				ret = MDIOWriteRegister(SMIPort, ops[i].phyAddr, ops[i].regAddr, ops[i].data);
+				break;
+			case MREG_XMDIO_READ:
+				ret = XMDIOReadRegister(SMIPort, ops[i].phyAddr, ops[i].devAddr, ops[i].regAddr);
+				break;
+			case MREG_XMDIO_WRITE:
+				ret = XMDIOWriteRegister(SMIPort, ops[i].phyAddr, ops[i].devAddr, ops[i].regAddr, ops[i].data);
+				break;
+			default:
+				return -3;
+			}
+			if(ret < 0)
+				return ret;
+			if(ops[i].type == MREG_MDIO_READ || ops[i].type == MREG_XMDIO_READ)
+				ops[i].data = (unsigned int)ret;
+		}
+		return 0;
+	};
+
+	// One asynchronous bulk transfer, status is a libusb error code once done is set
+	typedef struct _BulkXfer{
+		unsigned char endpoint;
+		unsigned char *data;
+		int length;
+		int transferred;
+		int status;
+		int done;
+		struct libusb_transfer *transfer;
+	}BulkXfer;
+
+	// All bulk transfers of the burst path go through here, a CPLD model can override them
+	virtual int SubmitBulk(BulkXfer *xfer);
+	virtual int WaitBulk(BulkXfer *xfer);
+	virtual void CancelBulk(BulkXfer *xfer);
+	// Clear a stalled endpoint pair and drop stale EP6 data after a failed burst
+	virtual void RecoverEndpoints(int status);
 	
 	virtual ~MRegAccessBaseClass(){};
 };
@@ -68,6 +115,22 @@ private:
 		StatusReg,
 		GPIORWMask0
 	}FPGARegMap;
+	// SMI frames in one burst, bounds the bulk OUT to 8 + 4 * 128 bytes.
+	// Bursts sent ahead of the one whose results are being read, keeps the
+	// EP6 data queued in the adapter small
+	enum { BurstMaxFrames = 128, BurstMaxInFlight = 3 };
+	typedef struct _Burst{
+		MREG_SMI_OP *ops;
+		unsigned int count;
+		unsigned int reads;
+		unsigned char outData[8 + 4 * BurstMaxFrames];
+		unsigned char inData[2 * BurstMaxFrames];
+		BulkXfer out;
+		BulkXfer in;
+		int inDone;
+	}Burst;
+	int BuildBurst(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count, Burst *burst);
+	void ReadBurst(Burst *burst);
 public:
 	MRegAccess_v61xx(cyusb_handle *usb_handle):MRegAccessBaseClass(usb_handle){
 		_usb_handle = usb_handle;
@@ -78,6 +141,8 @@ public:
 	
 	int XMDIOReadRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr);
 	int XMDIOWriteRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int data);
+
+	int MDIOBatchAccess(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count);
 };
 
 class MRegAccess_v6 : public MRegAccessBaseClass {
@@ -150,3 +150,183 @@ int MRegAccess_v61xx::XMDIOWriteRegister(unsigned int SMIPort, unsigned int phyA
 	return 0;
 }
 
+
+// Frames of one SMI burst: the leading accesses of ops that share the clause of
+// ops[0] and fit in BurstMaxFrames
+int MRegAccess_v61xx::BuildBurst(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count, Burst *burst)
+{
+	unsigned char *outData = burst->outData;
+	unsigned int xmdio = (ops[0].type == MREG_XMDIO_READ || ops[0].type == MREG_XMDIO_WRITE);
+	unsigned int frames = 0, reads = 0, pos = 8, i, need, inc;
+	int lastRead = -1;
+
+	for(i = 0; i < count; i++){
+		MREG_SMI_OP *op = &ops[i];
+		unsigned int phyHigh = (op->phyAddr & 0x1F) >> 3;
+
+		if(op->type > MREG_XMDIO_WRITE)
+			return -3;
+		if((op->type == MREG_XMDIO_READ || op->type == MREG_XMDIO_WRITE) != (xmdio != 0))
+			break;
+
+		// an XMDIO read of the register after the previous XMDIO read reuses its address
+		inc = (op->type == MREG_XMDIO_READ && lastRead >= 0 &&
+			ops[i - 1].phyAddr == op->phyAddr && ops[i - 1].devAddr == op->devAddr &&
+			((ops[i - 1].regAddr + 1) & 0xFFFF) == (op->regAddr & 0xFFFF));
+		need = (xmdio && !inc) ? 2 : 1;
+		if(frames + need > BurstMaxFrames)
+			break;
+		frames += need;
+
+		if(xmdio){
+			if(inc){
+				// the previous read post increments the address
+				outData[lastRead] = (SMI_READ + XMDIO_READ_INC + phyHigh);
+			}
+			else{
+				outData[pos++] = (((op->phyAddr & 0x7) << 5) + (op->devAddr & 0x1F));
+				outData[pos++] = (SMI_WRITE + XMDIO_ADDRESS + phyHigh);
+				outData[pos++] = (op->regAddr & 0x00FF);
+				outData[pos++] = ((op->regAddr & 0xFF00) >> 8);
+			}
+			outData[pos++] = (((op->phyAddr & 0x7) << 5) + (op->devAddr & 0x1F));
+			if(op->type == MREG_XMDIO_READ){
+				lastRead = pos;
+				outData[pos++] = (SMI_READ + XMDIO_READ + phyHigh);
+				reads++;
+			}
+			else{
+				lastRead = -1;
+				outData[pos++] = (SMI_WRITE + XMDIO_WRITE + phyHigh);
+				outData[pos++] = (op->data & 0x00FF);
+				outData[pos++] = ((op->data & 0xFF00) >> 8);
+			}
+		}
+		else{
+			outData[pos++] = (((op->phyAddr & 0x7) << 5) + (op->regAddr & 0x1F));
+			if(op->type == MREG_MDIO_READ){
+				outData[pos++] = (SMI_READ + MDIO_READ + phyHigh);
+				reads++;
+			}
+			else{
+				outData[pos++] = (SMI_WRITE + MDIO_WRITE + phyHigh);
+				outData[pos++] = (op->data & 0x00FF);
+				outData[pos++] = ((op->data & 0xFF00) >> 8);
+			}
+		}
+	}
+
+	// 4 bytes CFG2 data, MDIO st_code=0x1, XMDIO st_code=0
+	unsigned int st_code = xmdio ? 0 : 1, smi_mode = 0, smi_port = SMIPort, burst_len = frames;
+	outData[0] = SMIControlReg;
+	outData[1] = 0x06 << 5;
+	outData[2] = (((_last_TA_ext & 0x1) << 4) | ((smi_mode & 0x1) << 3) | (smi_port & 0x7));
+	outData[3] = st_code << 3;
+
+	// 4 bytes burstLen data, one count per SMI frame
+	outData[4] = BurstLen;
+	outData[5] = 0x06 << 5;
+	outData[6] = burst_len & 0x00FF;
+	outData[7] = (burst_len & 0xFF00) >> 8;
+
+	burst->ops = ops;
+	burst->count = i;
+	burst->reads = reads;
+	burst->out.endpoint = ENDPOINT2;
+	burst->out.data = outData;
+	burst->out.length = pos;
+	burst->out.transfer = NULL;
+	burst->in.endpoint = ENDPOINT6;
+	burst->in.transfer = NULL;
+	burst->inDone = 0;
+
+	return 0;
+}
+
+// Store the read results of a burst, 16-bit each in frame order
+void MRegAccess_v61xx::ReadBurst(Burst *burst)
+{
+	unsigned int i, n = 0;
+
+	for(i = 0; i < burst->count; i++){
+		if(burst->ops[i].type == MREG_MDIO_READ || burst->ops[i].type == MREG_XMDIO_READ){
+			burst->ops[i].data = ((unsigned int)burst->inData[2 * n + 1] << 8) + (unsigned int)burst->inData[2 * n];
+			n++;
+		}
+	}
+}
+
+// Up to BurstMaxInFlight bursts are sent ahead on EP2 while the results of the
+// oldest one are read on EP6. The EP6 read is resubmitted for the rest of the
+// results if the adapter answers with a short packet.
+int MRegAccess_v61xx::MDIOBatchAccess(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count)
+{
+	Burst burst[BurstMaxInFlight];
+	Burst *b;
+	unsigned int start = 0, head = 0, tail = 0, i;
+	int status = 0, ret = 0;
+
+	while(1){
+		while(start < count && head - tail < BurstMaxInFlight){
+			b = &burst[head % BurstMaxInFlight];
+			ret = BuildBurst(SMIPort, ops + start, count - start, b);
+			if(ret < 0)
+				break;
+			status = SubmitBulk(&b->out);
+			if(status < 0){
+				ret = -1;
+				break;
+			}
+			start += b->count;
+			head++;
+		}
+		if(ret < 0 || tail == head)
+			break;
+
+		b = &burst[tail % BurstMaxInFlight];
+		if(b->reads != 0){
+			b->in.data = b->inData + b->inDone;
+			b->in.length = 2 * b->reads - b->inDone;
+			status = SubmitBulk(&b->in);
+			if(status == 0)
+				status = WaitBulk(&b->in);
+			if(status < 0){
+				ret = -2;
+				break;
+			}
+			b->inDone += b->in.transferred;
+			if(b->in.transferred == 0){
+				ret = -2;
+				break;
+			}
+		}
+		status = WaitBulk(&b->out);
+		if(status < 0){
+			ret = -1;
+			break;
+		}
+		if(b->inDone < (int)(2 * b->reads))
+			continue;
+
+		ReadBurst(b);
+		tail++;
+	}
+
+	if(ret < 0){
+		// reap what is still in flight before the buffers go away
+		for(i = tail; i < head; i++){
+			CancelBulk(&burst[i % BurstMaxInFlight].out);
+			CancelBulk(&burst[i % BurstMaxInFlight].in);
+		}
+		for(i = tail; i < head; i++){
+			WaitBulk(&burst[i % BurstMaxInFlight].out);
+			if(burst[i % BurstMaxInFlight].in.transfer != NULL)
+				WaitBulk(&burst[i % BurstMaxInFlight].in);
+		}
+		RecoverEndpoints(status);
+		if(status == LIBUSB_ERROR_NO_DEVICE)
+			ret = -4;
+	}
+
+	return ret;
+}
@@ -1,6 +1,7 @@
 // QdCppWrapper.cpp : source file that includes just the standard includes
 
 #include <semaphore.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <time.h>
 #include <stdlib.h>
@@ -15,6 +16,59 @@ unsigned int  g_USBPort;
 sem_t g_semlist[MAXSEMNUMBER];
 static int g_semcount = 1;
 
+/* Writes posted inside a smiBatchBegin/smiBatchEnd window, sent with the next read */
+#define SMIBATCHMAX 64
+static MREG_SMI_OP g_smiBatch[SMIBATCHMAX];
+static unsigned int g_smiBatchCount = 0;
+static __thread int g_smiBatchDepth = 0;
+static pthread_mutex_t g_smiBatchLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Queue one access; send the queue unless it is a write posted in a batch window.
+   Accesses from outside a window send the queue too, so the order is kept. */
+static int smiBatchAccess(unsigned int type, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int data)
+{
+	MREG_SMI_OP *op;
+	int ret;
+
+	pthread_mutex_lock(&g_smiBatchLock);
+	op = &g_smiBatch[g_smiBatchCount++];
+	op->type = type;
+	op->phyAddr = phyAddr;
+	op->devAddr = devAddr;
+	op->regAddr = regAddr;
+	op->data = data;
+
+	if((type == MREG_MDIO_WRITE || type == MREG_XMDIO_WRITE) &&
+	   g_smiBatchDepth > 0 && g_smiBatchCount < SMIBATCHMAX)
+	{
+		pthread_mutex_unlock(&g_smiBatchLock);
+		return 0;
+	}
+
+	ret = MDIOBatchAccess(g_USBPort, g_smiBatch, g_smiBatchCount);
+	g_smiBatchCount = 0;
+	if(ret == 0 && (type == MREG_MDIO_READ || type == MREG_XMDIO_READ))
+		ret = (int)op->data;
+	pthread_mutex_unlock(&g_smiBatchLock);
+
+	return ret;
+}
+
+static int smiBatchFlush()
+{
+	int ret = 0;
+
+	pthread_mutex_lock(&g_smiBatchLock);
+	if(g_smiBatchCount != 0)
+	{
+		ret = MDIOBatchAccess(g_USBPort, g_smiBatch, g_smiBatchCount);
+		g_smiBatchCount = 0;
+	}
+	pthread_mutex_unlock(&g_smiBatchLock);
+
+	return ret;
+}
+
 int openDefaultUSBDriver()
 {
 	return InitDefaultUSBConn();
@@ -30,26 +84,60 @@ void setUSBPort(int usbPort)
 
 int readRegister(unsigned int phyAddr,unsigned int regAddr)
 {
-	return MDIOReadRegister(g_USBPort, phyAddr, regAddr);
+	return smiBatchAccess(MREG_MDIO_READ, phyAddr, 0, regAddr, 0);
 }
 
 int writeRegister(unsigned int phyAddr,unsigned int regAddr,unsigned int data)
 {
-	return MDIOWriteRegister(g_USBPort, phyAddr, regAddr, data);
+	return smiBatchAccess(MREG_MDIO_WRITE, phyAddr, 0, regAddr, data);
 }
 
 int readC45Register(unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr)
 {
-	return XMDIOReadRegister(g_USBPort, phyAddr, devAddr, regAddr);
+	return smiBatchAccess(MREG_XMDIO_READ, phyAddr, devAddr, regAddr, 0);
 }
 
 int writeC45Register(unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int data)
 {
-	return XMDIOWriteRegister(g_USBPort, phyAddr, devAddr, regAddr, data);
+	return smiBatchAccess(MREG_XMDIO_WRITE, phyAddr, devAddr, regAddr, data);
+}
+
+int readC45RegisterRange(unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int count, unsigned int *data)
+{
+	int ret = 0;
+
+	/* posted writes go first */
+	pthread_mutex_lock(&g_smiBatchLock);
+	if(g_smiBatchCount != 0)
+	{
+		ret = MDIOBatchAccess(g_USBPort, g_smiBatch, g_smiBatchCount);
+		g_smiBatchCount = 0;
+	}
+	if(ret == 0)
+		ret = XMDIOReadRange(g_USBPort, phyAddr, devAddr, regAddr, count, data);
+	pthread_mutex_unlock(&g_smiBatchLock);
+
+	return ret;
+}
+
+void smiBatchBegin()
+{
+	g_smiBatchDepth++;
+}
+
+int smiBatchEnd()
+{
+	if(g_smiBatchDepth > 0)
+		g_smiBatchDepth--;
+	if(g_smiBatchDepth != 0)
+		return 0;
+
+	return smiBatchFlush();
 }
 
 void closeUSBDriver()
 { 
+	smiBatchFlush();
 	return MRegLibRelease();
 }
 
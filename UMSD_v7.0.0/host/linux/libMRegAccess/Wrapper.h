@@ -19,6 +19,13 @@ extern int readRegister(unsigned int phyAddr,unsigned int regAddr);
 extern int writeRegister(unsigned int phyAddr,unsigned int regAddr,unsigned int data);
 extern int readC45Register(unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr);
 extern int writeC45Register(unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int data);
+extern int readC45RegisterRange(unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int count, unsigned int *data);
+/* Between smiBatchBegin and smiBatchEnd the register writes of the calling thread
+   are posted and sent with the next register read, so a write sequence and the
+   read that follows it take one USB round trip. A failed posted write is reported
+   by that read or by smiBatchEnd. Windows nest. */
+extern void smiBatchBegin();
+extern int smiBatchEnd();
 extern void closeUSBDriver();
 
 extern int semaphoreCreate(int count);
@@ -7,16 +7,29 @@
 static MRegAccessBaseClass *regAccess = NULL;
 static cyusb_handle *g_handle = NULL;
 static const int g_interface = 0;
+static int g_opened = 0;
+static int g_claimed = 0;
 static const unsigned short vid = 0x1286;
 static const unsigned short pid = 0x1fa4;
 
+/* The interface stays claimed for the life of the connection */
+static int ClaimUSBInterface()
+{
+	if(cyusb_claim_interface(g_handle, g_interface) != 0)
+		return -3;
+	g_claimed = 1;
+	return 0;
+}
+
 int InitDefaultUSBConn()
 {
 	int status = 0;
 	int count = 0;
 	int cpldversion = 0;
 
+	MRegLibRelease();
 	count = cyusb_open(vid, pid);
+	g_opened = 1;
 	
 	if(count == 1){
 		g_handle = cyusb_gethandle(0);
@@ -34,6 +47,7 @@ int InitDefaultUSBConn()
 			else{
 				regAccess = new MRegAccessBaseClass(g_handle);
 			}
+			status = ClaimUSBInterface();
 		}
 		else{
 			status = -3;
@@ -59,7 +73,9 @@ int InitOneUSBConn(char *usb_did)
         strncpy(did, usb_did, 6);
         temp = (unsigned short)strtol(did, NULL, 0);
 
+	MRegLibRelease();
 	count = cyusb_open(vid, pid);
+	g_opened = 1;
 	
 	for(index = 0; index < count; index++){
 		g_handle = cyusb_gethandle(index);
@@ -79,11 +95,13 @@ int InitOneUSBConn(char *usb_did)
 				else{
 					regAccess = new MRegAccessBaseClass(g_handle);
 				}
-                                status = 0;
+                                status = ClaimUSBInterface();
 			}
 			else{
 				status = -3;
 			}
+			/* keep g_handle on the device that was picked */
+			break;
                  }
 	}
 
@@ -96,9 +114,7 @@ int MDIOReadRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int re
 	int data = 0;
 	if(regAccess == NULL || g_handle == NULL)
 		return -1;
-	cyusb_claim_interface(g_handle, g_interface);
 	data = regAccess->MDIOReadRegister(SMIPort, phyAddr, regAddr);
-	cyusb_release_interface(g_handle, g_interface);
 	return data;
 }
 int MDIOWriteRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int regAddr, unsigned int data)
@@ -106,9 +122,7 @@ int MDIOWriteRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int r
 	int status = 0;
 	if(regAccess == NULL || g_handle == NULL)
 		return -1;
-	cyusb_claim_interface(g_handle, g_interface);
 	status = regAccess->MDIOWriteRegister(SMIPort, phyAddr, regAddr, data);
-	cyusb_release_interface(g_handle, g_interface);
 
 	return status;
 }
@@ -118,9 +132,7 @@ int XMDIOReadRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int d
 	int data = 0;
 	if(regAccess == NULL || g_handle == NULL)
 		return -1;
-	cyusb_claim_interface(g_handle, g_interface);
 	data = regAccess->XMDIOReadRegister(SMIPort, phyAddr, devAddr, regAddr);
-	cyusb_release_interface(g_handle, g_interface);
 	return data;
 }
 int XMDIOWriteRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int data)
@@ -128,9 +140,47 @@ int XMDIOWriteRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int
 	int status = 0;
 	if(regAccess == NULL || g_handle == NULL)
 		return -1;
-	cyusb_claim_interface(g_handle, g_interface);
 	status = regAccess->XMDIOWriteRegister(SMIPort, phyAddr, devAddr, regAddr, data);
-	cyusb_release_interface(g_handle, g_interface);
+
+	return status;
+}
+
+int MDIOBatchAccess(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count)
+{
+	int status = 0;
+	if(regAccess == NULL || g_handle == NULL || (ops == NULL && count != 0))
+		return -1;
+	if(count == 0)
+		return 0;
+	status = regAccess->MDIOBatchAccess(SMIPort, ops, count);
+
+	return status;
+}
+
+int XMDIOReadRange(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int count, unsigned int *data)
+{
+	MREG_SMI_OP ops[256];
+	unsigned int i, n, done;
+	int status = 0;
+	if(regAccess == NULL || g_handle == NULL || (data == NULL && count != 0))
+		return -1;
+	for(done = 0; done < count; done += n){
+		n = count - done;
+		if(n > sizeof(ops) / sizeof(ops[0]))
+			n = sizeof(ops) / sizeof(ops[0]);
+		for(i = 0; i < n; i++){
+			ops[i].type = MREG_XMDIO_READ;
+			ops[i].phyAddr = phyAddr;
+			ops[i].devAddr = devAddr;
+			ops[i].regAddr = (regAddr + done + i) & 0xFFFF;
+			ops[i].data = 0;
+		}
+		status = regAccess->MDIOBatchAccess(SMIPort, ops, n);
+		if(status < 0)
+			return status;
+		for(i = 0; i < n; i++)
+			data[done + i] = ops[i].data;
+	}
 
 	return status;
 }
@@ -146,10 +196,12 @@ int ReadCPLDVersion()
 	unsigned char data[2] = {0x00, 0x60};
 	unsigned char refdata[4];
 	
-	cyusb_claim_interface(g_handle, g_interface);
+	if(!g_claimed)
+		cyusb_claim_interface(g_handle, g_interface);
 	cyusb_bulk_transfer(g_handle, 0x02, data, 2, &len, 2000);
 	cyusb_bulk_transfer(g_handle, 0x86, refdata, 4, &len, 2000);
-	cyusb_release_interface(g_handle, g_interface);
+	if(!g_claimed)
+		cyusb_release_interface(g_handle, g_interface);
 	
 	version = refdata[1] << 8 | refdata[0];
 	
@@ -158,8 +210,18 @@ int ReadCPLDVersion()
 
 void MRegLibRelease()
 {
-	cyusb_close();
-	if(regAccess != NULL)
+	if(g_claimed){
+		cyusb_release_interface(g_handle, g_interface);
+		g_claimed = 0;
+	}
+	if(regAccess != NULL){
 		delete regAccess;
+		regAccess = NULL;
+	}
+	if(g_opened){
+		cyusb_close();
+		g_opened = 0;
+	}
+	g_handle = NULL;
 }
 
@@ -12,18 +12,38 @@
  *       v61xx v5 and v6 USB2MI Adapter support	                                      *
  *       ReadCPLDVersion support									              *
  *       Only single MDIO/XMDIO Read/Write support								  *
+ *    2. Batched MDIO/XMDIO Read/Write support, one USB transfer each way on v61xx  *
+ *    3. USB interface claimed once per connection, asynchronous v61xx bursts      *
+ *    4. XMDIO incrementing range read support                                     *
  *       											                              *
  \********************************************************************************/
 #ifdef __cplusplus
 extern "C"
 {
 #endif
+/* Operation types of a batched access */
+#define MREG_MDIO_READ		0
+#define MREG_MDIO_WRITE		1
+#define MREG_XMDIO_READ		2
+#define MREG_XMDIO_WRITE	3
+
+/* One register access of a batch, read results are returned in data */
+typedef struct _MREG_SMI_OP {
+	unsigned int type;		/* MREG_MDIO_READ ... MREG_XMDIO_WRITE */
+	unsigned int phyAddr;
+	unsigned int devAddr;	/* XMDIO only */
+	unsigned int regAddr;
+	unsigned int data;
+} MREG_SMI_OP;
+
 /* Function prototypes */
 /*******************************************************************************************
   Prototype    : int InitDefaultUSBConn();
   Description  : Init USB connect, only support one USB2MI connect, will get the usb device
                  handle and create suitable derived class object
                  Init USB must be called before any other operation
+                 The USB interface stays claimed until MRegLibRelease, a previous
+                 connection is released first, so this also reconnects after an unplug
   Parameters   : None
   Return Value : 0 on success, negative value on error.
  *******************************************************************************************/
@@ -33,6 +53,7 @@ int InitDefaultUSBConn();
   Description  : Init one USB connect, only support one USB2MI connect, will get the usb device
                  handle and create suitable derived class object
                  Init USB must be called before any other operation
+                 The USB interface stays claimed until MRegLibRelease
   Parameters   : None
   Return Value : 0 on success, negative value on error.
  *******************************************************************************************/
@@ -46,7 +67,7 @@ int InitOneUSBConn(char *usb_did);
 int ReadCPLDVersion();
 /*******************************************************************************************
   Prototype    : int MRegLibRelease();
-  Description  : This function delete the global MRegAccessClass
+  Description  : This function releases the USB interface and delete the global MRegAccessClass
   Parameters   : None
   Return Value : None
  *******************************************************************************************/
@@ -91,6 +112,38 @@ int XMDIOReadRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int d
   Return Value : 0 on success, negative value on error
  *******************************************************************************************/
 int XMDIOWriteRegister(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int data);
+/*******************************************************************************************
+  Prototype    : int MDIOBatchAccess(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count);
+  Description  : Batched MDIO/XMDIO Register Read and Write, executed in list order.
+                 The v61xx adapter sends a run of accesses of the same clause as one SMI
+                 burst, one bulk OUT transfer with all the frames and one bulk IN transfer
+                 with all the read results. Consecutive XMDIO reads of the same phy and
+                 device at incrementing addresses use post read increment frames.
+                 Bursts are asynchronous transfers, the next bursts are sent while the
+                 results of the current one are read. After a stall or timeout the
+                 endpoints are cleared so the next call starts in sync.
+                 Other adapters run the accesses one by one.
+  Parameters   : unsigned int SMIPort	:	USB2MI port, range form 0 to 3
+                 MREG_SMI_OP *ops		:	accesses, read back values are stored in data
+                 unsigned int count		:	number of accesses
+  Return Value : 0 on success, -1 on bulk OUT error, -2 on bulk IN error,
+                 -3 on a bad access type, -4 if the adapter is disconnected
+ *******************************************************************************************/
+int MDIOBatchAccess(unsigned int SMIPort, MREG_SMI_OP *ops, unsigned int count);
+/*******************************************************************************************
+  Prototype    : int XMDIOReadRange(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr,
+                                    unsigned int regAddr, unsigned int count, unsigned int *data);
+  Description  : Consecutive XMDIO Register Read. On the v61xx adapter each burst has one
+                 address frame followed by post read increment frames
+  Parameters   : unsigned int SMIPort	:	USB2MI port, range form 0 to 3
+                 unsigned int phyAddr	:	16-bit phy address
+                 unsigned int devAddr	:	16-bit device address
+                 unsigned int regAddr	:	16-bit address of the first register
+                 unsigned int count		:	number of registers
+                 unsigned int *data		:	16-bit read back register values
+  Return Value : 0 on success, negative value on error as MDIOBatchAccess
+ *******************************************************************************************/
+int XMDIOReadRange(unsigned int SMIPort, unsigned int phyAddr, unsigned int devAddr, unsigned int regAddr, unsigned int count, unsigned int *data);
 #ifdef __cplusplus
 }
 #endif
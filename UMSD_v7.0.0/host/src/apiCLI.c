@@ -17,6 +17,10 @@
 #include "msdApi.h"
 #include "apiCLI.h"
 #include "version.h"
+#ifndef WIN32
+#include "phcServer.h"
+#include "Wrapper.h"
+#endif
 #include <ctype.h>
 #define MAX_ARGS        200
 #define MAX_ARGS_LENGTH 200
@@ -957,6 +961,9 @@ CLI_COMMAND_STRUCT directCMDList[] =
     { "setPhyMode", &CustomizedPhyModeCases },
     { "enableHwSem", &enableHwSemaphore},
     { "disableHwSem", &disableHwSemaphore},
+#ifndef WIN32
+    { "phcServer", &phcServerOperation },
+#endif
 
     { "", NULL },
 };
@@ -1117,6 +1124,9 @@ EXTERN_CLI_STRUCT externCLICMDList[] =
     { "setPhyMode", directCMDList }, /*CustomizedCases, NULL, NULL, "customized : Run customized cases", "customized : Run customized cases\n" },*/
     { "enableHwSem", directCMDList },
     { "disableHwSem", directCMDList },
+#ifndef WIN32
+    { "phcServer", directCMDList },
+#endif
 
 	/*{ "exec",   execSystemCmd,		"exec <systemCmd> : exec the system command\n"},*/
     { NULL, NULL }
@@ -1335,6 +1345,9 @@ static char* reflectMSD_STATUS(MSD_STATUS status)
     case MSD_NO_SUCH:
         str = "Can not find such item";
         break;
+    case MSD_NO_SPACE:
+        str = "No space left in table";
+        break;
     case MSD_NOT_SUPPORTED:
         str = "The request is not support";
         break;
@@ -4459,6 +4472,42 @@ static Node* Ihx_Parse_Memory(MSD_U8* filename)
 
     return head;
 }
+/*
+* Merge records that continue the previous one into a single region, so the
+* IMP address is set up once per region instead of once per record. Regions
+* do not cross a 64KB boundary, the IMP address auto increment is 16 bit.
+*/
+static MSD_STATUS Ihx_Coalesce(Node* head, MSD_U32 *total)
+{
+    Node *next;
+    MSD_U8 *data;
+
+    *total = 0;
+    while (head != NULL)
+    {
+        next = head->next;
+        if ((next != NULL) && (next->addr == head->addr + head->len) &&
+            (((next->addr + next->len - 1) >> 16) == (head->addr >> 16)))
+        {
+            data = (MSD_U8*)realloc(head->data, head->len + next->len);
+            if (data == NULL)
+            {
+                return MSD_FAIL;
+            }
+            memcpy(data + head->len, next->data, next->len);
+            head->data = data;
+            head->len += next->len;
+            head->next = next->next;
+            free(next->data);
+            free(next);
+            continue;
+        }
+        *total += head->len;
+        head = next;
+    }
+
+    return MSD_OK;
+}
 static int UpdateFilename(char *tempName)
 {
     char *pTemp = tempName;
@@ -4661,6 +4710,7 @@ int IMPLoadToRAM(void)
     MSD_STATUS retVal;
     char filename[MAX_ARGS_LENGTH] = { 0 };
     MSD_U16 addr = 0xffff;
+    MSD_U32 total, done;
     Node* head;
     Node* node;
 
@@ -4674,6 +4724,13 @@ int IMPLoadToRAM(void)
         CLI_ERROR("Parsing the %s error, make sure the file is correct\n", filename);
         return MSD_FAIL;
     }
+    if (Ihx_Coalesce(head, &total) != MSD_OK)
+    {
+        CLI_ERROR("Out of memory merging the %s records\n", filename);
+        freeNode(node);
+        return MSD_FAIL;
+    }
+    done = 0;
 
     /* load data to memory */
     while (head != NULL)
@@ -4693,6 +4750,9 @@ int IMPLoadToRAM(void)
         }
         if (addr > head->addr)
             addr = head->addr;
+        done += head->len;
+        CLI_INFO("Loaded 0x%05x-0x%05x, %u/%u bytes\n", (unsigned int)head->addr,
+            (unsigned int)(head->addr + head->len - 1), (unsigned int)done, (unsigned int)total);
         head = head->next;
     }
 
@@ -17302,6 +17362,95 @@ int disableHwSemaphore(void)
     return retVal;
 }
 
+#ifndef WIN32
+/* Start or stop the PTP hardware clock emulation service */
+int phcServerOperation(void)
+{
+    UMSD_PHC_CONFIG cfg;
+    MSD_PTP_PULSE_STRUCT pulsePara;
+    int index;
+    char *cmd, *value;
+
+    if ((nargs == 2) && (strIcmp(CMD_ARGS[1], "stop") == 0))
+    {
+        if (phcServerStop() != 0)
+        {
+            CLI_ERROR("phcServer is not running\n");
+            return 1;
+        }
+        return 0;
+    }
+
+    if ((nargs < 3) || (strIcmp(CMD_ARGS[1], "start") != 0))
+    {
+        CLI_ERROR("Syntax Error, Using command as follows: phcServer start <socketPath> [options] | phcServer stop\n");
+        return 1;
+    }
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.clkPeriodPs = 8000;
+    cfg.minIntervalUs = 1000;
+    cfg.maxAdjPpb = 500000;
+    if (msdPtpPulseGet(sohoDevNum, &pulsePara) == MSD_OK)
+    {
+        cfg.ppsOnSelect = pulsePara.ptp1ppsSelect;
+    }
+
+    for (index = 3; index < nargs;)
+    {
+        cmd = CMD_ARGS[index];
+        index++;
+
+        if ((*cmd != '-') || (index >= nargs))
+        {
+            CLI_ERROR("Invalid option input: %s\n", cmd);
+            return 1;
+        }
+        value = CMD_ARGS[index];
+        index++;
+
+        if (strIcmp(cmd, "-timeArrayIndex") == 0)
+        {
+            cfg.timeArrayIndex = (MSD_U8)strtoul(value, NULL, 0);
+        }
+        else if (strIcmp(cmd, "-clkPeriod") == 0)
+        {
+            cfg.clkPeriodPs = (MSD_U32)strtoul(value, NULL, 0);
+        }
+        else if (strIcmp(cmd, "-minInterval") == 0)
+        {
+            cfg.minIntervalUs = (MSD_U32)strtoul(value, NULL, 0);
+        }
+        else if (strIcmp(cmd, "-maxAdj") == 0)
+        {
+            cfg.maxAdjPpb = (int32_t)strtol(value, NULL, 0);
+        }
+        else if (strIcmp(cmd, "-ppsOnSelect") == 0)
+        {
+            cfg.ppsOnSelect = (MSD_U8)strtoul(value, NULL, 0);
+        }
+        else if (strIcmp(cmd, "-ppsOffSelect") == 0)
+        {
+            cfg.ppsOffSelect = (MSD_U8)strtoul(value, NULL, 0);
+        }
+        else
+        {
+            CLI_ERROR("Invalid option input: %s\n", cmd);
+            return 1;
+        }
+    }
+
+    if (phcServerStart(sohoDevNum, CMD_ARGS[2], &cfg) != 0)
+    {
+        CLI_ERROR("phcServer start on %s failed\n", CMD_ARGS[2]);
+        return 1;
+    }
+    CLI_INFO("phcServer listening on %s\n", CMD_ARGS[2]);
+
+    return 0;
+}
+#endif
+
 static char* replace_str(char* str, char *orig, char *rep)
 {
     static char buffer[MAX_ARGS];
@@ -17652,6 +17801,21 @@ int parseCmd_cli(const char *command, char *argv[], int argc)
     nargs = count;
     return count;
 }
+/* Run one CLI command with its SMI register writes posted between reads */
+static void runCallback(CALLBACE callback)
+{
+#ifndef WIN32
+    smiBatchBegin();
+#endif
+    callback();
+#ifndef WIN32
+    if (smiBatchEnd() < 0)
+    {
+        CLI_ERROR("Error: SMI register write failed\n");
+    }
+#endif
+}
+
 int runCommand(FILE* fp, char* prompt)
 {
     int i, rval = 0;
@@ -17691,7 +17855,7 @@ int runCommand(FILE* fp, char* prompt)
             CALLBACE callback = (CALLBACE)(intptr_t)cmdJSON->valueint;
             if (callback != NULL)
             {
-                callback();
+                runCallback(callback);
 				CLI_INFO("\n");
 				/*free(buf);
                 return 0;*/
@@ -17710,7 +17874,7 @@ int runCommand(FILE* fp, char* prompt)
 				callback = (CALLBACE)(intptr_t)subcmdJSON->valueint;
 				if (callback != NULL)
 				{
-					callback();
+					runCallback(callback);
 					CLI_INFO("\n");
 				}
 			}
@@ -17791,7 +17955,7 @@ int cmd_operation(struct cli_def *cli, const char *command, char *argv[], int ar
     CALLBACE callback = (CALLBACE)(intptr_t)cmdJSON->valueint;
     if (callback != NULL)
     {
-        callback();
+        runCallback(callback);
         return 0;
     }
 
@@ -17799,7 +17963,7 @@ int cmd_operation(struct cli_def *cli, const char *command, char *argv[], int ar
     callback = (CALLBACE)(intptr_t)subcmdJSON->valueint;
 	if (callback != NULL)
 	{
-		callback();
+		runCallback(callback);
 	}
 
     return 0;
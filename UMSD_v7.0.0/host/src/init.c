@@ -13,6 +13,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 #include "Wrapper.h"
 #include "msdApi.h"
 #include "rmuPcap.h"
@@ -135,6 +136,14 @@ static MSD_STATUS osSemSignal(MSD_SEM smid)
 }
 #endif
 
+static MSD_U64 osGetTime(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (MSD_U64)ts.tv_sec * 1000000000ULL + (MSD_U64)ts.tv_nsec;
+}
+
 /* Register function to BSP */
 MSD_STATUS qdStart(MSD_U8 devNum, MSD_U8 baseAddr, MSD_U32 phyAddr, MSD_U32 cpuPort, MSD_32 bus_interface, MSD_U16 tempDeviceId)
 {
@@ -146,6 +155,7 @@ MSD_STATUS qdStart(MSD_U8 devNum, MSD_U8 baseAddr, MSD_U32 phyAddr, MSD_U32 cpuP
 	cfg.BSPFunctions.rmu_tx_rx = send_and_receive_packet;
 	cfg.BSPFunctions.readMii   = SMIRead;
 	cfg.BSPFunctions.writeMii  = SMIWrite;
+	cfg.BSPFunctions.getTime   = osGetTime;
     cfg.InterfaceChannel = (MSD_INTERFACE)bus_interface;
 #ifdef USE_SEMAPHORE
 	cfg.BSPFunctions.semCreate = osSemCreate;
@@ -0,0 +1,349 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "msdApi.h"
+#include "phcServer.h"
+
+#define PHC_CC_SHIFT        28
+#define PHC_CC_MASK         (((MSD_U64)1 << PHC_CC_SHIFT) - 1U)
+/* The 32 bit counter wraps every 34s at 8ns, read it well before that */
+#define PHC_WATCHDOG_MS     1000
+/* Distance of the ToD load point ahead of the current counter */
+#define PHC_TOD_LEAD_NS     1000000U
+#define PHC_NSEC_PER_SEC    1000000000U
+
+typedef struct
+{
+    MSD_U8          devNum;
+    UMSD_PHC_CONFIG cfg;
+    int             sock;
+    char            path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+    pthread_t       thread;
+    volatile int    running;
+    MSD_U64         baseMult;
+    MSD_U64         mult;
+    MSD_U32         cycleLast;  /* TAI global time at the last counter read */
+    MSD_U64         nsec;       /* PHC time at cycleLast */
+    MSD_U64         frac;       /* sub ns part of nsec, in 2^-PHC_CC_SHIFT ns */
+    MSD_U64         hostLast;   /* CLOCK_MONOTONIC_RAW at the last counter read */
+    int             todPending; /* the ToD time array no longer follows the PHC */
+    MSD_U64         todLast;    /* CLOCK_MONOTONIC_RAW at the last ToD store */
+} PHC_STATE;
+
+static PHC_STATE phc;
+
+static MSD_U64 phcHostTime(clockid_t clk)
+{
+    struct timespec ts;
+
+    clock_gettime(clk, &ts);
+    return (MSD_U64)ts.tv_sec * PHC_NSEC_PER_SEC + (MSD_U64)ts.tv_nsec;
+}
+
+/* Accumulate the counter cycles since the last read into the PHC time */
+static MSD_STATUS phcReadCounter(void)
+{
+    MSD_STATUS retVal;
+    MSD_U32 cycle;
+    MSD_U64 ns;
+
+    retVal = msdGetPTPGlobalTime(phc.devNum, &cycle);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+    phc.hostLast = phcHostTime(CLOCK_MONOTONIC_RAW);
+
+    ns = (MSD_U64)(MSD_U32)(cycle - phc.cycleLast) * phc.mult + phc.frac;
+    phc.nsec += ns >> PHC_CC_SHIFT;
+    phc.frac = ns & PHC_CC_MASK;
+    phc.cycleLast = cycle;
+
+    return MSD_OK;
+}
+
+static MSD_STATUS phcGetTime(int cached, UMSD_PHC_RSP *rsp)
+{
+    MSD_STATUS retVal;
+    MSD_U64 delta;
+
+    delta = phcHostTime(CLOCK_MONOTONIC_RAW) - phc.hostLast;
+    if (cached && (delta < (MSD_U64)phc.cfg.minIntervalUs * 1000U))
+    {
+        /* Extrapolate with the host clock at the adjusted PHC rate */
+        rsp->time = phc.nsec + delta +
+            (MSD_U64)((MSD_64)delta * ((MSD_64)phc.mult - (MSD_64)phc.baseMult) / (MSD_64)phc.baseMult);
+        return MSD_OK;
+    }
+
+    rsp->sysBefore = phcHostTime(CLOCK_REALTIME);
+    retVal = phcReadCounter();
+    rsp->sysAfter = phcHostTime(CLOCK_REALTIME);
+    rsp->time = phc.nsec;
+
+    return retVal;
+}
+
+/* Load the PHC time into the ToD time array, at most once per minIntervalUs */
+static MSD_STATUS phcFlushTod(int force)
+{
+    MSD_STATUS retVal;
+    MSD_PTP_TIME_ARRAY timeArray;
+    MSD_U64 now;
+    MSD_U64 lead;
+    MSD_U64 target;
+    MSD_U64 seconds;
+
+    now = phcHostTime(CLOCK_MONOTONIC_RAW);
+    if ((phc.todPending == 0) ||
+        ((force == 0) && (now - phc.todLast < (MSD_U64)phc.cfg.minIntervalUs * 1000U)))
+    {
+        return MSD_OK;
+    }
+
+    /* Keep the compensation and domain number of the time array */
+    retVal = msdPtpTODCaptureAll(phc.devNum, phc.cfg.timeArrayIndex, &timeArray);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    retVal = phcReadCounter();
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+
+    lead = (MSD_U64)PHC_TOD_LEAD_NS * 1000U / phc.cfg.clkPeriodPs;
+    target = phc.nsec + ((lead * phc.mult + phc.frac) >> PHC_CC_SHIFT);
+    seconds = target / PHC_NSEC_PER_SEC;
+
+    timeArray.todLoadPoint = phc.cycleLast + (MSD_U32)lead;
+    timeArray.todNanoseconds = (MSD_U32)(target % PHC_NSEC_PER_SEC);
+    timeArray.todSecondsLow = (MSD_U32)seconds;
+    timeArray.todSecondsHigh = (MSD_U16)(seconds >> 32);
+    timeArray.Nanoseconds1722Low = (MSD_U32)target;
+    timeArray.Nanoseconds1722High = (MSD_U32)(target >> 32);
+    timeArray.clkValid = MSD_TRUE;
+
+    retVal = msdPtpTODStoreAll(phc.devNum, phc.cfg.timeArrayIndex, &timeArray);
+    if (retVal == MSD_OK)
+    {
+        phc.todPending = 0;
+        phc.todLast = now;
+    }
+
+    return retVal;
+}
+
+static MSD_STATUS phcSetPps(int enable)
+{
+    MSD_STATUS retVal;
+    MSD_PTP_PULSE_STRUCT pulsePara;
+
+    retVal = msdPtpPulseGet(phc.devNum, &pulsePara);
+    if (retVal != MSD_OK)
+    {
+        return retVal;
+    }
+    pulsePara.ptp1ppsSelect = enable ? phc.cfg.ppsOnSelect : phc.cfg.ppsOffSelect;
+
+    return msdPtpPulseSet(phc.devNum, &pulsePara);
+}
+
+static MSD_STATUS phcRequest(const UMSD_PHC_REQ *req, UMSD_PHC_RSP *rsp)
+{
+    MSD_STATUS retVal;
+    MSD_64 ppb;
+
+    memset(rsp, 0, sizeof(*rsp));
+
+    switch (req->op)
+    {
+    case UMSD_PHC_OP_GETTIME:
+        return phcGetTime(1, rsp);
+    case UMSD_PHC_OP_SYS_OFFSET:
+        return phcGetTime(0, rsp);
+    case UMSD_PHC_OP_SETTIME:
+    case UMSD_PHC_OP_ADJTIME:
+        retVal = phcReadCounter();
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+        if (req->op == UMSD_PHC_OP_SETTIME)
+        {
+            phc.nsec = (MSD_U64)req->arg;
+            phc.frac = 0;
+        }
+        else
+        {
+            phc.nsec += (MSD_U64)req->arg;
+        }
+        rsp->time = phc.nsec;
+        phc.todPending = 1;
+        return phcFlushTod(0);
+    case UMSD_PHC_OP_ADJFINE:
+        /* Cycles so far run at the old rate */
+        retVal = phcReadCounter();
+        if (retVal != MSD_OK)
+        {
+            return retVal;
+        }
+        ppb = req->arg * 125 / 8192;
+        if ((ppb > phc.cfg.maxAdjPpb) || (ppb < -(MSD_64)phc.cfg.maxAdjPpb))
+        {
+            return MSD_BAD_PARAM;
+        }
+        phc.mult = (MSD_U64)((MSD_64)phc.baseMult + (MSD_64)phc.baseMult * ppb / (MSD_64)PHC_NSEC_PER_SEC);
+        rsp->time = phc.nsec;
+        return MSD_OK;
+    case UMSD_PHC_OP_PPS:
+        return phcSetPps(req->arg != 0);
+    case UMSD_PHC_OP_PEROUT:
+        if ((req->arg != 0) && (req->arg != (MSD_64)PHC_NSEC_PER_SEC))
+        {
+            return MSD_NOT_SUPPORTED;
+        }
+        return phcSetPps(req->arg != 0);
+    default:
+        return MSD_BAD_PARAM;
+    }
+}
+
+static void *phcServerThread(void *arg)
+{
+    struct pollfd pfd;
+    struct sockaddr_un client;
+    socklen_t clientLen;
+    UMSD_PHC_REQ req;
+    UMSD_PHC_RSP rsp;
+    ssize_t len;
+    int timeout;
+    MSD_STATUS retVal;
+
+    (void)arg;
+    pfd.fd = phc.sock;
+    pfd.events = POLLIN;
+
+    while (phc.running)
+    {
+        if (phcHostTime(CLOCK_MONOTONIC_RAW) - phc.hostLast >= (MSD_U64)PHC_WATCHDOG_MS * 1000000U)
+        {
+            if (phcReadCounter() != MSD_OK)
+            {
+                printf("phcServer: reading PTP global time failed\n");
+            }
+        }
+        /* Retry a ToD load deferred by the rate limit or a busy time array */
+        phcFlushTod(0);
+        timeout = PHC_WATCHDOG_MS;
+        if (phc.todPending && (phc.cfg.minIntervalUs / 1000U < PHC_WATCHDOG_MS))
+        {
+            timeout = (int)(phc.cfg.minIntervalUs / 1000U) + 1;
+        }
+
+        if (poll(&pfd, 1, timeout) <= 0)
+        {
+            continue;
+        }
+
+        clientLen = sizeof(client);
+        len = recvfrom(phc.sock, &req, sizeof(req), 0, (struct sockaddr *)&client, &clientLen);
+        if (len != (ssize_t)sizeof(req))
+        {
+            continue;
+        }
+
+        retVal = phcRequest(&req, &rsp);
+        rsp.status = (int32_t)retVal;
+        sendto(phc.sock, &rsp, sizeof(rsp), 0, (struct sockaddr *)&client, clientLen);
+    }
+
+    return NULL;
+}
+
+int phcServerStart(uint8_t devNum, const char *path, const UMSD_PHC_CONFIG *cfg)
+{
+    struct sockaddr_un addr;
+
+    if (phc.running)
+    {
+        printf("phcServer is already running on %s\n", phc.path);
+        return -1;
+    }
+    if ((path == NULL) || (strlen(path) >= sizeof(addr.sun_path)) ||
+        (cfg == NULL) || (cfg->clkPeriodPs == 0U) || (cfg->timeArrayIndex > 1U))
+    {
+        return -1;
+    }
+
+    phc.devNum = devNum;
+    phc.cfg = *cfg;
+    phc.baseMult = ((MSD_U64)cfg->clkPeriodPs << PHC_CC_SHIFT) / 1000U;
+    phc.mult = phc.baseMult;
+    phc.frac = 0;
+    if (msdGetPTPGlobalTime(devNum, &phc.cycleLast) != MSD_OK)
+    {
+        printf("phcServer: reading PTP global time failed\n");
+        return -1;
+    }
+    phc.hostLast = phcHostTime(CLOCK_MONOTONIC_RAW);
+    phc.nsec = phcHostTime(CLOCK_REALTIME);
+    phc.todPending = 1;
+    phc.todLast = 0;
+
+    phc.sock = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (phc.sock < 0)
+    {
+        perror("socket");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+    if (bind(phc.sock, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        perror("bind");
+        close(phc.sock);
+        phc.sock = -1;
+        return -1;
+    }
+    strcpy(phc.path, path);
+
+    phc.running = 1;
+    if (pthread_create(&phc.thread, NULL, phcServerThread, NULL) != 0)
+    {
+        phc.running = 0;
+        close(phc.sock);
+        phc.sock = -1;
+        unlink(path);
+        return -1;
+    }
+
+    return 0;
+}
+
+int phcServerStop(void)
+{
+    if (!phc.running)
+    {
+        return -1;
+    }
+
+    phc.running = 0;
+    pthread_join(phc.thread, NULL);
+    close(phc.sock);
+    phc.sock = -1;
+    unlink(phc.path);
+
+    return 0;
+}
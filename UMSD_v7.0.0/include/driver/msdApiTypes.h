@@ -44,6 +44,7 @@ typedef void  MSD_VOID;
 typedef char  MSD_8;
 typedef short MSD_16;
 typedef long  MSD_32;
+typedef int64_t  MSD_64;
 
 typedef uint8_t  MSD_U8;
 typedef uint16_t MSD_U16;
@@ -87,6 +88,7 @@ typedef int MSD_STATUS;
 #define MSD_BAD_PARAM       (0x04)   /* Illegal parameter in function called  */
 #define MSD_BUSY            (0x05)   /* Last operation busy */
 #define MSD_NO_SUCH         (0x0D)   /* No such item                    */
+#define MSD_NO_SPACE        (0x0E)   /* No space left in table                */
 #define MSD_NOT_SUPPORTED   (0x10)   /* This request is not support           */
 #define MSD_ALREADY_EXIST   (0x1B)   /* Tried to create existing item         */
 #define MSD_BAD_CPU_PORT    (0x20)   /* Input CPU Port is not valid physical port number */
@@ -79,6 +79,10 @@ extern "C" {
 #define MSD_SMI_ACCESS_LOOP        1000U
 #define MSD_SMI_TIMEOUT            2U
 
+/* Bits of MSD_QD_DEV smiState, only used in multi address mode */
+#define MSD_SMI_STATE_CMD_IDLE      0x1U    /* MSD_REG_SMI_COMMAND seen not busy since the last command */
+#define MSD_SMI_STATE_PHY_CMD_IDLE  0x2U    /* smiPhyCmd holds the not busy SMI PHY command register */
+
 /***********************************************************************
 *  Internal Phy Clause 45 Register access *
 ***********************************************************************/
@@ -364,6 +368,44 @@ IN  MSD_U8    fieldLength,
 OUT MSD_U32   *data
 );
 
+/*******************************************************************************
+* msdAnyRegAccess
+*
+* DESCRIPTION:
+*       This function runs a list of switch register reads, writes and wait on
+*       bit commands under one lock of the register access semaphore.
+*
+* INPUTS:
+*       regCmd  - Array of commands, in the RMU register command format.
+*                 isWaitOnBit MSD_RMU_WAIT_ON_BIT_FALSE with opCode
+*                 MSD_RMU_REQ_OPCODE_READ or MSD_RMU_REQ_OPCODE_WRITE,
+*                 or isWaitOnBit MSD_RMU_WAIT_ON_BIT_TRUE with opCode
+*                 MSD_RMU_WAIT_ON_BIT_VAL0/VAL1 and the bit number in data.
+*       nCmd    - Number of commands.
+*
+* OUTPUTS:
+*       regCmd  - data of the read commands.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       Over RMU the commands are sent MSD_RMU_MAX_REGCMDS per frame. In multi
+*       address mode writes are posted, the SMI busy bit is only polled before
+*       a command that follows a write and once at the end of the list.
+*       The hardware semaphore register must not be accessed this way.
+*
+*******************************************************************************/
+MSD_STATUS msdAnyRegAccess
+(
+IN    MSD_U8      devNum,
+INOUT MSD_RegCmd  *regCmd,
+IN    MSD_U32     nCmd
+);
+
 /****************************************************************************/
 /* SMI PHY Registers indirect R/W functions.                                */
 /****************************************************************************/
@@ -733,8 +733,8 @@ typedef MSD_STATUS(*FMSD_gqciFlowMeterRedBlkStatSet)(MSD_QD_DEV* dev, MSD_U8 flo
 typedef MSD_STATUS(*FMSD_gqciFlowMeterRedBlkStatGet)(MSD_QD_DEV* dev, MSD_U8 flowMeterId, MSD_U8 *status);
 typedef MSD_STATUS(*FMSD_gqciFlowMeterAdvConfig)(MSD_QD_DEV* dev, MSD_U8 flowMeterId, MSD_U32 tgtRate, MSD_U32 bstSize, MSD_U8 countMode);
 
-typedef MSD_STATUS(*FMSD_gmacsecRead)(MSD_QD_DEV dev, MSD_U32 regAddr, MSD_U32* data);
-typedef MSD_STATUS(*FMSD_gmacsecWrite)(MSD_QD_DEV dev, MSD_U32 regAddr, MSD_U32 data);
+typedef MSD_STATUS(*FMSD_gmacsecRead)(MSD_QD_DEV* dev, MSD_U32 regAddr, MSD_U32* data);
+typedef MSD_STATUS(*FMSD_gmacsecWrite)(MSD_QD_DEV* dev, MSD_U32 regAddr, MSD_U32 data);
 typedef MSD_STATUS(*FMSD_gmacsecFlushAll)(MSD_QD_DEV* dev);
 typedef MSD_STATUS(*FMSD_gmacsecGetEvent)(MSD_QD_DEV* dev, MSD_MSEC_EVENT* event);
 typedef MSD_STATUS(*FMSD_gmacsecCreateRule)(MSD_QD_DEV* dev, MSD_U8 ruleIndex, MSD_MSEC_RULE* rule);
@@ -1543,6 +1543,13 @@ typedef MSD_STATUS (*MSD_FMSD_SEM_TAKE)(
                         MSD_SEM semId, MSD_U32 timOut);
 typedef MSD_STATUS (*MSD_FMSD_SEM_GIVE)(
                         MSD_SEM semId);
+
+/*
+ * definition for the host time function, returns a free running host time in
+ * nanoseconds, used to tag data read from the device.
+ *
+*/
+typedef MSD_U64 (*MSD_FMSD_GET_TIME)(void);
 						
 /*
  * Typedef: struct MSD_QD_DEV
@@ -1580,6 +1587,10 @@ typedef MSD_STATUS (*MSD_FMSD_SEM_GIVE)(
  *   semDelete      - function to delete the semapore
  *   semTake        - function to get a semapore
  *   semGive        - function to return semaphore
+ *   getTime        - function to read the host time, NULL if not provided
+ *   tcamShadow     - host copy of the TCAM, NULL when not attached
+ *   smiState       - MSD_SMI_STATE_xxx bits of the multi address mode SMI
+ *   smiPhyCmd      - SMI PHY command register value while MSD_SMI_STATE_PHY_CMD_IDLE is set
  */
 struct MSD_QD_DEV_
 {
@@ -1631,12 +1642,18 @@ struct MSD_QD_DEV_
     MSD_FMSD_SEM_DELETE  semDelete;     	/* delete the semaphore */
     MSD_FMSD_SEM_TAKE    semTake;    	/* try to get a semaphore */
     MSD_FMSD_SEM_GIVE    semGive;    	/* return semaphore */
+    MSD_FMSD_GET_TIME    getTime;    	/* read host time, optional */
 
     MSD_INTERFACE    InterfaceChannel;
 
 	MSD_BOOL           hwSemaphoreSupport;    /* true means the device support Hardware semaphore, false means do not support*/
 	MSD_HWSEMAPHORE    HWSemaphore;
 
+	void               *tcamShadow;    /* host copy of the TCAM, see Fir_gtcamShadowEnable */
+
+	MSD_U8             smiState;      /* MSD_SMI_STATE_xxx, see msdHwAccess.h */
+	MSD_U16            smiPhyCmd;
+
     SwitchDevObj_ SwitchDevObj;
 };
 
@@ -1652,6 +1669,8 @@ typedef struct BSP_FUNCTIONS_
     MSD_FMSD_SEM_DELETE    semDelete;    /* delete the semapore */
     MSD_FMSD_SEM_TAKE    semTake;        /* try to get a semapore */
     MSD_FMSD_SEM_GIVE    semGive;        /* return semaphore */
+
+    MSD_FMSD_GET_TIME    getTime;        /* read host time in ns, optional */
 } MSD_BSP_FUNCTIONS;
 
 /* System configuration Parameters struct*/
@@ -57,7 +57,7 @@ MSD_STATUS msdMacSecRead
 	{
 		if (dev->SwitchDevObj.MACSECObj.gmacsecRead != NULL)
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecRead(*dev, regAddr, data);
+			retVal = dev->SwitchDevObj.MACSECObj.gmacsecRead(dev, regAddr, data);
 		}
 		else
 		{
@@ -104,7 +104,7 @@ MSD_STATUS msdMacSecWrite
 	{
 		if (dev->SwitchDevObj.MACSECObj.gmacsecWrite != NULL)
 		{
-			retVal = dev->SwitchDevObj.MACSECObj.gmacsecWrite(*dev, regAddr, data);
+			retVal = dev->SwitchDevObj.MACSECObj.gmacsecWrite(dev, regAddr, data);
 		}
 		else
 		{
@@ -28,6 +28,10 @@ static MSD_STATUS msdRmuRegWrite (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAd
 
 static MSD_STATUS msdMultiAddrRead (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAddr, OUT MSD_U16* value);
 static MSD_STATUS msdMultiAddrWrite (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAddr, MSD_U16 value);
+static MSD_STATUS msdMultiAddrWaitReady (MSD_QD_DEV* dev);
+
+static MSD_STATUS msdAnyRegRead (MSD_QD_DEV* dev, MSD_U8 devAddr, MSD_U8 regAddr, OUT MSD_U16* data);
+static MSD_STATUS msdAnyRegWrite (MSD_QD_DEV* dev, MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 data);
 
 static void msdU32VauleCpy(MSD_U8 *ptr, MSD_U32 value);
 static void msdU16VauleCpy(MSD_U8 *ptr, MSD_U16 value);
@@ -88,26 +92,7 @@ MSD_STATUS msdSetAnyReg
 		msdSemTake(devNum, dev->multiAddrSem, OS_WAIT_FOREVER);
 	}	
 
-	if (IS_RMU_SUPPORTED(dev))
-	{
-		retVal = msdRmuRegWrite(dev, devAddr, regAddr, data);
-	}
-	else if (IS_SMI_MULTICHIP_SUPPORTED(dev))
-	{
-		retVal = msdMultiAddrWrite(dev, devAddr, regAddr, data);
-	}
-	else
-	{
-		if (dev->fgtWriteMii)
-		{
-			retVal = dev->fgtWriteMii(devNum, devAddr, regAddr, data);
-		}
-		else
-		{
-			MSD_DBG_ERROR(("FMSD_WRITE_MII API is NULL.\n"));
-			retVal = MSD_NOT_SUPPORTED;
-		}
-	}
+	retVal = msdAnyRegWrite(dev, devAddr, regAddr, data);
 
 	if (regAddr != OS_HW_SEMAPHORE_REG)
 	{
@@ -161,26 +146,7 @@ MSD_STATUS msdGetAnyReg
 		msdSemTake(devNum, dev->multiAddrSem, OS_WAIT_FOREVER);
 	}
 
-	if (IS_RMU_SUPPORTED(dev))
-	{
-		retVal = msdRmuRegRead(dev, devAddr, regAddr, data);
-	}
-	else if (IS_SMI_MULTICHIP_SUPPORTED(dev))
-	{
-		retVal = msdMultiAddrRead(dev, devAddr, regAddr, data);
-	}
-	else
-	{
-		if (dev->fgtReadMii)
-		{
-			retVal = dev->fgtReadMii(devNum, devAddr, regAddr, data);
-		}
-		else
-		{
-			MSD_DBG_ERROR(("FMSD_READ_MII API is NULL.\n"));
-			retVal = MSD_NOT_SUPPORTED;
-		}
-	}
+	retVal = msdAnyRegRead(dev, devAddr, regAddr, data);
 	
 	if (regAddr != OS_HW_SEMAPHORE_REG)
 	{
@@ -368,6 +334,7 @@ IN  MSD_U32   data
 		dataLo = data & 0xFFFF;
 
 		msdSemTake(devNum, dev->multiAddrSem, OS_WAIT_FOREVER);
+		dev->smiState &= (MSD_U8)~MSD_SMI_STATE_PHY_CMD_IDLE;
 
 		if (IS_RMU_SUPPORTED(dev))
 		{
@@ -605,6 +572,197 @@ OUT MSD_U32   *data
 	return retVal;
 }
 
+/*******************************************************************************
+* msdAnyRegAccess
+*
+* DESCRIPTION:
+*       This function runs a list of switch register reads, writes and wait on
+*       bit commands under one lock of the register access semaphore.
+*
+* INPUTS:
+*       regCmd  - Array of commands, in the RMU register command format.
+*       nCmd    - Number of commands.
+*
+* OUTPUTS:
+*       regCmd  - data of the read commands.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error
+*       MSD_BAD_PARAM - if invalid parameter is given
+*       MSD_NOT_SUPPORTED - device not support
+*
+* COMMENTS:
+*       The hardware semaphore register must not be accessed this way.
+*
+*******************************************************************************/
+MSD_STATUS msdAnyRegAccess
+(
+IN    MSD_U8      devNum,
+INOUT MSD_RegCmd  *regCmd,
+IN    MSD_U32     nCmd
+)
+{
+	MSD_STATUS retVal = MSD_OK;
+	MSD_U32 i;
+	MSD_U32 n;
+	MSD_U16 data;
+	MSD_U16 bitVal;
+	unsigned int timeOut;
+	MSD_RegCmd *pRegCmd;
+
+	MSD_QD_DEV* dev = sohoDevGet(devNum);
+	if (NULL == dev)
+	{
+		MSD_DBG_ERROR(("Dev is NULL for devNum %d.\n", devNum));
+		return MSD_FAIL;
+	}
+
+	if ((nCmd != 0U) && (NULL == regCmd))
+	{
+		MSD_DBG_ERROR(("regCmd is NULL with nCmd: %d.\n", nCmd));
+		return MSD_BAD_PARAM;
+	}
+
+	for (i = 0; i < nCmd; i++)
+	{
+		if (regCmd[i].isWaitOnBit == MSD_RMU_WAIT_ON_BIT_FALSE)
+		{
+			if ((regCmd[i].opCode != MSD_RMU_REQ_OPCODE_READ) && (regCmd[i].opCode != MSD_RMU_REQ_OPCODE_WRITE))
+			{
+				MSD_DBG_ERROR(("Bad opCode %d in regCmd %d.\n", regCmd[i].opCode, i));
+				return MSD_BAD_PARAM;
+			}
+		}
+		else if ((regCmd[i].isWaitOnBit != MSD_RMU_WAIT_ON_BIT_TRUE) || (regCmd[i].data > 15U) ||
+			((regCmd[i].opCode != MSD_RMU_WAIT_ON_BIT_VAL0) && (regCmd[i].opCode != MSD_RMU_WAIT_ON_BIT_VAL1)))
+		{
+			MSD_DBG_ERROR(("Bad wait on bit command %d.\n", i));
+			return MSD_BAD_PARAM;
+		}
+	}
+
+	msdSemTake(devNum, dev->multiAddrSem, OS_WAIT_FOREVER);
+	dev->smiState &= (MSD_U8)~MSD_SMI_STATE_PHY_CMD_IDLE;
+
+	if (IS_RMU_SUPPORTED(dev) && (dev->SwitchDevObj.RMUObj.grmuMultiRegAccess != NULL))
+	{
+		for (i = 0; (i < nCmd) && (retVal == MSD_OK); i += n)
+		{
+			n = nCmd - i;
+			if (n > MSD_RMU_MAX_REGCMDS)
+			{
+				n = MSD_RMU_MAX_REGCMDS;
+			}
+			pRegCmd = &regCmd[i];
+			retVal = dev->SwitchDevObj.RMUObj.grmuMultiRegAccess(dev, &pRegCmd, n);
+		}
+	}
+	else
+	{
+		for (i = 0; (i < nCmd) && (retVal == MSD_OK); i++)
+		{
+			if (regCmd[i].isWaitOnBit == MSD_RMU_WAIT_ON_BIT_FALSE)
+			{
+				if (regCmd[i].opCode == MSD_RMU_REQ_OPCODE_WRITE)
+				{
+					retVal = msdAnyRegWrite(dev, regCmd[i].devAddr, regCmd[i].regAddr, regCmd[i].data);
+				}
+				else
+				{
+					retVal = msdAnyRegRead(dev, regCmd[i].devAddr, regCmd[i].regAddr, &regCmd[i].data);
+				}
+				continue;
+			}
+
+			bitVal = (regCmd[i].opCode == MSD_RMU_WAIT_ON_BIT_VAL1) ? 1U : 0U;
+			timeOut = MSD_SMI_ACCESS_LOOP;
+			do
+			{
+				if (timeOut-- < 1U)
+				{
+					MSD_DBG_INFO(("Wait on bit %d of devAddr 0x%02x, regAddr 0x%02x Timed Out\n",
+						regCmd[i].data, regCmd[i].devAddr, regCmd[i].regAddr));
+					retVal = MSD_FAIL;
+					break;
+				}
+				retVal = msdAnyRegRead(dev, regCmd[i].devAddr, regCmd[i].regAddr, &data);
+			} while ((retVal == MSD_OK) && (((data >> regCmd[i].data) & 1U) != bitVal));
+		}
+
+		/* Writes are posted, one final poll so they are all done on return */
+		if ((retVal == MSD_OK) && IS_SMI_MULTICHIP_SUPPORTED(dev) &&
+			((dev->smiState & MSD_SMI_STATE_CMD_IDLE) == 0U))
+		{
+			retVal = msdMultiAddrWaitReady(dev);
+		}
+	}
+
+	msdSemGive(devNum, dev->multiAddrSem);
+
+	return retVal;
+}
+
+/* Register read/write over the device access path, multiAddrSem held by the caller */
+static MSD_STATUS msdAnyRegRead (MSD_QD_DEV* dev, MSD_U8 devAddr, MSD_U8 regAddr, OUT MSD_U16* data)
+{
+	MSD_STATUS retVal;
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		retVal = msdRmuRegRead(dev, devAddr, regAddr, data);
+	}
+	else if (IS_SMI_MULTICHIP_SUPPORTED(dev))
+	{
+		retVal = msdMultiAddrRead(dev, devAddr, regAddr, data);
+	}
+	else
+	{
+		if (dev->fgtReadMii)
+		{
+			retVal = dev->fgtReadMii(dev->devNum, devAddr, regAddr, data);
+		}
+		else
+		{
+			MSD_DBG_ERROR(("FMSD_READ_MII API is NULL.\n"));
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
+static MSD_STATUS msdAnyRegWrite (MSD_QD_DEV* dev, MSD_U8 devAddr, MSD_U8 regAddr, MSD_U16 data)
+{
+	MSD_STATUS retVal;
+
+	/* A write may start an SMI PHY command, drop the cached idle command register */
+	dev->smiState &= (MSD_U8)~MSD_SMI_STATE_PHY_CMD_IDLE;
+
+	if (IS_RMU_SUPPORTED(dev))
+	{
+		retVal = msdRmuRegWrite(dev, devAddr, regAddr, data);
+	}
+	else if (IS_SMI_MULTICHIP_SUPPORTED(dev))
+	{
+		retVal = msdMultiAddrWrite(dev, devAddr, regAddr, data);
+	}
+	else
+	{
+		if (dev->fgtWriteMii)
+		{
+			retVal = dev->fgtWriteMii(dev->devNum, devAddr, regAddr, data);
+		}
+		else
+		{
+			MSD_DBG_ERROR(("FMSD_WRITE_MII API is NULL.\n"));
+			retVal = MSD_NOT_SUPPORTED;
+		}
+	}
+
+	return retVal;
+}
+
 
 /****************************************************************************/
 /* SMI PHY Registers indirect R/W functions.                                */
@@ -1657,43 +1815,29 @@ static MSD_STATUS msdRmuRegWrite (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAd
 static MSD_STATUS msdMultiAddrRead (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAddr, OUT MSD_U16* value)
 {
     MSD_U16 smiReg;
-    volatile unsigned int timeOut; /* in 100MS units */
-
-    timeOut = MSD_SMI_ACCESS_LOOP; /* initialize the loop count */
 
-    do 
+    /* The previous command is known done when the busy bit was seen clear since */
+    if ((dev->smiState & MSD_SMI_STATE_CMD_IDLE) == 0U)
     {
-        if((dev->fgtReadMii(dev->devNum,dev->phyAddr,MSD_REG_SMI_COMMAND, &smiReg)) != MSD_OK)
-        {
-            return MSD_FAIL;
-        }
-		if(timeOut-- < 1 ) 
+        if (msdMultiAddrWaitReady(dev) != MSD_OK)
         {
             return MSD_FAIL;
         }
-    } while (smiReg & MSD_SMI_BUSY);
+    }
 
     smiReg =  MSD_SMI_BUSY | (phyAddr << MSD_SMI_DEV_ADDR_BIT) | (MSD_SMI_READ_22 << MSD_SMI_OP_BIT) | 
             (regAddr << MSD_SMI_REG_ADDR_BIT) | (MSD_SMI_CLAUSE22 << MSD_SMI_MODE_BIT);
 
+    dev->smiState &= (MSD_U8)~MSD_SMI_STATE_CMD_IDLE;
 	if((dev->fgtWriteMii(dev->devNum,dev->phyAddr,MSD_REG_SMI_COMMAND, smiReg)) != MSD_OK)
     {
         return MSD_FAIL;
     }
 	
-    timeOut = MSD_SMI_ACCESS_LOOP; /* initialize the loop count */
-
-    do 
+    if (msdMultiAddrWaitReady(dev) != MSD_OK)
     {
-		if((dev->fgtReadMii(dev->devNum,dev->phyAddr,MSD_REG_SMI_COMMAND, &smiReg)) != MSD_OK)
-        {
-            return MSD_FAIL;
-        }
-		if(timeOut-- < 1 ) 
-        {
-            return MSD_FAIL;
-        }
-    } while (smiReg & MSD_SMI_BUSY);
+        return MSD_FAIL;
+    }
 
 	if((dev->fgtReadMii(dev->devNum,dev->phyAddr,MSD_REG_SMI_DATA, &smiReg)) != MSD_OK)
     {
@@ -1731,22 +1875,17 @@ static MSD_STATUS msdMultiAddrRead (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 reg
 static MSD_STATUS msdMultiAddrWrite (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 regAddr, MSD_U16 value)
 {
     MSD_U16 smiReg;
-    volatile unsigned int timeOut; /* in 100MS units */
-
-    timeOut = MSD_SMI_ACCESS_LOOP; /* initialize the loop count */
 
-    do 
+    /* The data register is shared, wait for the previous command only if it may still run */
+    if ((dev->smiState & MSD_SMI_STATE_CMD_IDLE) == 0U)
     {
-		if((dev->fgtReadMii(dev->devNum,dev->phyAddr,MSD_REG_SMI_COMMAND, &smiReg)) != MSD_OK)
-        {
-            return MSD_FAIL;
-        }
-		if(timeOut-- < 1 ) 
+        if (msdMultiAddrWaitReady(dev) != MSD_OK)
         {
             return MSD_FAIL;
         }
-    } while (smiReg & MSD_SMI_BUSY);
+    }
 
+    dev->smiState &= (MSD_U8)~MSD_SMI_STATE_CMD_IDLE;
 	if((dev->fgtWriteMii(dev->devNum,dev->phyAddr,MSD_REG_SMI_DATA, value)) != MSD_OK)
     {
         return MSD_FAIL;
@@ -1759,5 +1898,51 @@ static MSD_STATUS msdMultiAddrWrite (MSD_QD_DEV* dev, MSD_U8 phyAddr , MSD_U8 re
         return MSD_FAIL;
     }
 
+    /* Posted, the next access polls the busy bit */
+    return MSD_OK;
+}
+
+/*****************************************************************************
+* msdMultiAddrWaitReady
+*
+* DESCRIPTION:
+*       This function waits for the SMI command of the multi address mode to
+*       complete and records the command register as idle.
+*
+* INPUTS:
+*       None.
+*
+* OUTPUTS:
+*       None.
+*
+* RETURNS:
+*       MSD_OK  - on success
+*       MSD_FAIL  - on error or time out
+*
+* COMMENTS:
+*       None.
+*
+*******************************************************************************/
+static MSD_STATUS msdMultiAddrWaitReady (MSD_QD_DEV* dev)
+{
+    MSD_U16 smiReg;
+    volatile unsigned int timeOut; /* in 100MS units */
+
+    timeOut = MSD_SMI_ACCESS_LOOP; /* initialize the loop count */
+
+    do 
+    {
+		if((dev->fgtReadMii(dev->devNum,dev->phyAddr,MSD_REG_SMI_COMMAND, &smiReg)) != MSD_OK)
+        {
+            return MSD_FAIL;
+        }
+		if(timeOut-- < 1 ) 
+        {
+            return MSD_FAIL;
+        }
+    } while (smiReg & MSD_SMI_BUSY);
+
+    dev->smiState |= MSD_SMI_STATE_CMD_IDLE;
+
     return MSD_OK;
 }
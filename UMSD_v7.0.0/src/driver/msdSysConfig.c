@@ -1171,6 +1171,9 @@ MSD_STATUS msdDisableHwSemaphore
 *        6) Semaphore Give - (Input, optional)
 *            OS specific Semaphore Give function.
 *        Notes: 3) ~ 6) should be provided all or should not be provided at all.
+*        7) Get Time - (Input, optional)
+*            Host time in nanoseconds, used to tag timestamps harvested from
+*            the device.
 *
 * INPUTS:
 *        pBSPFunctions - pointer to the structure for above functions.
@@ -1197,6 +1200,8 @@ static MSD_BOOL msdRegister(MSD_QD_DEV *dev, const MSD_BSP_FUNCTIONS* pBSPFuncti
     dev->semDelete = pBSPFunctions->semDelete;
     dev->semTake   = pBSPFunctions->semTake  ;
     dev->semGive   = pBSPFunctions->semGive  ;
+
+    dev->getTime   = pBSPFunctions->getTime  ;
     
     return MSD_TRUE;
 }
\ No newline at end of file
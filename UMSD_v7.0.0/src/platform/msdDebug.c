@@ -169,6 +169,9 @@ char* msdDisplayStatus(MSD_STATUS status)
 	case MSD_NO_SUCH:
 		str = "MSD_NO_SUCH";
 		break;
+	case MSD_NO_SPACE:
+		str = "MSD_NO_SPACE";
+		break;
 	case MSD_NOT_SUPPORTED:
 		str = "MSD_NOT_SUPPORTED";
 		break;